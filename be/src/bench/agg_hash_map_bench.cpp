@@ -0,0 +1,143 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+#include <glog/logging.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "bench.h"
+#include "column/fixed_length_column.h"
+#include "exec/aggregate/agg_hash_variant.h"
+#include "runtime/mem_pool.h"
+
+namespace starrocks {
+
+// Looks up the group-by keys of chunks in an aggregate hash map which already holds all the groups, with the slots
+// prefetched `prefetch_dist` rows ahead (0 means no prefetch).
+enum AggHashMapKeyType { ONE_BIGINT_KEY = 0, SERIALIZED_KEY = 1 };
+
+class AggHashMapBench {
+public:
+    AggHashMapBench(int64_t num_groups, AggHashMapKeyType key_type, size_t prefetch_dist)
+            : _num_groups(num_groups), _key_type(key_type), _prefetch_dist(prefetch_dist) {}
+
+    void SetUp();
+    void TearDown() {}
+
+    void do_bench(benchmark::State& state);
+
+private:
+    static constexpr size_t kNumChunks = 256;
+
+    template <typename HashMapWithKey>
+    void _do_bench(benchmark::State& state, HashMapWithKey* hash_map_with_key);
+
+    int64_t _num_groups;
+    AggHashMapKeyType _key_type;
+    size_t _prefetch_dist;
+
+    MemPool _pool;
+    uint8_t _agg_state = 0;
+    std::vector<Columns> _key_columns;
+};
+
+static ColumnPtr create_bigint_column(const std::vector<int64_t>& values) {
+    auto column = Int64Column::create();
+    column->append_numbers(values.data(), values.size() * sizeof(int64_t));
+    return column;
+}
+
+void AggHashMapBench::SetUp() {
+    std::mt19937_64 rng(_num_groups);
+    std::uniform_int_distribution<int64_t> key_gen(0, _num_groups - 1);
+    std::vector<int64_t> keys(kTestChunkSize);
+    for (size_t i = 0; i < kNumChunks; i++) {
+        for (auto& key : keys) {
+            key = key_gen(rng);
+        }
+        Columns columns{create_bigint_column(keys)};
+        if (_key_type == SERIALIZED_KEY) {
+            columns.emplace_back(create_bigint_column(keys));
+        }
+        _key_columns.emplace_back(std::move(columns));
+    }
+}
+
+template <typename HashMapWithKey>
+void AggHashMapBench::_do_bench(benchmark::State& state, HashMapWithKey* hash_map_with_key) {
+    auto allocate_func = [this](const auto& key) { return &_agg_state; };
+    Buffer<AggDataPtr> agg_states(kTestChunkSize);
+
+    // populate all the groups, so that the measured lookups always hit.
+    std::vector<int64_t> keys(kTestChunkSize);
+    for (int64_t from = 0; from < _num_groups; from += kTestChunkSize) {
+        size_t count = std::min<int64_t>(kTestChunkSize, _num_groups - from);
+        keys.resize(count);
+        std::iota(keys.begin(), keys.end(), from);
+        Columns columns{create_bigint_column(keys)};
+        if (_key_type == SERIALIZED_KEY) {
+            columns.emplace_back(create_bigint_column(keys));
+        }
+        hash_map_with_key->build_hash_map(count, columns, &_pool, allocate_func, &agg_states);
+    }
+    hash_map_with_key->prefetch_dist = _prefetch_dist;
+
+    for (auto _ : state) {
+        for (const auto& columns : _key_columns) {
+            hash_map_with_key->build_hash_map(kTestChunkSize, columns, &_pool, allocate_func, &agg_states);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * kNumChunks * kTestChunkSize);
+    state.counters["groups"] = hash_map_with_key->hash_map.size();
+}
+
+void AggHashMapBench::do_bench(benchmark::State& state) {
+    if (_key_type == ONE_BIGINT_KEY) {
+        Int64AggHashMapWithOneNumberKey<PhmapSeed1> hash_map_with_key(kTestChunkSize, nullptr);
+        _do_bench(state, &hash_map_with_key);
+    } else {
+        SerializedKeyAggHashMap<PhmapSeed1> hash_map_with_key(kTestChunkSize, nullptr);
+        _do_bench(state, &hash_map_with_key);
+    }
+}
+
+static void BM_AggHashMap_Emplace(benchmark::State& state) {
+    AggHashMapBench bench(state.range(0), static_cast<AggHashMapKeyType>(state.range(1)), state.range(2));
+    bench.SetUp();
+    bench.do_bench(state);
+    bench.TearDown();
+}
+
+static void BM_AggHashMap_Emplace_Args(benchmark::internal::Benchmark* b) {
+    for (int64_t num_groups : {1L << 10, 1L << 16, 1L << 20, 1L << 24}) {
+        for (int64_t key_type : {ONE_BIGINT_KEY, SERIALIZED_KEY}) {
+            for (int64_t prefetch_dist : {0, 4, 8, 16, 32}) {
+                b->Args({num_groups, key_type, prefetch_dist});
+            }
+        }
+    }
+    b->Unit(benchmark::kMillisecond);
+}
+
+BENCHMARK(BM_AggHashMap_Emplace)->Apply(BM_AggHashMap_Emplace_Args);
+
+} // namespace starrocks
+
+BENCHMARK_MAIN();
@@ -0,0 +1,128 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "column/fixed_length_column.h"
+#include "storage/rowset/encoding_info.h"
+#include "storage/rowset/options.h"
+#include "storage/rowset/page_builder.h"
+#include "storage/rowset/page_decoder.h"
+
+namespace starrocks {
+
+// Encode and decode a page of DOUBLE values by ALP and plain encoding, and report the throughput in bytes of the
+// plain values per second, and the encoded size in percent of the plain size.
+enum Dataset { DECIMALS = 0, INTEGERS = 1, FULL_PRECISION = 2 };
+
+static constexpr size_t kNumValues = 64 * 1024;
+
+static std::vector<double> generate_values(Dataset dataset) {
+    std::mt19937_64 rng(42);
+    std::vector<double> values(kNumValues);
+    switch (dataset) {
+    case DECIMALS: {
+        // e.g. the prices and the metrics of two decimal digits.
+        std::uniform_int_distribution<int64_t> dist(0, 10000000);
+        for (auto& v : values) {
+            v = dist(rng) / 100.0;
+        }
+        break;
+    }
+    case INTEGERS: {
+        std::uniform_int_distribution<int64_t> dist(0, 1000000);
+        for (auto& v : values) {
+            v = static_cast<double>(dist(rng));
+        }
+        break;
+    }
+    case FULL_PRECISION: {
+        std::uniform_real_distribution<double> dist(0, 1);
+        for (auto& v : values) {
+            v = dist(rng);
+        }
+        break;
+    }
+    }
+    return values;
+}
+
+static std::unique_ptr<PageBuilder> create_page_builder(EncodingTypePB encoding) {
+    const EncodingInfo* info = nullptr;
+    CHECK(EncodingInfo::get(TYPE_DOUBLE, encoding, &info).ok());
+    PageBuilderOptions options;
+    options.data_page_size = kNumValues * sizeof(double);
+    PageBuilder* builder = nullptr;
+    CHECK(info->create_page_builder(options, &builder).ok());
+    return std::unique_ptr<PageBuilder>(builder);
+}
+
+// Args: encoding, dataset
+static void BM_DoubleEncode(benchmark::State& state) {
+    auto encoding = static_cast<EncodingTypePB>(state.range(0));
+    auto values = generate_values(static_cast<Dataset>(state.range(1)));
+    auto builder = create_page_builder(encoding);
+    size_t encoded_size = 0;
+    for (auto _ : state) {
+        builder->reset();
+        builder->add(reinterpret_cast<const uint8_t*>(values.data()), values.size());
+        encoded_size = builder->finish()->size();
+        benchmark::DoNotOptimize(encoded_size);
+    }
+    state.SetBytesProcessed(state.iterations() * values.size() * sizeof(double));
+    state.counters["size_percent"] = 100.0 * encoded_size / (values.size() * sizeof(double));
+}
+
+// Args: encoding, dataset
+static void BM_DoubleDecode(benchmark::State& state) {
+    auto encoding = static_cast<EncodingTypePB>(state.range(0));
+    auto values = generate_values(static_cast<Dataset>(state.range(1)));
+    auto builder = create_page_builder(encoding);
+    builder->add(reinterpret_cast<const uint8_t*>(values.data()), values.size());
+    OwnedSlice page = builder->finish()->build();
+
+    const EncodingInfo* info = nullptr;
+    CHECK(EncodingInfo::get(TYPE_DOUBLE, encoding, &info).ok());
+    auto column = DoubleColumn::create();
+    column->reserve(values.size());
+    for (auto _ : state) {
+        PageDecoder* decoder = nullptr;
+        CHECK(info->create_page_decoder(page.slice(), &decoder).ok());
+        std::unique_ptr<PageDecoder> guard(decoder);
+        CHECK(decoder->init().ok());
+        column->resize(0);
+        size_t n = values.size();
+        CHECK(decoder->next_batch(&n, column.get()).ok());
+        benchmark::DoNotOptimize(column->get_data().data());
+    }
+    state.SetBytesProcessed(state.iterations() * values.size() * sizeof(double));
+}
+
+static void encoding_args(benchmark::internal::Benchmark* b) {
+    for (int dataset : {DECIMALS, INTEGERS, FULL_PRECISION}) {
+        b->Args({ALP_ENCODING, dataset});
+        b->Args({PLAIN_ENCODING, dataset});
+    }
+}
+
+BENCHMARK(BM_DoubleEncode)->Apply(encoding_args);
+BENCHMARK(BM_DoubleDecode)->Apply(encoding_args);
+
+} // namespace starrocks
+
+BENCHMARK_MAIN();
@@ -0,0 +1,137 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+#include "util/bit_packing.inline.h"
+#include "util/bit_unpacking.h"
+#include "util/faststring.h"
+#include "util/frame_of_reference_coding.h"
+
+namespace starrocks {
+
+// Unpack the bit-packed values of every bit width, and report the throughput in values per second.
+static constexpr size_t kNumValues = 64 * 1024;
+
+static std::vector<uint8_t> random_bytes(int bit_width) {
+    std::mt19937_64 rng(bit_width);
+    std::vector<uint8_t> bytes((kNumValues * bit_width + 7) / 8);
+    for (auto& b : bytes) {
+        b = static_cast<uint8_t>(rng());
+    }
+    return bytes;
+}
+
+// Args: msb, bit_width
+static void BM_Unpack64(benchmark::State& state) {
+    bool msb = state.range(0);
+    int bit_width = state.range(1);
+    auto in = random_bytes(bit_width);
+    std::vector<uint64_t> out(kNumValues);
+    for (auto _ : state) {
+        if (msb) {
+            BitUnpacking::unpack_msb(in.data(), in.size(), bit_width, kNumValues, out.data());
+        } else {
+            BitUnpacking::unpack_lsb(in.data(), in.size(), bit_width, kNumValues, out.data());
+        }
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * kNumValues);
+}
+
+// Args: msb, bit_width
+static void BM_Unpack32(benchmark::State& state) {
+    bool msb = state.range(0);
+    int bit_width = state.range(1);
+    auto in = random_bytes(bit_width);
+    std::vector<uint32_t> out(kNumValues);
+    for (auto _ : state) {
+        if (msb) {
+            BitUnpacking::unpack_msb(in.data(), in.size(), bit_width, kNumValues, out.data());
+        } else {
+            BitUnpacking::unpack_lsb(in.data(), in.size(), bit_width, kNumValues, out.data());
+        }
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * kNumValues);
+}
+
+// The scalar unpacking of BitPacking, as the baseline of the LSB first unpacking.
+// Args: bit_width
+static void BM_BitPackingUnpack64(benchmark::State& state) {
+    int bit_width = state.range(0);
+    auto in = random_bytes(bit_width);
+    std::vector<uint64_t> out(kNumValues);
+    for (auto _ : state) {
+        BitPacking::UnpackValues(bit_width, in.data(), in.size(), kNumValues, out.data());
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * kNumValues);
+}
+
+static std::vector<int64_t> for_values(int bit_width) {
+    std::mt19937_64 rng(bit_width);
+    std::vector<int64_t> values(kNumValues);
+    for (auto& v : values) {
+        v = bit_width == 0 ? 0 : static_cast<int64_t>(rng() >> (64 - bit_width));
+    }
+    return values;
+}
+
+// Decode the frame of reference encoded BIGINT values.
+static void BM_ForDecode(benchmark::State& state) {
+    int bit_width = state.range(0);
+    auto values = for_values(bit_width);
+    faststring buffer;
+    ForEncoder<int64_t> encoder(&buffer);
+    encoder.put_batch(values.data(), values.size());
+    encoder.flush();
+
+    std::vector<int64_t> out(kNumValues);
+    for (auto _ : state) {
+        ForDecoder<int64_t> decoder(buffer.data(), buffer.size());
+        CHECK(decoder.init());
+        CHECK(decoder.get_batch(out.data(), kNumValues));
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * kNumValues);
+}
+
+static void unpack64_args(benchmark::internal::Benchmark* b) {
+    for (int msb : {0, 1}) {
+        for (int bit_width = 0; bit_width <= 64; bit_width++) {
+            b->Args({msb, bit_width});
+        }
+    }
+}
+
+static void unpack32_args(benchmark::internal::Benchmark* b) {
+    for (int msb : {0, 1}) {
+        for (int bit_width = 0; bit_width <= 32; bit_width++) {
+            b->Args({msb, bit_width});
+        }
+    }
+}
+
+BENCHMARK(BM_Unpack64)->Apply(unpack64_args);
+BENCHMARK(BM_Unpack32)->Apply(unpack32_args);
+BENCHMARK(BM_BitPackingUnpack64)->DenseRange(0, 64);
+BENCHMARK(BM_ForDecode)->Arg(1)->Arg(7)->Arg(13)->Arg(24)->Arg(32)->Arg(40)->Arg(57)->Arg(63);
+
+} // namespace starrocks
+
+BENCHMARK_MAIN();
@@ -0,0 +1,141 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "storage/roaring2range.h"
+
+namespace starrocks {
+
+// Combine the bitmaps of the bitmap indexed predicates over a segment of 100M rows, pairwise as the bitmap index
+// evaluator did before, and at once by roaring_and_many/roaring_or_many.
+static constexpr uint32_t kNumRows = 100 * 1000 * 1000;
+
+static Roaring random_bitmap(uint32_t seed, int percent) {
+    std::mt19937 rng(seed);
+    Roaring bitmap;
+    std::vector<uint32_t> rows;
+    rows.reserve(64 * 1024);
+    for (uint32_t row = 0; row < kNumRows; row++) {
+        if (static_cast<int>(rng() % 100) < percent) {
+            rows.emplace_back(row);
+        }
+        if (rows.size() == rows.capacity()) {
+            bitmap.addMany(rows.size(), rows.data());
+            rows.clear();
+        }
+    }
+    bitmap.addMany(rows.size(), rows.data());
+    return bitmap;
+}
+
+// The bitmaps of a 5-predicate conjunct, in the order of the predicates: a range on the clustered column
+// (run containers), 50% and 10% of the random rows (bitmap containers), every other run of 64K rows (run
+// containers), and 1% of the random rows (array containers).
+static const std::vector<Roaring>& conjunct_bitmaps() {
+    static const std::vector<Roaring> bitmaps = [] {
+        std::vector<Roaring> v;
+        Roaring range;
+        range.addRange(kNumRows / 10, kNumRows / 10 * 9);
+        v.emplace_back(std::move(range));
+        v.emplace_back(random_bitmap(1, 50));
+        v.emplace_back(random_bitmap(2, 10));
+        Roaring runs;
+        for (uint32_t begin = 0; begin < kNumRows; begin += 128 * 1024) {
+            runs.addRange(begin, std::min(begin + 64 * 1024, kNumRows));
+        }
+        runs.runOptimize();
+        v.emplace_back(std::move(runs));
+        v.emplace_back(random_bitmap(3, 1));
+        return v;
+    }();
+    return bitmaps;
+}
+
+// The bitmaps of the 1000 distinct values of a random column.
+static const std::vector<Roaring>& dictionary_bitmaps() {
+    static const std::vector<Roaring> bitmaps = [] {
+        std::vector<Roaring> v(1000);
+        std::mt19937 rng(42);
+        for (uint32_t row = 0; row < kNumRows; row++) {
+            v[rng() % v.size()].add(row);
+        }
+        return v;
+    }();
+    return bitmaps;
+}
+
+static void BM_AndPairwise(benchmark::State& state) {
+    const auto& bitmaps = conjunct_bitmaps();
+    for (auto _ : state) {
+        Roaring result = bitmaps[0];
+        for (size_t i = 1; i < bitmaps.size(); i++) {
+            result &= bitmaps[i];
+        }
+        benchmark::DoNotOptimize(result.cardinality());
+    }
+    state.SetItemsProcessed(state.iterations() * kNumRows);
+}
+
+static void BM_AndMany(benchmark::State& state) {
+    const auto& bitmaps = conjunct_bitmaps();
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::vector<Roaring> inputs = bitmaps;
+        state.ResumeTiming();
+        Roaring result = roaring_and_many(inputs);
+        benchmark::DoNotOptimize(result.cardinality());
+    }
+    state.SetItemsProcessed(state.iterations() * kNumRows);
+}
+
+// Union the bitmaps of |state.range(0)| values, e.g. of an IN predicate.
+static void BM_OrPairwise(benchmark::State& state) {
+    const auto& bitmaps = dictionary_bitmaps();
+    const size_t num_values = state.range(0);
+    for (auto _ : state) {
+        Roaring result;
+        for (size_t i = 0; i < num_values; i++) {
+            result |= bitmaps[i];
+        }
+        benchmark::DoNotOptimize(result.cardinality());
+    }
+    state.SetItemsProcessed(state.iterations() * kNumRows);
+}
+
+static void BM_OrMany(benchmark::State& state) {
+    const auto& bitmaps = dictionary_bitmaps();
+    const size_t num_values = state.range(0);
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::vector<Roaring> inputs(bitmaps.begin(), bitmaps.begin() + num_values);
+        state.ResumeTiming();
+        Roaring result = roaring_or_many(inputs);
+        benchmark::DoNotOptimize(result.cardinality());
+    }
+    state.SetItemsProcessed(state.iterations() * kNumRows);
+}
+
+BENCHMARK(BM_AndPairwise)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_AndMany)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_OrPairwise)->RangeMultiplier(4)->Range(4, 1000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_OrMany)->RangeMultiplier(4)->Range(4, 1000)->Unit(benchmark::kMillisecond);
+
+} // namespace starrocks
+
+BENCHMARK_MAIN();
@@ -0,0 +1,120 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+#include <glog/logging.h>
+
+#include <memory>
+#include <vector>
+
+#include "exec/pipeline/pipeline_driver_queue.h"
+#include "exec/pipeline/source_operator.h"
+
+namespace starrocks::pipeline {
+
+// Each executor thread repeatedly takes a ready driver, and puts it back as if it had run out of its time slice,
+// which is how the executor threads contend on the driver queue when running a lot of short-lived drivers.
+enum DriverQueueType { QUERY_SHARED = 0, SHARDED = 1 };
+
+class BenchSourceOperator final : public SourceOperator {
+public:
+    BenchSourceOperator() : SourceOperator(nullptr, 1, "bench_source_operator", 1, false, 0) {}
+    ~BenchSourceOperator() override = default;
+
+    bool has_output() const override { return true; }
+    bool need_input() const override { return false; }
+    bool is_finished() const override { return false; }
+
+    StatusOr<ChunkPtr> pull_chunk(RuntimeState* state) override { return nullptr; }
+    Status push_chunk(RuntimeState* state, const ChunkPtr& chunk) override { return Status::OK(); }
+};
+
+class DriverQueueBench {
+public:
+    DriverQueueBench(DriverQueueType queue_type, int num_threads)
+            : _queue_type(queue_type), _num_threads(num_threads) {}
+
+    void SetUp();
+    void TearDown();
+
+    // Take a driver and put it back, and return false if there is no ready driver.
+    bool take_and_put_back();
+
+private:
+    static constexpr int kNumDriversPerThread = 16;
+    static constexpr int64_t kTimeSliceNs = 1'000'000;
+
+    DriverQueueType _queue_type;
+    int _num_threads;
+
+    QueryContext _query_ctx;
+    DriverQueuePtr _queue;
+    std::vector<DriverPtr> _drivers;
+};
+
+void DriverQueueBench::SetUp() {
+    if (_queue_type == QUERY_SHARED) {
+        _queue = std::make_unique<QuerySharedDriverQueue>();
+    } else {
+        _queue = std::make_unique<ShardedDriverQueue>(_num_threads);
+    }
+    for (int i = 0; i < _num_threads * kNumDriversPerThread; i++) {
+        Operators operators{std::make_shared<BenchSourceOperator>()};
+        auto driver = std::make_shared<PipelineDriver>(operators, &_query_ctx, nullptr, nullptr, i);
+        _queue->put_back(driver.get());
+        _drivers.emplace_back(std::move(driver));
+    }
+}
+
+void DriverQueueBench::TearDown() {
+    _queue->close();
+}
+
+bool DriverQueueBench::take_and_put_back() {
+    auto maybe_driver = _queue->take(false);
+    if (!maybe_driver.ok() || maybe_driver.value() == nullptr) {
+        return false;
+    }
+    auto* driver = maybe_driver.value();
+    driver->driver_acct().update_last_time_spent(kTimeSliceNs);
+    _queue->update_statistics(driver);
+    _queue->put_back_from_executor(driver);
+    return true;
+}
+
+static std::unique_ptr<DriverQueueBench> bench;
+
+static void BM_DriverQueue_PutTake(benchmark::State& state) {
+    // All the threads share the same queue, and the loop of the threads starts after the queue is set up.
+    if (state.thread_index == 0) {
+        bench = std::make_unique<DriverQueueBench>(static_cast<DriverQueueType>(state.range(0)), state.threads);
+        bench->SetUp();
+    }
+    PartitionedDriverQueue::bind_current_thread(state.thread_index);
+    int64_t num_taken = 0;
+    for (auto _ : state) {
+        num_taken += bench->take_and_put_back();
+    }
+    state.SetItemsProcessed(num_taken);
+    if (state.thread_index == 0) {
+        bench->TearDown();
+        bench.reset();
+    }
+}
+
+BENCHMARK(BM_DriverQueue_PutTake)->Arg(QUERY_SHARED)->Arg(SHARDED)->ThreadRange(1, 128)->UseRealTime();
+
+} // namespace starrocks::pipeline
+
+BENCHMARK_MAIN();
@@ -0,0 +1,134 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+#include <fcntl.h>
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "common/logging.h"
+#include "io/fd_input_stream.h"
+#include "io/io_uring.h"
+#include "io/uring_input_stream.h"
+
+namespace starrocks {
+
+// Random reads of a local file by blocking pread one at a time, and by submitting the reads of a batch to
+// io_uring at once. Reports the IOPS as items_per_second and the CPU time (user + sys) spent per GB read.
+//
+// By default a 1GB temporary file is used, which is most likely in the page cache. To measure the device,
+// point IO_URING_BENCH_FILE to a file much larger than the memory, or drop the page cache before running.
+static constexpr int64_t kDefaultFileSize = 1024L * 1024 * 1024;
+
+static const std::string& bench_file() {
+    static const std::string path = [] {
+        if (const char* env = ::getenv("IO_URING_BENCH_FILE"); env != nullptr) {
+            return std::string(env);
+        }
+        std::string tmp = "/tmp/io_uring_bench.dat";
+        int fd = ::open(tmp.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        CHECK(fd >= 0) << "failed to create " << tmp;
+        std::vector<char> block(4 * 1024 * 1024);
+        std::mt19937 rng(0);
+        for (auto& c : block) c = static_cast<char>(rng());
+        for (int64_t offset = 0; offset < kDefaultFileSize; offset += block.size()) {
+            CHECK(::pwrite(fd, block.data(), block.size(), offset) == static_cast<ssize_t>(block.size()));
+        }
+        ::close(fd);
+        return tmp;
+    }();
+    return path;
+}
+
+static std::unique_ptr<io::FdInputStream> open_bench_file() {
+    int fd = ::open(bench_file().c_str(), O_RDONLY);
+    CHECK(fd >= 0) << "failed to open " << bench_file();
+    auto stream = std::make_unique<io::FdInputStream>(fd);
+    stream->set_close_on_delete(true);
+    return stream;
+}
+
+static int64_t thread_cpu_ns() {
+    struct rusage usage;
+    ::getrusage(RUSAGE_THREAD, &usage);
+    return (usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) * 1000000000L +
+           (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) * 1000L;
+}
+
+static void do_bench(benchmark::State& state, io::SeekableInputStream* stream, bool batch) {
+    const int64_t block_size = state.range(0);
+    const int64_t batch_size = state.range(1);
+    const int64_t file_size = stream->get_size().value();
+    const int64_t num_blocks = file_size / block_size;
+    std::vector<char> buffer(block_size * batch_size);
+    std::vector<io::SeekableInputStream::ReadRequest> requests(batch_size);
+    std::mt19937_64 rng(42);
+
+    int64_t cpu_ns = thread_cpu_ns();
+    for (auto _ : state) {
+        for (int64_t i = 0; i < batch_size; i++) {
+            requests[i] = {.offset = static_cast<int64_t>(rng() % num_blocks) * block_size,
+                           .out = buffer.data() + i * block_size,
+                           .count = block_size};
+        }
+        if (batch) {
+            CHECK(stream->read_at_fully_batch(requests).ok());
+        } else {
+            for (const auto& r : requests) {
+                CHECK(stream->read_at_fully(r.offset, r.out, r.count).ok());
+            }
+        }
+        benchmark::DoNotOptimize(buffer.data());
+    }
+    cpu_ns = thread_cpu_ns() - cpu_ns;
+
+    int64_t total_bytes = state.iterations() * batch_size * block_size;
+    state.SetItemsProcessed(state.iterations() * batch_size);
+    state.SetBytesProcessed(total_bytes);
+    state.counters["cpu_ms_per_GB"] = static_cast<double>(cpu_ns) / 1e6 / (static_cast<double>(total_bytes) / 1e9);
+}
+
+static void BM_pread(benchmark::State& state) {
+    auto stream = open_bench_file();
+    do_bench(state, stream.get(), false);
+}
+
+static void BM_io_uring_batch(benchmark::State& state) {
+    if (io::IoUring::thread_local_instance() == nullptr) {
+        state.SkipWithError("io_uring is not supported");
+        return;
+    }
+    io::UringInputStream stream(open_bench_file());
+    do_bench(state, &stream, true);
+}
+
+// {block size, reads per batch}, a batch of one read goes to pread even with io_uring
+static void bench_args(benchmark::internal::Benchmark* b) {
+    for (int64_t block_size : {4 * 1024, 64 * 1024}) {
+        for (int64_t batch_size : {1, 8, 32, 128}) {
+            b->Args({block_size, batch_size});
+        }
+    }
+}
+
+BENCHMARK(BM_pread)->Apply(bench_args)->UseRealTime();
+BENCHMARK(BM_io_uring_batch)->Apply(bench_args)->UseRealTime();
+
+} // namespace starrocks
+
+BENCHMARK_MAIN();
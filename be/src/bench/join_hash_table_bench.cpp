@@ -0,0 +1,202 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+#include <glog/logging.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "bench.h"
+#include "column/fixed_length_column.h"
+#include "common/config.h"
+#include "exec/join_hash_map.h"
+#include "runtime/descriptor_helper.h"
+#include "runtime/runtime_state.h"
+
+namespace starrocks {
+
+// Compares the layouts of JoinHashTable on a BIGINT inner join whose probe keys are uniformly picked from the
+// build keys, with and without the software-pipelined lookup of bucket heads.
+enum JoinHashTableLayout { CHAINED = 0, LINEAR_PROBING = 1 };
+
+class JoinHashTableBench {
+public:
+    JoinHashTableBench(int64_t num_build_rows, JoinHashTableLayout layout, int32_t prefetch_distance)
+            : _num_build_rows(num_build_rows), _layout(layout), _prefetch_distance(prefetch_distance) {}
+
+    void SetUp();
+    void TearDown();
+
+    void do_bench(benchmark::State& state);
+
+private:
+    static constexpr size_t kNumProbeChunks = 256;
+    static constexpr size_t kNumPayloadColumns = 2;
+
+    std::shared_ptr<RowDescriptor> _create_row_desc(TTupleId tuple_id);
+
+    int64_t _num_build_rows;
+    JoinHashTableLayout _layout;
+    int32_t _prefetch_distance;
+    int64_t _old_linear_probing_min_rows = 0;
+
+    ObjectPool _pool;
+    TDescriptorTableBuilder _desc_builder;
+    std::shared_ptr<RuntimeState> _runtime_state;
+    std::shared_ptr<RuntimeProfile> _profile;
+    std::shared_ptr<RowDescriptor> _build_row_desc;
+    std::shared_ptr<RowDescriptor> _probe_row_desc;
+    TypeDescriptor _bigint_type = TypeDescriptor::from_logical_type(TYPE_BIGINT);
+
+    JoinHashTable _hash_table;
+    std::vector<ChunkPtr> _probe_chunks;
+};
+
+std::shared_ptr<RowDescriptor> JoinHashTableBench::_create_row_desc(TTupleId tuple_id) {
+    DescriptorTbl* tbl = nullptr;
+    CHECK(DescriptorTbl::create(_runtime_state.get(), &_pool, _desc_builder.desc_tbl(), &tbl, kTestChunkSize).ok());
+    return std::make_shared<RowDescriptor>(*tbl, std::vector<TTupleId>{tuple_id});
+}
+
+static ColumnPtr create_bigint_column(const std::vector<int64_t>& values, size_t from, size_t count) {
+    auto column = Int64Column::create();
+    column->append_numbers(values.data() + from, count * sizeof(int64_t));
+    return column;
+}
+
+void JoinHashTableBench::SetUp() {
+    _old_linear_probing_min_rows = config::hash_join_linear_probing_min_rows;
+    config::hash_join_linear_probing_min_rows = _layout == LINEAR_PROBING ? 0 : -1;
+
+    TQueryOptions query_options;
+    query_options.batch_size = kTestChunkSize;
+    query_options.__set_hash_table_prefetch_distance(_prefetch_distance);
+    _runtime_state = std::make_shared<RuntimeState>(TUniqueId(), query_options, TQueryGlobals(), nullptr);
+    _runtime_state->init_instance_mem_tracker();
+    _profile = std::make_shared<RuntimeProfile>("bench");
+
+    // tuple 0 is the probe side, and tuple 1 is the build side.
+    for (int t = 0; t < 2; t++) {
+        TTupleDescriptorBuilder tuple_builder;
+        for (int i = 0; i < 1 + kNumPayloadColumns; i++) {
+            tuple_builder.add_slot(TSlotDescriptorBuilder()
+                                           .type(TYPE_BIGINT)
+                                           .column_name("c" + std::to_string(i))
+                                           .column_pos(i)
+                                           .nullable(false)
+                                           .build());
+        }
+        tuple_builder.build(&_desc_builder);
+    }
+    _probe_row_desc = _create_row_desc(0);
+    _build_row_desc = _create_row_desc(1);
+
+    HashTableParam param;
+    param.join_type = TJoinOp::INNER_JOIN;
+    param.build_row_desc = _build_row_desc.get();
+    param.probe_row_desc = _probe_row_desc.get();
+    param.join_keys.emplace_back(JoinKeyDesc{&_bigint_type, false, nullptr});
+    param.search_ht_timer = ADD_TIMER(_profile.get(), "SearchHashTableTime");
+    param.output_build_column_timer = ADD_TIMER(_profile.get(), "OutputBuildColumnTime");
+    param.output_probe_column_timer = ADD_TIMER(_profile.get(), "OutputProbeColumnTime");
+    param.pipelined_probe_rows_counter = ADD_COUNTER(_profile.get(), "PipelinedProbeRows", TUnit::UNIT);
+    _hash_table.create(param);
+
+    std::vector<int64_t> keys(_num_build_rows);
+    std::iota(keys.begin(), keys.end(), 0);
+    std::mt19937_64 rng(_num_build_rows);
+    std::shuffle(keys.begin(), keys.end(), rng);
+
+    const auto& build_slots = _build_row_desc->tuple_descriptors()[0]->slots();
+    for (size_t from = 0; from < keys.size(); from += kTestChunkSize) {
+        size_t count = std::min<size_t>(kTestChunkSize, keys.size() - from);
+        auto chunk = std::make_shared<Chunk>();
+        for (auto* slot : build_slots) {
+            chunk->append_column(create_bigint_column(keys, from, count), slot->id());
+        }
+        _hash_table.append_chunk(chunk, Columns{chunk->columns()[0]});
+    }
+    CHECK(_hash_table.build(_runtime_state.get()).ok());
+
+    std::uniform_int_distribution<int64_t> key_gen(0, _num_build_rows - 1);
+    std::vector<int64_t> probe_keys(kTestChunkSize);
+    const auto& probe_slots = _probe_row_desc->tuple_descriptors()[0]->slots();
+    for (size_t i = 0; i < kNumProbeChunks; i++) {
+        for (auto& key : probe_keys) {
+            key = key_gen(rng);
+        }
+        auto chunk = std::make_shared<Chunk>();
+        for (auto* slot : probe_slots) {
+            chunk->append_column(create_bigint_column(probe_keys, 0, kTestChunkSize), slot->id());
+        }
+        _probe_chunks.emplace_back(std::move(chunk));
+    }
+}
+
+void JoinHashTableBench::TearDown() {
+    _hash_table.close();
+    config::hash_join_linear_probing_min_rows = _old_linear_probing_min_rows;
+}
+
+void JoinHashTableBench::do_bench(benchmark::State& state) {
+    size_t num_output_rows = 0;
+    for (auto _ : state) {
+        for (auto& probe_chunk : _probe_chunks) {
+            // probe() may filter the columns of probe chunk in place, so probe with a copy.
+            ChunkPtr input = probe_chunk->clone_unique();
+            Columns key_columns{input->columns()[0]};
+            bool has_remain = true;
+            while (has_remain) {
+                ChunkPtr result = std::make_shared<Chunk>();
+                CHECK(_hash_table.probe(_runtime_state.get(), key_columns, &input, &result, &has_remain).ok());
+                num_output_rows += result->num_rows();
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * kNumProbeChunks * kTestChunkSize);
+    state.counters["output_rows"] = num_output_rows;
+    state.counters["pipelined_rows"] = _profile->get_counter("PipelinedProbeRows")->value();
+}
+
+static void BM_JoinHashTable_Probe(benchmark::State& state) {
+    JoinHashTableBench bench(state.range(0), static_cast<JoinHashTableLayout>(state.range(1)), state.range(2));
+    bench.SetUp();
+    bench.do_bench(state);
+    bench.TearDown();
+}
+
+static void BM_JoinHashTable_Probe_Args(benchmark::internal::Benchmark* b) {
+    for (int64_t num_build_rows : {1L << 16, 1L << 20, 1L << 23, 1L << 25, 50'000'000L}) {
+        for (int64_t layout : {CHAINED, LINEAR_PROBING}) {
+            b->Args({num_build_rows, layout, 0});
+        }
+        // the pipelined lookup only kicks in when the hash table may encounter serious cache misses.
+        for (int64_t prefetch_distance : {8, 16, 32}) {
+            b->Args({num_build_rows, CHAINED, prefetch_distance});
+            b->Args({num_build_rows, LINEAR_PROBING, prefetch_distance});
+        }
+    }
+    b->Unit(benchmark::kMillisecond);
+}
+
+BENCHMARK(BM_JoinHashTable_Probe)->Apply(BM_JoinHashTable_Probe_Args);
+
+} // namespace starrocks
+
+BENCHMARK_MAIN();
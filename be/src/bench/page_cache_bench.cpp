@@ -0,0 +1,139 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "util/lru_cache.h"
+
+namespace starrocks {
+
+// Replay a page access trace against the cache with each eviction and admission policy, and report the hit ratio.
+//
+// The trace is read from the file named by the environment variable PAGE_CACHE_TRACE, one access per line as
+// "<page key> <page size>", e.g. "<segment file>:<offset> 65536". Without it, a synthetic trace is used, where a
+// skewed working set of dashboard queries is interleaved with the full scans of a large table.
+struct PageAccess {
+    std::string key;
+    size_t size;
+};
+
+static std::vector<PageAccess> load_trace(const char* path) {
+    std::vector<PageAccess> trace;
+    std::ifstream in(path);
+    PageAccess access;
+    while (in >> access.key >> access.size) {
+        trace.emplace_back(std::move(access));
+    }
+    return trace;
+}
+
+static std::vector<PageAccess> synthetic_trace() {
+    static constexpr int kNumHotPages = 20000;
+    static constexpr int kNumScanPages = 200000;
+    static constexpr int kNumRounds = 10;
+    static constexpr int kNumHotAccessesPerRound = 200000;
+    static constexpr size_t kPageSize = 64 * 1024;
+
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<double> dist(0, 1);
+    std::vector<PageAccess> trace;
+    for (int round = 0; round < kNumRounds; round++) {
+        for (int i = 0; i < kNumHotAccessesPerRound; i++) {
+            auto page = static_cast<int>(kNumHotPages * std::pow(dist(rng), 3));
+            trace.push_back({"hot:" + std::to_string(page), kPageSize});
+            // an ad-hoc scan reads all the pages of a large table once in the middle of each round.
+            if (i == kNumHotAccessesPerRound / 2) {
+                for (int scan_page = 0; scan_page < kNumScanPages; scan_page++) {
+                    trace.push_back({"scan:" + std::to_string(scan_page), kPageSize});
+                }
+            }
+        }
+    }
+    return trace;
+}
+
+static const std::vector<PageAccess>& trace() {
+    static const std::vector<PageAccess> trace = [] {
+        const char* path = std::getenv("PAGE_CACHE_TRACE");
+        return path != nullptr ? load_trace(path) : synthetic_trace();
+    }();
+    return trace;
+}
+
+// The bytes of the distinct pages of the trace, i.e. the size of a cache never missing but the first accesses.
+static size_t trace_footprint() {
+    static const size_t footprint = [] {
+        std::unordered_map<std::string, size_t> sizes;
+        for (const auto& access : trace()) {
+            sizes[access.key] = access.size;
+        }
+        size_t footprint = 0;
+        for (const auto& [key, size] : sizes) {
+            footprint += size;
+        }
+        return footprint;
+    }();
+    return footprint;
+}
+
+// Args: eviction policy, whether to enable the TinyLFU admission, and the capacity in percent of the footprint.
+static void BM_PageCache_Replay(benchmark::State& state) {
+    CacheOptions options;
+    options.eviction_policy = static_cast<CacheEvictionPolicy>(state.range(0));
+    options.tinylfu_admission = state.range(1) != 0;
+    options.capacity = trace_footprint() * state.range(2) / 100;
+
+    const auto& accesses = trace();
+    auto deleter = [](const CacheKey& key, void* value) {};
+    size_t num_hits = 0;
+    for (auto _ : state) {
+        std::unique_ptr<Cache> cache(new_cache(options));
+        num_hits = 0;
+        for (const auto& access : accesses) {
+            Cache::Handle* handle = cache->lookup(access.key);
+            if (handle != nullptr) {
+                num_hits++;
+            } else {
+                handle = cache->insert(access.key, nullptr, access.size, deleter);
+            }
+            cache->release(handle);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * accesses.size());
+    state.counters["hit_ratio"] = static_cast<double>(num_hits) / accesses.size();
+}
+
+static void replay_args(benchmark::internal::Benchmark* b) {
+    for (int capacity_percent : {5, 10, 20}) {
+        b->Args({static_cast<int>(CacheEvictionPolicy::LRU), 0, capacity_percent});
+        b->Args({static_cast<int>(CacheEvictionPolicy::LRU), 1, capacity_percent});
+        b->Args({static_cast<int>(CacheEvictionPolicy::S3FIFO), 0, capacity_percent});
+        b->Args({static_cast<int>(CacheEvictionPolicy::S3FIFO), 1, capacity_percent});
+    }
+}
+
+BENCHMARK(BM_PageCache_Replay)->Apply(replay_args)->Unit(benchmark::kMillisecond);
+
+} // namespace starrocks
+
+BENCHMARK_MAIN();
@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include <benchmark/benchmark.h>
+#include <butil/iobuf.h>
 #include <testutil/assert.h>
 
 #include <memory>
@@ -24,6 +25,7 @@
 #include "runtime/chunk_cursor.h"
 #include "runtime/runtime_state.h"
 #include "runtime/types.h"
+#include "serde/protobuf_serde.h"
 
 namespace starrocks {
 
@@ -50,6 +52,7 @@ public:
     void do_hash(const ColumnPtr& col);
     void do_shuffle(const Chunk& src_chunk);
     void do_bench(benchmark::State& state);
+    void do_serialize_bench(benchmark::State& state, bool zero_copy);
 
 private:
     int _chunk_count = 400;
@@ -185,6 +188,57 @@ void ShuffleChunkPerf::do_bench(benchmark::State& state) {
     state.PauseTiming();
 }
 
+// Serialize the shuffled chunks to the brpc attachment like ExchangeSinkOperator does, either to ChunkPB and then
+// copied to the attachment, or straight to a buffer handed over to the attachment as a user-data block.
+// Reports the bytes copied into the attachment per row, the bytes serialized are not counted.
+void ShuffleChunkPerf::do_serialize_bench(benchmark::State& state, bool zero_copy) {
+    init_types();
+    _dest_chunks.resize(_node_count, nullptr);
+    init_dest_chunks();
+    for (int i = 0; i < _chunk_count; i++) {
+        ChunkPtr src_chunk = init_src_chunk();
+        do_hash(src_chunk->columns()[0]);
+        do_shuffle(*src_chunk);
+    }
+
+    int64_t num_rows = 0;
+    int64_t serialized_bytes = 0;
+    int64_t copied_bytes = 0;
+    for (auto _ : state) {
+        for (const auto& chunk : _dest_chunks) {
+            butil::IOBuf attachment;
+            const char* buffer = nullptr;
+            if (zero_copy) {
+                auto* data = new uint8_t[serde::ProtobufChunkSerde::max_serialized_data_size(*chunk)];
+                auto res = serde::ProtobufChunkSerde::serialize_to(*chunk, data, false);
+                CHECK(res.ok());
+                attachment.append_user_data(data, res->uncompressed_size(),
+                                            [](void* buf) { delete[] static_cast<uint8_t*>(buf); });
+                buffer = reinterpret_cast<const char*>(data);
+            } else {
+                auto res = serde::ProtobufChunkSerde::serialize_without_meta(*chunk);
+                CHECK(res.ok());
+                attachment.append(res->data());
+            }
+            // the blocks not backed by the serialize buffer are copies
+            for (size_t i = 0; i < attachment.backing_block_num(); i++) {
+                auto block = attachment.backing_block(i);
+                if (block.data() != buffer) {
+                    copied_bytes += block.size();
+                }
+            }
+            num_rows += chunk->num_rows();
+            serialized_bytes += attachment.size();
+            benchmark::DoNotOptimize(attachment);
+        }
+    }
+
+    state.SetItemsProcessed(num_rows);
+    state.SetBytesProcessed(serialized_bytes);
+    state.counters["copied_bytes_per_row"] = static_cast<double>(copied_bytes) / num_rows;
+    state.counters["serialized_bytes_per_row"] = static_cast<double>(serialized_bytes) / num_rows;
+}
+
 static void bench_func(benchmark::State& state) {
     int chunk_count = state.range(0);
     int column_count = state.range(1);
@@ -225,7 +279,30 @@ static void process_args(benchmark::internal::Benchmark* b) {
     b->Args({400, 400, 3, 4096, 0});
 }
 
+static void bench_serialize_func(benchmark::State& state) {
+    int chunk_count = state.range(0);
+    int column_count = state.range(1);
+    int node_count = state.range(2);
+    int src_chunk_size = state.range(3);
+    int null_percent = state.range(4);
+    bool zero_copy = state.range(5);
+
+    ShuffleChunkPerf perf(chunk_count, column_count, node_count, src_chunk_size, null_percent);
+    perf.do_serialize_bench(state, zero_copy);
+}
+
+static void process_serialize_args(benchmark::internal::Benchmark* b) {
+    // chunk_count, column_count, node_count, src_chunk_size, null percent, zero copy
+    // chunk_count is the same as node_count, so about src_chunk_size rows are sent to each node
+    for (int zero_copy : {0, 1}) {
+        b->Args({10, 100, 10, 4096, 80, zero_copy});
+        b->Args({10, 100, 10, 4096, 0, zero_copy});
+        b->Args({40, 10, 40, 4096, 0, zero_copy});
+    }
+}
+
 BENCHMARK(bench_func)->Apply(process_args);
+BENCHMARK(bench_serialize_func)->Apply(process_serialize_args);
 
 } // namespace starrocks
 
@@ -15,6 +15,7 @@
 #pragma once
 
 #include <cstdint>
+#include <cstring>
 
 #include "column/column_hash.h"
 #include "runtime/memory/counting_allocator.h"
@@ -83,6 +84,59 @@ public:
     }
 };
 
+// Slice key which keeps the hash value beside the string, so rehashing never reads the string bytes again.
+// A string not longer than kInlineSize bytes is stored inline with zero padding and compared with one 16-byte load,
+// a longer one points to the bytes persisted in an arena, and its bytes are compared only when the hash values match.
+template <PhmapSeed seed>
+class TInlineSliceWithHash {
+public:
+    static constexpr size_t kInlineSize = 16;
+
+    TInlineSliceWithHash() = default;
+    TInlineSliceWithHash(const Slice& src) : TInlineSliceWithHash(src, SliceHashWithSeed<seed>()(src)) {}
+    TInlineSliceWithHash(const Slice& src, size_t h) : size(src.size), hash(h) {
+        if (is_inline()) {
+            memset(u.inline_data, 0, kInlineSize);
+            memcpy(u.inline_data, src.data, src.size);
+        } else {
+            u.data = reinterpret_cast<const uint8_t*>(src.data);
+        }
+    }
+
+    bool is_inline() const { return size <= kInlineSize; }
+    const uint8_t* get_data() const { return is_inline() ? u.inline_data : u.data; }
+    Slice to_slice() const { return {get_data(), size}; }
+
+    bool operator==(const TInlineSliceWithHash& rhs) const {
+        if (hash != rhs.hash || size != rhs.size) {
+            return false;
+        }
+        if (is_inline()) {
+#if defined(__SSE2__)
+            __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(u.inline_data));
+            __m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs.u.inline_data));
+            return _mm_movemask_epi8(_mm_cmpeq_epi8(x, y)) == 0xFFFF;
+#else
+            return memcmp(u.inline_data, rhs.u.inline_data, kInlineSize) == 0;
+#endif
+        }
+        return memequal_padded(u.data, size, rhs.u.data, rhs.size);
+    }
+
+    union {
+        uint8_t inline_data[kInlineSize];
+        const uint8_t* data;
+    } u;
+    uint32_t size = 0;
+    size_t hash = 0;
+};
+
+template <PhmapSeed seed>
+class THashOnInlineSliceWithHash {
+public:
+    std::size_t operator()(const TInlineSliceWithHash<seed>& slice) const { return slice.hash; }
+};
+
 using SliceHashSet = phmap::flat_hash_set<SliceWithHash, HashOnSliceWithHash, EqualOnSliceWithHash>;
 using SliceHashSetWithMemoryCounting = phmap::flat_hash_set<SliceWithHash, HashOnSliceWithHash, EqualOnSliceWithHash,
                                                             CountingAllocator<SliceWithHash>>;
@@ -262,6 +262,11 @@ CONF_Int32(file_descriptor_cache_capacity, "16384");
 // minimum file descriptor number
 // modify them upon necessity
 CONF_Int32(min_file_descriptor_number, "60000");
+// Use io_uring instead of blocking pread/pwritev for local files, including segment files and
+// spill files. Ignored when the kernel does not support io_uring.
+CONF_Bool(enable_io_uring, "false");
+// The number of submission queue entries of the io_uring of each thread.
+CONF_Int32(io_uring_queue_depth, "64");
 CONF_Int64(index_stream_cache_capacity, "10737418240");
 // CONF_Int64(max_packed_row_block_size, "20971520");
 
@@ -272,6 +277,16 @@ CONF_Int32(data_page_size, "65536");
 CONF_mString(storage_page_cache_limit, "20%");
 // whether to disable page cache feature in storage
 CONF_mBool(disable_storage_page_cache, "false");
+// The eviction policy of the storage page cache, "lru" or "s3fifo". s3fifo keeps the pages read only once, e.g. by
+// a big scan, from flushing the frequently read pages.
+CONF_String(storage_page_cache_eviction_policy, "lru");
+// Whether to admit the new pages into the storage page cache by TinyLFU, which only admits a new page if it has been
+// read more frequently than the page to evict for it.
+CONF_Bool(enable_storage_page_cache_tinylfu_admission, "false");
+// The memory limit of the decoded page tier of the storage page cache, e.g. "1G" or "2%", which caches the data pages
+// of the fixed-length columns decoded into their values, and the dictionary encoded pages of the strings decoded into
+// their codes, so that the hot pages, e.g. of the small dimension tables, are read without decoding. 0 disables it.
+CONF_mString(storage_decoded_page_cache_limit, "0");
 // whether to enable the bitmap index memory cache
 CONF_mBool(enable_bitmap_index_memory_page_cache, "false");
 // whether to enable the zonemap index memory cache
@@ -406,6 +421,20 @@ CONF_Double(dictionary_encoding_ratio_for_non_string_column, "0");
 // The minimum chunk size for dictionary encoding speculation
 CONF_Int32(dictionary_speculate_min_chunk_size, "10000");
 
+// If the ALP encoded size of the FLOAT/DOUBLE values, estimated by sampling the first chunk, is at most this
+// fraction of their plain size, the column is encoded by ALP instead of bitshuffle. 0 disables ALP encoding.
+CONF_Double(alp_encoding_ratio_for_float_column, "0");
+
+// Whether to compress the strings by FSST instead of storing them as they are, if the column is not suitable for
+// dictionary encoding, or its dictionary page is full. The segments written are not readable by the versions
+// without FSST encoding.
+CONF_Bool(enable_fsst_string_encoding, "false");
+
+// Whether to encode the integer, DATE and DATETIME columns of the sort key by delta binary packed encoding, which
+// stores the nearly monotonic values in a few bits each. The segments written are not readable by the versions
+// without delta binary packed encoding.
+CONF_Bool(enable_delta_binary_packed_sort_key_encoding, "false");
+
 // Whether to use special thread pool for streaming load to avoid deadlock for
 // concurrent streaming loads. The maximum number of threads and queue size are
 // set INT32_MAX which indicate there is no limit for the thread pool. Note you
@@ -685,6 +714,11 @@ CONF_Bool(ignore_rowset_stale_unconsistent_delete, "false");
 // The chunk size for vector query engine
 CONF_Int32(vector_chunk_size, "4096");
 
+// Valid range: [0-1].
+// Once the ratio of the rows selected by the evaluated conjuncts drops below it, the remaining conjuncts are only
+// evaluated on the selected rows, and the chunk is gathered once at the end. `0` will disable it.
+CONF_mDouble(selection_vector_conjunct_eval_max_selectivity, "0.25");
+
 // Valid range: [0-1000].
 // `0` will disable late materialization.
 // `1000` will enable late materialization always.
@@ -697,6 +731,10 @@ CONF_Int32(metric_late_materialization_ratio, "1000");
 
 // Max batched bytes for each transmit request. (256KB)
 CONF_Int64(max_transmit_batched_bytes, "262144");
+// Serialize the chunks of exchange into buffers handed over to the brpc attachment, instead of serializing
+// them into ChunkPB and copying them to the attachment. Only the sender saves the copy, the receiver still
+// gathers each chunk into contiguous memory before deserializing it.
+CONF_mBool(enable_exchange_zero_copy_serialize, "false");
 
 CONF_Int16(bitmap_max_filter_items, "30");
 
@@ -758,6 +796,10 @@ CONF_mDouble(pipeline_connector_scan_thread_num_per_cpu, "8");
 CONF_Int64(pipeline_scan_thread_pool_queue_size, "102400");
 // The number of execution threads for pipeline engine.
 CONF_Int64(pipeline_exec_thread_pool_thread_num, "0");
+// Whether to partition the execution threads and the ready drivers of pipeline engine per NUMA node. The drivers of a
+// fragment instance are executed by the threads of one node, which are bound to the cores and a memory arena of the
+// node, and a thread executes the drivers of the other nodes only when there is no ready driver of its own node.
+CONF_Bool(enable_pipeline_numa_aware_scheduling, "false");
 // The number of threads for preparing fragment instances in pipeline engine, vCPUs by default.
 // *  "n": positive integer, fixed number of threads to n.
 // *  "0": default value, means the same as number of cpu cores.
@@ -775,11 +817,20 @@ CONF_Int64(pipeline_sink_brpc_dop, "64");
 // exceeds it*pipeline_exec_thread_pool_thread_num.
 CONF_Int64(pipeline_max_num_drivers_per_exec_thread, "10240");
 CONF_mBool(pipeline_print_profile, "false");
+// Whether the blocked drivers waiting for the exchange sources, local exchange sources and runtime filters are woken up
+// by the notifications of them, instead of being polled by the poller thread continuously.
+CONF_Bool(enable_pipeline_event_driven_poller, "true");
+// The interval of checking the timeout and cancellation of the blocked drivers which are waiting for the notifications.
+CONF_mInt64(pipeline_poller_event_driver_check_interval_ms, "10");
 
 // The arguments of multilevel feedback pipeline_driver_queue. It prioritizes small queries over larger ones,
 // when the value of level_time_slice_base_ns is smaller and queue_ratio_of_adjacent_queue is larger.
 CONF_Int64(pipeline_driver_queue_level_time_slice_base_ns, "200000000");
 CONF_Double(pipeline_driver_queue_ratio_of_adjacent_queue, "1.2");
+// The number of shards of the ready driver queue shared by the queries, each of which has its own lock and multilevel
+// feedback queues. The executor threads take the drivers from their own shards first and steal from the others, which
+// reduces the lock contention when a lot of executor threads run short-lived drivers. 1 means no sharding.
+CONF_Int32(pipeline_driver_queue_num_shards, "1");
 // 0 represents PriorityScanTaskQueue (by default), while 1 represents MultiLevelFeedScanTaskQueue.
 // - PriorityScanTaskQueue prioritizes scan tasks with lower committed times.
 // - MultiLevelFeedScanTaskQueue prioritizes scan tasks with shorter execution time.
@@ -796,7 +847,16 @@ CONF_Bool(pipeline_analytic_enable_streaming_process, "true");
 CONF_Bool(pipeline_analytic_enable_removable_cumulative_process, "true");
 CONF_Int32(pipline_limit_max_delivery, "4096");
 
+// The hash table of hash join uses linear probing with SIMD tag matching instead of bucket chains when the build side
+// has more rows than this. Set a negative value to disable it. It's opt-in only, and disabled by default until a
+// threshold is measured with join_hash_table_bench.
+CONF_mInt64(hash_join_linear_probing_min_rows, "-1");
+
 CONF_mBool(use_default_dop_when_shared_scan, "true");
+// Whether the driver of a scan steals the morsels from the queues of the other drivers of the same scan after its own
+// morsels run out, when the morsels are distributed to the drivers uniformly. The idle driver also splits off the
+// pending rows of the OLAP tablets being scanned by the other drivers, see WorkStealingMorselQueue.
+CONF_mBool(enable_scan_morsel_stealing, "false");
 /// For parallel scan on the single tablet.
 // These three configs are used to calculate the minimum number of rows picked up from a segment at one time.
 // It is `splitted_scan_bytes/scan_row_bytes` and restricted in the range [min_splitted_scan_rows, max_splitted_scan_rows].
@@ -1063,6 +1123,14 @@ CONF_mInt32(spill_init_partition, "16");
 // make sure 2^spill_max_partition_level < spill_max_partition_size
 CONF_Int32(spill_max_partition_level, "7");
 CONF_Int32(spill_max_partition_size, "1024");
+// the max number of levels to split a spilled partition of hash join at once, the number of children
+// is chosen by the memory budget and is at most 2^spill_max_partition_split_levels
+CONF_mInt32(spill_max_partition_split_levels, "3");
+// The max bytes of the compressed spilled blocks kept in memory by each query before they go to the spill
+// dirs, the coldest blocks are moved to the spill dirs when the budget is used up. 0 means disabled.
+CONF_Int64(spill_mem_tier_max_bytes_per_query, "0");
+// The compression of the spilled blocks kept in memory, lz4 or zstd.
+CONF_String(spill_mem_tier_compression, "lz4");
 
 // The maximum size of a single log block container file, this is not a hard limit.
 // If the file size exceeds this limit, a new file will be created to store the block.
@@ -1250,6 +1318,9 @@ CONF_Int64(local_exchange_buffer_mem_limit_per_driver, "134217728"); // 128MB
 CONF_mInt64(streaming_agg_limited_memory_size, "134217728");
 // pipeline streaming aggregate chunk buffer size
 CONF_mInt32(streaming_agg_chunk_buffer_size, "1024");
+// Whether to group by one string column with the hash map whose keys cache the hash value and inline the short
+// strings.
+CONF_mBool(enable_agg_inline_string_key, "true");
 CONF_mInt64(wait_apply_time, "6000"); // 6s
 
 // Max size of a binlog file. The default is 512MB.
@@ -1266,6 +1337,12 @@ CONF_mBool(enable_auto_evict_update_cache, "true");
 CONF_mInt64(load_tablet_timeout_seconds, "60");
 
 CONF_mBool(enable_pk_value_column_zonemap, "true");
+// Whether to write the page zone maps of the leaf subfields of STRUCT, the flattened sub-columns of JSON and the
+// keys of MAP, which prune the pages by the predicates on the subfields.
+CONF_mBool(enable_subfield_zonemap, "false");
+// Whether to write the HyperLogLog of the values of each scalar column to the segment footer, which is merged by
+// the meta scan to estimate the NDV of the column without reading the data pages.
+CONF_mBool(enable_segment_ndv_sketch, "false");
 
 // Used by default mv resource group
 CONF_mDouble(default_mv_resource_group_memory_limit, "0.8");
@@ -405,6 +405,9 @@ void LakeDataSource::init_counter(RuntimeState* state) {
     _bi_filter_timer = ADD_CHILD_TIMER(_runtime_profile, "BitmapIndexFilter", segment_init_name);
     _bi_filtered_counter = ADD_CHILD_COUNTER(_runtime_profile, "BitmapIndexFilterRows", TUnit::UNIT, segment_init_name);
     _bf_filtered_counter = ADD_CHILD_COUNTER(_runtime_profile, "BloomFilterFilterRows", TUnit::UNIT, segment_init_name);
+    _fsst_filtered_counter = ADD_CHILD_COUNTER(_runtime_profile, "FsstFilterRows", TUnit::UNIT, segment_init_name);
+    _delta_anchor_filtered_counter =
+            ADD_CHILD_COUNTER(_runtime_profile, "DeltaAnchorFilterRows", TUnit::UNIT, segment_init_name);
     _seg_zm_filtered_counter =
             ADD_CHILD_COUNTER(_runtime_profile, "SegmentZoneMapFilterRows", TUnit::UNIT, segment_init_name);
     _seg_rt_filtered_counter =
@@ -421,6 +424,8 @@ void LakeDataSource::init_counter(RuntimeState* state) {
     _zone_map_filter_timer = ADD_CHILD_TIMER(_runtime_profile, "ZoneMapIndexFiter", segment_init_name);
     _rows_key_range_filter_timer = ADD_CHILD_TIMER(_runtime_profile, "ShortKeyFilter", segment_init_name);
     _bf_filter_timer = ADD_CHILD_TIMER(_runtime_profile, "BloomFilterFilter", segment_init_name);
+    _fsst_filter_timer = ADD_CHILD_TIMER(_runtime_profile, "FsstFilter", segment_init_name);
+    _delta_anchor_filter_timer = ADD_CHILD_TIMER(_runtime_profile, "DeltaAnchorFilter", segment_init_name);
 
     // SegmentRead
     const std::string segment_read_name = "SegmentRead";
@@ -510,6 +515,8 @@ void LakeDataSource::update_counter() {
     COUNTER_UPDATE(_zone_map_filter_timer, _reader->stats().zone_map_filter_ns);
     COUNTER_UPDATE(_rows_key_range_filter_timer, _reader->stats().rows_key_range_filter_ns);
     COUNTER_UPDATE(_bf_filter_timer, _reader->stats().bf_filter_ns);
+    COUNTER_UPDATE(_fsst_filter_timer, _reader->stats().fsst_filter_ns);
+    COUNTER_UPDATE(_delta_anchor_filter_timer, _reader->stats().delta_anchor_filter_ns);
     COUNTER_UPDATE(_read_pk_index_timer, _reader->stats().read_pk_index_ns);
 
     COUNTER_UPDATE(_raw_rows_counter, _reader->stats().raw_rows_read);
@@ -528,6 +535,8 @@ void LakeDataSource::update_counter() {
     COUNTER_UPDATE(_seg_rt_filtered_counter, _reader->stats().runtime_stats_filtered);
     COUNTER_UPDATE(_zm_filtered_counter, _reader->stats().rows_stats_filtered);
     COUNTER_UPDATE(_bf_filtered_counter, _reader->stats().rows_bf_filtered);
+    COUNTER_UPDATE(_fsst_filtered_counter, _reader->stats().rows_fsst_filtered);
+    COUNTER_UPDATE(_delta_anchor_filtered_counter, _reader->stats().rows_delta_anchor_filtered);
     COUNTER_UPDATE(_sk_filtered_counter, _reader->stats().rows_key_range_filtered);
     COUNTER_UPDATE(_rows_after_sk_filtered_counter, _reader->stats().rows_after_key_range);
     COUNTER_UPDATE(_rows_key_range_counter, _reader->stats().rows_key_range_num);
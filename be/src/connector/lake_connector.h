@@ -133,6 +133,10 @@ private:
     RuntimeProfile::Counter* _bf_filter_timer = nullptr;
     RuntimeProfile::Counter* _zm_filtered_counter = nullptr;
     RuntimeProfile::Counter* _bf_filtered_counter = nullptr;
+    RuntimeProfile::Counter* _fsst_filter_timer = nullptr;
+    RuntimeProfile::Counter* _fsst_filtered_counter = nullptr;
+    RuntimeProfile::Counter* _delta_anchor_filter_timer = nullptr;
+    RuntimeProfile::Counter* _delta_anchor_filtered_counter = nullptr;
     RuntimeProfile::Counter* _seg_zm_filtered_counter = nullptr;
     RuntimeProfile::Counter* _seg_rt_filtered_counter = nullptr;
     RuntimeProfile::Counter* _sk_filtered_counter = nullptr;
@@ -57,6 +57,9 @@ template <PhmapSeed seed>
 using TimeStampAggHashMap = phmap::flat_hash_map<TimestampValue, AggDataPtr, StdHashWithSeed<TimestampValue, seed>>;
 template <PhmapSeed seed>
 using SliceAggHashMap = phmap::flat_hash_map<Slice, AggDataPtr, SliceHashWithSeed<seed>, SliceEqual>;
+template <PhmapSeed seed>
+using InlineSliceAggHashMap =
+        phmap::flat_hash_map<TInlineSliceWithHash<seed>, AggDataPtr, THashOnInlineSliceWithHash<seed>>;
 
 // ==================
 // one level fixed size slice hash map
@@ -105,6 +108,17 @@ struct AggHashMapWithKey {
     using HashMapType = HashMap;
     HashMap hash_map;
     AggStatistics* agg_stat;
+    // Distance in rows of the hash table slot prefetches issued ahead of the lookups, 0 disables the prefetch path.
+    size_t prefetch_dist = AGG_HASH_MAP_DEFAULT_PREFETCH_DIST;
+
+    // The lookups are pipelined with prefetches only if the hash table is too large to stay in cache.
+    bool enable_prefetch() const { return prefetch_dist > 0 && hash_map.bucket_count() >= prefetch_threhold; }
+
+    void update_pipelined_probe_rows(size_t num_rows) {
+        if (agg_stat != nullptr) {
+            COUNTER_UPDATE(agg_stat->pipelined_probe_rows, num_rows);
+        }
+    }
 
     ////// Common Methods ////////
     template <typename Func>
@@ -173,15 +187,13 @@ struct AggHashMapWithOneNumberKeyWithNullable
         DCHECK(!key_columns[0]->is_nullable());
         auto column = down_cast<ColumnType*>(key_columns[0].get());
 
-        size_t bucket_count = this->hash_map.bucket_count();
-
         // Assign not_founds vector when needs compute not founds.
         if constexpr (compute_not_founds) {
             DCHECK(not_founds);
             (*not_founds).assign(chunk_size, 0);
         }
 
-        if (bucket_count < prefetch_threhold) {
+        if (!this->enable_prefetch()) {
             this->template compute_agg_noprefetch<Func, allocate_and_compute_state, compute_not_founds>(
                     column, agg_states, std::forward<Func>(allocate_func), not_founds);
         } else {
@@ -215,7 +227,7 @@ struct AggHashMapWithOneNumberKeyWithNullable
 
             // Shortcut: if nullable column has no nulls.
             if (!nullable_column->has_null()) {
-                if (this->hash_map.bucket_count() < prefetch_threhold) {
+                if (!this->enable_prefetch()) {
                     this->template compute_agg_noprefetch<Func, allocate_and_compute_state, compute_not_founds>(
                             data_column, agg_states, std::forward<Func>(allocate_func), not_founds);
                 } else {
@@ -233,7 +245,8 @@ struct AggHashMapWithOneNumberKeyWithNullable
     template <typename Func, bool allocate_and_compute_state, bool compute_not_founds>
     ALWAYS_NOINLINE void compute_agg_prefetch(ColumnType* column, Buffer<AggDataPtr>* agg_states, Func&& allocate_func,
                                               std::vector<uint8_t>* not_founds) {
-        AGG_HASH_MAP_PRECOMPUTE_HASH_VALUES(column, AGG_HASH_MAP_DEFAULT_PREFETCH_DIST);
+        AGG_HASH_MAP_PRECOMPUTE_HASH_VALUES(column, this->prefetch_dist);
+        this->update_pipelined_probe_rows(column_size);
         for (size_t i = 0; i < column_size; i++) {
             AGG_HASH_MAP_PREFETCH_HASH_VALUE();
 
@@ -251,7 +264,7 @@ struct AggHashMapWithOneNumberKeyWithNullable
                 (*agg_states)[i] = iter->second;
             } else if constexpr (compute_not_founds) {
                 DCHECK(not_founds);
-                if (auto iter = this->hash_map.find(key); iter != this->hash_map.end()) {
+                if (auto iter = this->hash_map.find(key, hash_values[i]); iter != this->hash_map.end()) {
                     (*agg_states)[i] = iter->second;
                 } else {
                     (*not_founds)[i] = 1;
@@ -398,7 +411,7 @@ struct AggHashMapWithOneStringKeyWithNullable
             (*not_founds).assign(chunk_size, 0);
         }
 
-        if (this->hash_map.bucket_count() < prefetch_threhold) {
+        if (!this->enable_prefetch()) {
             this->template compute_agg_noprefetch<Func, allocate_and_compute_state, compute_not_founds>(
                     column, agg_states, pool, std::forward<Func>(allocate_func), not_founds);
         } else {
@@ -432,7 +445,7 @@ struct AggHashMapWithOneStringKeyWithNullable
             DCHECK(data_column->is_binary());
 
             if (!nullable_column->has_null()) {
-                if (this->hash_map.bucket_count() < prefetch_threhold) {
+                if (!this->enable_prefetch()) {
                     this->template compute_agg_noprefetch<Func, allocate_and_compute_state, compute_not_founds>(
                             data_column, agg_states, pool, std::forward<Func>(allocate_func), not_founds);
                 } else {
@@ -449,7 +462,8 @@ struct AggHashMapWithOneStringKeyWithNullable
     template <typename Func, bool allocate_and_compute_state, bool compute_not_founds>
     ALWAYS_NOINLINE void compute_agg_prefetch(BinaryColumn* column, Buffer<AggDataPtr>* agg_states, MemPool* pool,
                                               Func&& allocate_func, std::vector<uint8_t>* not_founds) {
-        AGG_HASH_MAP_PRECOMPUTE_HASH_VALUES(column, AGG_HASH_MAP_DEFAULT_PREFETCH_DIST);
+        AGG_HASH_MAP_PRECOMPUTE_HASH_VALUES(column, this->prefetch_dist);
+        this->update_pipelined_probe_rows(column_size);
         for (size_t i = 0; i < column_size; i++) {
             AGG_HASH_MAP_PREFETCH_HASH_VALUE();
             auto key = column->get_slice(i);
@@ -468,7 +482,7 @@ struct AggHashMapWithOneStringKeyWithNullable
                 (*agg_states)[i] = iter->second;
             } else if constexpr (compute_not_founds) {
                 DCHECK(not_founds);
-                if (auto iter = this->hash_map.find(key); iter != this->hash_map.end()) {
+                if (auto iter = this->hash_map.find(key, hash_values[i]); iter != this->hash_map.end()) {
                     (*agg_states)[i] = iter->second;
                 } else {
                     (*not_founds)[i] = 1;
@@ -585,6 +599,145 @@ using AggHashMapWithOneStringKey = AggHashMapWithOneStringKeyWithNullable<HashMa
 template <typename HashMap>
 using AggHashMapWithOneNullableStringKey = AggHashMapWithOneStringKeyWithNullable<HashMap, true>;
 
+// handle one string hash key whose hash map key caches the hash value and inlines the short strings,
+// see TInlineSliceWithHash. The long strings are persisted in the memory pool of aggregator, which
+// works as the key arena.
+template <typename HashMap, bool is_nullable>
+struct AggHashMapWithOneInlineStringKeyWithNullable
+        : public AggHashMapWithKey<HashMap, AggHashMapWithOneInlineStringKeyWithNullable<HashMap, is_nullable>> {
+    using Self = AggHashMapWithOneInlineStringKeyWithNullable<HashMap, is_nullable>;
+    using Base = AggHashMapWithKey<HashMap, Self>;
+    using KeyType = typename HashMap::key_type;
+    using Iterator = typename HashMap::iterator;
+    using ResultVector = typename std::vector<KeyType>;
+
+    template <class... Args>
+    AggHashMapWithOneInlineStringKeyWithNullable(Args&&... args) : Base(std::forward<Args>(args)...) {}
+
+    AggDataPtr get_null_key_data() { return null_key_data; }
+
+    template <typename Func, bool allocate_and_compute_state, bool compute_not_founds>
+    void compute_agg_states(size_t chunk_size, const Columns& key_columns, MemPool* pool, Func&& allocate_func,
+                            Buffer<AggDataPtr>* agg_states, std::vector<uint8_t>* not_founds) {
+        // Assign not_founds vector when needs compute not founds.
+        if constexpr (compute_not_founds) {
+            DCHECK(not_founds);
+            (*not_founds).assign(chunk_size, 0);
+        }
+
+        if constexpr (is_nullable) {
+            if (key_columns[0]->only_null()) {
+                if (null_key_data == nullptr) {
+                    null_key_data = allocate_func(nullptr);
+                }
+                for (size_t i = 0; i < chunk_size; i++) {
+                    (*agg_states)[i] = null_key_data;
+                }
+                return;
+            }
+            DCHECK(key_columns[0]->is_nullable());
+            auto* nullable_column = down_cast<NullableColumn*>(key_columns[0].get());
+            auto* data_column = down_cast<BinaryColumn*>(nullable_column->data_column().get());
+            const uint8_t* null_data =
+                    nullable_column->has_null() ? nullable_column->null_column_data().data() : nullptr;
+            this->template compute_agg_keys<Func, allocate_and_compute_state, compute_not_founds>(
+                    chunk_size, data_column, null_data, pool, std::forward<Func>(allocate_func), agg_states,
+                    not_founds);
+        } else {
+            DCHECK(!key_columns[0]->is_nullable());
+            auto* column = down_cast<BinaryColumn*>(key_columns[0].get());
+            this->template compute_agg_keys<Func, allocate_and_compute_state, compute_not_founds>(
+                    chunk_size, column, nullptr, pool, std::forward<Func>(allocate_func), agg_states, not_founds);
+        }
+    }
+
+    // The keys with their hash values are built for the whole chunk first, so the hash table slots can be prefetched
+    // ahead for the large hash tables.
+    template <typename Func, bool allocate_and_compute_state, bool compute_not_founds>
+    ALWAYS_NOINLINE void compute_agg_keys(size_t chunk_size, BinaryColumn* column, const uint8_t* null_data,
+                                          MemPool* pool, Func&& allocate_func, Buffer<AggDataPtr>* agg_states,
+                                          std::vector<uint8_t>* not_founds) {
+        tmp_keys.resize(chunk_size);
+        for (size_t i = 0; i < chunk_size; i++) {
+            tmp_keys[i] = KeyType(column->get_slice(i));
+        }
+
+        const bool enable_prefetch = this->enable_prefetch();
+        if (enable_prefetch) {
+            this->update_pipelined_probe_rows(chunk_size);
+        }
+        for (size_t i = 0; i < chunk_size; i++) {
+            if (enable_prefetch && i + this->prefetch_dist < chunk_size) {
+                this->hash_map.prefetch_hash(tmp_keys[i + this->prefetch_dist].hash);
+            }
+            if (null_data != nullptr && null_data[i]) {
+                if (UNLIKELY(null_key_data == nullptr)) {
+                    null_key_data = allocate_func(nullptr);
+                }
+                (*agg_states)[i] = null_key_data;
+                continue;
+            }
+
+            const KeyType& key = tmp_keys[i];
+            if constexpr (allocate_and_compute_state) {
+                auto iter = this->hash_map.lazy_emplace_with_hash(key, key.hash, [&](const auto& ctor) {
+                    if constexpr (compute_not_founds) {
+                        DCHECK(not_founds);
+                        (*not_founds)[i] = 1;
+                    }
+                    KeyType pk = key;
+                    if (!key.is_inline()) {
+                        // we must persist the long string before insert
+                        uint8_t* pos = pool->allocate_with_reserve(key.size, SLICE_MEMEQUAL_OVERFLOW_PADDING);
+                        strings::memcpy_inlined(pos, key.u.data, key.size);
+                        pk.u.data = pos;
+                    }
+                    AggDataPtr pv = allocate_func(pk);
+                    ctor(pk, pv);
+                });
+                (*agg_states)[i] = iter->second;
+            } else if constexpr (compute_not_founds) {
+                DCHECK(not_founds);
+                if (auto iter = this->hash_map.find(key, key.hash); iter != this->hash_map.end()) {
+                    (*agg_states)[i] = iter->second;
+                } else {
+                    (*not_founds)[i] = 1;
+                }
+            }
+        }
+    }
+
+    void insert_keys_to_columns(ResultVector& keys, const Columns& key_columns, size_t chunk_size) {
+        tmp_slices.resize(chunk_size);
+        for (size_t i = 0; i < chunk_size; i++) {
+            tmp_slices[i] = keys[i].to_slice();
+        }
+        if constexpr (is_nullable) {
+            DCHECK(key_columns[0]->is_nullable());
+            auto* nullable_column = down_cast<NullableColumn*>(key_columns[0].get());
+            auto* column = down_cast<BinaryColumn*>(nullable_column->mutable_data_column());
+            column->append_strings(tmp_slices);
+            nullable_column->null_column_data().resize(chunk_size);
+        } else {
+            DCHECK(!null_key_data);
+            auto* column = down_cast<BinaryColumn*>(key_columns[0].get());
+            column->append_strings(tmp_slices);
+        }
+    }
+
+    static constexpr bool has_single_null_key = is_nullable;
+
+    AggDataPtr null_key_data = nullptr;
+    ResultVector results;
+    std::vector<KeyType> tmp_keys;
+    std::vector<Slice> tmp_slices;
+};
+
+template <typename HashMap>
+using AggHashMapWithOneInlineStringKey = AggHashMapWithOneInlineStringKeyWithNullable<HashMap, false>;
+template <typename HashMap>
+using AggHashMapWithOneNullableInlineStringKey = AggHashMapWithOneInlineStringKeyWithNullable<HashMap, true>;
+
 template <typename HashMap>
 struct AggHashMapWithSerializedKey : public AggHashMapWithKey<HashMap, AggHashMapWithSerializedKey<HashMap>> {
     using Base = AggHashMapWithKey<HashMap, AggHashMapWithSerializedKey<HashMap>>;
@@ -688,6 +841,59 @@ struct AggHashMapWithSerializedKey : public AggHashMapWithKey<HashMap, AggHashMa
             key_column->serialize_batch(buffer, slice_sizes, chunk_size, max_one_row_size);
         }
 
+        if (!this->enable_prefetch()) {
+            this->template compute_agg_noprefetch<Func, allocate_and_compute_state, compute_not_founds>(
+                    chunk_size, pool, std::forward<Func>(allocate_func), agg_states, not_founds);
+        } else {
+            this->template compute_agg_prefetch<Func, allocate_and_compute_state, compute_not_founds>(
+                    chunk_size, pool, std::forward<Func>(allocate_func), agg_states, not_founds);
+        }
+    }
+
+    // prefetch branch better performance in case with larger hash tables
+    template <typename Func, bool allocate_and_compute_state, bool compute_not_founds>
+    ALWAYS_NOINLINE void compute_agg_prefetch(size_t chunk_size, MemPool* pool, Func&& allocate_func,
+                                              Buffer<AggDataPtr>* agg_states, std::vector<uint8_t>* not_founds) {
+        // the hash values share the memory of agg_states, the i-th one is consumed before the i-th state is set.
+        size_t* hash_values = reinterpret_cast<size_t*>(agg_states->data());
+        for (size_t i = 0; i < chunk_size; ++i) {
+            hash_values[i] = this->hash_map.hash_function()(Slice{buffer + i * max_one_row_size, slice_sizes[i]});
+        }
+        this->update_pipelined_probe_rows(chunk_size);
+
+        for (size_t i = 0; i < chunk_size; ++i) {
+            if (i + this->prefetch_dist < chunk_size) {
+                this->hash_map.prefetch_hash(hash_values[i + this->prefetch_dist]);
+            }
+            Slice key = {buffer + i * max_one_row_size, slice_sizes[i]};
+            if constexpr (allocate_and_compute_state) {
+                auto iter = this->hash_map.lazy_emplace_with_hash(key, hash_values[i], [&](const auto& ctor) {
+                    if constexpr (compute_not_founds) {
+                        DCHECK(not_founds);
+                        (*not_founds)[i] = 1;
+                    }
+                    // we must persist the slice before insert
+                    uint8_t* pos = pool->allocate_with_reserve(key.size, SLICE_MEMEQUAL_OVERFLOW_PADDING);
+                    strings::memcpy_inlined(pos, key.data, key.size);
+                    Slice pk{pos, key.size};
+                    AggDataPtr pv = allocate_func(pk);
+                    ctor(pk, pv);
+                });
+                (*agg_states)[i] = iter->second;
+            } else if constexpr (compute_not_founds) {
+                DCHECK(not_founds);
+                if (auto iter = this->hash_map.find(key, hash_values[i]); iter != this->hash_map.end()) {
+                    (*agg_states)[i] = iter->second;
+                } else {
+                    (*not_founds)[i] = 1;
+                }
+            }
+        }
+    }
+
+    template <typename Func, bool allocate_and_compute_state, bool compute_not_founds>
+    ALWAYS_NOINLINE void compute_agg_noprefetch(size_t chunk_size, MemPool* pool, Func&& allocate_func,
+                                                Buffer<AggDataPtr>* agg_states, std::vector<uint8_t>* not_founds) {
         for (size_t i = 0; i < chunk_size; ++i) {
             Slice key = {buffer + i * max_one_row_size, slice_sizes[i]};
             if constexpr (allocate_and_compute_state) {
@@ -806,7 +1012,8 @@ struct AggHashMapWithSerializedKeyFixedSize
             caches[i].hashval = this->hash_map.hash_function()(caches[i].key);
         }
 
-        size_t __prefetch_index = AGG_HASH_MAP_DEFAULT_PREFETCH_DIST;
+        size_t __prefetch_index = this->prefetch_dist;
+        this->update_pipelined_probe_rows(chunk_size);
 
         for (size_t i = 0; i < chunk_size; ++i) {
             if (__prefetch_index < chunk_size) {
@@ -885,7 +1092,7 @@ struct AggHashMapWithSerializedKeyFixedSize
             memset(buffer, 0x0, max_fixed_size * chunk_size);
         }
 
-        if (this->hash_map.bucket_count() < prefetch_threhold) {
+        if (!this->enable_prefetch()) {
             this->template compute_agg_noprefetch<Func, allocate_and_compute_state, compute_not_founds>(
                     chunk_size, key_columns, agg_states, std::forward<Func>(allocate_func), not_founds);
         } else {
@@ -91,6 +91,10 @@ DEFINE_MAP_TYPE(AggHashMapVariant::Type::phase2_int32_two_level, Int32TwoLevelAg
 DEFINE_MAP_TYPE(AggHashMapVariant::Type::phase2_slice_fx4, SerializedKeyFixedSize4AggHashMap<PhmapSeed2>);
 DEFINE_MAP_TYPE(AggHashMapVariant::Type::phase2_slice_fx8, SerializedKeyFixedSize8AggHashMap<PhmapSeed2>);
 DEFINE_MAP_TYPE(AggHashMapVariant::Type::phase2_slice_fx16, SerializedKeyFixedSize16AggHashMap<PhmapSeed2>);
+DEFINE_MAP_TYPE(AggHashMapVariant::Type::phase1_inline_string, OneInlineStringAggHashMap<PhmapSeed1>);
+DEFINE_MAP_TYPE(AggHashMapVariant::Type::phase1_null_inline_string, NullOneInlineStringAggHashMap<PhmapSeed1>);
+DEFINE_MAP_TYPE(AggHashMapVariant::Type::phase2_inline_string, OneInlineStringAggHashMap<PhmapSeed2>);
+DEFINE_MAP_TYPE(AggHashMapVariant::Type::phase2_null_inline_string, NullOneInlineStringAggHashMap<PhmapSeed2>);
 
 template <AggHashSetVariant::Type>
 struct AggHashSetVariantTypeTraits;
@@ -161,8 +165,18 @@ DEFINE_SET_TYPE(AggHashSetVariant::Type::phase1_slice_fx16, SerializedKeyAggHash
 DEFINE_SET_TYPE(AggHashSetVariant::Type::phase2_slice_fx4, SerializedKeyAggHashSetFixedSize4<PhmapSeed2>);
 DEFINE_SET_TYPE(AggHashSetVariant::Type::phase2_slice_fx8, SerializedKeyAggHashSetFixedSize8<PhmapSeed2>);
 DEFINE_SET_TYPE(AggHashSetVariant::Type::phase2_slice_fx16, SerializedKeyAggHashSetFixedSize16<PhmapSeed2>);
+// the slice hash sets already cache the hash value of keys, so the inline string keys share them.
+DEFINE_SET_TYPE(AggHashSetVariant::Type::phase1_inline_string, OneStringAggHashSet<PhmapSeed1>);
+DEFINE_SET_TYPE(AggHashSetVariant::Type::phase1_null_inline_string, NullOneStringAggHashSet<PhmapSeed1>);
+DEFINE_SET_TYPE(AggHashSetVariant::Type::phase2_inline_string, OneStringAggHashSet<PhmapSeed2>);
+DEFINE_SET_TYPE(AggHashSetVariant::Type::phase2_null_inline_string, NullOneStringAggHashSet<PhmapSeed2>);
 
 } // namespace detail
+static size_t agg_hash_map_prefetch_dist(RuntimeState* state) {
+    int32_t dist = state->hash_table_prefetch_distance();
+    return dist < 0 ? AGG_HASH_MAP_DEFAULT_PREFETCH_DIST : dist;
+}
+
 void AggHashMapVariant::init(RuntimeState* state, Type type, AggStatistics* agg_stat) {
     _type = type;
     _agg_stat = agg_stat;
@@ -175,12 +189,14 @@ void AggHashMapVariant::init(RuntimeState* state, Type type, AggStatistics* agg_
         APPLY_FOR_AGG_VARIANT_ALL(M)
 #undef M
     }
+    visit([&](auto& hash_map_with_key) { hash_map_with_key->prefetch_dist = agg_hash_map_prefetch_dist(state); });
 }
 
 #define CONVERT_TO_TWO_LEVEL_MAP(DST, SRC)                                                                            \
     if (_type == AggHashMapVariant::Type::SRC) {                                                                      \
         auto dst = std::make_unique<detail::AggHashMapVariantTypeTraits<Type::DST>::HashMapWithKeyType>(              \
                 state->chunk_size(), _agg_stat);                                                                      \
+        dst->prefetch_dist = agg_hash_map_prefetch_dist(state);                                                       \
         std::visit(                                                                                                   \
                 [&](auto& hash_map_with_key) {                                                                        \
                     if constexpr (std::is_same_v<typename decltype(hash_map_with_key->hash_map)::key_type,            \
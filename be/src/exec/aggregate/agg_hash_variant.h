@@ -89,7 +89,11 @@ namespace starrocks {
     M(phase1_slice_fx16)             \
     M(phase2_slice_fx4)              \
     M(phase2_slice_fx8)              \
-    M(phase2_slice_fx16)
+    M(phase2_slice_fx16)             \
+    M(phase1_inline_string)          \
+    M(phase1_null_inline_string)     \
+    M(phase2_inline_string)          \
+    M(phase2_null_inline_string)
 
 // Aggregate Hash maps
 
@@ -151,6 +155,10 @@ using OneStringAggHashMap = AggHashMapWithOneStringKey<SliceAggHashMap<seed>>;
 template <PhmapSeed seed>
 using NullOneStringAggHashMap = AggHashMapWithOneNullableStringKey<SliceAggHashMap<seed>>;
 template <PhmapSeed seed>
+using OneInlineStringAggHashMap = AggHashMapWithOneInlineStringKey<InlineSliceAggHashMap<seed>>;
+template <PhmapSeed seed>
+using NullOneInlineStringAggHashMap = AggHashMapWithOneNullableInlineStringKey<InlineSliceAggHashMap<seed>>;
+template <PhmapSeed seed>
 using SerializedKeyAggHashMap = AggHashMapWithSerializedKey<SliceAggHashMap<seed>>;
 template <PhmapSeed seed>
 using SerializedKeyTwoLevelAggHashMap = AggHashMapWithSerializedKey<SliceAggTwoLevelHashMap<seed>>;
@@ -334,7 +342,11 @@ using AggHashMapWithKeyPtr = std::variant<
         std::unique_ptr<Int32TwoLevelAggHashMapWithOneNumberKey<PhmapSeed2>>,
         std::unique_ptr<SerializedKeyFixedSize4AggHashMap<PhmapSeed2>>,
         std::unique_ptr<SerializedKeyFixedSize8AggHashMap<PhmapSeed2>>,
-        std::unique_ptr<SerializedKeyFixedSize16AggHashMap<PhmapSeed2>>>;
+        std::unique_ptr<SerializedKeyFixedSize16AggHashMap<PhmapSeed2>>,
+        std::unique_ptr<OneInlineStringAggHashMap<PhmapSeed1>>,
+        std::unique_ptr<NullOneInlineStringAggHashMap<PhmapSeed1>>,
+        std::unique_ptr<OneInlineStringAggHashMap<PhmapSeed2>>,
+        std::unique_ptr<NullOneInlineStringAggHashMap<PhmapSeed2>>>;
 
 using AggHashSetWithKeyPtr = std::variant<
         std::unique_ptr<UInt8AggHashSetOfOneNumberKey<PhmapSeed1>>,
@@ -461,6 +473,11 @@ struct AggHashMapVariant {
         phase2_slice_fx4,
         phase2_slice_fx8,
         phase2_slice_fx16,
+
+        phase1_inline_string,
+        phase1_null_inline_string,
+        phase2_inline_string,
+        phase2_null_inline_string,
     };
 
     detail::AggHashMapWithKeyPtr hash_map_with_key;
@@ -564,6 +581,11 @@ struct AggHashSetVariant {
         phase2_slice_fx4,
         phase2_slice_fx8,
         phase2_slice_fx16,
+
+        phase1_inline_string,
+        phase1_null_inline_string,
+        phase2_inline_string,
+        phase2_null_inline_string,
     };
 
     detail::AggHashSetWithKeyPtr hash_set_with_key;
@@ -30,6 +30,7 @@ struct AggStatistics {
         expr_release_timer = ADD_TIMER(runtime_profile, "ExprReleaseTime");
         input_row_count = ADD_COUNTER(runtime_profile, "InputRowCount", TUnit::UNIT);
         hash_table_size = ADD_COUNTER(runtime_profile, "HashTableSize", TUnit::UNIT);
+        pipelined_probe_rows = ADD_COUNTER(runtime_profile, "PipelinedProbeRows", TUnit::UNIT);
         pass_through_row_count = ADD_COUNTER(runtime_profile, "PassThroughRowCount", TUnit::UNIT);
         rows_returned_counter = ADD_COUNTER(runtime_profile, "RowsReturned", TUnit::UNIT);
         state_destroy_timer = ADD_TIMER(runtime_profile, "StateDestroy");
@@ -51,6 +52,8 @@ struct AggStatistics {
     RuntimeProfile::Counter* rows_returned_counter;
     // hash table elements size
     RuntimeProfile::Counter* hash_table_size{};
+    // rows looked up in hash table with prefetches issued ahead
+    RuntimeProfile::Counter* pipelined_probe_rows{};
     // timer for iterator hash table
     RuntimeProfile::Counter* iter_timer{};
     // timer for get result from hash table
@@ -1288,6 +1288,17 @@ void Aggregator::_init_agg_hash_variant(HashVariantType& hash_variant) {
             }
         }
     }
+    if (config::enable_agg_inline_string_key) {
+        if (type == HashVariantType::Type::phase1_string) {
+            type = HashVariantType::Type::phase1_inline_string;
+        } else if (type == HashVariantType::Type::phase2_string) {
+            type = HashVariantType::Type::phase2_inline_string;
+        } else if (type == HashVariantType::Type::phase1_null_string) {
+            type = HashVariantType::Type::phase1_null_inline_string;
+        } else if (type == HashVariantType::Type::phase2_null_string) {
+            type = HashVariantType::Type::phase2_null_inline_string;
+        }
+    }
     VLOG_ROW << "hash type is "
              << static_cast<typename std::underlying_type<typename HashVariantType::Type>::type>(type);
     hash_variant.init(_state, type, _agg_stat);
@@ -37,11 +37,14 @@
 #include <thrift/protocol/TDebugProtocol.h>
 #include <unistd.h>
 
+#include <algorithm>
+#include <limits>
 #include <sstream>
 
 #include "column/column_helper.h"
 #include "column/vectorized_fwd.h"
 #include "common/compiler_util.h"
+#include "common/config.h"
 #include "common/object_pool.h"
 #include "common/status.h"
 #include "exec/aggregate/aggregate_blocking_node.h"
@@ -648,6 +651,118 @@ Status eager_prune_eval_conjuncts(const std::vector<ExprContext*>& ctxs, Chunk*
     return Status::OK();
 }
 
+// Gathers the selected rows of the columns referenced by the conjuncts `ctxs[from:]` into a compact chunk.
+// Return nullptr if these conjuncts reference none of the columns of `chunk`.
+static ChunkPtr gather_referenced_columns(const std::vector<ExprContext*>& ctxs, size_t from, const Chunk& chunk,
+                                          const Buffer<uint32_t>& indexes) {
+    std::vector<SlotId> slot_ids;
+    for (size_t i = from; i < ctxs.size(); i++) {
+        ctxs[i]->root()->get_slot_ids(&slot_ids);
+    }
+    std::sort(slot_ids.begin(), slot_ids.end());
+    slot_ids.erase(std::unique(slot_ids.begin(), slot_ids.end()), slot_ids.end());
+
+    auto compact_chunk = std::make_shared<Chunk>();
+    for (SlotId slot_id : slot_ids) {
+        if (!chunk.is_slot_exist(slot_id)) {
+            continue;
+        }
+        const ColumnPtr& column = chunk.get_column_by_slot_id(slot_id);
+        ColumnPtr compact_column = column->clone_empty();
+        compact_column->append_selective(*column, indexes.data(), 0, indexes.size());
+        compact_chunk->append_column(std::move(compact_column), slot_id);
+    }
+    return compact_chunk->num_columns() > 0 ? compact_chunk : nullptr;
+}
+
+// Like eager_prune_eval_conjuncts, but tracks the rows passing the evaluated conjuncts by a selection vector.
+// Once only a small portion of rows are selected, the remaining conjuncts are evaluated on a compact chunk which
+// only holds the selected rows of the columns referenced by them, so that the following conjuncts neither evaluate
+// the filtered rows nor copy the columns they don't reference. The columns of `chunk` are gathered only once at
+// the end, instead of being copied by `filter` after each selective conjunct.
+Status selection_vector_eval_conjuncts(const std::vector<ExprContext*>& ctxs, Chunk* chunk) {
+    const size_t num_rows = chunk->num_rows();
+    DCHECK_LE(num_rows, std::numeric_limits<uint16_t>::max());
+    const auto max_selected_rows =
+            static_cast<size_t>(num_rows * config::selection_vector_conjunct_eval_max_selectivity);
+
+    Filter filter(num_rows, 1);
+    size_t selected_rows = num_rows;
+    // The indexes of the selected rows in `chunk`, and `compact_chunk` holds the same rows in the same order.
+    std::vector<uint16_t> selection;
+    ChunkPtr compact_chunk;
+
+    for (size_t i = 0; i < ctxs.size(); i++) {
+        Chunk* input = compact_chunk != nullptr ? compact_chunk.get() : chunk;
+        ASSIGN_OR_RETURN(ColumnPtr column, ctxs[i]->evaluate(input))
+        size_t true_count = ColumnHelper::count_true_with_notnull(column);
+
+        if (true_count == column->size()) {
+            // all hit, skip
+            continue;
+        } else if (0 == true_count) {
+            // all not hit, return
+            chunk->set_num_rows(0);
+            return Status::OK();
+        }
+
+        if (compact_chunk == nullptr) {
+            ColumnHelper::merge_two_filters(column, &filter, nullptr);
+            selected_rows = num_rows - SIMD::count_zero(filter);
+            if (selected_rows == 0) {
+                chunk->set_num_rows(0);
+                return Status::OK();
+            }
+            if (i + 1 == ctxs.size() || selected_rows > max_selected_rows) {
+                continue;
+            }
+            // branchless, so that it can be vectorized.
+            selection.resize(num_rows);
+            uint16_t sel_size = 0;
+            for (uint16_t row = 0; row < num_rows; row++) {
+                selection[sel_size] = row;
+                sel_size += filter[row];
+            }
+            selection.resize(sel_size);
+            Buffer<uint32_t> indexes(selection.begin(), selection.end());
+            compact_chunk = gather_referenced_columns(ctxs, i + 1, *chunk, indexes);
+            if (compact_chunk == nullptr) {
+                // the remaining conjuncts don't reference any column, keep evaluating them on `chunk`.
+                selection.clear();
+            }
+        } else {
+            // refine the selection by the rows of the compact chunk passing this conjunct.
+            Filter compact_filter(column->size(), 1);
+            ColumnHelper::merge_two_filters(column, &compact_filter, nullptr);
+            uint16_t sel_size = 0;
+            for (size_t j = 0; j < selection.size(); j++) {
+                selection[sel_size] = selection[j];
+                sel_size += compact_filter[j];
+            }
+            selection.resize(sel_size);
+            selected_rows = sel_size;
+            if (i + 1 < ctxs.size()) {
+                compact_chunk->filter(compact_filter, true);
+            }
+        }
+    }
+
+    if (selected_rows == num_rows) {
+        return Status::OK();
+    }
+    if (compact_chunk == nullptr) {
+        chunk->filter(filter, true);
+        return Status::OK();
+    }
+    Buffer<uint32_t> indexes(selection.begin(), selection.end());
+    for (auto& column : chunk->columns()) {
+        ColumnPtr selected_column = column->clone_empty();
+        selected_column->append_selective(*column, indexes.data(), 0, indexes.size());
+        column = std::move(selected_column);
+    }
+    return Status::OK();
+}
+
 Status ExecNode::eval_conjuncts(const std::vector<ExprContext*>& ctxs, Chunk* chunk, FilterPtr* filter_ptr,
                                 bool apply_filter) {
     // No need to do expression if none rows
@@ -665,6 +780,10 @@ Status ExecNode::eval_conjuncts(const std::vector<ExprContext*>& ctxs, Chunk* ch
     // TO BE NOTED, that there is no storng evidence that this has better performance.
     // It's just by intuition.
     TRY_CATCH_ALLOC_SCOPE_START()
+    if (filter_ptr == nullptr && ctxs.size() > 1 && config::selection_vector_conjunct_eval_max_selectivity > 0 &&
+        chunk->num_rows() <= std::numeric_limits<uint16_t>::max()) {
+        return selection_vector_eval_conjuncts(ctxs, chunk);
+    }
     const int eager_prune_max_column_number = 5;
     if (filter_ptr == nullptr && chunk->num_columns() <= eager_prune_max_column_number) {
         return eager_prune_eval_conjuncts(ctxs, chunk);
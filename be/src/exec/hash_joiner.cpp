@@ -36,6 +36,7 @@ void HashJoinProbeMetrics::prepare(RuntimeProfile* runtime_profile) {
     search_ht_timer = ADD_TIMER(runtime_profile, "SearchHashTableTime");
     output_build_column_timer = ADD_TIMER(runtime_profile, "OutputBuildColumnTime");
     output_probe_column_timer = ADD_TIMER(runtime_profile, "OutputProbeColumnTime");
+    pipelined_probe_rows_counter = ADD_COUNTER(runtime_profile, "PipelinedProbeRows", TUnit::UNIT);
     probe_conjunct_evaluate_timer = ADD_TIMER(runtime_profile, "ProbeConjunctEvaluateTime");
     other_join_conjunct_evaluate_timer = ADD_TIMER(runtime_profile, "OtherJoinConjunctEvaluateTime");
     where_conjunct_evaluate_timer = ADD_TIMER(runtime_profile, "WhereConjunctEvaluateTime");
@@ -127,11 +128,13 @@ Status HashJoiner::prepare_prober(RuntimeState* state, RuntimeProfile* runtime_p
 
     auto& hash_table = _hash_join_builder->hash_table();
     hash_table.set_probe_profile(probe_metrics().search_ht_timer, probe_metrics().output_probe_column_timer,
-                                 probe_metrics().output_build_column_timer);
+                                 probe_metrics().output_build_column_timer,
+                                 probe_metrics().pipelined_probe_rows_counter);
 
     _hash_table_param.search_ht_timer = probe_metrics().search_ht_timer;
     _hash_table_param.output_build_column_timer = probe_metrics().output_build_column_timer;
     _hash_table_param.output_probe_column_timer = probe_metrics().output_probe_column_timer;
+    _hash_table_param.pipelined_probe_rows_counter = probe_metrics().pipelined_probe_rows_counter;
 
     return Status::OK();
 }
@@ -317,7 +320,8 @@ void HashJoiner::reference_hash_table(HashJoiner* src_join_builder) {
     _hash_table_param = src_join_builder->hash_table_param();
     hash_table = src_join_builder->_hash_join_builder->hash_table().clone_readable_table();
     hash_table.set_probe_profile(probe_metrics().search_ht_timer, probe_metrics().output_probe_column_timer,
-                                 probe_metrics().output_build_column_timer);
+                                 probe_metrics().output_build_column_timer,
+                                 probe_metrics().pipelined_probe_rows_counter);
 
     // _hash_table_build_rows is root truth, it used to by _short_circuit_break().
     _hash_table_build_rows = src_join_builder->_hash_table_build_rows;
@@ -142,6 +142,7 @@ struct HashJoinProbeMetrics {
     RuntimeProfile::Counter* other_join_conjunct_evaluate_timer = nullptr;
     RuntimeProfile::Counter* where_conjunct_evaluate_timer = nullptr;
     RuntimeProfile::Counter* output_build_column_timer = nullptr;
+    RuntimeProfile::Counter* pipelined_probe_rows_counter = nullptr;
 
     void prepare(RuntimeProfile* runtime_profile);
 };
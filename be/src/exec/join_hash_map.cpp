@@ -17,9 +17,11 @@
 #include <column/chunk.h>
 #include <runtime/descriptors.h>
 
+#include <algorithm>
 #include <memory>
 
 #include "column/vectorized_fwd.h"
+#include "common/config.h"
 #include "common/statusor.h"
 #include "exec/hash_join_node.h"
 #include "serde/column_array_serde.h"
@@ -73,6 +75,64 @@ void HashTableProbeState::consider_probe_time_locality() {
     ++probe_chunks;
 }
 
+void JoinHashMapHelper::lookup_bucket_heads(const JoinHashTableItems& table_items, HashTableProbeState* probe_state,
+                                            const uint8_t* is_nulls, uint32_t row_count) {
+    const auto& first = table_items.first;
+    const auto& buckets = probe_state->buckets;
+    auto& next = probe_state->next;
+
+    if (probe_state->prefetch_distance > 0) {
+        _lookup_bucket_heads_with_prefetch(table_items, probe_state, is_nulls, row_count);
+    } else if (is_nulls == nullptr) {
+        for (uint32_t i = 0; i < row_count; i++) {
+            next[i] = first[buckets[i]];
+        }
+    } else {
+        for (uint32_t i = 0; i < row_count; i++) {
+            next[i] = is_nulls[i] == 0 ? first[buckets[i]] : 0;
+        }
+    }
+}
+
+// Group prefetching in two stages: `first[buckets[i + distance]]` is prefetched while the head of the i-th row is
+// loaded, and once the head is known, the chain link and the build key it points to are prefetched, so the probe loop
+// which walks the chains right after finds them in cache instead of stalling on each row's miss in turn.
+void JoinHashMapHelper::_lookup_bucket_heads_with_prefetch(const JoinHashTableItems& table_items,
+                                                           HashTableProbeState* probe_state, const uint8_t* is_nulls,
+                                                           uint32_t row_count) {
+    const uint32_t* first = table_items.first.data();
+    const uint32_t* build_next = table_items.next.data();
+    const uint32_t* buckets = probe_state->buckets.data();
+    uint32_t* next = probe_state->next.data();
+    const uint32_t distance = probe_state->prefetch_distance;
+    const uint8_t* build_keys = probe_state->prefetch_build_keys;
+    const uint32_t key_size = probe_state->prefetch_build_key_size;
+
+    for (uint32_t i = 0; i < std::min(distance, row_count); i++) {
+        if (is_nulls == nullptr || is_nulls[i] == 0) {
+            __builtin_prefetch(first + buckets[i]);
+        }
+    }
+    for (uint32_t i = 0; i < row_count; i++) {
+        const uint32_t ahead = i + distance;
+        if (ahead < row_count && (is_nulls == nullptr || is_nulls[ahead] == 0)) {
+            __builtin_prefetch(first + buckets[ahead]);
+        }
+        if (is_nulls != nullptr && is_nulls[i] != 0) {
+            next[i] = 0;
+            continue;
+        }
+        const uint32_t head = first[buckets[i]];
+        next[i] = head;
+        if (head != 0) {
+            __builtin_prefetch(build_next + head);
+            if (build_keys != nullptr) {
+                __builtin_prefetch(build_keys + static_cast<size_t>(head) * key_size);
+            }
+        }
+    }
+}
+
 void SerializedJoinBuildFunc::prepare(RuntimeState* state, JoinHashTableItems* table_items) {
     table_items->bucket_size = JoinHashMapHelper::calc_bucket_size(table_items->row_count + 1);
     table_items->first.resize(table_items->bucket_size, 0);
@@ -134,11 +194,15 @@ void SerializedJoinBuildFunc::construct_hash_table(RuntimeState* state, JoinHash
 void SerializedJoinBuildFunc::_build_columns(JoinHashTableItems* table_items, HashTableProbeState* probe_state,
                                              const Columns& data_columns, uint32_t start, uint32_t count,
                                              uint8_t** ptr) {
+    uint8_t* row_tags = table_items->enable_linear_probing ? table_items->tags.data() : nullptr;
     for (size_t i = 0; i < count; i++) {
-        table_items->build_slice[start + i] = JoinHashMapHelper::get_hash_key(data_columns, start + i, *ptr);
-        probe_state->buckets[i] = JoinHashMapHelper::calc_bucket_num<Slice>(table_items->build_slice[start + i],
-                                                                            table_items->bucket_size);
-        *ptr += table_items->build_slice[start + i].size;
+        const Slice& key = table_items->build_slice[start + i] =
+                JoinHashMapHelper::get_hash_key(data_columns, start + i, *ptr);
+        probe_state->buckets[i] =
+                row_tags == nullptr ? JoinHashMapHelper::calc_bucket_num<Slice>(key, table_items->bucket_size)
+                                    : JoinHashMapHelper::calc_bucket_num<Slice>(key, table_items->bucket_size,
+                                                                                &row_tags[start + i]);
+        *ptr += key.size;
     }
 
     for (size_t i = 0; i < count; i++) {
@@ -159,12 +223,16 @@ void SerializedJoinBuildFunc::_build_nullable_columns(JoinHashTableItems* table_
         }
     }
 
+    uint8_t* row_tags = table_items->enable_linear_probing ? table_items->tags.data() : nullptr;
     for (size_t i = 0; i < count; i++) {
         if (probe_state->is_nulls[i] == 0) {
-            table_items->build_slice[start + i] = JoinHashMapHelper::get_hash_key(data_columns, start + i, *ptr);
-            probe_state->buckets[i] = JoinHashMapHelper::calc_bucket_num<Slice>(table_items->build_slice[start + i],
-                                                                                table_items->bucket_size);
-            *ptr += table_items->build_slice[start + i].size;
+            const Slice& key = table_items->build_slice[start + i] =
+                    JoinHashMapHelper::get_hash_key(data_columns, start + i, *ptr);
+            probe_state->buckets[i] =
+                    row_tags == nullptr ? JoinHashMapHelper::calc_bucket_num<Slice>(key, table_items->bucket_size)
+                                        : JoinHashMapHelper::calc_bucket_num<Slice>(key, table_items->bucket_size,
+                                                                                    &row_tags[start + i]);
+            *ptr += key.size;
         }
     }
 
@@ -220,16 +288,18 @@ void SerializedJoinProbeFunc::_probe_column(const JoinHashTableItems& table_item
                                             const Columns& data_columns, uint8_t* ptr) {
     uint32_t row_count = probe_state->probe_row_count;
 
+    uint8_t* tags = table_items.enable_linear_probing ? probe_state->tags.data() : nullptr;
     for (uint32_t i = 0; i < row_count; i++) {
         probe_state->probe_slice[i] = JoinHashMapHelper::get_hash_key(data_columns, i, ptr);
         probe_state->buckets[i] =
-                JoinHashMapHelper::calc_bucket_num<Slice>(probe_state->probe_slice[i], table_items.bucket_size);
+                tags == nullptr ? JoinHashMapHelper::calc_bucket_num<Slice>(probe_state->probe_slice[i],
+                                                                            table_items.bucket_size)
+                                : JoinHashMapHelper::calc_bucket_num<Slice>(probe_state->probe_slice[i],
+                                                                            table_items.bucket_size, &tags[i]);
         ptr += probe_state->probe_slice[i].size;
     }
 
-    for (uint32_t i = 0; i < row_count; i++) {
-        probe_state->next[i] = table_items.first[probe_state->buckets[i]];
-    }
+    JoinHashMapHelper::lookup_bucket_heads(table_items, probe_state, nullptr, row_count);
 }
 
 void SerializedJoinProbeFunc::_probe_nullable_column(const JoinHashTableItems& table_items,
@@ -254,15 +324,17 @@ void SerializedJoinProbeFunc::_probe_nullable_column(const JoinHashTableItems& t
         }
     }
 
+    uint8_t* tags = table_items.enable_linear_probing ? probe_state->tags.data() : nullptr;
     for (uint32_t i = 0; i < row_count; i++) {
         if (probe_state->is_nulls[i] == 0) {
             probe_state->buckets[i] =
-                    JoinHashMapHelper::calc_bucket_num<Slice>(probe_state->probe_slice[i], table_items.bucket_size);
-            probe_state->next[i] = table_items.first[probe_state->buckets[i]];
-        } else {
-            probe_state->next[i] = 0;
+                    tags == nullptr ? JoinHashMapHelper::calc_bucket_num<Slice>(probe_state->probe_slice[i],
+                                                                                table_items.bucket_size)
+                                    : JoinHashMapHelper::calc_bucket_num<Slice>(probe_state->probe_slice[i],
+                                                                                table_items.bucket_size, &tags[i]);
         }
     }
+    JoinHashMapHelper::lookup_bucket_heads(table_items, probe_state, probe_state->is_nulls.data(), row_count);
 }
 
 template <LogicalType LT, class BuildFunc, class ProbeFunc>
@@ -303,11 +375,13 @@ JoinHashTable JoinHashTable::clone_readable_table() {
 
 void JoinHashTable::set_probe_profile(RuntimeProfile::Counter* search_ht_timer,
                                       RuntimeProfile::Counter* output_probe_column_timer,
-                                      RuntimeProfile::Counter* output_build_column_timer) {
+                                      RuntimeProfile::Counter* output_build_column_timer,
+                                      RuntimeProfile::Counter* pipelined_probe_rows_counter) {
     if (_probe_state == nullptr) return;
     _probe_state->search_ht_timer = search_ht_timer;
     _probe_state->output_probe_column_timer = output_probe_column_timer;
     _probe_state->output_build_column_timer = output_build_column_timer;
+    _probe_state->pipelined_probe_rows_counter = pipelined_probe_rows_counter;
 }
 
 float JoinHashTable::get_keys_per_bucket() const {
@@ -329,6 +403,7 @@ void JoinHashTable::create(const HashTableParam& param) {
         _probe_state->search_ht_timer = param.search_ht_timer;
         _probe_state->output_probe_column_timer = param.output_probe_column_timer;
         _probe_state->output_build_column_timer = param.output_build_column_timer;
+        _probe_state->pipelined_probe_rows_counter = param.pipelined_probe_rows_counter;
     }
 
     _table_items->build_chunk = std::make_shared<Chunk>();
@@ -524,6 +599,7 @@ int64_t JoinHashTable::mem_usage() const {
     }
     usage += _table_items->first.capacity() * sizeof(uint32_t);
     usage += _table_items->next.capacity() * sizeof(uint32_t);
+    usage += _table_items->tags.capacity();
     if (_table_items->build_pool != nullptr) {
         usage += _table_items->build_pool->total_reserved_bytes();
     }
@@ -552,6 +628,8 @@ Status JoinHashTable::build(RuntimeState* state) {
 
     RETURN_IF_ERROR(_upgrade_key_columns_if_overflow());
 
+    // decide it once here, so that reset_probe_state() always chooses the same hash map as the built one.
+    _table_items->enable_linear_probing = _need_linear_probing();
     _hash_map_type = _choose_join_hash_map();
 
     switch (_hash_map_type) {
@@ -560,7 +638,7 @@ Status JoinHashTable::build(RuntimeState* state) {
         _##NAME = std::make_unique<typename decltype(_##NAME)::element_type>(_table_items.get(), _probe_state.get()); \
         _##NAME->build_prepare(state);                                                                                \
         _##NAME->probe_prepare(state);                                                                                \
-        _##NAME->build(state);                                                                                        \
+        RETURN_IF_ERROR(_##NAME->build(state));                                                                       \
         break;
         APPLY_FOR_JOIN_VARIANTS(M)
 #undef M
@@ -730,6 +808,34 @@ Status JoinHashTable::_upgrade_key_columns_if_overflow() {
 }
 
 JoinHashMapType JoinHashTable::_choose_join_hash_map() {
+    JoinHashMapType type = _choose_chained_join_hash_map();
+    if (!_table_items->enable_linear_probing) {
+        return type;
+    }
+    switch (type) {
+    case JoinHashMapType::key32:
+        return JoinHashMapType::linear_key32;
+    case JoinHashMapType::key64:
+        return JoinHashMapType::linear_key64;
+    case JoinHashMapType::fixed64:
+        return JoinHashMapType::linear_fixed64;
+    case JoinHashMapType::fixed128:
+        return JoinHashMapType::linear_fixed128;
+    case JoinHashMapType::slice:
+        return JoinHashMapType::linear_slice;
+    default:
+        return type;
+    }
+}
+
+bool JoinHashTable::_need_linear_probing() const {
+    const int64_t min_rows = config::hash_join_linear_probing_min_rows;
+    // keep the load factor not larger than 0.5 with the maximum slot size
+    return min_rows >= 0 && _table_items->row_count >= min_rows &&
+           _table_items->row_count < LinearProbingHelper::kMaxSlotSize / 2;
+}
+
+JoinHashMapType JoinHashTable::_choose_chained_join_hash_map() {
     if (_table_items->row_count == 0) {
         return JoinHashMapType::empty;
     }
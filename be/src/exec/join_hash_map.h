@@ -58,7 +58,12 @@ class ColumnRef;
     M(slice)                       \
     M(fixed32)                     \
     M(fixed64)                     \
-    M(fixed128)
+    M(fixed128)                    \
+    M(linear_key32)                \
+    M(linear_key64)                \
+    M(linear_fixed64)              \
+    M(linear_fixed128)             \
+    M(linear_slice)
 
 enum class JoinHashMapType {
     empty,
@@ -79,8 +84,14 @@ enum class JoinHashMapType {
     keydecimal128,
     slice,
     fixed32, // 4 bytes
-    fixed64, // 8 bytes
-    fixed128 // 16 bytes
+    fixed64,  // 8 bytes
+    fixed128, // 16 bytes
+    // The linear probing variants of key32, key64, fixed64, fixed128 and slice, see LinearProbingJoinBuildFunc.
+    linear_key32,
+    linear_key64,
+    linear_fixed64,
+    linear_fixed128,
+    linear_slice
 };
 
 enum class JoinMatchFlag { NORMAL, ALL_NOT_MATCH, ALL_MATCH_ONE, MOST_MATCH_ONE };
@@ -112,6 +123,9 @@ struct JoinHashTableItems {
     // about the bucket-chained hash table of this kind.
     Buffer<uint32_t> first;
     Buffer<uint32_t> next;
+    // Only used by the linear probing hash maps, see LinearProbingHelper. While the chained hash table is built, it
+    // holds the tag of each build row instead, see LinearProbingJoinBuildFunc.
+    Buffer<uint8_t> tags;
     Buffer<Slice> build_slice;
     ColumnPtr build_key_column = nullptr;
     uint32_t bucket_size = 0;
@@ -131,6 +145,9 @@ struct JoinHashTableItems {
     bool cache_miss_serious = false;
     bool mor_reader_mode = false;
     bool enable_late_materialization = false;
+    // The fixed-size and slice keys are stored in open-addressing slots with 1-byte tags instead of bucket chains.
+    // It's decided once the build side is complete, see JoinHashTable::_need_linear_probing().
+    bool enable_linear_probing = false;
 
     float get_keys_per_bucket() const { return keys_per_bucket; }
     bool ht_cache_miss_serious() const { return cache_miss_serious; }
@@ -161,8 +178,17 @@ struct HashTableProbeState {
     //TODO: memory release
     Buffer<uint8_t> is_nulls;
     Buffer<uint32_t> buckets;
+    // the tag of the key of buckets[i], only used by the linear probing hash maps.
+    Buffer<uint8_t> tags;
     Buffer<uint32_t> next;
     Buffer<Slice> probe_slice;
+    // used by the software-pipelined lookup, 0 means looking up the bucket heads one after another.
+    // Otherwise the bucket head of the row `prefetch_distance` rows ahead is prefetched before it's dereferenced,
+    // and the chain link and the build key of each head are prefetched before the probe loop walks them.
+    // prefetch_build_keys is null if the build keys are slices, whose serialized data is not prefetched.
+    uint32_t prefetch_distance = 0;
+    const uint8_t* prefetch_build_keys = nullptr;
+    uint32_t prefetch_build_key_size = 0;
     Buffer<uint8_t>* null_array = nullptr;
     ColumnPtr probe_key_column;
     const Columns* key_columns = nullptr;
@@ -197,6 +223,7 @@ struct HashTableProbeState {
     RuntimeProfile::Counter* search_ht_timer = nullptr;
     RuntimeProfile::Counter* output_probe_column_timer = nullptr;
     RuntimeProfile::Counter* output_build_column_timer = nullptr;
+    RuntimeProfile::Counter* pipelined_probe_rows_counter = nullptr;
 
     HashTableProbeState()
             : build_index_column(UInt32Column::create()),
@@ -256,7 +283,8 @@ struct HashTableProbeState {
               cur_row_match_count(rhs.cur_row_match_count),
               probe_pool(rhs.probe_pool == nullptr ? nullptr : std::make_unique<MemPool>()),
               search_ht_timer(rhs.search_ht_timer),
-              output_probe_column_timer(rhs.output_probe_column_timer) {}
+              output_probe_column_timer(rhs.output_probe_column_timer),
+              pipelined_probe_rows_counter(rhs.pipelined_probe_rows_counter) {}
 
     // Disable copy assignment.
     HashTableProbeState& operator=(const HashTableProbeState& rhs) = delete;
@@ -288,6 +316,7 @@ struct HashTableParam {
     RuntimeProfile::Counter* search_ht_timer = nullptr;
     RuntimeProfile::Counter* output_build_column_timer = nullptr;
     RuntimeProfile::Counter* output_probe_column_timer = nullptr;
+    RuntimeProfile::Counter* pipelined_probe_rows_counter = nullptr;
     bool mor_reader_mode = false;
 };
 
@@ -325,6 +354,76 @@ struct JoinKeyHash<Slice> {
     std::size_t operator()(const Slice& slice) const { return crc_hash_32(slice.data, slice.size, CRC_SEED); }
 };
 
+// The open addressing layout used by the linear probing join hash maps. A slot of `first` holds the head row of a
+// distinct key instead of the head row of a bucket, and `next` only links the rows with the same key, so following
+// `next` never compares keys. Each slot has a 1-byte tag derived from the hash in `tags`, and 0 means empty.
+// The tags are checked kTagGroupSize at a time with SIMD, and the first kTagGroupSize - 1 tags are cloned at the
+// tail, so that a group can be loaded from any slot without wrapping around.
+class LinearProbingHelper {
+public:
+    static constexpr uint32_t kTagGroupSize = 16;
+    static constexpr uint32_t kMaxSlotSize = 1U << 31;
+    // returned by find_slot() if the key is neither found nor insertable after visiting all the slots.
+    static constexpr uint32_t kNoSlot = UINT32_MAX;
+
+    // The number of slots for `size` distinct keys at most, which keeps the load factor not larger than 0.5, so that
+    // the probe sequences stay short. It is a power of 2, and is the bucket size of the linear probing hash maps.
+    static uint32_t calc_slot_size(uint32_t size) {
+        const size_t expect_slot_size = std::max<size_t>(static_cast<size_t>(size) * 2, kTagGroupSize);
+        if (expect_slot_size >= kMaxSlotSize) {
+            return kMaxSlotSize;
+        }
+        return phmap::priv::NormalizeCapacity(expect_slot_size - 1) + 1;
+    }
+
+    // The low log2(slot_size) bits of the hash decide the home slot, so take the tag from the bits just above them.
+    static uint8_t tag(size_t hash, uint32_t slot_size) {
+        return static_cast<uint8_t>(hash >> __builtin_ctz(slot_size)) | 0x80;
+    }
+
+    static void set_tag(Buffer<uint8_t>* tags, uint32_t slot_size, uint32_t slot, uint8_t tag) {
+        (*tags)[slot] = tag;
+        if (slot < kTagGroupSize - 1) {
+            (*tags)[slot_size + slot] = tag;
+        }
+    }
+
+    // Find the slot of the key from its home slot. `equal(row)` tells whether the key of the row is the searched one.
+    // Returns the slot holding the key and sets *found to true, or returns the first empty slot where the key could
+    // be inserted and sets *found to false. The probe stops after all the slots are visited, and then kNoSlot is
+    // returned, which only happens if the table is full.
+    template <class Equal>
+    static uint32_t find_slot(const uint8_t* tags, const uint32_t* first, uint32_t slot_size, uint32_t home,
+                              uint8_t tag, const Equal& equal, bool* found) {
+        const uint32_t mask = slot_size - 1;
+        const uint32_t max_groups = slot_size / kTagGroupSize;
+        uint32_t pos = home;
+        for (uint32_t group = 0; group < max_groups; group++) {
+            const uint32_t empty = SIMD::match_byte16(tags + pos, 0);
+            uint32_t matched = SIMD::match_byte16(tags + pos, tag);
+            if (empty != 0) {
+                // the key cannot be placed after the first empty slot
+                matched &= (empty & (~empty + 1)) - 1;
+            }
+            while (matched != 0) {
+                const uint32_t slot = (pos + __builtin_ctz(matched)) & mask;
+                if (equal(first[slot])) {
+                    *found = true;
+                    return slot;
+                }
+                matched &= matched - 1;
+            }
+            if (empty != 0) {
+                *found = false;
+                return (pos + __builtin_ctz(empty)) & mask;
+            }
+            pos = (pos + kTagGroupSize) & mask;
+        }
+        *found = false;
+        return kNoSlot;
+    }
+};
+
 class JoinHashMapHelper {
 public:
     // maxinum bucket size
@@ -346,14 +445,37 @@ public:
         return HashFunc()(value) & (bucket_size - 1);
     }
 
+    // Also output the tag of the key in the linear probing hash maps, which comes from the same hash as the bucket.
+    template <typename CppType>
+    static uint32_t calc_bucket_num(const CppType& value, uint32_t bucket_size, uint8_t* tag) {
+        using HashFunc = JoinKeyHash<CppType>;
+
+        const size_t hash = HashFunc()(value);
+        *tag = LinearProbingHelper::tag(hash, bucket_size);
+        return hash & (bucket_size - 1);
+    }
+
+    // If `tags` is not null, tags[i] is set to the tag of the key of buckets[i], see LinearProbingHelper.
     template <typename CppType>
     static void calc_bucket_nums(const Buffer<CppType>& data, uint32_t bucket_size, Buffer<uint32_t>* buckets,
-                                 uint32_t start, uint32_t count) {
+                                 uint32_t start, uint32_t count, uint8_t* tags = nullptr) {
+        if (tags != nullptr) {
+            for (size_t i = 0; i < count; i++) {
+                (*buckets)[i] = calc_bucket_num<CppType>(data[start + i], bucket_size, &tags[i]);
+            }
+            return;
+        }
         for (size_t i = 0; i < count; i++) {
             (*buckets)[i] = calc_bucket_num<CppType>(data[start + i], bucket_size);
         }
     }
 
+    // Set probe_state->next[i] to the head of the bucket of the i-th probe row.
+    // The rows whose is_nulls[i] is not 0 are skipped and get 0, and `is_nulls` can be null if there is no null.
+    // If probe_state->prefetch_distance is not 0, the lookups are software-pipelined with prefetches.
+    static void lookup_bucket_heads(const JoinHashTableItems& table_items, HashTableProbeState* probe_state,
+                                    const uint8_t* is_nulls, uint32_t row_count);
+
     static Slice get_hash_key(const Columns& key_columns, size_t row_idx, uint8_t* buffer) {
         size_t byte_size = 0;
         for (const auto& key_column : key_columns) {
@@ -379,6 +501,11 @@ public:
             byte_offset += offset;
         }
     }
+
+private:
+    static void _lookup_bucket_heads_with_prefetch(const JoinHashTableItems& table_items,
+                                                   HashTableProbeState* probe_state, const uint8_t* is_nulls,
+                                                   uint32_t row_count);
 };
 
 template <LogicalType LT>
@@ -516,6 +643,39 @@ private:
                                        const Columns& data_columns, const NullColumns& null_columns, uint8_t* ptr);
 };
 
+// Build the chained hash table by BaseBuildFunc first, which takes care of key serialization and null keys, and then
+// convert the chains to the linear probing layout. The bucket size is the slot size, so the bucket of a key in the
+// chained table is its home slot, and the tag of each row is computed along with its bucket.
+template <LogicalType LT, class BaseBuildFunc>
+class LinearProbingJoinBuildFunc {
+public:
+    using CppType = typename RunTimeTypeTraits<LT>::CppType;
+
+    static void prepare(RuntimeState* state, JoinHashTableItems* table_items);
+    static const Buffer<CppType>& get_key_data(const JoinHashTableItems& table_items) {
+        return BaseBuildFunc::get_key_data(table_items);
+    }
+    static Status construct_hash_table(RuntimeState* state, JoinHashTableItems* table_items,
+                                       HashTableProbeState* probe_state);
+};
+
+template <LogicalType LT, class BaseBuildFunc, class BaseProbeFunc>
+class LinearProbingJoinProbeFunc {
+public:
+    using CppType = typename RunTimeTypeTraits<LT>::CppType;
+
+    static void prepare(RuntimeState* state, HashTableProbeState* probe_state) {
+        BaseProbeFunc::prepare(state, probe_state);
+        probe_state->tags.resize(state->chunk_size());
+    }
+    static void lookup_init(const JoinHashTableItems& table_items, HashTableProbeState* probe_state);
+    static const Buffer<CppType>& get_key_data(const HashTableProbeState& probe_state) {
+        return BaseProbeFunc::get_key_data(probe_state);
+    }
+    // `next` only links the rows with the same key, and lookup_init() has compared the key of the head row.
+    static bool equal(const CppType& x, const CppType& y) { return true; }
+};
+
 // When hash table is empty, specific its implemention.
 // TODO: Merge with JoinHashMap?
 class JoinHashMapForEmpty {
@@ -525,7 +685,7 @@ public:
 
     void build_prepare(RuntimeState* state) {}
     void probe_prepare(RuntimeState* state) {}
-    void build(RuntimeState* state) {}
+    Status build(RuntimeState* state) { return Status::OK(); }
     void probe(RuntimeState* state, const Columns& key_columns, ChunkPtr* probe_chunk, ChunkPtr* chunk,
                bool* has_remain) {
         DCHECK_EQ(0, _table_items->row_count);
@@ -662,7 +822,7 @@ public:
     void build_prepare(RuntimeState* state);
     void probe_prepare(RuntimeState* state);
 
-    void build(RuntimeState* state);
+    Status build(RuntimeState* state);
     void probe(RuntimeState* state, const Columns& key_columns, ChunkPtr* probe_chunk, ChunkPtr* chunk,
                bool* has_remain);
     void probe_remain(RuntimeState* state, ChunkPtr* chunk, bool* has_remain);
@@ -691,6 +851,8 @@ private:
     void _build_index_output(ChunkPtr* chunk);
 
     void _search_ht(RuntimeState* state, ChunkPtr* probe_chunk);
+    // decide whether the bucket heads of this probe chunk are looked up by the software-pipelined path
+    void _prepare_pipelined_probe(RuntimeState* state, const Buffer<CppType>& build_data);
     void _search_ht_remain(RuntimeState* state);
 
     template <bool first_probe>
@@ -799,6 +961,13 @@ private:
 #define JoinHashMapForDirectMapping(LT) JoinHashMap<LT, DirectMappingJoinBuildFunc<LT>, DirectMappingJoinProbeFunc<LT>>
 #define JoinHashMapForFixedSizeKey(LT) JoinHashMap<LT, FixedSizeJoinBuildFunc<LT>, FixedSizeJoinProbeFunc<LT>>
 #define JoinHashMapForSerializedKey(LT) JoinHashMap<LT, SerializedJoinBuildFunc, SerializedJoinProbeFunc>
+#define JoinHashMapForLinearProbing(LT, BuildFunc, ProbeFunc) \
+    JoinHashMap<LT, LinearProbingJoinBuildFunc<LT, BuildFunc>, LinearProbingJoinProbeFunc<LT, BuildFunc, ProbeFunc>>
+#define JoinHashMapForLinearProbingOneKey(LT) JoinHashMapForLinearProbing(LT, JoinBuildFunc<LT>, JoinProbeFunc<LT>)
+#define JoinHashMapForLinearProbingFixedSizeKey(LT) \
+    JoinHashMapForLinearProbing(LT, FixedSizeJoinBuildFunc<LT>, FixedSizeJoinProbeFunc<LT>)
+#define JoinHashMapForLinearProbingSerializedKey(LT) \
+    JoinHashMapForLinearProbing(LT, SerializedJoinBuildFunc, SerializedJoinProbeFunc)
 
 class JoinHashTable {
 public:
@@ -816,7 +985,8 @@ public:
     // and the different probe state from this.
     JoinHashTable clone_readable_table();
     void set_probe_profile(RuntimeProfile::Counter* search_ht_timer, RuntimeProfile::Counter* output_probe_column_timer,
-                           RuntimeProfile::Counter* output_build_column_timer);
+                           RuntimeProfile::Counter* output_build_column_timer,
+                           RuntimeProfile::Counter* pipelined_probe_rows_counter);
 
     void create(const HashTableParam& param);
     void close();
@@ -853,6 +1023,8 @@ private:
     void _init_join_keys();
 
     JoinHashMapType _choose_join_hash_map();
+    JoinHashMapType _choose_chained_join_hash_map();
+    bool _need_linear_probing() const;
     static size_t _get_size_of_fixed_and_contiguous_type(LogicalType data_type);
 
     Status _upgrade_key_columns_if_overflow();
@@ -885,6 +1057,11 @@ private:
     std::unique_ptr<JoinHashMapForFixedSizeKey(TYPE_INT)> _fixed32 = nullptr;
     std::unique_ptr<JoinHashMapForFixedSizeKey(TYPE_BIGINT)> _fixed64 = nullptr;
     std::unique_ptr<JoinHashMapForFixedSizeKey(TYPE_LARGEINT)> _fixed128 = nullptr;
+    std::unique_ptr<JoinHashMapForLinearProbingOneKey(TYPE_INT)> _linear_key32 = nullptr;
+    std::unique_ptr<JoinHashMapForLinearProbingOneKey(TYPE_BIGINT)> _linear_key64 = nullptr;
+    std::unique_ptr<JoinHashMapForLinearProbingFixedSizeKey(TYPE_BIGINT)> _linear_fixed64 = nullptr;
+    std::unique_ptr<JoinHashMapForLinearProbingFixedSizeKey(TYPE_LARGEINT)> _linear_fixed128 = nullptr;
+    std::unique_ptr<JoinHashMapForLinearProbingSerializedKey(TYPE_VARCHAR)> _linear_slice = nullptr;
 
     JoinHashMapType _hash_map_type = JoinHashMapType::empty;
 
@@ -54,19 +54,25 @@ template <LogicalType LT>
 void JoinBuildFunc<LT>::construct_hash_table(RuntimeState* state, JoinHashTableItems* table_items,
                                              HashTableProbeState* probe_state) {
     auto& data = get_key_data(*table_items);
+    uint8_t* row_tags = table_items->enable_linear_probing ? table_items->tags.data() : nullptr;
+    auto calc_bucket_num = [&](size_t i) {
+        return row_tags == nullptr
+                       ? JoinHashMapHelper::calc_bucket_num<CppType>(data[i], table_items->bucket_size)
+                       : JoinHashMapHelper::calc_bucket_num<CppType>(data[i], table_items->bucket_size, &row_tags[i]);
+    };
     if (table_items->key_columns[0]->is_nullable()) {
         auto* nullable_column = ColumnHelper::as_raw_column<NullableColumn>(table_items->key_columns[0]);
         auto& null_array = nullable_column->null_column()->get_data();
         for (size_t i = 1; i < table_items->row_count + 1; i++) {
             if (null_array[i] == 0) {
-                uint32_t bucket_num = JoinHashMapHelper::calc_bucket_num<CppType>(data[i], table_items->bucket_size);
+                uint32_t bucket_num = calc_bucket_num(i);
                 table_items->next[i] = table_items->first[bucket_num];
                 table_items->first[bucket_num] = i;
             }
         }
     } else {
         for (size_t i = 1; i < table_items->row_count + 1; i++) {
-            uint32_t bucket_num = JoinHashMapHelper::calc_bucket_num<CppType>(data[i], table_items->bucket_size);
+            uint32_t bucket_num = calc_bucket_num(i);
             table_items->next[i] = table_items->first[bucket_num];
             table_items->first[bucket_num] = i;
         }
@@ -177,7 +183,9 @@ void FixedSizeJoinBuildFunc<LT>::_build_columns(JoinHashTableItems* table_items,
                                                            count);
 
     const auto& data = get_key_data(*table_items);
-    JoinHashMapHelper::calc_bucket_nums<CppType>(data, table_items->bucket_size, &probe_state->buckets, start, count);
+    uint8_t* row_tags = table_items->enable_linear_probing ? table_items->tags.data() + start : nullptr;
+    JoinHashMapHelper::calc_bucket_nums<CppType>(data, table_items->bucket_size, &probe_state->buckets, start, count,
+                                                 row_tags);
 
     for (uint32_t i = 0; i < count; i++) {
         table_items->next[start + i] = table_items->first[probe_state->buckets[i]];
@@ -202,7 +210,9 @@ void FixedSizeJoinBuildFunc<LT>::_build_nullable_columns(JoinHashTableItems* tab
     JoinHashMapHelper::serialize_fixed_size_key_column<LT>(data_columns, table_items->build_key_column.get(), start,
                                                            count);
     const auto& data = get_key_data(*table_items);
-    JoinHashMapHelper::calc_bucket_nums<CppType>(data, table_items->bucket_size, &probe_state->buckets, start, count);
+    uint8_t* row_tags = table_items->enable_linear_probing ? table_items->tags.data() + start : nullptr;
+    JoinHashMapHelper::calc_bucket_nums<CppType>(data, table_items->bucket_size, &probe_state->buckets, start, count,
+                                                 row_tags);
 
     for (size_t i = 0; i < count; i++) {
         if (probe_state->is_nulls[i] == 0) {
@@ -263,34 +273,26 @@ template <LogicalType LT>
 void JoinProbeFunc<LT>::lookup_init(const JoinHashTableItems& table_items, HashTableProbeState* probe_state) {
     size_t probe_row_count = probe_state->probe_row_count;
     auto& data = get_key_data(*probe_state);
-    JoinHashMapHelper::calc_bucket_nums<CppType>(data, table_items.bucket_size, &probe_state->buckets, 0, data.size());
+    uint8_t* tags = table_items.enable_linear_probing ? probe_state->tags.data() : nullptr;
+    JoinHashMapHelper::calc_bucket_nums<CppType>(data, table_items.bucket_size, &probe_state->buckets, 0, data.size(),
+                                                 tags);
 
     if ((*probe_state->key_columns)[0]->is_nullable()) {
         auto* nullable_column = ColumnHelper::as_raw_column<NullableColumn>((*probe_state->key_columns)[0]);
 
         if (nullable_column->has_null()) {
             auto& null_array = nullable_column->null_column()->get_data();
-            for (size_t i = 0; i < probe_row_count; i++) {
-                if (null_array[i] == 0) {
-                    probe_state->next[i] = table_items.first[probe_state->buckets[i]];
-                } else {
-                    probe_state->next[i] = 0;
-                }
-            }
+            JoinHashMapHelper::lookup_bucket_heads(table_items, probe_state, null_array.data(), probe_row_count);
             probe_state->null_array = &nullable_column->null_column()->get_data();
         } else {
-            for (size_t i = 0; i < probe_row_count; i++) {
-                probe_state->next[i] = table_items.first[probe_state->buckets[i]];
-            }
+            JoinHashMapHelper::lookup_bucket_heads(table_items, probe_state, nullptr, probe_row_count);
             probe_state->null_array = nullptr;
         }
         probe_state->consider_probe_time_locality();
         return;
     }
 
-    for (size_t i = 0; i < probe_row_count; i++) {
-        probe_state->next[i] = table_items.first[probe_state->buckets[i]];
-    }
+    JoinHashMapHelper::lookup_bucket_heads(table_items, probe_state, nullptr, probe_row_count);
     probe_state->consider_probe_time_locality();
     probe_state->null_array = nullptr;
 }
@@ -349,11 +351,11 @@ void FixedSizeJoinProbeFunc<LT>::_probe_column(const JoinHashTableItems& table_i
     JoinHashMapHelper::serialize_fixed_size_key_column<LT>(data_columns, probe_state->probe_key_column.get(), 0,
                                                            row_count);
     const auto& data = get_key_data(*probe_state);
-    JoinHashMapHelper::calc_bucket_nums<CppType>(data, table_items.bucket_size, &probe_state->buckets, 0, row_count);
+    uint8_t* tags = table_items.enable_linear_probing ? probe_state->tags.data() : nullptr;
+    JoinHashMapHelper::calc_bucket_nums<CppType>(data, table_items.bucket_size, &probe_state->buckets, 0, row_count,
+                                                 tags);
 
-    for (uint32_t i = 0; i < row_count; i++) {
-        probe_state->next[i] = table_items.first[probe_state->buckets[i]];
-    }
+    JoinHashMapHelper::lookup_bucket_heads(table_items, probe_state, nullptr, row_count);
 }
 
 template <LogicalType LT>
@@ -375,14 +377,81 @@ void FixedSizeJoinProbeFunc<LT>::_probe_nullable_column(const JoinHashTableItems
     JoinHashMapHelper::serialize_fixed_size_key_column<LT>(data_columns, probe_state->probe_key_column.get(), 0,
                                                            row_count);
     const auto& data = get_key_data(*probe_state);
-    JoinHashMapHelper::calc_bucket_nums<CppType>(data, table_items.bucket_size, &probe_state->buckets, 0, row_count);
+    uint8_t* tags = table_items.enable_linear_probing ? probe_state->tags.data() : nullptr;
+    JoinHashMapHelper::calc_bucket_nums<CppType>(data, table_items.bucket_size, &probe_state->buckets, 0, row_count,
+                                                 tags);
 
+    JoinHashMapHelper::lookup_bucket_heads(table_items, probe_state, probe_state->is_nulls.data(), row_count);
+}
+
+template <LogicalType LT, class BaseBuildFunc>
+void LinearProbingJoinBuildFunc<LT, BaseBuildFunc>::prepare(RuntimeState* state, JoinHashTableItems* table_items) {
+    BaseBuildFunc::prepare(state, table_items);
+    // a slot holds a distinct key, so row_count + 1 slots are enough, and size them for the load factor.
+    table_items->bucket_size = LinearProbingHelper::calc_slot_size(table_items->row_count + 1);
+    table_items->first.resize(table_items->bucket_size, 0);
+    // the tag of each row, filled by BaseBuildFunc::construct_hash_table() along with the buckets.
+    table_items->tags.resize(table_items->row_count + 1);
+}
+
+template <LogicalType LT, class BaseBuildFunc>
+Status LinearProbingJoinBuildFunc<LT, BaseBuildFunc>::construct_hash_table(RuntimeState* state,
+                                                                           JoinHashTableItems* table_items,
+                                                                           HashTableProbeState* probe_state) {
+    BaseBuildFunc::construct_hash_table(state, table_items, probe_state);
+
+    const auto& data = get_key_data(*table_items);
+    const uint32_t slot_size = table_items->bucket_size;
+    Buffer<uint8_t> row_tags;
+    row_tags.swap(table_items->tags);
+    Buffer<uint32_t> first(slot_size, 0);
+    Buffer<uint32_t> next(table_items->row_count + 1, 0);
+    table_items->tags.assign(slot_size + LinearProbingHelper::kTagGroupSize - 1, 0);
+
+    // The rows of a chain have the same home slot, which is the bucket of the chain.
+    for (uint32_t bucket = 0; bucket < slot_size; bucket++) {
+        for (uint32_t i = table_items->first[bucket]; i != 0; i = table_items->next[i]) {
+            const uint8_t tag = row_tags[i];
+            bool found = false;
+            const uint32_t slot = LinearProbingHelper::find_slot(
+                    table_items->tags.data(), first.data(), slot_size, bucket, tag,
+                    [&](uint32_t row) { return data[row] == data[i]; }, &found);
+            if (UNLIKELY(slot == LinearProbingHelper::kNoSlot)) {
+                return Status::InternalError(
+                        fmt::format("linear probing hash table of hash join is full, slot size: {}", slot_size));
+            }
+            if (!found) {
+                LinearProbingHelper::set_tag(&table_items->tags, slot_size, slot, tag);
+            }
+            next[i] = first[slot];
+            first[slot] = i;
+        }
+    }
+
+    table_items->first.swap(first);
+    table_items->next.swap(next);
+    return Status::OK();
+}
+
+template <LogicalType LT, class BaseBuildFunc, class BaseProbeFunc>
+void LinearProbingJoinProbeFunc<LT, BaseBuildFunc, BaseProbeFunc>::lookup_init(const JoinHashTableItems& table_items,
+                                                                               HashTableProbeState* probe_state) {
+    // BaseProbeFunc serializes the probe keys, computes the home slots to `buckets` and the tags to `tags`, and sets
+    // `next` to the row of the home slot, or 0 if the key is null or the home slot is empty.
+    BaseProbeFunc::lookup_init(table_items, probe_state);
+
+    const auto& build_data = BaseBuildFunc::get_key_data(table_items);
+    const auto& probe_data = get_key_data(*probe_state);
+    const uint32_t row_count = probe_state->probe_row_count;
     for (uint32_t i = 0; i < row_count; i++) {
-        if (probe_state->is_nulls[i] == 0) {
-            probe_state->next[i] = table_items.first[probe_state->buckets[i]];
-        } else {
-            probe_state->next[i] = 0;
+        if (probe_state->next[i] == 0) {
+            continue;
         }
+        bool found = false;
+        const uint32_t slot = LinearProbingHelper::find_slot(
+                table_items.tags.data(), table_items.first.data(), table_items.bucket_size, probe_state->buckets[i],
+                probe_state->tags[i], [&](uint32_t row) { return build_data[row] == probe_data[i]; }, &found);
+        probe_state->next[i] = found ? table_items.first[slot] : 0;
     }
 }
 
@@ -411,8 +480,14 @@ void JoinHashMap<LT, BuildFunc, ProbeFunc>::probe_prepare(RuntimeState* state) {
 }
 
 template <LogicalType LT, class BuildFunc, class ProbeFunc>
-void JoinHashMap<LT, BuildFunc, ProbeFunc>::build(RuntimeState* state) {
-    BuildFunc().construct_hash_table(state, _table_items, _probe_state);
+Status JoinHashMap<LT, BuildFunc, ProbeFunc>::build(RuntimeState* state) {
+    if constexpr (std::is_same_v<decltype(BuildFunc::construct_hash_table(state, _table_items, _probe_state)),
+                                 Status>) {
+        return BuildFunc::construct_hash_table(state, _table_items, _probe_state);
+    } else {
+        BuildFunc::construct_hash_table(state, _table_items, _probe_state);
+        return Status::OK();
+    }
 }
 
 template <LogicalType LT, class BuildFunc, class ProbeFunc>
@@ -744,9 +819,10 @@ void JoinHashMap<LT, BuildFunc, ProbeFunc>::_search_ht(RuntimeState* state, Chun
         if (state->query_options().interleaving_group_size > 0 && !_table_items->ht_cache_miss_serious()) {
             _probe_state->active_coroutines = 0;
         }
+        auto& build_data = BuildFunc().get_key_data(*_table_items);
+        _prepare_pipelined_probe(state, build_data);
         ProbeFunc().lookup_init(*_table_items, _probe_state);
 
-        auto& build_data = BuildFunc().get_key_data(*_table_items);
         auto& probe_data = ProbeFunc().get_key_data(*_probe_state);
         _search_ht_impl<true>(state, build_data, probe_data);
     } else {
@@ -756,6 +832,30 @@ void JoinHashMap<LT, BuildFunc, ProbeFunc>::_search_ht(RuntimeState* state, Chun
     }
 }
 
+template <LogicalType LT, class BuildFunc, class ProbeFunc>
+void JoinHashMap<LT, BuildFunc, ProbeFunc>::_prepare_pipelined_probe(RuntimeState* state,
+                                                                     const Buffer<CppType>& build_data) {
+    _probe_state->prefetch_distance = 0;
+    const int32_t distance = state->hash_table_prefetch_distance();
+    if (distance <= 0 || !_table_items->ht_cache_miss_serious()) {
+        return;
+    }
+    // the prefetches hide the cache misses of the whole chunk, so there is nothing left for the coroutines.
+    _probe_state->active_coroutines = 0;
+    _probe_state->prefetch_distance = distance;
+    // a slice key only points to the serialized key, which could not be prefetched without loading the slice first.
+    if constexpr (std::is_same_v<CppType, Slice>) {
+        _probe_state->prefetch_build_keys = nullptr;
+        _probe_state->prefetch_build_key_size = 0;
+    } else {
+        _probe_state->prefetch_build_keys = reinterpret_cast<const uint8_t*>(build_data.data());
+        _probe_state->prefetch_build_key_size = sizeof(CppType);
+    }
+    if (_probe_state->pipelined_probe_rows_counter != nullptr) {
+        COUNTER_UPDATE(_probe_state->pipelined_probe_rows_counter, _probe_state->probe_row_count);
+    }
+}
+
 template <LogicalType LT, class BuildFunc, class ProbeFunc>
 void JoinHashMap<LT, BuildFunc, ProbeFunc>::_search_ht_remain(RuntimeState* state) {
     if (!_probe_state->has_remain) {
@@ -508,6 +508,15 @@ StatusOr<bool> OlapScanNode::_could_split_tablet_physically(const std::vector<TS
     return is_keys_type_matched;
 }
 
+StatusOr<bool> OlapScanNode::could_split_running_morsels(const std::vector<TScanRangeParams>& scan_ranges) const {
+    // The split rows are read by another driver, so the rows of a tablet are no longer output in order.
+    if (scan_ranges.empty() || _sorted_by_keys_per_tablet || !is_asc_hint() || partition_order_hint().has_value() ||
+        _olap_scan_node.use_pk_index) {
+        return false;
+    }
+    return _could_split_tablet_physically(scan_ranges);
+}
+
 Status OlapScanNode::collect_query_statistics(QueryStatistics* statistics) {
     RETURN_IF_ERROR(ExecNode::collect_query_statistics(statistics));
     QueryStatisticsItemPB stats_item;
@@ -71,6 +71,7 @@ public:
             const std::vector<TScanRangeParams>& scan_ranges, int node_id, int32_t pipeline_dop,
             bool enable_tablet_internal_parallel, TTabletInternalParallelMode::type tablet_internal_parallel_mode,
             size_t num_total_scan_ranges) override;
+    StatusOr<bool> could_split_running_morsels(const std::vector<TScanRangeParams>& scan_ranges) const override;
 
     void debug_string(int indentation_level, std::stringstream* out) const override { *out << "OlapScanNode"; }
     Status collect_query_statistics(QueryStatistics* statistics) override;
@@ -127,6 +127,7 @@ private:
     // always be 1
     std::vector<std::unique_ptr<Chunk>> _chunks;
     PTransmitChunkParamsPtr _chunk_request;
+    ChunkAttachment _chunk_attachment;
     size_t _current_request_bytes = 0;
 
     bool _is_inited = false;
@@ -249,8 +250,9 @@ Status ExchangeSinkOperator::Channel::send_one_chunk(RuntimeState* state, const
                 _chunk_request->add_driver_sequences(driver_sequence);
             }
             auto pchunk = _chunk_request->add_chunks();
-            TRY_CATCH_BAD_ALLOC(RETURN_IF_ERROR(_parent->serialize_chunk(chunk, pchunk, &_is_first_chunk)));
-            _current_request_bytes += pchunk->data().size();
+            TRY_CATCH_BAD_ALLOC(
+                    RETURN_IF_ERROR(_parent->serialize_chunk(chunk, pchunk, &_is_first_chunk, &_chunk_attachment)));
+            _current_request_bytes += pchunk->data_size();
         }
     }
 
@@ -260,7 +262,8 @@ Status ExchangeSinkOperator::Channel::send_one_chunk(RuntimeState* state, const
         _chunk_request->set_eos(eos);
         _chunk_request->set_use_pass_through(_use_pass_through);
         butil::IOBuf attachment;
-        int64_t attachment_physical_bytes = _parent->construct_brpc_attachment(_chunk_request, attachment);
+        int64_t attachment_physical_bytes =
+                _parent->construct_brpc_attachment(_chunk_request, &_chunk_attachment, attachment);
         TransmitChunkInfo info = {this->_fragment_instance_id, _brpc_stub,     std::move(_chunk_request), attachment,
                                   attachment_physical_bytes,   _brpc_dest_addr};
         RETURN_IF_ERROR(_parent->_buffer->add_request(info));
@@ -406,6 +409,7 @@ Status ExchangeSinkOperator::prepare(RuntimeState* state) {
         _compress_type = CompressionTypePB::LZ4;
     }
     RETURN_IF_ERROR(get_block_compression_codec(_compress_type, &_compress_codec));
+    _enable_zero_copy_serialize = config::enable_exchange_zero_copy_serialize;
 
     std::string instances;
     for (const auto& channel : _channels) {
@@ -520,13 +524,14 @@ Status ExchangeSinkOperator::push_chunk(RuntimeState* state, const ChunkPtr& chu
             // 1. create a new chunk PB to serialize
             ChunkPB* pchunk = _chunk_request->add_chunks();
             // 2. serialize input chunk to pchunk
-            TRY_CATCH_BAD_ALLOC(
-                    RETURN_IF_ERROR(serialize_chunk(send_chunk, pchunk, &_is_first_chunk, _channels.size())));
-            _current_request_bytes += pchunk->data().size();
+            TRY_CATCH_BAD_ALLOC(RETURN_IF_ERROR(
+                    serialize_chunk(send_chunk, pchunk, &_is_first_chunk, &_chunk_attachment, _channels.size())));
+            _current_request_bytes += pchunk->data_size();
             // 3. if request bytes exceede the threshold, send current request
             if (_current_request_bytes > config::max_transmit_batched_bytes) {
                 butil::IOBuf attachment;
-                int64_t attachment_physical_bytes = construct_brpc_attachment(_chunk_request, attachment);
+                int64_t attachment_physical_bytes =
+                        construct_brpc_attachment(_chunk_request, &_chunk_attachment, attachment);
                 for (auto idx : _channel_indices) {
                     if (!_channels[idx]->use_pass_through()) {
                         PTransmitChunkParamsPtr copy = std::make_shared<PTransmitChunkParams>(*_chunk_request);
@@ -639,7 +644,8 @@ Status ExchangeSinkOperator::set_finishing(RuntimeState* state) {
 
     if (_chunk_request != nullptr) {
         butil::IOBuf attachment;
-        int64_t attachment_physical_bytes = construct_brpc_attachment(_chunk_request, attachment);
+        int64_t attachment_physical_bytes =
+                construct_brpc_attachment(_chunk_request, &_chunk_attachment, attachment);
         for (const auto& [_, channel] : _instance_id2channel) {
             PTransmitChunkParamsPtr copy = std::make_shared<PTransmitChunkParams>(*_chunk_request);
             RETURN_IF_ERROR(channel->send_chunk_request(state, copy, attachment, attachment_physical_bytes));
@@ -666,34 +672,46 @@ void ExchangeSinkOperator::close(RuntimeState* state) {
     Operator::close(state);
 }
 
-Status ExchangeSinkOperator::serialize_chunk(const Chunk* src, ChunkPB* dst, bool* is_first_chunk, int num_receivers) {
+Status ExchangeSinkOperator::serialize_chunk(const Chunk* src, ChunkPB* dst, bool* is_first_chunk,
+                                             ChunkAttachment* attachment, int num_receivers) {
     VLOG_ROW << "[ExchangeSinkOperator] serializing " << src->num_rows() << " rows";
     auto send_input_bytes = serde::ProtobufChunkSerde::max_serialized_size(*src, nullptr);
     COUNTER_UPDATE(_sender_input_bytes_counter, send_input_bytes * num_receivers);
+    // the buffer which the data is serialized to, and handed over to the attachment without copying
+    std::unique_ptr<uint8_t[]> buffer;
+    int64_t buffer_size = 0;
+    int64_t buffer_physical_bytes = 0;
     {
         SCOPED_TIMER(_serialize_chunk_timer);
         // We only serialize chunk meta for first chunk
         if (*is_first_chunk) {
             _encode_context = serde::EncodeContext::get_encode_context_shared_ptr(src->columns().size(), _encode_level);
-            StatusOr<ChunkPB> res = Status::OK();
+        }
+        StatusOr<ChunkPB> res = Status::OK();
+        if (_enable_zero_copy_serialize) {
+            buffer_size = serde::ProtobufChunkSerde::max_serialized_data_size(*src, _encode_context);
+            int64_t before_bytes = CurrentThread::current().get_consumed_bytes();
+            TRY_CATCH_BAD_ALLOC(buffer.reset(new uint8_t[buffer_size]));
+            buffer_physical_bytes = CurrentThread::current().get_consumed_bytes() - before_bytes;
+            TRY_CATCH_BAD_ALLOC(res = serde::ProtobufChunkSerde::serialize_to(*src, buffer.get(), *is_first_chunk,
+                                                                               _encode_context));
+        } else if (*is_first_chunk) {
             TRY_CATCH_BAD_ALLOC(res = serde::ProtobufChunkSerde::serialize(*src, _encode_context));
-            RETURN_IF_ERROR(res);
-            res->Swap(dst);
-            *is_first_chunk = false;
         } else {
-            StatusOr<ChunkPB> res = Status::OK();
             TRY_CATCH_BAD_ALLOC(res = serde::ProtobufChunkSerde::serialize_without_meta(*src, _encode_context));
-            RETURN_IF_ERROR(res);
-            res->Swap(dst);
         }
+        RETURN_IF_ERROR(res);
+        res->Swap(dst);
+        *is_first_chunk = false;
     }
     if (_encode_context) {
         _encode_context->set_encode_levels_in_pb(dst);
     }
     DCHECK(dst->has_uncompressed_size());
-    DCHECK_EQ(dst->uncompressed_size(), dst->data().size());
+    DCHECK(buffer != nullptr || dst->uncompressed_size() == dst->data().size());
     const size_t serialized_size = dst->uncompressed_size();
     COUNTER_UPDATE(_serialized_bytes_counter, serialized_size * num_receivers);
+    Slice serialized_data = buffer != nullptr ? Slice(buffer.get(), serialized_size) : Slice(dst->data());
 
     if (_compress_codec != nullptr && _compress_codec->exceed_max_input_size(serialized_size)) {
         return Status::InternalError(strings::Substitute("The input size for compression should be less than $0",
@@ -701,14 +719,14 @@ Status ExchangeSinkOperator::serialize_chunk(const Chunk* src, ChunkPB* dst, boo
     }
 
     // try compress the ChunkPB data
+    bool compressed = false;
     if (_compress_codec != nullptr && serialized_size > 0) {
         SCOPED_TIMER(_compress_timer);
 
         if (use_compression_pool(_compress_codec->type())) {
             Slice compressed_slice;
-            Slice input(dst->data());
-            RETURN_IF_ERROR(_compress_codec->compress(input, &compressed_slice, true, serialized_size, nullptr,
-                                                      &_compression_scratch));
+            RETURN_IF_ERROR(_compress_codec->compress(serialized_data, &compressed_slice, true, serialized_size,
+                                                      nullptr, &_compression_scratch));
         } else {
             int max_compressed_size = _compress_codec->max_compressed_len(serialized_size);
 
@@ -718,28 +736,57 @@ Status ExchangeSinkOperator::serialize_chunk(const Chunk* src, ChunkPB* dst, boo
 
             Slice compressed_slice{_compression_scratch.data(), _compression_scratch.size()};
 
-            Slice input(dst->data());
-            RETURN_IF_ERROR(_compress_codec->compress(input, &compressed_slice));
+            RETURN_IF_ERROR(_compress_codec->compress(serialized_data, &compressed_slice));
             _compression_scratch.resize(compressed_slice.size);
         }
 
         double compress_ratio = (static_cast<double>(serialized_size)) / _compression_scratch.size();
         if (LIKELY(compress_ratio > config::rpc_compress_ratio_threshold)) {
-            dst->mutable_data()->swap(reinterpret_cast<std::string&>(_compression_scratch));
+            compressed = true;
             dst->set_compress_type(_compress_type);
         }
         COUNTER_UPDATE(_compressed_bytes_counter, _compression_scratch.size() * num_receivers);
         VLOG_ROW << "uncompressed size: " << serialized_size << ", compressed size: " << _compression_scratch.size();
     }
+
+    if (buffer == nullptr) {
+        if (compressed) {
+            dst->mutable_data()->swap(reinterpret_cast<std::string&>(_compression_scratch));
+        }
+        dst->set_data_size(dst->data().size());
+        return Status::OK();
+    }
+
+    // The data is left in the buffer if it is not compressed, and the buffer is appended to the attachment as
+    // a user-data block, which is released by brpc after the request is sent. Copy the data if the buffer is
+    // much larger than the data though, so the memory held by the pending requests is close to their size.
+    if (!compressed && serialized_size * 2 >= buffer_size) {
+        attachment->data.append_user_data(buffer.release(), serialized_size,
+                                          [](void* buf) { delete[] static_cast<uint8_t*>(buf); });
+        attachment->physical_bytes += buffer_physical_bytes;
+    } else {
+        Slice data = compressed ? Slice(_compression_scratch.data(), _compression_scratch.size()) : serialized_data;
+        int64_t before_bytes = CurrentThread::current().get_consumed_bytes();
+        attachment->data.append(data.data, data.size);
+        attachment->physical_bytes += CurrentThread::current().get_consumed_bytes() - before_bytes;
+    }
+    dst->set_data_size(compressed ? _compression_scratch.size() : serialized_size);
     return Status::OK();
 }
 
 int64_t ExchangeSinkOperator::construct_brpc_attachment(const PTransmitChunkParamsPtr& chunk_request,
-                                                        butil::IOBuf& attachment) {
-    int64_t attachment_physical_bytes = 0;
+                                                        ChunkAttachment* serialized, butil::IOBuf& attachment) {
+    // the data serialized to the attachment already comes first, it is empty unless zero copy is enabled
+    int64_t attachment_physical_bytes = serialized->physical_bytes;
+    attachment.swap(serialized->data);
+    serialized->data.clear();
+    serialized->physical_bytes = 0;
     for (int i = 0; i < chunk_request->chunks().size(); ++i) {
         auto chunk = chunk_request->mutable_chunks(i);
-        chunk->set_data_size(chunk->data().size());
+        if (chunk->data().empty()) {
+            continue;
+        }
+        DCHECK_EQ(chunk->data_size(), chunk->data().size());
 
         int64_t before_bytes = CurrentThread::current().get_consumed_bytes();
         attachment.append(chunk->data());
@@ -77,12 +77,23 @@ public:
 
     void update_metrics(RuntimeState* state) override;
 
+    // The data of the chunks serialized straight into the brpc attachment, waiting for the request to be sent.
+    struct ChunkAttachment {
+        butil::IOBuf data;
+        int64_t physical_bytes = 0;
+    };
+
     // For the first chunk , serialize the chunk data and meta to ChunkPB both.
     // For other chunk, only serialize the chunk data to ChunkPB.
-    Status serialize_chunk(const Chunk* chunk, ChunkPB* dst, bool* is_first_chunk, int num_receivers = 1);
+    // If enable_exchange_zero_copy_serialize is set, the chunk data is appended to |attachment| instead of
+    // ChunkPB::data(), and the buffer it is serialized to is handed over to the attachment without copying.
+    Status serialize_chunk(const Chunk* chunk, ChunkPB* dst, bool* is_first_chunk, ChunkAttachment* attachment,
+                           int num_receivers = 1);
 
+    // Move the data of |serialized| and of the chunks of |chunk_request| to |attachment|.
     // Return the physical bytes of attachment.
-    int64_t construct_brpc_attachment(const PTransmitChunkParamsPtr& _chunk_request, butil::IOBuf& attachment);
+    int64_t construct_brpc_attachment(const PTransmitChunkParamsPtr& _chunk_request, ChunkAttachment* serialized,
+                                      butil::IOBuf& attachment);
 
 private:
     bool _is_large_chunk(size_t sz) const {
@@ -159,6 +170,7 @@ private:
 
     // Only used when broadcast
     PTransmitChunkParamsPtr _chunk_request;
+    ChunkAttachment _chunk_attachment;
     size_t _current_request_bytes = 0;
 
     bool _is_first_chunk = true;
@@ -171,6 +183,7 @@ private:
 
     CompressionTypePB _compress_type = CompressionTypePB::NO_COMPRESSION;
     const BlockCompressionCodec* _compress_codec = nullptr;
+    bool _enable_zero_copy_serialize = false;
 
     RuntimeProfile::Counter* _serialize_chunk_timer = nullptr;
     RuntimeProfile::Counter* _shuffle_hash_timer = nullptr;
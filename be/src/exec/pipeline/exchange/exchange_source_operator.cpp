@@ -29,6 +29,10 @@ Status ExchangeSourceOperator::prepare(RuntimeState* state) {
     return Status::OK();
 }
 
+PipelineObservable* ExchangeSourceOperator::output_observable() {
+    return _stream_recvr->observable();
+}
+
 bool ExchangeSourceOperator::has_output() const {
     return _stream_recvr->has_output_for_pipeline(_driver_sequence);
 }
@@ -35,6 +35,8 @@ public:
 
     bool is_finished() const override;
 
+    PipelineObservable* output_observable() override;
+
     Status set_finishing(RuntimeState* state) override;
 
     StatusOr<ChunkPtr> pull_chunk(RuntimeState* state) override;
@@ -16,12 +16,15 @@
 
 #include "column/chunk.h"
 #include "runtime/runtime_state.h"
+#include "util/defer_op.h"
 
 namespace starrocks::pipeline {
 
 // Used for PassthroughExchanger.
 // The input chunk is most likely full, so we don't merge it to avoid copying chunk data.
 void LocalExchangeSourceOperator::add_chunk(ChunkPtr chunk) {
+    // Notify the observer after the lock is released.
+    DeferOp notify_op([this] { _observable.notify_observers(); });
     std::lock_guard<std::mutex> l(_chunk_lock);
     if (_is_finished) {
         return;
@@ -37,6 +40,8 @@ void LocalExchangeSourceOperator::add_chunk(ChunkPtr chunk) {
 // Only enqueue the partition chunk information here, and merge chunk in pull_chunk().
 Status LocalExchangeSourceOperator::add_chunk(ChunkPtr chunk, const std::shared_ptr<std::vector<uint32_t>>& indexes,
                                               uint32_t from, uint32_t size, size_t memory_usage) {
+    // Notify the observer after the lock is released.
+    DeferOp notify_op([this] { _observable.notify_observers(); });
     std::lock_guard<std::mutex> l(_chunk_lock);
     if (_is_finished) {
         return Status::OK();
@@ -55,6 +60,8 @@ Status LocalExchangeSourceOperator::add_chunk(ChunkPtr chunk, const std::shared_
 
 Status LocalExchangeSourceOperator::add_chunk(const std::vector<std::string>& partition_key,
                                               std::unique_ptr<Chunk> chunk) {
+    // Notify the observer after the lock is released.
+    DeferOp notify_op([this] { _observable.notify_observers(); });
     std::lock_guard<std::mutex> l(_chunk_lock);
     if (_is_finished) {
         return Status::OK();
@@ -125,6 +132,8 @@ void LocalExchangeSourceOperator::enter_release_memory_mode() {
     _local_memory_limit = min_local_memory_limit;
     size_t max_memory_usage = min_local_memory_limit * _memory_manager->get_max_input_dop();
     _memory_manager->update_max_memory_usage(max_memory_usage);
+    // The buffered chunks may be enough to output under the new limit.
+    _observable.notify_observers();
 }
 
 void LocalExchangeSourceOperator::set_execute_mode(int performance_level) {
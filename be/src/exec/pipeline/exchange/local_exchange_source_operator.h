@@ -70,10 +70,15 @@ public:
 
     bool is_finished() const override;
 
+    PipelineObservable* output_observable() override { return &_observable; }
+
     Status set_finished(RuntimeState* state) override;
     Status set_finishing(RuntimeState* state) override {
-        std::lock_guard<std::mutex> l(_chunk_lock);
-        _is_finished = true;
+        {
+            std::lock_guard<std::mutex> l(_chunk_lock);
+            _is_finished = true;
+        }
+        _observable.notify_observers();
         return Status::OK();
     }
 
@@ -82,8 +87,11 @@ public:
         return _is_epoch_finished && _full_chunk_queue.empty() && !_partition_rows_num;
     }
     Status set_epoch_finishing(RuntimeState* state) override {
-        std::lock_guard<std::mutex> l(_chunk_lock);
-        _is_epoch_finished = true;
+        {
+            std::lock_guard<std::mutex> l(_chunk_lock);
+            _is_epoch_finished = true;
+        }
+        _observable.notify_observers();
         return Status::OK();
     }
     Status reset_epoch(RuntimeState* state) override {
@@ -134,6 +142,9 @@ private:
 
     // STREAM MV
     bool _is_epoch_finished = false;
+
+    // Notified when the chunks are added or the source is finishing.
+    PipelineObservable _observable;
 };
 
 class LocalExchangeSourceOperatorFactory final : public SourceOperatorFactory {
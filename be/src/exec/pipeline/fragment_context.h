@@ -112,6 +112,9 @@ public:
 
     RuntimeFilterHub* runtime_filter_hub() { return &_runtime_filter_hub; }
 
+    // Notifies the observers of the drivers when an operator shared with other pipelines is finished.
+    PipelineObservable* operator_finished_observable() { return &_operator_finished_observable; }
+
     RuntimeFilterPort* runtime_filter_port() { return _runtime_state->runtime_filter_port(); }
 
     void prepare_pass_through_chunk_buffer();
@@ -197,6 +200,7 @@ private:
     std::atomic<size_t> _num_finished_execution_groups = 0;
 
     RuntimeFilterHub _runtime_filter_hub;
+    PipelineObservable _operator_finished_observable;
 
     MorselQueueFactoryMap _morsel_queue_factories;
     workgroup::WorkGroupPtr _workgroup = nullptr;
@@ -46,6 +46,7 @@ Status SpillableHashJoinProbeOperator::prepare(RuntimeState* state) {
             "SpillBuildPartitionPeakMemoryUsage", TUnit::BYTES, RuntimeProfile::Counter::create_strategy(TUnit::BYTES));
     metrics.prober_peak_memory_usage = _unique_metrics->AddHighWaterMarkCounter(
             "SpillProberPeakMemoryUsage", TUnit::BYTES, RuntimeProfile::Counter::create_strategy(TUnit::BYTES));
+    metrics.skewed_build_slices = ADD_COUNTER(_unique_metrics.get(), "SpillSkewedBuildSlices", TUnit::UNIT);
     RETURN_IF_ERROR(_probe_spiller->prepare(state));
     auto wg = state->fragment_ctx()->workgroup();
     return Status::OK();
@@ -274,15 +275,22 @@ Status SpillableHashJoinProbeOperator::_load_partition_build_side(workgroup::Yie
                 RETURN_IF_ERROR(builder->append_chunk(std::move(chunk_st.value())));
                 hash_table_mem_usage = builder->hash_table_mem_usage();
                 COUNTER_ADD(metrics.build_partition_peak_memory_usage, hash_table_mem_usage - old_mem_usage);
+                // the current slice is full, the rest of build side is loaded after it is joined
+                if (_slice_build_side && hash_table_mem_usage > _build_slice_bytes) {
+                    RETURN_IF_ERROR(builder->build(state));
+                    _build_side_remain = true;
+                    finish = true;
+                }
             } else if (chunk_st.status().is_end_of_file()) {
                 RETURN_IF_ERROR(builder->build(state));
+                _build_side_remain = false;
                 finish = true;
             } else if (!chunk_st.ok()) {
                 return chunk_st.status();
             }
         }
     }
-    if (finish) {
+    if (finish && !_slice_build_side) {
         DCHECK_EQ(builder->hash_table_row_count(), _processing_partitions[idx]->num_rows);
     }
     TRY_CATCH_ALLOC_SCOPE_END()
@@ -290,12 +298,14 @@ Status SpillableHashJoinProbeOperator::_load_partition_build_side(workgroup::Yie
 }
 
 Status SpillableHashJoinProbeOperator::_load_all_partition_build_side(RuntimeState* state) {
-    auto spill_readers = _join_builder->spiller()->get_partition_spill_readers(_processing_partitions);
+    if (_build_readers.empty()) {
+        _build_readers = _join_builder->spiller()->get_partition_spill_readers(_processing_partitions);
+    }
     _latch.reset(_processing_partitions.size());
     int32_t driver_id = CurrentThread::current().get_driver_id();
     auto query_ctx = state->query_ctx()->weak_from_this();
     for (size_t i = 0; i < _processing_partitions.size(); ++i) {
-        std::shared_ptr<spill::SpillerReader> reader = std::move(spill_readers[i]);
+        std::shared_ptr<spill::SpillerReader> reader = _build_readers[i];
         auto task = [this, state, reader, i, query_ctx, driver_id](auto& yield_ctx) {
             if (auto acquired = query_ctx.lock()) {
                 SCOPED_SET_TRACE_INFO(driver_id, state->query_id(), state->fragment_instance_id());
@@ -444,12 +454,17 @@ StatusOr<ChunkPtr> SpillableHashJoinProbeOperator::pull_chunk(RuntimeState* stat
     // processing partitions
     if (_is_finishing && eofs == _processing_partitions.size() && !_has_probe_remain) {
         DCHECK(all_probe_partition_is_empty());
+        if (_build_side_remain) {
+            RETURN_IF_ERROR(_load_next_build_slice(state));
+            return nullptr;
+        }
         // current partition is finished
         for (auto* partition : _processing_partitions) {
             _processed_partitions.emplace(partition->partition_id);
         }
         _processing_partitions.clear();
         _current_reader.clear();
+        _build_readers.clear();
         _has_probe_remain = false;
         _builders.clear();
         COUNTER_SET(metrics.build_partition_peak_memory_usage, 0);
@@ -458,6 +473,32 @@ StatusOr<ChunkPtr> SpillableHashJoinProbeOperator::pull_chunk(RuntimeState* stat
     return nullptr;
 }
 
+bool SpillableHashJoinProbeOperator::_could_slice_build_side(const SpillPartitionInfo* partition,
+                                                             size_t avaliable_bytes) const {
+    if (!partition->skewed || partition->bytes <= avaliable_bytes) {
+        return false;
+    }
+    auto join_type = _join_prober->join_type();
+    return join_type == TJoinOp::INNER_JOIN || join_type == TJoinOp::RIGHT_SEMI_JOIN ||
+           join_type == TJoinOp::RIGHT_ANTI_JOIN || join_type == TJoinOp::RIGHT_OUTER_JOIN;
+}
+
+Status SpillableHashJoinProbeOperator::_load_next_build_slice(RuntimeState* state) {
+    DCHECK(_slice_build_side);
+    COUNTER_UPDATE(metrics.skewed_build_slices, 1);
+    for (size_t i = 0; i < _processing_partitions.size(); ++i) {
+        _builders[i]->close();
+        _builders[i] = _join_builder->new_builder(&_component_pool);
+        _builders[i]->create(_join_builder->hash_table_param());
+        _probers[i] = _join_prober->new_prober(&_component_pool);
+    }
+    // the probe side of the partition is read again from the beginning
+    _current_reader.clear();
+    _has_probe_remain = false;
+    COUNTER_SET(metrics.build_partition_peak_memory_usage, 0);
+    return _load_all_partition_build_side(state);
+}
+
 void SpillableHashJoinProbeOperator::_acquire_next_partitions() {
     // get all spill partition
     if (_build_partitions.empty()) {
@@ -483,10 +524,24 @@ void SpillableHashJoinProbeOperator::_acquire_next_partitions() {
     }
 
     size_t avaliable_bytes = _mem_resource_manager.operator_avaliable_memory_bytes();
+    _slice_build_side = false;
+    _build_side_remain = false;
+    _build_slice_bytes =
+            std::max<size_t>(avaliable_bytes, _join_builder->spiller()->options().spill_mem_table_bytes_size);
     // process the partition could be hold in memory
     if (_processing_partitions.empty()) {
         for (const auto* partition : _build_partitions) {
             if (!partition->in_mem && !_processed_partitions.count(partition->partition_id)) {
+                // the probe side of a sliced partition is read once for each slice, so it is always spilled
+                // instead of being pushed to the prober directly
+                if (_could_slice_build_side(partition, avaliable_bytes)) {
+                    if (_processing_partitions.empty()) {
+                        _processing_partitions.emplace_back(partition);
+                        _slice_build_side = true;
+                        break;
+                    }
+                    continue;
+                }
                 if ((partition->bytes + bytes_usage < avaliable_bytes || _processing_partitions.empty()) &&
                     std::find(_processing_partitions.begin(), _processing_partitions.end(), partition) ==
                             _processing_partitions.end()) {
@@ -50,6 +50,8 @@ struct SpillableHashJoinProbeMetrics {
     RuntimeProfile::Counter* probe_shuffle_timer = nullptr;
     RuntimeProfile::HighWaterMarkCounter* prober_peak_memory_usage = nullptr;
     RuntimeProfile::HighWaterMarkCounter* build_partition_peak_memory_usage = nullptr;
+    // the number of extra build side slices loaded for the skewed partitions
+    RuntimeProfile::Counter* skewed_build_slices = nullptr;
 };
 
 class SpillableHashJoinProbeOperator final : public HashJoinProbeOperator {
@@ -96,6 +98,13 @@ private:
     Status _load_partition_build_side(workgroup::YieldContext& ctx, RuntimeState* state,
                                       const std::shared_ptr<spill::SpillerReader>& reader, size_t idx);
 
+    // A skewed partition which can not be hold in memory is joined alone slice by slice: each slice of the build
+    // side is loaded under the memory budget, and all the probe side of the partition is probed against it.
+    // It only works for the join types whose output of a probe row does not depend on the other slices.
+    bool _could_slice_build_side(const SpillPartitionInfo* partition, size_t avaliable_bytes) const;
+
+    Status _load_next_build_slice(RuntimeState* state);
+
     void _update_status(Status&& status) const;
 
     Status _status() const;
@@ -115,6 +124,13 @@ private:
     std::vector<const SpillPartitionInfo*> _processing_partitions;
     std::unordered_set<int32_t> _processed_partitions;
 
+    // build side readers of processing partitions, kept for the next slice of a skewed partition
+    std::vector<std::shared_ptr<spill::SpillerReader>> _build_readers;
+    bool _slice_build_side = false;
+    size_t _build_slice_bytes = 0;
+    // written by the load task of the slice, and read after _latch is ready
+    bool _build_side_remain = false;
+
     std::vector<std::shared_ptr<spill::SpillerReader>> _current_reader;
     std::vector<bool> _probe_read_eofs;
     std::vector<bool> _probe_post_eofs;
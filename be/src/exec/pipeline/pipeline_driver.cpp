@@ -18,6 +18,7 @@
 #include <sstream>
 
 #include "column/chunk.h"
+#include "common/config.h"
 #include "common/statusor.h"
 #include "exec/pipeline/adaptive/event.h"
 #include "exec/pipeline/exchange/exchange_sink_operator.h"
@@ -209,6 +210,29 @@ Status PipelineDriver::prepare(RuntimeState* runtime_state) {
     _all_local_rf_ready = _local_rf_holders.empty();
     // Driver has no global rf to wait for completion always sets _all_global_rf_ready_or_timeout to true;
     _all_global_rf_ready_or_timeout = _global_rf_descriptors.empty();
+
+    if (config::enable_pipeline_event_driven_poller) {
+        if (auto* observable = source_op->output_observable(); observable != nullptr) {
+            _is_input_observable = true;
+            _observe(observable);
+        }
+        // The dependencies cannot notify the observer, so only the driver waiting for the runtime filters alone is
+        // woken up by them, and by the poller when waiting for the global runtime filters times out.
+        _is_precondition_observable = true;
+        for (auto* holder : _local_rf_holders) {
+            _observe(holder->observable());
+        }
+        for (auto* rf_desc : _global_rf_descriptors) {
+            if (!rf_desc->is_local()) {
+                _observe(rf_desc->observable());
+            }
+        }
+        // The sink operator may be finished by the other drivers sharing its state, e.g. when its downstream pipeline
+        // reaches the limit, and then the driver waiting for the notification needs to be woken up.
+        if (_is_input_observable || has_precondition()) {
+            _observe(_fragment_ctx->operator_finished_observable());
+        }
+    }
     set_driver_state(DriverState::READY);
 
     _total_timer_sw = runtime_state->obj_pool()->add(new MonotonicStopWatch());
@@ -555,6 +579,7 @@ void PipelineDriver::cancel_operators(RuntimeState* runtime_state) {
     if (this->query_ctx()->is_query_expired()) {
         LOG(WARNING) << "begin to cancel operators for " << to_readable_string();
     }
+    _unobserve_all();
     for (auto& op : _operators) {
         WARN_IF_ERROR(_mark_operator_cancelled(op, runtime_state),
                       fmt::format("cancel pipeline driver error [driver={}]", to_readable_string()));
@@ -670,6 +695,7 @@ void PipelineDriver::finalize(RuntimeState* runtime_state, DriverState state, in
     VLOG_ROW << "[Driver] finalize, driver=" << this;
     DCHECK(state == DriverState::FINISH || state == DriverState::CANCELED || state == DriverState::INTERNAL_ERROR);
     QUERY_TRACE_BEGIN("finalize", _driver_name);
+    _unobserve_all();
     _close_operators(runtime_state);
 
     set_driver_state(state);
@@ -797,7 +823,30 @@ Status PipelineDriver::_mark_operator_finished(OperatorPtr& op, RuntimeState* st
         SCOPED_TIMER(op->_finished_timer);
         op_state = OperatorStage::FINISHED;
         QUERY_TRACE_SCOPED(op->get_name(), "set_finished");
-        return op->set_finished(state);
+        RETURN_IF_ERROR(op->set_finished(state));
+    }
+    _notify_operator_finished(op);
+    return Status::OK();
+}
+
+void PipelineDriver::_observe(PipelineObservable* observable) {
+    observable->add_observer(_observer);
+    _observables.emplace_back(observable);
+}
+
+void PipelineDriver::_unobserve_all() {
+    for (auto* observable : _observables) {
+        observable->remove_observer(_observer);
+    }
+    _observables.clear();
+    _observer->attach_poller(nullptr);
+}
+
+void PipelineDriver::_notify_operator_finished(const OperatorPtr& op) {
+    // The source and sink operators share their states with the other pipelines, so finishing them may finish the
+    // sink operators of the other drivers in the fragment.
+    if (config::enable_pipeline_event_driven_poller && (op.get() == source_operator() || op.get() == sink_operator())) {
+        _fragment_ctx->operator_finished_observable()->notify_observers();
     }
 }
 
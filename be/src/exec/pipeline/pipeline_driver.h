@@ -25,6 +25,7 @@
 #include "exec/pipeline/operator.h"
 #include "exec/pipeline/operator_with_dependency.h"
 #include "exec/pipeline/pipeline_fwd.h"
+#include "exec/pipeline/pipeline_observer.h"
 #include "exec/pipeline/query_context.h"
 #include "exec/pipeline/runtime_filter_types.h"
 #include "exec/pipeline/scan/morsel.h"
@@ -435,6 +436,22 @@ public:
     void set_workgroup(workgroup::WorkGroupPtr wg);
 
     void set_in_queue(DriverQueue* in_queue) { _in_queue = in_queue; }
+
+    const PipelineObserverPtr& observer() const { return _observer; }
+    // Whether the blocked driver is woken up by its observer instead of being polled by PipelineDriverPoller, which is
+    // the case when it waits for the output of an observable source operator or only for the runtime filters.
+    bool is_waiting_for_event() const {
+        return (_state == DriverState::INPUT_EMPTY && _is_input_observable) ||
+               (_state == DriverState::PRECONDITION_BLOCK && _is_precondition_observable && _all_dependencies_ready);
+    }
+    // Return the remaining time of waiting for the global runtime filters, or -1 if the driver isn't waiting for them.
+    // The poller wakes up the driver waiting for the notification when the time is up.
+    int64_t global_rf_wait_remaining_ns() const {
+        if (_state != DriverState::PRECONDITION_BLOCK || !_wait_global_rf_ready || _all_global_rf_ready_or_timeout) {
+            return -1;
+        }
+        return std::max<int64_t>(0, _global_rf_wait_timeout_ns - _precondition_block_timer_sw->elapsed_time());
+    }
     size_t get_driver_queue_level() const { return _driver_queue_level; }
     void set_driver_queue_level(size_t driver_queue_level) { _driver_queue_level = driver_queue_level; }
 
@@ -479,6 +496,11 @@ protected:
     Status _mark_operator_cancelled(OperatorPtr& op, RuntimeState* runtime_state);
     Status _mark_operator_closed(OperatorPtr& op, RuntimeState* runtime_state);
     void _close_operators(RuntimeState* runtime_state);
+    // Register _observer to the observable and record it for unregistering.
+    void _observe(PipelineObservable* observable);
+    // Unregister _observer from all the observables, so they don't notify the driver after it is gone.
+    void _unobserve_all();
+    void _notify_operator_finished(const OperatorPtr& op);
 
     void _adjust_memory_usage(RuntimeState* state, MemTracker* tracker, OperatorPtr& op, const ChunkPtr& chunk);
     void _try_to_release_buffer(RuntimeState* state, OperatorPtr& op);
@@ -522,6 +544,11 @@ protected:
 
     workgroup::WorkGroupPtr _workgroup = nullptr;
     DriverQueue* _in_queue = nullptr;
+    PipelineObserverPtr _observer = std::make_shared<PipelineObserver>();
+    // The states observed by _observer, which are unobserved when the driver is finalized or cancelled.
+    std::vector<PipelineObservable*> _observables;
+    bool _is_input_observable = false;
+    bool _is_precondition_observable = false;
     // The index of QuerySharedDriverQueue._queues which this driver belongs to.
     size_t _driver_queue_level = 0;
     std::atomic<bool> _in_ready_queue{false};
@@ -14,12 +14,19 @@
 
 #include "exec/pipeline/pipeline_driver_executor.h"
 
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+
 #include <memory>
 
+#include "common/config.h"
 #include "exec/pipeline/stream_pipeline_driver.h"
 #include "exec/workgroup/work_group.h"
 #include "gutil/strings/substitute.h"
+#include "jemalloc/jemalloc.h"
 #include "runtime/current_thread.h"
+#include "util/cpu_info.h"
 #include "util/debug/query_trace.h"
 #include "util/defer_op.h"
 #include "util/failpoint/fail_point.h"
@@ -32,7 +39,7 @@ GlobalDriverExecutor::GlobalDriverExecutor(const std::string& name, std::unique_
                                            bool enable_resource_group)
         : Base(name),
           _driver_queue(enable_resource_group ? std::unique_ptr<DriverQueue>(std::make_unique<WorkGroupDriverQueue>())
-                                              : std::make_unique<QuerySharedDriverQueue>()),
+                                              : create_query_shared_driver_queue()),
           _thread_pool(std::move(thread_pool)),
           _blocked_driver_poller(new PipelineDriverPoller(_driver_queue.get())),
           _exec_state_reporter(new ExecStateReporter()),
@@ -68,6 +75,51 @@ void GlobalDriverExecutor::change_num_threads(int32_t num_threads) {
     }
 }
 
+// Bind the executor thread to the cores of a NUMA node, and let it allocate memory from a jemalloc arena dedicated to
+// the node, so that the chunks and hash tables built by the drivers executed on the node are placed on the node.
+static void bind_thread_to_numa_node(int node) {
+    // Only the cores allowed by the process, such as the cpuset of cgroup, can be bound.
+    cpu_set_t allowed_cores;
+    CPU_ZERO(&allowed_cores);
+    if (sched_getaffinity(getpid(), sizeof(allowed_cores), &allowed_cores) != 0) {
+        return;
+    }
+    cpu_set_t node_cores;
+    CPU_ZERO(&node_cores);
+    for (int core : CpuInfo::get_cores_of_numa_node(node)) {
+        if (core < CPU_SETSIZE && CPU_ISSET(core, &allowed_cores)) {
+            CPU_SET(core, &node_cores);
+        }
+    }
+    if (CPU_COUNT(&node_cores) == 0) {
+        return;
+    }
+    if (int err = pthread_setaffinity_np(pthread_self(), sizeof(node_cores), &node_cores); err != 0) {
+        LOG(WARNING) << "failed to bind the pipeline executor thread to NUMA node " << node << ", errno=" << err;
+        return;
+    }
+
+#if !defined(ADDRESS_SANITIZER) && !defined(LEAK_SANITIZER) && !defined(THREAD_SANITIZER)
+    static std::mutex arenas_mutex;
+    static std::vector<int64_t> node_arenas(CpuInfo::get_max_num_numa_nodes(), -1);
+    unsigned arena = 0;
+    {
+        std::lock_guard<std::mutex> lock(arenas_mutex);
+        if (node_arenas[node] < 0) {
+            size_t sz = sizeof(arena);
+            if (je_mallctl("arenas.create", &arena, &sz, nullptr, 0) != 0) {
+                LOG(WARNING) << "failed to create the jemalloc arena of NUMA node " << node;
+                return;
+            }
+            node_arenas[node] = arena;
+        }
+        arena = node_arenas[node];
+    }
+    // The pages of the arena are touched firstly by the threads bound to the node, which are allocated on the node.
+    je_mallctl("thread.arena", nullptr, nullptr, &arena, sizeof(arena));
+#endif
+}
+
 void GlobalDriverExecutor::_finalize_driver(DriverRawPtr driver, RuntimeState* runtime_state, DriverState state) {
     DCHECK(driver);
     driver->finalize(runtime_state, state, _schedule_count, _driver_execution_ns);
@@ -77,6 +129,11 @@ void GlobalDriverExecutor::_worker_thread() {
     auto current_thread = Thread::current_thread();
     const int worker_id = _next_id++;
     std::queue<DriverRawPtr> local_driver_queue;
+    // The worker of NumaAwareDriverQueue takes the drivers of the node (worker_id % num_nodes) first.
+    PartitionedDriverQueue::bind_current_thread(worker_id);
+    if (config::enable_pipeline_numa_aware_scheduling && CpuInfo::get_max_num_numa_nodes() > 1) {
+        bind_thread_to_numa_node(worker_id % CpuInfo::get_max_num_numa_nodes());
+    }
     while (true) {
         if (_num_threads_setter.should_shrink()) {
             break;
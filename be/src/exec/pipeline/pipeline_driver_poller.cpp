@@ -14,7 +14,12 @@
 
 #include "pipeline_driver_poller.h"
 
+#include <algorithm>
 #include <chrono>
+
+#include "common/config.h"
+#include "util/time.h"
+
 namespace starrocks::pipeline {
 
 void PipelineDriverPoller::start() {
@@ -46,14 +51,18 @@ void PipelineDriverPoller::run_internal() {
         {
             std::unique_lock<std::mutex> lock(_global_mutex);
             tmp_blocked_drivers.splice(tmp_blocked_drivers.end(), _blocked_drivers);
-            if (_local_blocked_drivers.empty() && tmp_blocked_drivers.empty() && _blocked_drivers.empty()) {
-                std::cv_status cv_status = std::cv_status::no_timeout;
-                while (!_is_shutdown.load(std::memory_order_acquire) && this->_blocked_drivers.empty()) {
-                    cv_status = _cond.wait_for(lock, std::chrono::milliseconds(10));
-                }
-                if (cv_status == std::cv_status::timeout) {
-                    continue;
+            if (_local_blocked_drivers.empty() && tmp_blocked_drivers.empty()) {
+                // No driver needs to be polled, so wait for the new blocked drivers or the notifications, and wake up
+                // periodically, or when waiting for the global runtime filters times out, to check the drivers
+                // waiting for the notifications.
+                int64_t wait_ms = 10;
+                if (!_event_blocked_drivers.empty()) {
+                    wait_ms = std::clamp<int64_t>(_next_check_event_drivers_ms - MonotonicMillis(), 0, wait_ms);
                 }
+                _cond.wait_for(lock, std::chrono::milliseconds(wait_ms), [this] {
+                    return _is_shutdown.load(std::memory_order_acquire) || !_blocked_drivers.empty() ||
+                           _has_pending_events.load(std::memory_order_acquire);
+                });
                 if (_is_shutdown.load(std::memory_order_acquire)) {
                     break;
                 }
@@ -67,79 +76,18 @@ void PipelineDriverPoller::run_internal() {
             if (!tmp_blocked_drivers.empty()) {
                 _local_blocked_drivers.splice(_local_blocked_drivers.end(), tmp_blocked_drivers);
             }
+            _poll_blocked_drivers(_local_blocked_drivers, false, ready_drivers);
 
-            auto driver_it = _local_blocked_drivers.begin();
-            while (driver_it != _local_blocked_drivers.end()) {
-                auto* driver = *driver_it;
-
-                if (!driver->is_query_never_expired() && driver->query_ctx()->is_query_expired()) {
-                    // there are not any drivers belonging to a query context can make progress for an expiration period
-                    // indicates that some fragments are missing because of failed exec_plan_fragment invocation. in
-                    // this situation, query is failed finally, so drivers are marked PENDING_FINISH/FINISH.
-                    //
-                    // If the fragment is expired when the source operator is already pending i/o task,
-                    // The state of driver shouldn't be changed.
-                    size_t expired_log_count = driver->fragment_ctx()->expired_log_count();
-                    if (expired_log_count <= 10) {
-                        LOG(WARNING) << "[Driver] Timeout " << driver->to_readable_string();
-                        driver->fragment_ctx()->set_expired_log_count(++expired_log_count);
-                    }
-                    driver->fragment_ctx()->cancel(
-                            Status::TimedOut(fmt::format("Query exceeded time limit of {} seconds",
-                                                         driver->query_ctx()->get_query_expire_seconds())));
-                    on_cancel(driver, ready_drivers, _local_blocked_drivers, driver_it);
-                } else if (driver->fragment_ctx()->is_canceled()) {
-                    // If the fragment is cancelled when the source operator is already pending i/o task,
-                    // The state of driver shouldn't be changed.
-                    on_cancel(driver, ready_drivers, _local_blocked_drivers, driver_it);
-                } else if (driver->need_report_exec_state()) {
-                    // If the runtime profile is enabled, the driver should be rescheduled after the timeout for triggering
-                    // the profile report prcessing.
-                    remove_blocked_driver(_local_blocked_drivers, driver_it);
-                    ready_drivers.emplace_back(driver);
-                } else if (driver->pending_finish()) {
-                    if (driver->is_still_pending_finish()) {
-                        ++driver_it;
-                    } else {
-                        // driver->pending_finish() return true means that when a driver's sink operator is finished,
-                        // but its source operator still has pending io task that executed in io threads and has
-                        // reference to object outside(such as desc_tbl) owned by FragmentContext. So a driver in
-                        // PENDING_FINISH state should wait for pending io task's completion, then turn into FINISH state,
-                        // otherwise, pending tasks shall reference to destructed objects in FragmentContext since
-                        // FragmentContext is unregistered prematurely.
-                        driver->set_driver_state(driver->fragment_ctx()->is_canceled() ? DriverState::CANCELED
-                                                                                       : DriverState::FINISH);
-                        remove_blocked_driver(_local_blocked_drivers, driver_it);
-                        ready_drivers.emplace_back(driver);
-                    }
-                } else if (driver->is_epoch_finishing()) {
-                    if (driver->is_still_epoch_finishing()) {
-                        ++driver_it;
-                    } else {
-                        driver->set_driver_state(driver->fragment_ctx()->is_canceled() ? DriverState::CANCELED
-                                                                                       : DriverState::EPOCH_FINISH);
-                        remove_blocked_driver(_local_blocked_drivers, driver_it);
-                        ready_drivers.emplace_back(driver);
-                    }
-                } else if (driver->is_epoch_finished()) {
-                    remove_blocked_driver(_local_blocked_drivers, driver_it);
-                    ready_drivers.emplace_back(driver);
-                } else if (driver->is_finished()) {
-                    remove_blocked_driver(_local_blocked_drivers, driver_it);
-                    ready_drivers.emplace_back(driver);
-                } else {
-                    auto status_or_is_not_blocked = driver->is_not_blocked();
-                    if (!status_or_is_not_blocked.ok()) {
-                        driver->fragment_ctx()->cancel(status_or_is_not_blocked.status());
-                        on_cancel(driver, ready_drivers, _local_blocked_drivers, driver_it);
-                    } else if (status_or_is_not_blocked.value()) {
-                        driver->set_driver_state(DriverState::READY);
-                        remove_blocked_driver(_local_blocked_drivers, driver_it);
-                        ready_drivers.emplace_back(driver);
-                    } else {
-                        ++driver_it;
-                    }
-                }
+            // The drivers waiting for the notifications are checked only when notified, except that all of them are
+            // checked periodically, or when waiting for the global runtime filters times out, for the timeout,
+            // cancellation and report of the execution state. _keep_blocked brings the next check forward.
+            int64_t now_ms = MonotonicMillis();
+            bool check_all = now_ms >= _next_check_event_drivers_ms;
+            if (check_all) {
+                _next_check_event_drivers_ms = now_ms + config::pipeline_poller_event_driver_check_interval_ms;
+            }
+            if (_has_pending_events.exchange(false, std::memory_order_acq_rel) || check_all) {
+                _poll_blocked_drivers(_event_blocked_drivers, !check_all, ready_drivers);
             }
         }
 
@@ -175,15 +123,126 @@ void PipelineDriverPoller::run_internal() {
     }
 }
 
+void PipelineDriverPoller::_poll_blocked_drivers(DriverList& blocked_drivers, bool only_notified,
+                                                 std::vector<DriverRawPtr>& ready_drivers) {
+    auto driver_it = blocked_drivers.begin();
+    while (driver_it != blocked_drivers.end()) {
+        auto* driver = *driver_it;
+        // Clear the event before checking the driver, so the notification after the check is not missed.
+        bool has_event = driver->observer()->consume_event();
+        if (only_notified && !has_event) {
+            ++driver_it;
+            continue;
+        }
+
+        if (!driver->is_query_never_expired() && driver->query_ctx()->is_query_expired()) {
+            // there are not any drivers belonging to a query context can make progress for an expiration period
+            // indicates that some fragments are missing because of failed exec_plan_fragment invocation. in
+            // this situation, query is failed finally, so drivers are marked PENDING_FINISH/FINISH.
+            //
+            // If the fragment is expired when the source operator is already pending i/o task,
+            // The state of driver shouldn't be changed.
+            size_t expired_log_count = driver->fragment_ctx()->expired_log_count();
+            if (expired_log_count <= 10) {
+                LOG(WARNING) << "[Driver] Timeout " << driver->to_readable_string();
+                driver->fragment_ctx()->set_expired_log_count(++expired_log_count);
+            }
+            driver->fragment_ctx()->cancel(
+                    Status::TimedOut(fmt::format("Query exceeded time limit of {} seconds",
+                                                 driver->query_ctx()->get_query_expire_seconds())));
+            on_cancel(driver, ready_drivers, blocked_drivers, driver_it);
+        } else if (driver->fragment_ctx()->is_canceled()) {
+            // If the fragment is cancelled when the source operator is already pending i/o task,
+            // The state of driver shouldn't be changed.
+            on_cancel(driver, ready_drivers, blocked_drivers, driver_it);
+        } else if (driver->need_report_exec_state()) {
+            // If the runtime profile is enabled, the driver should be rescheduled after the timeout for triggering
+            // the profile report prcessing.
+            remove_blocked_driver(blocked_drivers, driver_it);
+            ready_drivers.emplace_back(driver);
+        } else if (driver->pending_finish()) {
+            if (driver->is_still_pending_finish()) {
+                _keep_blocked(blocked_drivers, driver_it);
+            } else {
+                // driver->pending_finish() return true means that when a driver's sink operator is finished,
+                // but its source operator still has pending io task that executed in io threads and has
+                // reference to object outside(such as desc_tbl) owned by FragmentContext. So a driver in
+                // PENDING_FINISH state should wait for pending io task's completion, then turn into FINISH state,
+                // otherwise, pending tasks shall reference to destructed objects in FragmentContext since
+                // FragmentContext is unregistered prematurely.
+                driver->set_driver_state(driver->fragment_ctx()->is_canceled() ? DriverState::CANCELED
+                                                                               : DriverState::FINISH);
+                remove_blocked_driver(blocked_drivers, driver_it);
+                ready_drivers.emplace_back(driver);
+            }
+        } else if (driver->is_epoch_finishing()) {
+            if (driver->is_still_epoch_finishing()) {
+                _keep_blocked(blocked_drivers, driver_it);
+            } else {
+                driver->set_driver_state(driver->fragment_ctx()->is_canceled() ? DriverState::CANCELED
+                                                                               : DriverState::EPOCH_FINISH);
+                remove_blocked_driver(blocked_drivers, driver_it);
+                ready_drivers.emplace_back(driver);
+            }
+        } else if (driver->is_epoch_finished()) {
+            remove_blocked_driver(blocked_drivers, driver_it);
+            ready_drivers.emplace_back(driver);
+        } else if (driver->is_finished()) {
+            remove_blocked_driver(blocked_drivers, driver_it);
+            ready_drivers.emplace_back(driver);
+        } else {
+            auto status_or_is_not_blocked = driver->is_not_blocked();
+            if (!status_or_is_not_blocked.ok()) {
+                driver->fragment_ctx()->cancel(status_or_is_not_blocked.status());
+                on_cancel(driver, ready_drivers, blocked_drivers, driver_it);
+            } else if (status_or_is_not_blocked.value()) {
+                driver->set_driver_state(DriverState::READY);
+                remove_blocked_driver(blocked_drivers, driver_it);
+                ready_drivers.emplace_back(driver);
+            } else {
+                _keep_blocked(blocked_drivers, driver_it);
+            }
+        }
+    }
+}
+
+void PipelineDriverPoller::_keep_blocked(DriverList& blocked_drivers, DriverList::iterator& driver_it) {
+    auto* driver = *driver_it;
+    bool is_waiting_for_event = driver->is_waiting_for_event();
+    if (is_waiting_for_event) {
+        // The global runtime filters cannot notify the timeout, so check the driver again when it times out.
+        if (int64_t remaining_ns = driver->global_rf_wait_remaining_ns(); remaining_ns >= 0) {
+            constexpr int64_t nanos_per_milli = NANOS_PER_MICRO * MICROS_PER_MILLI;
+            int64_t timeout_ms = MonotonicMillis() + (remaining_ns + nanos_per_milli - 1) / nanos_per_milli;
+            _next_check_event_drivers_ms = std::min(_next_check_event_drivers_ms, timeout_ms);
+        }
+    }
+    if (is_waiting_for_event == (&blocked_drivers == &_event_blocked_drivers)) {
+        ++driver_it;
+        return;
+    }
+    auto& target_drivers = is_waiting_for_event ? _event_blocked_drivers : _local_blocked_drivers;
+    target_drivers.splice(target_drivers.end(), blocked_drivers, driver_it++);
+}
+
 void PipelineDriverPoller::add_blocked_driver(const DriverRawPtr driver) {
     std::unique_lock<std::mutex> lock(_global_mutex);
     _blocked_drivers.push_back(driver);
     _blocked_driver_queue_len++;
     driver->_pending_timer_sw->reset();
     driver->driver_acct().clean_local_queue_infos();
+    driver->observer()->attach_poller(this);
     _cond.notify_one();
 }
 
+void PipelineDriverPoller::wake_up() {
+    // Only the first notification since the last round of polling needs to wake up the poller thread.
+    if (!_has_pending_events.exchange(true, std::memory_order_acq_rel)) {
+        std::lock_guard<std::mutex> lock(_global_mutex);
+        _cond.notify_one();
+    }
+}
+
 void PipelineDriverPoller::park_driver(const DriverRawPtr driver) {
     std::unique_lock<std::mutex> lock(_global_parked_mutex);
     VLOG_ROW << "Add to parked driver:" << driver->to_readable_string();
@@ -238,7 +297,7 @@ void PipelineDriverPoller::on_cancel(DriverRawPtr driver, std::vector<DriverRawP
     driver->cancel_operators(driver->fragment_ctx()->runtime_state());
     if (driver->is_still_pending_finish()) {
         driver->set_driver_state(DriverState::PENDING_FINISH);
-        ++driver_it;
+        _keep_blocked(local_blocked_drivers, driver_it);
     } else {
         driver->set_driver_state(DriverState::CANCELED);
         remove_blocked_driver(local_blocked_drivers, driver_it);
@@ -251,6 +310,9 @@ void PipelineDriverPoller::iterate_immutable_driver(const IterateImmutableDriver
     for (auto* driver : _local_blocked_drivers) {
         call(driver);
     }
+    for (auto* driver : _event_blocked_drivers) {
+        call(driver);
+    }
 }
 
 } // namespace starrocks::pipeline
@@ -49,6 +49,8 @@ public:
     void remove_blocked_driver(DriverList& local_blocked_drivers, DriverList::iterator& driver_it);
     void on_cancel(DriverRawPtr driver, std::vector<DriverRawPtr>& ready_drivers, DriverList& local_blocked_drivers,
                    DriverList::iterator& driver_it);
+    // Wake up the poller to check the drivers whose observers are notified.
+    void wake_up();
 
     // add driver into the parked driver list
     void park_driver(const DriverRawPtr driver);
@@ -63,6 +65,13 @@ public:
 
 private:
     void run_internal();
+    // Check the blocked drivers and move the ready ones to ready_drivers. Only the drivers whose observers are
+    // notified are checked if only_notified is true.
+    void _poll_blocked_drivers(DriverList& blocked_drivers, bool only_notified,
+                               std::vector<DriverRawPtr>& ready_drivers);
+    // Keep the driver blocked and move driver_it forward. The driver is moved to _event_blocked_drivers if it waits
+    // for the notification, and to _local_blocked_drivers otherwise.
+    void _keep_blocked(DriverList& blocked_drivers, DriverList::iterator& driver_it);
     PipelineDriverPoller(const PipelineDriverPoller&) = delete;
     PipelineDriverPoller& operator=(const PipelineDriverPoller&) = delete;
 
@@ -72,6 +81,11 @@ private:
 
     mutable std::shared_mutex _local_mutex;
     DriverList _local_blocked_drivers;
+    // The blocked drivers waiting for the notifications of their observers, which needn't be polled continuously.
+    DriverList _event_blocked_drivers;
+    std::atomic<bool> _has_pending_events = false;
+    // When to check all the drivers in _event_blocked_drivers next time, which is only accessed by the polling thread.
+    int64_t _next_check_event_drivers_ms = 0;
 
     DriverQueue* _driver_queue;
     scoped_refptr<Thread> _polling_thread;
@@ -14,9 +14,12 @@
 
 #include "exec/pipeline/pipeline_driver_queue.h"
 
+#include "common/config.h"
 #include "exec/pipeline/source_operator.h"
 #include "exec/workgroup/work_group.h"
 #include "gutil/strings/substitute.h"
+#include "util/cpu_info.h"
+#include "util/hash_util.hpp"
 
 namespace starrocks::pipeline {
 
@@ -141,14 +144,11 @@ void QuerySharedDriverQueue::cancel(DriverRawPtr driver) {
 }
 
 size_t QuerySharedDriverQueue::size() const {
-    std::lock_guard<std::mutex> lock(_global_mutex);
-
     return _num_drivers;
 }
 
 void QuerySharedDriverQueue::update_statistics(const DriverRawPtr driver) {
-    std::lock_guard<std::mutex> lock(_global_mutex);
-
+    // The accumulated time of the sub queue is atomic.
     _queues[driver->get_driver_queue_level()].update_accu_time(driver);
 }
 
@@ -204,6 +204,146 @@ DriverRawPtr SubQuerySharedDriverQueue::take(const bool block) {
     return nullptr;
 }
 
+/// PartitionedDriverQueue.
+thread_local int PartitionedDriverQueue::_tls_partition = 0;
+
+PartitionedDriverQueue::PartitionedDriverQueue(int num_partitions)
+        : _partition_cvs(num_partitions), _num_waiting_threads(num_partitions, 0), _num_signals(num_partitions, 0) {
+    DCHECK_GT(num_partitions, 0);
+    _partitions.reserve(num_partitions);
+    for (int i = 0; i < num_partitions; ++i) {
+        _partitions.emplace_back(std::make_unique<QuerySharedDriverQueue>());
+    }
+}
+
+void PartitionedDriverQueue::close() {
+    for (auto& partition : _partitions) {
+        partition->close();
+    }
+    std::lock_guard<std::mutex> lock(_global_mutex);
+    _is_closed = true;
+    for (auto& cv : _partition_cvs) {
+        cv.notify_all();
+    }
+}
+
+void PartitionedDriverQueue::put_back(const DriverRawPtr driver) {
+    int partition = _partition_of(driver);
+    _partitions[partition]->put_back(driver);
+    _notify(partition);
+}
+
+void PartitionedDriverQueue::put_back(const std::vector<DriverRawPtr>& drivers) {
+    for (const auto& driver : drivers) {
+        put_back(driver);
+    }
+}
+
+void PartitionedDriverQueue::put_back_from_executor(const DriverRawPtr driver) {
+    int partition = _partition_of(driver);
+    _partitions[partition]->put_back_from_executor(driver);
+    _notify(partition);
+}
+
+void PartitionedDriverQueue::update_statistics(const DriverRawPtr driver) {
+    _partitions[_partition_of(driver)]->update_statistics(driver);
+}
+
+StatusOr<DriverRawPtr> PartitionedDriverQueue::take(const bool block) {
+    const int num_partitions = _partitions.size();
+    const int local_partition = _tls_partition % num_partitions;
+    while (true) {
+        // Take the driver of the local partition first, and then steal from the other partitions.
+        for (int i = 0; i < num_partitions; ++i) {
+            int partition = (local_partition + i) % num_partitions;
+            if (_partitions[partition]->empty()) {
+                continue;
+            }
+            ASSIGN_OR_RETURN(auto* driver, _partitions[partition]->take(false));
+            if (driver != nullptr) {
+                if (partition != local_partition) {
+                    _num_stolen_drivers++;
+                }
+                return driver;
+            }
+        }
+        if (!block) {
+            return nullptr;
+        }
+
+        std::unique_lock<std::mutex> lock(_global_mutex);
+        if (_is_closed) {
+            return Status::Cancelled("Shutdown");
+        }
+        // put_back() skips notifying when there is no waiting thread, so announce waiting before checking the size
+        // again, otherwise the driver put back after the above attempt may be missed.
+        ++_num_waiting_threads[local_partition];
+        ++_num_total_waiting_threads;
+        if (size() == 0) {
+            _partition_cvs[local_partition].wait(
+                    lock, [this, local_partition] { return _is_closed || _num_signals[local_partition] > 0; });
+        }
+        if (_num_signals[local_partition] > 0) {
+            --_num_signals[local_partition];
+        }
+        --_num_total_waiting_threads;
+        --_num_waiting_threads[local_partition];
+    }
+}
+
+void PartitionedDriverQueue::cancel(DriverRawPtr driver) {
+    int partition = _partition_of(driver);
+    _partitions[partition]->cancel(driver);
+    _notify(partition);
+}
+
+size_t PartitionedDriverQueue::size() const {
+    size_t size = 0;
+    for (const auto& partition : _partitions) {
+        size += partition->size();
+    }
+    return size;
+}
+
+void PartitionedDriverQueue::_notify(int partition) {
+    if (_num_total_waiting_threads == 0) {
+        return;
+    }
+    const int num_partitions = _partitions.size();
+    std::lock_guard<std::mutex> lock(_global_mutex);
+    for (int i = 0; i < num_partitions; ++i) {
+        int target = (partition + i) % num_partitions;
+        // The woken thread has not consumed its signal yet, so wake up another one.
+        if (_num_waiting_threads[target] > _num_signals[target]) {
+            ++_num_signals[target];
+            _partition_cvs[target].notify_one();
+            return;
+        }
+    }
+}
+
+/// ShardedDriverQueue.
+int ShardedDriverQueue::_partition_of(const DriverRawPtr driver) const {
+    return HashUtil::hash64(&driver, sizeof(driver), 0) % num_partitions();
+}
+
+/// NumaAwareDriverQueue.
+int NumaAwareDriverQueue::_partition_of(const DriverRawPtr driver) const {
+    uint64_t instance_id = driver->fragment_ctx()->fragment_instance_id().lo;
+    return instance_id % num_partitions();
+}
+
+DriverQueuePtr create_query_shared_driver_queue() {
+    int num_nodes = CpuInfo::get_max_num_numa_nodes();
+    if (config::enable_pipeline_numa_aware_scheduling && num_nodes > 1) {
+        return std::make_unique<NumaAwareDriverQueue>(num_nodes);
+    }
+    if (config::pipeline_driver_queue_num_shards > 1) {
+        return std::make_unique<ShardedDriverQueue>(config::pipeline_driver_queue_num_shards);
+    }
+    return std::make_unique<QuerySharedDriverQueue>();
+}
+
 /// WorkGroupDriverQueue.
 bool WorkGroupDriverQueue::WorkGroupDriverSchedEntityComparator::operator()(
         const WorkGroupDriverSchedEntityPtr& lhs_ptr, const WorkGroupDriverSchedEntityPtr& rhs_ptr) const {
@@ -136,13 +136,103 @@ private:
     // The time slice of the i-th level is (i+1)*LEVEL_TIME_SLICE_BASE ns.
     int64_t _level_time_slices[QUEUE_SIZE];
 
-    size_t _num_drivers = 0;
+    // Atomic to let size() skip the lock, and it is only modified under the lock.
+    std::atomic<size_t> _num_drivers = 0;
 
     mutable std::mutex _global_mutex;
     std::condition_variable _cv;
     bool _is_closed = false;
 };
 
+// PartitionedDriverQueue splits the ready drivers into several QuerySharedDriverQueues, each of which has its own lock,
+// so that the executor threads putting and taking the drivers contend on different locks. The subclass decides the
+// partition of a driver, which must not change during the lifetime of the driver.
+// The executor thread bound to a partition by bind_current_thread() takes the drivers from its own partition first, and
+// steals the drivers from the other partitions only when its own partition has no ready driver.
+class PartitionedDriverQueue : public DriverQueue {
+public:
+    explicit PartitionedDriverQueue(int num_partitions);
+    ~PartitionedDriverQueue() override = default;
+    void close() override;
+    void put_back(const DriverRawPtr driver) override;
+    void put_back(const std::vector<DriverRawPtr>& drivers) override;
+    void put_back_from_executor(const DriverRawPtr driver) override;
+
+    void update_statistics(const DriverRawPtr driver) override;
+
+    // Return cancelled status, if the queue is closed.
+    StatusOr<DriverRawPtr> take(const bool block) override;
+
+    void cancel(DriverRawPtr driver) override;
+
+    size_t size() const override;
+
+    bool should_yield(const DriverRawPtr driver, int64_t unaccounted_runtime_ns) const override { return false; }
+
+    int num_partitions() const { return _partitions.size(); }
+    int64_t num_stolen_drivers() const { return _num_stolen_drivers; }
+
+    // The partition of the executor thread calling take() is `partition % num_partitions()`. The thread which is not
+    // bound takes the drivers from the partition 0 firstly.
+    static void bind_current_thread(int partition) { _tls_partition = partition; }
+
+protected:
+    virtual int _partition_of(const DriverRawPtr driver) const = 0;
+
+private:
+    // Wake up a thread waiting for the drivers of the partition, or the idle thread of the other partitions.
+    void _notify(int partition);
+
+private:
+    static thread_local int _tls_partition;
+
+    std::vector<std::unique_ptr<QuerySharedDriverQueue>> _partitions;
+
+    // The threads waiting for the drivers are woken up by the condition variable of their partitions.
+    mutable std::mutex _global_mutex;
+    std::vector<std::condition_variable> _partition_cvs;
+    std::vector<int> _num_waiting_threads;
+    // The number of the woken threads of each partition, which have not returned from waiting yet.
+    std::vector<int> _num_signals;
+    // Let put_back() skip the global lock when no thread is waiting.
+    std::atomic<int> _num_total_waiting_threads = 0;
+    bool _is_closed = false;
+
+    std::atomic<int64_t> _num_stolen_drivers = 0;
+};
+
+// ShardedDriverQueue spreads the ready drivers evenly over the shards, which reduces the contention on the lock of
+// QuerySharedDriverQueue when a lot of executor threads run short-lived drivers. The multi-level feedback priorities
+// are kept inside each shard.
+class ShardedDriverQueue final : public FactoryMethod<PartitionedDriverQueue, ShardedDriverQueue> {
+    friend class FactoryMethod<PartitionedDriverQueue, ShardedDriverQueue>;
+
+public:
+    explicit ShardedDriverQueue(int num_shards) : FactoryMethod(num_shards) {}
+    ~ShardedDriverQueue() override = default;
+
+protected:
+    int _partition_of(const DriverRawPtr driver) const override;
+};
+
+// NumaAwareDriverQueue partitions the ready drivers per NUMA node. The drivers of a fragment instance are always put
+// to the partition of the same node, and the executor thread bound to a node takes the drivers of its node first.
+class NumaAwareDriverQueue final : public FactoryMethod<PartitionedDriverQueue, NumaAwareDriverQueue> {
+    friend class FactoryMethod<PartitionedDriverQueue, NumaAwareDriverQueue>;
+
+public:
+    explicit NumaAwareDriverQueue(int num_nodes) : FactoryMethod(num_nodes) {}
+    ~NumaAwareDriverQueue() override = default;
+
+protected:
+    int _partition_of(const DriverRawPtr driver) const override;
+};
+
+// Create the queue of the drivers sharing the executor threads, which is NumaAwareDriverQueue when
+// enable_pipeline_numa_aware_scheduling is on and there are multiple NUMA nodes, ShardedDriverQueue when
+// pipeline_driver_queue_num_shards is greater than 1, and QuerySharedDriverQueue otherwise.
+DriverQueuePtr create_query_shared_driver_queue();
+
 // WorkGroupDriverQueue contains two levels of queues.
 // The first level is the work group queue, and the second level is the driver queue in a work group.
 class WorkGroupDriverQueue : public FactoryMethod<DriverQueue, WorkGroupDriverQueue> {
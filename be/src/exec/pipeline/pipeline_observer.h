@@ -0,0 +1,80 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace starrocks::pipeline {
+
+class PipelineDriverPoller;
+class PipelineObserver;
+using PipelineObserverPtr = std::shared_ptr<PipelineObserver>;
+
+// PipelineObserver belongs to a driver, and is notified when the state the blocked driver waits for may change, e.g.
+// chunks arrive at the exchange source, or the runtime filters are ready. The notified driver is checked by
+// PipelineDriverPoller at once, and the driver waiting for the notification needn't be polled at all.
+// The observer is shared by the driver and the states it observes, so it can be notified after the driver is gone.
+class PipelineObserver {
+public:
+    // Mark the driver has a pending event and wake up the poller holding the driver, which is called by the thread
+    // changing the state, after the state has been changed.
+    void notify();
+
+    // Return true and clear the event, if the observer has been notified since the last call.
+    bool consume_event() {
+        return _has_event.load(std::memory_order_relaxed) && _has_event.exchange(false, std::memory_order_acq_rel);
+    }
+
+    // Called by the poller when the driver is blocked in it.
+    void attach_poller(PipelineDriverPoller* poller) { _poller.store(poller, std::memory_order_release); }
+
+private:
+    std::atomic<bool> _has_event = false;
+    std::atomic<PipelineDriverPoller*> _poller = nullptr;
+};
+
+// PipelineObservable is the state observed by the drivers, which notifies all of them when the state changes.
+class PipelineObservable {
+public:
+    void add_observer(const PipelineObserverPtr& observer) {
+        std::lock_guard<std::mutex> l(_mutex);
+        _observers.emplace_back(observer);
+    }
+
+    void remove_observer(const PipelineObserverPtr& observer) {
+        std::lock_guard<std::mutex> l(_mutex);
+        auto it = std::find(_observers.begin(), _observers.end(), observer);
+        if (it != _observers.end()) {
+            _observers.erase(it);
+        }
+    }
+
+    void notify_observers() {
+        std::lock_guard<std::mutex> l(_mutex);
+        for (auto& observer : _observers) {
+            observer->notify();
+        }
+    }
+
+private:
+    std::mutex _mutex;
+    std::vector<PipelineObserverPtr> _observers;
+};
+
+} // namespace starrocks::pipeline
@@ -19,6 +19,7 @@
 
 #include "common/statusor.h"
 #include "exec/hash_join_node.h"
+#include "exec/pipeline/pipeline_observer.h"
 #include "exprs/expr_context.h"
 #include "exprs/predicate.h"
 #include "exprs/runtime_filter_bank.h"
@@ -116,13 +117,17 @@ public:
         DCHECK(_collector.load(std::memory_order_acquire) == nullptr);
         _collector_ownership = std::move(collector);
         _collector.store(_collector_ownership.get(), std::memory_order_release);
+        _observable.notify_observers();
     }
     RuntimeFilterCollector* get_collector() { return _collector.load(std::memory_order_acquire); }
     bool is_ready() { return get_collector() != nullptr; }
+    // Notifies the observers of the drivers when the holder becomes ready.
+    PipelineObservable* observable() { return &_observable; }
 
 private:
     RuntimeFilterCollectorPtr _collector_ownership;
     std::atomic<RuntimeFilterCollector*> _collector;
+    PipelineObservable _observable;
 };
 
 // RuntimeFilterHub is a mediator that used to gather all runtime filters generated by RuntimeFilterBuild instances.
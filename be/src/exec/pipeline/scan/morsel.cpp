@@ -16,8 +16,10 @@
 
 #include <fmt/compile.h>
 
+#include <algorithm>
 #include <memory>
 
+#include "common/config.h"
 #include "common/statusor.h"
 #include "exec/olap_utils.h"
 #include "storage/chunk_helper.h"
@@ -35,11 +37,17 @@ namespace starrocks::pipeline {
 
 const std::vector<BaseRowsetSharedPtr> ScanMorselX::kEmptyRowsets;
 
+void ScanMorselX::init_tablet_reader_params(TabletReaderParams* params) {
+    params->rowid_range_splitter = _rowid_range_splitter;
+}
+
 void PhysicalSplitScanMorsel::init_tablet_reader_params(TabletReaderParams* params) {
+    ScanMorsel::init_tablet_reader_params(params);
     params->rowid_range_option = _rowid_range_option;
 }
 
 void LogicalSplitScanMorsel::init_tablet_reader_params(TabletReaderParams* params) {
+    ScanMorsel::init_tablet_reader_params(params);
     params->short_key_ranges_option = _short_key_ranges_option;
 }
 
@@ -57,7 +65,7 @@ size_t IndividualMorselQueueFactory::num_original_morsels() const {
 }
 
 IndividualMorselQueueFactory::IndividualMorselQueueFactory(std::map<int, MorselQueuePtr>&& queue_per_driver_seq,
-                                                           bool could_local_shuffle)
+                                                           bool could_local_shuffle, bool could_split_running_morsels)
         : _could_local_shuffle(could_local_shuffle) {
     if (queue_per_driver_seq.empty()) {
         _queue_per_driver_seq.emplace_back(pipeline::create_empty_morsel_queue());
@@ -74,6 +82,33 @@ IndividualMorselQueueFactory::IndividualMorselQueueFactory(std::map<int, MorselQ
             _queue_per_driver_seq.emplace_back(std::move(it->second));
         }
     }
+
+    // Only the morsels which could be local shuffled are free to be processed by any driver. They are always in the
+    // fixed or dynamic morsel queues, while the split morsel queues are either shared by all the drivers or bound to
+    // the drivers.
+    bool could_steal = could_local_shuffle && config::enable_scan_morsel_stealing && _queue_per_driver_seq.size() > 1;
+    for (const auto& queue : _queue_per_driver_seq) {
+        could_steal &= queue->type() == MorselQueue::Type::FIXED || queue->type() == MorselQueue::Type::DYNAMIC;
+    }
+    if (could_steal) {
+        std::vector<WorkStealingMorselQueue*> queues;
+        queues.reserve(_queue_per_driver_seq.size());
+        for (auto& queue : _queue_per_driver_seq) {
+            auto work_stealing_queue =
+                    std::make_unique<WorkStealingMorselQueue>(std::move(queue), could_split_running_morsels);
+            queues.emplace_back(work_stealing_queue.get());
+            queue = std::move(work_stealing_queue);
+        }
+        for (size_t i = 0; i < queues.size(); ++i) {
+            // Start from the next driver, so that the drivers do not steal from the same victim at the same time.
+            std::vector<WorkStealingMorselQueue*> victim_queues;
+            victim_queues.reserve(queues.size() - 1);
+            for (size_t j = 1; j < queues.size(); ++j) {
+                victim_queues.emplace_back(queues[(i + j) % queues.size()]);
+            }
+            queues[i]->set_victim_queues(std::move(victim_queues));
+        }
+    }
 }
 
 BucketSequenceMorselQueueFactory::BucketSequenceMorselQueueFactory(std::map<int, MorselQueuePtr>&& queue_per_driver_seq,
@@ -124,24 +159,75 @@ void MorselQueue::unget(MorselPtr&& morsel) {
     _unget_morsel = std::move(morsel);
 }
 
+FixedMorselQueue::FixedMorselQueue(Morsels&& morsels) : MorselQueue(std::move(morsels)) {
+    _range = _pack(0, static_cast<uint32_t>(_num_morsels));
+    _need_tablet_rowsets = std::any_of(_morsels.begin(), _morsels.end(), [](const MorselPtr& morsel) {
+        auto* scan_morsel = dynamic_cast<ScanMorsel*>(morsel.get());
+        return scan_morsel != nullptr && scan_morsel->get_scan_range()->__isset.internal_scan_range;
+    });
+}
+
+bool FixedMorselQueue::empty() const {
+    uint64_t range = _range.load();
+    return _unget_morsel == nullptr && _begin_of(range) >= _end_of(range);
+}
+
 StatusOr<MorselPtr> FixedMorselQueue::try_get() {
     if (_unget_morsel != nullptr) {
         return std::move(_unget_morsel);
     }
-    auto idx = _pop_index.load();
-    // prevent _num_morsels from superfluous addition
-    if (idx >= _num_morsels) {
-        return nullptr;
+    uint64_t range = _range.load();
+    uint32_t idx;
+    do {
+        idx = _begin_of(range);
+        if (idx >= _end_of(range)) {
+            return nullptr;
+        }
+    } while (!_range.compare_exchange_weak(range, _pack(idx + 1, _end_of(range))));
+    if (!_tablet_rowsets.empty()) {
+        _morsels[idx]->set_rowsets(_tablet_rowsets[idx]);
     }
-    idx = _pop_index.fetch_add(1);
-    if (idx < _num_morsels) {
+    return std::move(_morsels[idx]);
+}
+
+void FixedMorselQueue::set_tablet_rowsets(const std::vector<std::vector<BaseRowsetSharedPtr>>& tablet_rowsets) {
+    MorselQueue::set_tablet_rowsets(tablet_rowsets);
+    _has_tablet_rowsets.store(true, std::memory_order_release);
+}
+
+bool FixedMorselQueue::has_stealable_morsels() const {
+    if (_need_tablet_rowsets && !_has_tablet_rowsets.load(std::memory_order_acquire)) {
+        return false;
+    }
+    uint64_t range = _range.load();
+    return _begin_of(range) < _end_of(range);
+}
+
+size_t FixedMorselQueue::steal(Morsels* morsels) {
+    if (_need_tablet_rowsets && !_has_tablet_rowsets.load(std::memory_order_acquire)) {
+        return 0;
+    }
+    // The owner pops the morsels from the begin, and the thief takes the half at the end.
+    uint64_t range = _range.load();
+    uint32_t begin;
+    uint32_t end;
+    uint32_t num_stolen;
+    do {
+        begin = _begin_of(range);
+        end = _end_of(range);
+        if (begin >= end) {
+            return 0;
+        }
+        num_stolen = (end - begin + 1) / 2;
+    } while (!_range.compare_exchange_weak(range, _pack(begin, end - num_stolen)));
+
+    for (uint32_t idx = end - num_stolen; idx < end; idx++) {
         if (!_tablet_rowsets.empty()) {
             _morsels[idx]->set_rowsets(_tablet_rowsets[idx]);
         }
-        return std::move(_morsels[idx]);
-    } else {
-        return nullptr;
+        morsels->emplace_back(std::move(_morsels[idx]));
     }
+    return num_stolen;
 }
 
 BucketSequenceMorselQueue::BucketSequenceMorselQueue(MorselQueuePtr&& morsel_queue)
@@ -857,6 +943,26 @@ void DynamicMorselQueue::unget(MorselPtr&& morsel) {
     _queue.emplace_front(std::move(morsel));
 }
 
+size_t DynamicMorselQueue::steal(Morsels* morsels) {
+    std::lock_guard<std::mutex> _l(_mutex);
+    // The morsels of a tablet must be processed by the same driver when the query cache is used.
+    if (_ticket_checker != nullptr || _queue.empty()) {
+        return 0;
+    }
+    // The owner pops the morsels from the front, and the thief takes the half at the tail.
+    size_t num_stolen = (_queue.size() + 1) / 2;
+    auto first = _queue.end() - num_stolen;
+    morsels->insert(morsels->end(), std::make_move_iterator(first), std::make_move_iterator(_queue.end()));
+    _queue.erase(first, _queue.end());
+    _size -= num_stolen;
+    return num_stolen;
+}
+
+bool DynamicMorselQueue::has_stealable_morsels() const {
+    std::lock_guard<std::mutex> _l(_mutex);
+    return _ticket_checker == nullptr && !_queue.empty();
+}
+
 void DynamicMorselQueue::append_morsels(std::vector<MorselPtr>&& morsels) {
     std::lock_guard<std::mutex> _l(_mutex);
     _size += morsels.size();
@@ -865,4 +971,127 @@ void DynamicMorselQueue::append_morsels(std::vector<MorselPtr>&& morsels) {
     _queue.insert(_queue.begin(), std::make_move_iterator(morsels.begin()), std::make_move_iterator(morsels.end()));
 }
 
+bool WorkStealingMorselQueue::empty() const {
+    if (!_local_queue->empty()) {
+        return false;
+    }
+    {
+        std::lock_guard<std::mutex> l(_mutex);
+        if (!_stolen_morsels.empty()) {
+            return false;
+        }
+    }
+    if (!_enable_steal) {
+        return true;
+    }
+    // A victim whose morsels can't be stolen now, e.g. its rowsets are not captured yet, isn't counted, otherwise
+    // the driver would keep polling try_get() in vain.
+    return std::none_of(_victim_queues.begin(), _victim_queues.end(), [](const WorkStealingMorselQueue* victim_queue) {
+        return victim_queue->has_stealable_morsels() || victim_queue->has_splittable_morsels();
+    });
+}
+
+StatusOr<MorselPtr> WorkStealingMorselQueue::try_get() {
+    ASSIGN_OR_RETURN(auto morsel, _local_queue->try_get());
+    if (morsel == nullptr) {
+        std::lock_guard<std::mutex> l(_mutex);
+        if (!_stolen_morsels.empty()) {
+            morsel = std::move(_stolen_morsels.front());
+            _stolen_morsels.pop_front();
+        }
+    }
+    if (morsel != nullptr) {
+        _add_running_morsel(morsel.get());
+        return morsel;
+    }
+    if (!_enable_steal) {
+        return nullptr;
+    }
+
+    const size_t next_victim = _next_victim.load();
+    for (size_t i = 0; i < _victim_queues.size(); ++i) {
+        auto* victim_queue = _victim_queues[(next_victim + i) % _victim_queues.size()];
+        Morsels stolen_morsels;
+        if (victim_queue->steal(&stolen_morsels) == 0) {
+            continue;
+        }
+        _next_victim = (next_victim + i + 1) % _victim_queues.size();
+        _num_stolen_morsels += stolen_morsels.size();
+        morsel = std::move(stolen_morsels.front());
+        {
+            std::lock_guard<std::mutex> l(_mutex);
+            _stolen_morsels.insert(_stolen_morsels.end(), std::make_move_iterator(stolen_morsels.begin() + 1),
+                                   std::make_move_iterator(stolen_morsels.end()));
+        }
+        _add_running_morsel(morsel.get());
+        return morsel;
+    }
+
+    // No morsel is left to be stolen, so split the morsels being scanned by the other drivers.
+    for (size_t i = 0; i < _victim_queues.size(); ++i) {
+        auto* victim_queue = _victim_queues[(next_victim + i) % _victim_queues.size()];
+        morsel = victim_queue->split_running_morsel();
+        if (morsel == nullptr) {
+            continue;
+        }
+        _next_victim = (next_victim + i + 1) % _victim_queues.size();
+        _num_stolen_morsels += 1;
+        _add_running_morsel(morsel.get());
+        return morsel;
+    }
+    return nullptr;
+}
+
+void WorkStealingMorselQueue::_add_running_morsel(Morsel* morsel) {
+    if (!_could_split_running_morsels || !_enable_steal ||
+        !morsel->get_scan_range()->__isset.internal_scan_range) {
+        return;
+    }
+    auto splitter = std::make_shared<RowidRangeSplitter>();
+    morsel->set_rowid_range_splitter(splitter);
+
+    std::lock_guard<std::mutex> l(_mutex);
+    // Remove the morsels which have been scanned.
+    _running_morsels.erase(std::remove_if(_running_morsels.begin(), _running_morsels.end(),
+                                          [](const RunningMorsel& running) { return running.splitter.expired(); }),
+                           _running_morsels.end());
+    _running_morsels.emplace_back(
+            RunningMorsel{splitter, morsel->get_plan_node_id(), *morsel->get_scan_range(), &morsel->rowsets()});
+}
+
+bool WorkStealingMorselQueue::has_splittable_morsels() const {
+    if (!_enable_steal) {
+        return false;
+    }
+    const auto min_rows = static_cast<uint32_t>(config::tablet_internal_parallel_min_splitted_scan_rows);
+    std::lock_guard<std::mutex> l(_mutex);
+    return std::any_of(_running_morsels.begin(), _running_morsels.end(), [min_rows](const RunningMorsel& running) {
+        auto splitter = running.splitter.lock();
+        return splitter != nullptr && splitter->could_split(min_rows);
+    });
+}
+
+MorselPtr WorkStealingMorselQueue::split_running_morsel() {
+    if (!_enable_steal) {
+        return nullptr;
+    }
+    const auto min_rows = static_cast<uint32_t>(config::tablet_internal_parallel_min_splitted_scan_rows);
+    std::lock_guard<std::mutex> l(_mutex);
+    for (const auto& running : _running_morsels) {
+        auto splitter = running.splitter.lock();
+        if (splitter == nullptr) {
+            continue;
+        }
+        auto rowid_range_option = splitter->split(min_rows);
+        if (rowid_range_option == nullptr) {
+            continue;
+        }
+        auto morsel = std::make_unique<PhysicalSplitScanMorsel>(running.plan_node_id, running.scan_range,
+                                                                std::move(rowid_range_option));
+        morsel->set_rowsets(*running.rowsets);
+        return morsel;
+    }
+    return nullptr;
+}
+
 } // namespace starrocks::pipeline
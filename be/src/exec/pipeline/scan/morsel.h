@@ -71,7 +71,7 @@ public:
 
     int32_t get_plan_node_id() const { return _plan_node_id; }
 
-    virtual void init_tablet_reader_params(TabletReaderParams* params) {}
+    virtual void init_tablet_reader_params(TabletReaderParams* params);
 
     virtual std::tuple<int64_t, int64_t> get_lane_owner_and_version() const {
         return std::tuple<int64_t, int64_t>{0L, 0L};
@@ -101,9 +101,14 @@ public:
         return metrics;
     }
 
+    // The rows of the morsel which are not read yet could be split off by the idle drivers of the same scan through
+    // it, see WorkStealingMorselQueue.
+    void set_rowid_range_splitter(RowidRangeSplitterPtr splitter) { _rowid_range_splitter = std::move(splitter); }
+
 private:
     int32_t _plan_node_id;
     int64_t _from_version = 0;
+    RowidRangeSplitterPtr _rowid_range_splitter;
 
     static const std::vector<BaseRowsetSharedPtr> kEmptyRowsets;
     // _rowsets is owned by MorselQueue, whose lifecycle is longer than that of Morsel.
@@ -265,7 +270,10 @@ private:
 
 class IndividualMorselQueueFactory final : public MorselQueueFactory {
 public:
-    IndividualMorselQueueFactory(std::map<int, MorselQueuePtr>&& queue_per_driver_seq, bool could_local_shuffle);
+    // `could_split_running_morsels` means that the pending rows of an OLAP tablet being scanned by a driver could be
+    // split off by the idle drivers, see WorkStealingMorselQueue.
+    IndividualMorselQueueFactory(std::map<int, MorselQueuePtr>&& queue_per_driver_seq, bool could_local_shuffle,
+                                 bool could_split_running_morsels = false);
     ~IndividualMorselQueueFactory() override = default;
 
     MorselQueue* create(int driver_sequence) override {
@@ -344,6 +352,12 @@ public:
     virtual StatusOr<bool> ready_for_next() const { return true; }
     virtual void append_morsels(Morsels&& morsels) {}
     virtual Type type() const = 0;
+    // Move about half of the pending morsels to `morsels` for an idle driver of the same scan, which steals them from
+    // the tail of this queue. Return the number of the stolen morsels.
+    virtual size_t steal(Morsels* morsels) { return 0; }
+    // Whether steal() could move any morsel now.
+    virtual bool has_stealable_morsels() const { return false; }
+    virtual size_t num_stolen_morsels() const { return 0; }
 
 protected:
     Morsels _morsels;
@@ -356,16 +370,29 @@ protected:
 // The morsel queue with a fixed number of morsels, which is determined in the constructor.
 class FixedMorselQueue final : public MorselQueue {
 public:
-    explicit FixedMorselQueue(Morsels&& morsels) : MorselQueue(std::move(morsels)), _pop_index(0) {}
+    explicit FixedMorselQueue(Morsels&& morsels);
     ~FixedMorselQueue() override = default;
-    bool empty() const override { return _unget_morsel == nullptr && _pop_index >= _num_morsels; }
+    bool empty() const override;
     StatusOr<MorselPtr> try_get() override;
+    void set_tablet_rowsets(const std::vector<std::vector<BaseRowsetSharedPtr>>& tablet_rowsets) override;
+    size_t steal(Morsels* morsels) override;
+    bool has_stealable_morsels() const override;
 
     std::string name() const override { return "fixed_morsel_queue"; }
     Type type() const override { return FIXED; }
 
 private:
-    std::atomic<size_t> _pop_index;
+    static uint64_t _pack(uint32_t begin, uint32_t end) { return (static_cast<uint64_t>(begin) << 32) | end; }
+    static uint32_t _begin_of(uint64_t range) { return static_cast<uint32_t>(range >> 32); }
+    static uint32_t _end_of(uint64_t range) { return static_cast<uint32_t>(range); }
+
+    // The pending morsels are [begin, end) packed in one word: the owner pops them from the begin, and the thief
+    // steals them from the end.
+    std::atomic<uint64_t> _range;
+    // The morsels of the OLAP tablets carry the rowsets captured by the OlapScanPrepareOperator of this queue, so they
+    // can't be stolen before the rowsets are set.
+    bool _need_tablet_rowsets = false;
+    std::atomic<bool> _has_tablet_rowsets = false;
 };
 
 class BucketSequenceMorselQueue : public MorselQueue {
@@ -567,6 +594,8 @@ public:
     void unget(MorselPtr&& morsel) override;
     std::string name() const override { return "dynamic_morsel_queue"; }
     void append_morsels(Morsels&& morsels) override;
+    size_t steal(Morsels* morsels) override;
+    bool has_stealable_morsels() const override;
     void set_ticket_checker(const query_cache::TicketCheckerPtr& ticket_checker) override {
         _ticket_checker = ticket_checker;
     }
@@ -579,11 +608,96 @@ public:
 private:
     std::atomic<int64_t> _size = 0;
     std::deque<MorselPtr> _queue;
-    std::mutex _mutex;
+    mutable std::mutex _mutex;
     query_cache::TicketCheckerPtr _ticket_checker;
     size_t _degree_of_parallelism;
 };
 
+// The morsel queue of one driver, which steals the morsels from the queues of the other drivers of the same scan after
+// its own morsels run out. A skewed tablet is split into the rowid or short key ranges by the driver scanning it, and
+// the splits are appended to the queue of this driver (see ConnectorChunkSource), so the idle drivers take over half of
+// the remaining ranges at a time, instead of waiting for the driver to drain them.
+//
+// The stolen morsels are kept by this queue rather than the local queue, since a FixedMorselQueue can't be appended
+// to. They are not stolen again.
+//
+// When no morsel is left to steal, an idle driver splits off the tail half of the pending rowids of the largest
+// segment being scanned by another driver, if both halves have at least tablet_internal_parallel_min_splitted_scan_rows
+// rows. The split is scanned as a PhysicalSplitScanMorsel, and could be split again. See RowidRangeSplitter.
+class WorkStealingMorselQueue final : public MorselQueue {
+public:
+    WorkStealingMorselQueue(MorselQueuePtr&& local_queue, bool could_split_running_morsels)
+            : _local_queue(std::move(local_queue)), _could_split_running_morsels(could_split_running_morsels) {}
+    ~WorkStealingMorselQueue() override = default;
+
+    // The queues of the other drivers, which are owned by IndividualMorselQueueFactory.
+    void set_victim_queues(std::vector<WorkStealingMorselQueue*> victim_queues) {
+        _victim_queues = std::move(victim_queues);
+    }
+
+    std::vector<TInternalScanRange*> prepare_olap_scan_ranges() const override {
+        return _local_queue->prepare_olap_scan_ranges();
+    }
+    void set_key_ranges(const std::vector<std::unique_ptr<OlapScanRange>>& key_ranges) override {
+        _local_queue->set_key_ranges(key_ranges);
+    }
+    void set_tablets(const std::vector<BaseTabletSharedPtr>& tablets) override { _local_queue->set_tablets(tablets); }
+    void set_tablet_rowsets(const std::vector<std::vector<BaseRowsetSharedPtr>>& tablet_rowsets) override {
+        _local_queue->set_tablet_rowsets(tablet_rowsets);
+    }
+    // The morsels of a tablet must be processed by the same driver when the query cache is used, so the queue
+    // attached to a ticket checker never steals and is never stolen from.
+    void set_ticket_checker(const query_cache::TicketCheckerPtr& ticket_checker) override {
+        _local_queue->set_ticket_checker(ticket_checker);
+        _enable_steal = false;
+    }
+    bool could_attch_ticket_checker() const override { return _local_queue->could_attch_ticket_checker(); }
+
+    size_t num_original_morsels() const override { return _local_queue->num_original_morsels(); }
+    size_t max_degree_of_parallelism() const override { return _local_queue->max_degree_of_parallelism(); }
+    bool empty() const override;
+    StatusOr<MorselPtr> try_get() override;
+    void unget(MorselPtr&& morsel) override { _local_queue->unget(std::move(morsel)); }
+    std::string name() const override { return "work_stealing_" + _local_queue->name(); }
+    StatusOr<bool> ready_for_next() const override { return _local_queue->ready_for_next(); }
+    void append_morsels(Morsels&& morsels) override { _local_queue->append_morsels(std::move(morsels)); }
+    Type type() const override { return _local_queue->type(); }
+    size_t steal(Morsels* morsels) override { return _enable_steal ? _local_queue->steal(morsels) : 0; }
+    bool has_stealable_morsels() const override { return _enable_steal && _local_queue->has_stealable_morsels(); }
+    size_t num_stolen_morsels() const override { return _num_stolen_morsels; }
+
+    // Whether split_running_morsel() could split off the rows of a morsel being scanned by the driver of this queue.
+    bool has_splittable_morsels() const;
+    // Split off the tail half of the pending rows of a morsel being scanned by the driver of this queue, and return
+    // them as a new morsel. Return null if no morsel could be split.
+    MorselPtr split_running_morsel();
+
+private:
+    // The morsel returned by try_get(), which is being scanned by the driver of this queue.
+    struct RunningMorsel {
+        // Expired once the morsel is destroyed.
+        std::weak_ptr<RowidRangeSplitter> splitter;
+        int32_t plan_node_id;
+        TScanRange scan_range;
+        // Owned by the FixedMorselQueue of the tablet, whose lifecycle is longer than that of the morsels.
+        const std::vector<BaseRowsetSharedPtr>* rowsets;
+    };
+
+    void _add_running_morsel(Morsel* morsel);
+
+    MorselQueuePtr _local_queue;
+    std::vector<WorkStealingMorselQueue*> _victim_queues;
+    const bool _could_split_running_morsels;
+    // The victim to steal from firstly, which is rotated to spread the stealing among the other drivers.
+    std::atomic<size_t> _next_victim = 0;
+    std::atomic<bool> _enable_steal = true;
+    std::atomic<size_t> _num_stolen_morsels = 0;
+
+    mutable std::mutex _mutex;
+    std::deque<MorselPtr> _stolen_morsels;
+    std::vector<RunningMorsel> _running_morsels;
+};
+
 MorselQueuePtr create_empty_morsel_queue();
 
 } // namespace pipeline
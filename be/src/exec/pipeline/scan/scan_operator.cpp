@@ -111,6 +111,10 @@ void ScanOperator::close(RuntimeState* state) {
     _tablets_counter =
             ADD_COUNTER_SKIP_MERGE(_unique_metrics, "TabletCount", TUnit::UNIT, TCounterMergeType::SKIP_FIRST_MERGE);
     COUNTER_SET(_tablets_counter, static_cast<int64_t>(_source_factory()->num_total_original_morsels()));
+    if (size_t num_stolen_morsels = _morsel_queue->num_stolen_morsels(); num_stolen_morsels > 0) {
+        COUNTER_SET(ADD_COUNTER(_unique_metrics, "StolenMorselsCount", TUnit::UNIT),
+                    static_cast<int64_t>(num_stolen_morsels));
+    }
 
     _merge_chunk_source_profiles(state);
 
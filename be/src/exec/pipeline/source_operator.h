@@ -18,6 +18,7 @@
 
 #include "exec/pipeline/adaptive/adaptive_fwd.h"
 #include "exec/pipeline/operator.h"
+#include "exec/pipeline/pipeline_observer.h"
 #include "exec/pipeline/scan/chunk_source.h"
 #include "exec/workgroup/work_group_fwd.h"
 
@@ -149,6 +150,11 @@ public:
         return Status::InternalError("Shouldn't push chunk to source operator");
     }
 
+    // Return the state notifying the observers when the result of `has_output` or `is_finished` may change, or nullptr
+    // if the operator cannot notify them, and then the blocked driver has to be polled.
+    // It is called after the operator is prepared.
+    virtual PipelineObservable* output_observable() { return nullptr; }
+
     virtual void add_morsel_queue(MorselQueue* morsel_queue) { _morsel_queue = morsel_queue; };
     MorselQueue* morsel_queue() const { return _morsel_queue; }
 
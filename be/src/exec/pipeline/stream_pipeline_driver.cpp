@@ -311,8 +311,10 @@ Status StreamPipelineDriver::_mark_operator_epoch_finished(OperatorPtr& op, Runt
         SCOPED_TIMER(op->_finishing_timer);
         op_state = OperatorStage::EPOCH_FINISHED;
         QUERY_TRACE_SCOPED(op->get_name(), "set_epoch_finished");
-        return op->set_epoch_finished(state);
+        RETURN_IF_ERROR(op->set_epoch_finished(state));
     }
+    _notify_operator_finished(op);
+    return Status::OK();
 }
 
 Status StreamPipelineDriver::reset_epoch(RuntimeState* runtime_state) {
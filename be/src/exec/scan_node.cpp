@@ -143,9 +143,13 @@ StatusOr<pipeline::MorselQueueFactoryPtr> ScanNode::convert_scan_range_to_morsel
         // If not so much morsels, try to assign morsel uniformly among operators to avoid data skew
         if (!always_shared_scan() && scan_dop > 1 && is_fixed_or_dynamic_morsel_queue &&
             morsel_queue->num_original_morsels() <= io_parallelism) {
+            bool could_split = false;
+            if (config::enable_scan_morsel_stealing) {
+                ASSIGN_OR_RETURN(could_split, could_split_running_morsels(global_scan_ranges));
+            }
             auto morsel_queue_map = uniform_distribute_morsels(std::move(morsel_queue), scan_dop);
-            return std::make_unique<pipeline::IndividualMorselQueueFactory>(std::move(morsel_queue_map),
-                                                                            /*could_local_shuffle*/ true);
+            return std::make_unique<pipeline::IndividualMorselQueueFactory>(
+                    std::move(morsel_queue_map), /*could_local_shuffle*/ true, could_split);
         } else {
             if (config::use_default_dop_when_shared_scan && enable_shared_scan && is_fixed_or_dynamic_morsel_queue) {
                 scan_dop = pipeline_dop;
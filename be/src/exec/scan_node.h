@@ -92,6 +92,11 @@ public:
             const std::vector<TScanRangeParams>& scan_ranges, int node_id, int32_t pipeline_dop,
             bool enable_tablet_internal_parallel, TTabletInternalParallelMode::type tablet_internal_parallel_mode,
             size_t num_total_scan_ranges);
+    // Whether the pending rows of a morsel being scanned could be split off by the idle drivers, see
+    // WorkStealingMorselQueue.
+    virtual StatusOr<bool> could_split_running_morsels(const std::vector<TScanRangeParams>& scan_ranges) const {
+        return false;
+    }
 
     // If this scan node accept empty scan ranges.
     virtual bool accept_empty_scan_ranges() const { return true; }
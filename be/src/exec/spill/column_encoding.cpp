@@ -0,0 +1,328 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/spill/column_encoding.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "column/binary_column.h"
+#include "column/column_hash.h"
+#include "column/nullable_column.h"
+#include "gutil/casts.h"
+#include "serde/column_array_serde.h"
+#include "util/coding.h"
+#include "util/phmap/phmap.h"
+
+namespace starrocks::spill {
+
+namespace {
+
+// format of the null flags: u32 num_rows|u8 NullEncoding|...
+//   NO_NULL: nothing
+//   NULL_RUNS: varint32 num_runs|varint32 run length..., the runs alternate between not null and null,
+//              starting with a not null run which may be empty.
+//   NULL_BITMAP: one bit for each row
+enum NullEncoding : uint8_t { NO_NULL = 0, NULL_RUNS = 1, NULL_BITMAP = 2 };
+
+// format of the binary column: u8 BinaryEncoding|...
+//   PLAIN: serialized by serde::ColumnArraySerde
+//   DICT: u32 num_rows|u8 code width|dict column serialized by serde::ColumnArraySerde|codes
+enum BinaryEncoding : uint8_t { PLAIN = 0, DICT = 1 };
+
+constexpr size_t kMinDictRows = 64;
+constexpr size_t kDictSampleRows = 1024;
+// the dictionary encoding is not tried if more than this ratio of the sampled rows are distinct
+constexpr double kMaxSampleDistinctRatio = 0.25;
+constexpr size_t kMaxDictSize = 65536;
+
+constexpr int64_t kMaxNullHeaderSize = sizeof(uint32_t) + sizeof(uint8_t) + sizeof(uint32_t) + 1;
+constexpr int64_t kMaxDictHeaderSize = sizeof(uint8_t) + sizeof(uint32_t) + sizeof(uint8_t);
+
+template <typename F>
+void for_each_null_run(const uint8_t* flags, size_t num_rows, F&& f) {
+    uint8_t current = 0;
+    size_t start = 0;
+    for (size_t i = 0; i < num_rows; i++) {
+        uint8_t is_null = flags[i] != 0;
+        if (is_null != current) {
+            f(static_cast<uint32_t>(i - start));
+            start = i;
+            current = is_null;
+        }
+    }
+    f(static_cast<uint32_t>(num_rows - start));
+}
+
+int64_t max_null_encoded_size(size_t num_rows) {
+    // the runs are used only if they are smaller than the bitmap
+    return kMaxNullHeaderSize + (num_rows + 7) / 8;
+}
+
+uint8_t* encode_nulls(const NullColumn& null_column, uint8_t* buff) {
+    const uint8_t* flags = null_column.get_data().data();
+    size_t num_rows = null_column.size();
+    encode_fixed32_le(buff, static_cast<uint32_t>(num_rows));
+    buff += sizeof(uint32_t);
+
+    size_t num_runs = 0;
+    size_t runs_bytes = 0;
+    for_each_null_run(flags, num_rows, [&](uint32_t length) {
+        num_runs++;
+        runs_bytes += varint_length(length);
+    });
+    if (num_runs == 1) {
+        *buff++ = NO_NULL;
+        return buff;
+    }
+    size_t bitmap_bytes = (num_rows + 7) / 8;
+    if (runs_bytes + varint_length(num_runs) < bitmap_bytes) {
+        *buff++ = NULL_RUNS;
+        buff = encode_varint32(buff, static_cast<uint32_t>(num_runs));
+        for_each_null_run(flags, num_rows, [&](uint32_t length) { buff = encode_varint32(buff, length); });
+        return buff;
+    }
+    *buff++ = NULL_BITMAP;
+    memset(buff, 0, bitmap_bytes);
+    for (size_t i = 0; i < num_rows; i++) {
+        buff[i >> 3] |= static_cast<uint8_t>((flags[i] != 0) << (i & 7));
+    }
+    return buff + bitmap_bytes;
+}
+
+const uint8_t* decode_nulls(const uint8_t* buff, NullColumn* null_column) {
+    uint32_t num_rows = decode_fixed32_le(buff);
+    buff += sizeof(uint32_t);
+    auto& flags = null_column->get_data();
+    flags.resize(num_rows);
+    uint8_t encoding = *buff++;
+    if (encoding == NO_NULL) {
+        memset(flags.data(), 0, num_rows);
+    } else if (encoding == NULL_RUNS) {
+        // varint32 takes at most 5 bytes
+        uint32_t num_runs = 0;
+        buff = decode_varint32_ptr(buff, buff + 5, &num_runs);
+        uint8_t value = 0;
+        size_t pos = 0;
+        for (uint32_t i = 0; i < num_runs; i++) {
+            uint32_t length = 0;
+            buff = decode_varint32_ptr(buff, buff + 5, &length);
+            if (buff == nullptr || pos + length > num_rows) {
+                return nullptr;
+            }
+            memset(flags.data() + pos, value, length);
+            pos += length;
+            value ^= 1;
+        }
+    } else if (encoding == NULL_BITMAP) {
+        for (size_t i = 0; i < num_rows; i++) {
+            flags[i] = (buff[i >> 3] >> (i & 7)) & 1;
+        }
+        buff += (num_rows + 7) / 8;
+    } else {
+        return nullptr;
+    }
+    return buff;
+}
+
+// Build the dictionary of |column|, returns false if the column is not worth being dictionary encoded.
+template <typename T>
+bool build_dict(const BinaryColumnBase<T>& column, std::vector<Slice>* dict, std::vector<uint32_t>* codes) {
+    size_t num_rows = column.size();
+    if (num_rows < kMinDictRows) {
+        return false;
+    }
+    // estimate the cardinality with a sample of rows before building the whole dictionary
+    size_t step = std::max<size_t>(1, num_rows / kDictSampleRows);
+    size_t num_sampled = 0;
+    phmap::flat_hash_set<Slice, SliceHash, SliceNormalEqual> sample;
+    for (size_t i = 0; i < num_rows; i += step) {
+        sample.insert(column.get_slice(i));
+        num_sampled++;
+    }
+    if (sample.size() > num_sampled * kMaxSampleDistinctRatio) {
+        return false;
+    }
+
+    size_t max_dict_size = std::min(kMaxDictSize, num_rows / 2);
+    phmap::flat_hash_map<Slice, uint32_t, SliceHash, SliceNormalEqual> dict_map;
+    dict_map.reserve(sample.size() * 2);
+    codes->resize(num_rows);
+    for (size_t i = 0; i < num_rows; i++) {
+        auto [iter, inserted] = dict_map.try_emplace(column.get_slice(i), static_cast<uint32_t>(dict->size()));
+        if (inserted) {
+            if (dict->size() >= max_dict_size) {
+                return false;
+            }
+            dict->emplace_back(iter->first);
+        }
+        (*codes)[i] = iter->second;
+    }
+    return true;
+}
+
+template <typename T>
+uint8_t* serialize_binary(const BinaryColumnBase<T>& column, uint8_t* buff, int encode_level) {
+    std::vector<Slice> dict;
+    std::vector<uint32_t> codes;
+    if (!build_dict(column, &dict, &codes)) {
+        *buff++ = PLAIN;
+        return serde::ColumnArraySerde::serialize(column, buff, false, encode_level);
+    }
+
+    *buff++ = DICT;
+    encode_fixed32_le(buff, static_cast<uint32_t>(codes.size()));
+    buff += sizeof(uint32_t);
+    uint8_t code_width = dict.size() <= 256 ? sizeof(uint8_t) : sizeof(uint16_t);
+    *buff++ = code_width;
+
+    auto dict_column = BinaryColumnBase<T>::create();
+    for (const Slice& value : dict) {
+        dict_column->append(value);
+    }
+    buff = serde::ColumnArraySerde::serialize(*dict_column, buff, false, encode_level);
+    if (buff == nullptr) {
+        return nullptr;
+    }
+    if (code_width == sizeof(uint8_t)) {
+        for (uint32_t code : codes) {
+            *buff++ = static_cast<uint8_t>(code);
+        }
+    } else {
+        for (uint32_t code : codes) {
+            encode_fixed16_le(buff, static_cast<uint16_t>(code));
+            buff += sizeof(uint16_t);
+        }
+    }
+    return buff;
+}
+
+const uint8_t* deserialize_binary(const uint8_t* buff, Column* column, int encode_level) {
+    uint8_t encoding = *buff++;
+    if (encoding == PLAIN) {
+        return serde::ColumnArraySerde::deserialize(buff, column, false, encode_level);
+    }
+    if (encoding != DICT) {
+        return nullptr;
+    }
+    uint32_t num_rows = decode_fixed32_le(buff);
+    buff += sizeof(uint32_t);
+    uint8_t code_width = *buff++;
+
+    auto dict_column = column->clone_empty();
+    buff = serde::ColumnArraySerde::deserialize(buff, dict_column.get(), false, encode_level);
+    if (buff == nullptr) {
+        return nullptr;
+    }
+    std::vector<uint32_t> codes(num_rows);
+    if (code_width == sizeof(uint8_t)) {
+        for (uint32_t i = 0; i < num_rows; i++) {
+            codes[i] = buff[i];
+        }
+    } else {
+        for (uint32_t i = 0; i < num_rows; i++) {
+            codes[i] = decode_fixed16_le(buff + i * sizeof(uint16_t));
+        }
+    }
+    buff += static_cast<size_t>(num_rows) * code_width;
+    column->append_selective(*dict_column, codes.data(), 0, num_rows);
+    return buff;
+}
+
+int64_t max_data_serialized_size(const Column& column, int encode_level) {
+    int64_t size = serde::ColumnArraySerde::max_serialized_size(column, encode_level);
+    if (size == 0) {
+        return 0;
+    }
+    if (SpillColumnEncoding::enable_encode_dict(encode_level) && (column.is_binary() || column.is_large_binary())) {
+        // the dictionary is not larger than the column itself
+        size += kMaxDictHeaderSize + column.size() * sizeof(uint16_t);
+    }
+    return size;
+}
+
+uint8_t* serialize_data(const Column& column, uint8_t* buff, int encode_level) {
+    if (SpillColumnEncoding::enable_encode_dict(encode_level)) {
+        if (column.is_binary()) {
+            return serialize_binary(down_cast<const BinaryColumn&>(column), buff, encode_level);
+        }
+        if (column.is_large_binary()) {
+            return serialize_binary(down_cast<const LargeBinaryColumn&>(column), buff, encode_level);
+        }
+    }
+    return serde::ColumnArraySerde::serialize(column, buff, false, encode_level);
+}
+
+const uint8_t* deserialize_data(const uint8_t* buff, Column* column, int encode_level) {
+    if (SpillColumnEncoding::enable_encode_dict(encode_level) && (column->is_binary() || column->is_large_binary())) {
+        return deserialize_binary(buff, column, encode_level);
+    }
+    return serde::ColumnArraySerde::deserialize(buff, column, false, encode_level);
+}
+
+bool enable_spill_encoding(int encode_level) {
+    return SpillColumnEncoding::enable_encode_dict(encode_level) ||
+           SpillColumnEncoding::enable_encode_null_rle(encode_level);
+}
+
+} // namespace
+
+int64_t SpillColumnEncoding::max_serialized_size(const Column& column, int encode_level) {
+    if (!enable_spill_encoding(encode_level) || !column.is_nullable()) {
+        return max_data_serialized_size(column, encode_level);
+    }
+    const auto& nullable = down_cast<const NullableColumn&>(column);
+    int64_t data_size = max_data_serialized_size(*nullable.data_column(), encode_level);
+    if (data_size == 0) {
+        return 0;
+    }
+    if (enable_encode_null_rle(encode_level)) {
+        return max_null_encoded_size(nullable.size()) + data_size;
+    }
+    return serde::ColumnArraySerde::max_serialized_size(*nullable.null_column(), encode_level) + data_size;
+}
+
+uint8_t* SpillColumnEncoding::serialize(const Column& column, uint8_t* buff, int encode_level) {
+    if (!enable_spill_encoding(encode_level) || !column.is_nullable()) {
+        return serialize_data(column, buff, encode_level);
+    }
+    const auto& nullable = down_cast<const NullableColumn&>(column);
+    if (enable_encode_null_rle(encode_level)) {
+        buff = encode_nulls(*nullable.null_column(), buff);
+    } else {
+        buff = serde::ColumnArraySerde::serialize(*nullable.null_column(), buff, false, encode_level);
+    }
+    return serialize_data(*nullable.data_column(), buff, encode_level);
+}
+
+const uint8_t* SpillColumnEncoding::deserialize(const uint8_t* buff, Column* column, int encode_level) {
+    if (!enable_spill_encoding(encode_level) || !column->is_nullable()) {
+        return deserialize_data(buff, column, encode_level);
+    }
+    auto* nullable = down_cast<NullableColumn*>(column);
+    if (enable_encode_null_rle(encode_level)) {
+        buff = decode_nulls(buff, nullable->null_column().get());
+    } else {
+        buff = serde::ColumnArraySerde::deserialize(buff, nullable->null_column().get(), false, encode_level);
+    }
+    if (buff == nullptr) {
+        return nullptr;
+    }
+    buff = deserialize_data(buff, nullable->data_column().get(), encode_level);
+    nullable->update_has_null();
+    return buff;
+}
+
+} // namespace starrocks::spill
@@ -0,0 +1,50 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+
+namespace starrocks {
+class Column;
+}
+
+namespace starrocks::spill {
+
+// Spill only column encodings on top of serde::ColumnArraySerde, selected per column by the bits of
+// spill_encode_level beyond the ones understood by serde::EncodeContext:
+//   8: dictionary encode the low cardinality binary columns, the cardinality is estimated on a sample of
+//      rows first, so the high cardinality columns cost little.
+//  16: encode the null flags of the nullable columns as runs or as a bitmap, whichever is smaller,
+//      instead of one byte per row.
+// If none of them is set, the format is the same as serde::ColumnArraySerde.
+class SpillColumnEncoding {
+public:
+    static constexpr int ENCODE_DICT = 8;
+    static constexpr int ENCODE_NULL_RLE = 16;
+
+    static bool enable_encode_dict(int encode_level) { return encode_level & ENCODE_DICT; }
+    static bool enable_encode_null_rle(int encode_level) { return encode_level & ENCODE_NULL_RLE; }
+
+    // 0 means does not support the type of column
+    static int64_t max_serialized_size(const Column& column, int encode_level);
+
+    // Return nullptr on error.
+    static uint8_t* serialize(const Column& column, uint8_t* buff, int encode_level);
+
+    // Return nullptr on error.
+    static const uint8_t* deserialize(const uint8_t* buff, Column* column, int encode_level);
+};
+
+} // namespace starrocks::spill
@@ -0,0 +1,411 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/spill/mem_block_manager.h"
+
+#include <cstring>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "common/logging.h"
+#include "common/status.h"
+#include "exec/spill/common.h"
+#include "fmt/format.h"
+#include "io/input_stream.h"
+#include "util/compression/block_compression.h"
+
+namespace starrocks::spill {
+
+class MemBlock;
+
+// The memory budget of a query, shared by the MemBlockManager and its blocks,
+// since the blocks may outlive the manager.
+struct MemBlockTier {
+    explicit MemBlockTier(int64_t max_bytes_) : max_bytes(max_bytes_) {}
+
+    bool try_reserve(int64_t bytes) {
+        if (used_bytes + bytes > max_bytes) {
+            return false;
+        }
+        used_bytes += bytes;
+        return true;
+    }
+
+    std::mutex mutex;
+    const int64_t max_bytes;
+    int64_t used_bytes = 0;
+    // the flushed blocks which are still in memory, the coldest one at the front
+    std::list<std::weak_ptr<MemBlock>> lru;
+};
+
+// a piece of the block compressed at once, it is kept uncompressed if compression does not help
+struct MemBlockFrame {
+    std::shared_ptr<const std::string> data;
+    size_t raw_size = 0;
+    bool compressed = false;
+};
+
+class MemBlockInputStream final : public io::InputStream {
+public:
+    MemBlockInputStream(const BlockCompressionCodec* codec, std::vector<MemBlockFrame> frames)
+            : _codec(codec), _frames(std::move(frames)) {}
+
+    StatusOr<int64_t> read(void* data, int64_t count) override {
+        int64_t read_bytes = 0;
+        while (read_bytes < count) {
+            if (_offset == _current.size) {
+                if (_next_frame == _frames.size()) {
+                    break;
+                }
+                RETURN_IF_ERROR(_load_next_frame());
+            }
+            int64_t n = std::min<int64_t>(count - read_bytes, _current.size - _offset);
+            memcpy(static_cast<uint8_t*>(data) + read_bytes, _current.data + _offset, n);
+            _offset += n;
+            read_bytes += n;
+        }
+        return read_bytes;
+    }
+
+    Status skip(int64_t count) override {
+        while (count > 0) {
+            if (_offset == _current.size) {
+                if (_next_frame == _frames.size()) {
+                    break;
+                }
+                // skip the whole frame without decompressing it
+                if (_frames[_next_frame].raw_size <= count) {
+                    count -= _frames[_next_frame++].raw_size;
+                    continue;
+                }
+                RETURN_IF_ERROR(_load_next_frame());
+            }
+            int64_t n = std::min<int64_t>(count, _current.size - _offset);
+            _offset += n;
+            count -= n;
+        }
+        return Status::OK();
+    }
+
+private:
+    Status _load_next_frame() {
+        const MemBlockFrame& frame = _frames[_next_frame++];
+        if (frame.compressed) {
+            _buffer.resize(frame.raw_size);
+            Slice output(_buffer.data(), _buffer.size());
+            RETURN_IF_ERROR(_codec->decompress(Slice(*frame.data), &output));
+            RETURN_IF(output.size != frame.raw_size,
+                      Status::InternalError(fmt::format("mem block frame's length is mismatched, actual[{}], "
+                                                        "expected[{}]",
+                                                        output.size, frame.raw_size)));
+            _current = Slice(_buffer.data(), _buffer.size());
+        } else {
+            _current = Slice(*frame.data);
+        }
+        _offset = 0;
+        return Status::OK();
+    }
+
+    const BlockCompressionCodec* _codec;
+    std::vector<MemBlockFrame> _frames;
+    size_t _next_frame = 0;
+    std::string _buffer;
+    Slice _current;
+    size_t _offset = 0;
+};
+
+class MemBlockReader final : public BlockReader {
+public:
+    MemBlockReader(const Block* block, const BlockReaderOptions& options = {}) : BlockReader(block, options) {}
+
+    ~MemBlockReader() override = default;
+
+    std::string debug_string() override { return _block->debug_string(); }
+
+    const Block* block() const override { return _block; }
+};
+
+// MemBlock buffers the appended data and compresses it by frames of kFrameBytes.
+// A flushed block can not be appended any more, and it is moved to disk as a whole by `evict`.
+class MemBlock final : public Block, public std::enable_shared_from_this<MemBlock> {
+public:
+    static constexpr size_t kFrameBytes = 1024 * 1024;
+
+    MemBlock(std::shared_ptr<MemBlockTier> tier, const BlockCompressionCodec* codec, AcquireBlockOptions opts,
+             int64_t reserved_bytes)
+            : _tier(std::move(tier)), _codec(codec), _opts(std::move(opts)), _reserved_bytes(reserved_bytes) {}
+
+    ~MemBlock() override {
+        std::lock_guard l(_tier->mutex);
+        if (_in_lru) {
+            _tier->lru.erase(_lru_pos);
+        }
+        _tier->used_bytes -= _reserved_bytes;
+    }
+
+    Status append(const std::vector<Slice>& data) override {
+        std::lock_guard l(_mutex);
+        DCHECK(!_flushed);
+        for (const auto& slice : data) {
+            _pending.append(slice.data, slice.size);
+            _size += slice.size;
+        }
+        if (_pending.size() >= kFrameBytes) {
+            RETURN_IF_ERROR(_compress_pending());
+        }
+        return Status::OK();
+    }
+
+    Status flush() override {
+        std::lock_guard l(_mutex);
+        if (_flushed) {
+            return Status::OK();
+        }
+        RETURN_IF_ERROR(_compress_pending());
+        std::string().swap(_pending);
+        _flushed = true;
+        std::lock_guard tl(_tier->mutex);
+        _lru_pos = _tier->lru.insert(_tier->lru.end(), weak_from_this());
+        _in_lru = true;
+        return Status::OK();
+    }
+
+    StatusOr<std::unique_ptr<io::InputStreamWrapper>> get_readable() const override {
+        std::lock_guard l(_mutex);
+        if (_disk_block != nullptr) {
+            return _disk_block->get_readable();
+        }
+        DCHECK(_flushed);
+        {
+            // the block is going to be restored, it is the hottest one now
+            std::lock_guard tl(_tier->mutex);
+            if (_in_lru) {
+                _tier->lru.splice(_tier->lru.end(), _tier->lru, _lru_pos);
+            }
+        }
+        // the frames are shared, so the block can be evicted while reading
+        auto stream = std::make_unique<MemBlockInputStream>(_codec, _frames);
+        return std::make_unique<io::InputStreamWrapper>(std::move(stream));
+    }
+
+    std::shared_ptr<BlockReader> get_reader(const BlockReaderOptions& options) override {
+        return std::make_shared<MemBlockReader>(this, options);
+    }
+
+    std::string debug_string() const override {
+        std::lock_guard l(_mutex);
+        if (_disk_block != nullptr) {
+            return fmt::format("MemBlock[evicted={}]", _disk_block->debug_string());
+        }
+#ifndef BE_TEST
+        return fmt::format("MemBlock:{}[len={}, mem_bytes={}]", (void*)this, _size, _frame_bytes + _pending.size());
+#else
+        return fmt::format("MemBlock[len={}, mem_bytes={}]", _size, _frame_bytes + _pending.size());
+#endif
+    }
+
+    bool preallocate(size_t write_size) override {
+        std::lock_guard l(_mutex);
+        if (_flushed) {
+            return false;
+        }
+        std::lock_guard tl(_tier->mutex);
+        if (!_tier->try_reserve(write_size)) {
+            return false;
+        }
+        _reserved_bytes += write_size;
+        return true;
+    }
+
+    // Take the coldest flushed block out of the lru, return nullptr if there is none.
+    static std::shared_ptr<MemBlock> pop_coldest(MemBlockTier* tier) {
+        for (auto it = tier->lru.begin(); it != tier->lru.end(); ++it) {
+            // the expired ones are being destroyed, and will be removed by themselves
+            if (auto block = it->lock(); block != nullptr) {
+                tier->lru.erase(it);
+                block->_in_lru = false;
+                return block;
+            }
+        }
+        return nullptr;
+    }
+
+    // Move the data to a block of disk_block_manager, and release the memory.
+    Status evict(BlockManager* disk_block_manager) {
+        std::lock_guard l(_mutex);
+        DCHECK(_flushed && _disk_block == nullptr);
+        AcquireBlockOptions opts = _opts;
+        opts.block_size = _size;
+        opts.direct_io = false;
+        ASSIGN_OR_RETURN(auto block, disk_block_manager->acquire_block(opts));
+        MemBlockInputStream input(_codec, _frames);
+        std::string buffer(kFrameBytes, 0);
+        while (true) {
+            ASSIGN_OR_RETURN(auto n, input.read(buffer.data(), buffer.size()));
+            if (n == 0) {
+                break;
+            }
+            RETURN_IF_ERROR(block->append({Slice(buffer.data(), n)}));
+        }
+        RETURN_IF_ERROR(block->flush());
+        RETURN_IF_ERROR(disk_block_manager->release_block(block));
+        DCHECK_EQ(block->size(), _size);
+        _disk_block = std::move(block);
+        _frames.clear();
+        _frame_bytes = 0;
+        _update_reservation();
+        return Status::OK();
+    }
+
+    // put an evicted block back to the lru if it failed to move to disk
+    void add_back_to_lru() {
+        std::lock_guard tl(_tier->mutex);
+        DCHECK(!_in_lru);
+        _lru_pos = _tier->lru.insert(_tier->lru.begin(), weak_from_this());
+        _in_lru = true;
+    }
+
+private:
+    Status _compress_pending() {
+        if (_pending.empty()) {
+            return Status::OK();
+        }
+        MemBlockFrame frame;
+        frame.raw_size = _pending.size();
+        auto data = std::make_shared<std::string>();
+        if (_codec != nullptr) {
+            data->resize(_codec->max_compressed_len(_pending.size()));
+            Slice output(data->data(), data->size());
+            RETURN_IF_ERROR(_codec->compress(Slice(_pending), &output));
+            if (output.size < _pending.size()) {
+                data->resize(output.size);
+                data->shrink_to_fit();
+                frame.compressed = true;
+            }
+        }
+        if (!frame.compressed) {
+            data->assign(_pending);
+        }
+        _frame_bytes += data->size();
+        frame.data = std::move(data);
+        _frames.emplace_back(std::move(frame));
+        _pending.clear();
+        _update_reservation();
+        return Status::OK();
+    }
+
+    // account the memory actually held instead of the reserved raw bytes
+    void _update_reservation() {
+        int64_t held_bytes = _frame_bytes + _pending.size();
+        std::lock_guard tl(_tier->mutex);
+        _tier->used_bytes += held_bytes - _reserved_bytes;
+        _reserved_bytes = held_bytes;
+    }
+
+    std::shared_ptr<MemBlockTier> _tier;
+    const BlockCompressionCodec* _codec;
+    const AcquireBlockOptions _opts;
+
+    mutable std::mutex _mutex;
+    std::string _pending;
+    std::vector<MemBlockFrame> _frames;
+    int64_t _frame_bytes = 0;
+    bool _flushed = false;
+    // where the data goes after it is evicted
+    BlockPtr _disk_block;
+
+    // guarded by _tier->mutex
+    int64_t _reserved_bytes = 0;
+    bool _in_lru = false;
+    std::list<std::weak_ptr<MemBlock>>::iterator _lru_pos;
+};
+
+MemBlockManager::MemBlockManager(const TUniqueId& query_id, std::unique_ptr<BlockManager> disk_block_manager,
+                                 int64_t max_bytes, CompressionTypePB compress_type)
+        : _disk_block_manager(std::move(disk_block_manager)),
+          _tier(std::make_shared<MemBlockTier>(max_bytes)) {
+    // the blocks are kept uncompressed without a codec
+    if (auto st = get_block_compression_codec(compress_type, &_codec); !st.ok()) {
+        LOG(WARNING) << "failed to get the compression codec of spill mem tier: " << st;
+        _codec = nullptr;
+    }
+}
+
+MemBlockManager::~MemBlockManager() = default;
+
+Status MemBlockManager::open() {
+    return _disk_block_manager->open();
+}
+
+void MemBlockManager::close() {
+    _disk_block_manager->close();
+}
+
+int64_t MemBlockManager::used_bytes() const {
+    std::lock_guard l(_tier->mutex);
+    return _tier->used_bytes;
+}
+
+int64_t MemBlockManager::max_bytes() const {
+    return _tier->max_bytes;
+}
+
+StatusOr<bool> MemBlockManager::_reserve(int64_t bytes) {
+    if (bytes > _tier->max_bytes) {
+        return false;
+    }
+    while (true) {
+        std::shared_ptr<MemBlock> victim;
+        {
+            std::lock_guard l(_tier->mutex);
+            if (_tier->try_reserve(bytes)) {
+                return true;
+            }
+            victim = MemBlock::pop_coldest(_tier.get());
+            if (victim == nullptr) {
+                return false;
+            }
+        }
+        // write the victim out of the lock, the other blocks are free to come and go meanwhile
+        if (auto st = victim->evict(_disk_block_manager.get()); !st.ok()) {
+            victim->add_back_to_lru();
+            return st;
+        }
+        TRACE_SPILL_LOG << fmt::format("evict block[{}]", victim->debug_string());
+    }
+}
+
+StatusOr<BlockPtr> MemBlockManager::acquire_block(const AcquireBlockOptions& opts) {
+    ASSIGN_OR_RETURN(bool reserved, _reserve(opts.block_size));
+    if (!reserved) {
+        return _disk_block_manager->acquire_block(opts);
+    }
+    auto block = std::make_shared<MemBlock>(_tier, _codec, opts, opts.block_size);
+    block->set_exclusive(opts.exclusive);
+    return block;
+}
+
+Status MemBlockManager::release_block(const BlockPtr& block) {
+    // a MemBlock is ready to be evicted once it is flushed, nothing to do with it here
+    if (dynamic_cast<MemBlock*>(block.get()) != nullptr) {
+        return Status::OK();
+    }
+    return _disk_block_manager->release_block(block);
+}
+
+} // namespace starrocks::spill
@@ -0,0 +1,57 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "exec/spill/block_manager.h"
+#include "gen_cpp/types.pb.h"
+
+namespace starrocks {
+class BlockCompressionCodec;
+}
+
+namespace starrocks::spill {
+struct MemBlockTier;
+
+// MemBlockManager is a memory tier in front of another BlockManager.
+// Blocks are kept in memory, compressed, as long as they fit in the budget of the query. A block that
+// does not fit makes room by moving the coldest flushed blocks (the ones flushed least recently) to the
+// wrapped BlockManager, and is allocated from the wrapped BlockManager itself if there is still no room.
+// So the disk is only touched when the spilled data of the query exceeds the budget.
+class MemBlockManager : public BlockManager {
+public:
+    MemBlockManager(const TUniqueId& query_id, std::unique_ptr<BlockManager> disk_block_manager, int64_t max_bytes,
+                    CompressionTypePB compress_type);
+    ~MemBlockManager() override;
+
+    Status open() override;
+    void close() override;
+    StatusOr<BlockPtr> acquire_block(const AcquireBlockOptions& opts) override;
+    Status release_block(const BlockPtr& block) override;
+
+    // the bytes of memory held or reserved by the blocks in memory
+    int64_t used_bytes() const;
+    int64_t max_bytes() const;
+
+private:
+    // reserve bytes in the tier, moving the coldest blocks to disk when needed.
+    // return false if there is no room even after all the flushed blocks are moved.
+    StatusOr<bool> _reserve(int64_t bytes);
+
+    std::unique_ptr<BlockManager> _disk_block_manager;
+    std::shared_ptr<MemBlockTier> _tier;
+    const BlockCompressionCodec* _codec = nullptr;
+};
+
+} // namespace starrocks::spill
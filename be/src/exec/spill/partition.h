@@ -41,6 +41,9 @@ struct SpillPartitionInfo {
     size_t mem_size = 0;
     size_t bytes = 0;
     bool in_mem = true;
+    // the partition is dominated by a hot key which alone exceeds the memory budget, so splitting it further
+    // does not help, the join processes its build side in several slices instead
+    bool skewed = false;
 
     bool empty() const { return num_rows == 0; }
 
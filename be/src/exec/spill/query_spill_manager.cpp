@@ -17,16 +17,34 @@
 #include <cstdint>
 #include <memory>
 
+#include "common/config.h"
 #include "exec/spill/dir_manager.h"
 #include "exec/spill/file_block_manager.h"
 #include "exec/spill/hybird_block_manager.h"
 #include "exec/spill/log_block_manager.h"
+#include "exec/spill/mem_block_manager.h"
 #include "gen_cpp/InternalService_types.h"
 #include "runtime/exec_env.h"
+#include "util/compression/compression_utils.h"
 
 namespace starrocks::spill {
 
 Status QuerySpillManager::init_block_manager(const TQueryOptions& query_options) {
+    RETURN_IF_ERROR(_init_disk_block_manager(query_options));
+    if (config::spill_mem_tier_max_bytes_per_query > 0) {
+        auto compress_type = CompressionUtils::to_compression_pb(config::spill_mem_tier_compression);
+        if (compress_type != CompressionTypePB::LZ4 && compress_type != CompressionTypePB::ZSTD) {
+            LOG(WARNING) << "unsupported spill_mem_tier_compression: " << config::spill_mem_tier_compression
+                         << ", use lz4 instead";
+            compress_type = CompressionTypePB::LZ4;
+        }
+        _block_manager = std::make_unique<MemBlockManager>(_uid, std::move(_block_manager),
+                                                           config::spill_mem_tier_max_bytes_per_query, compress_type);
+    }
+    return Status::OK();
+}
+
+Status QuerySpillManager::_init_disk_block_manager(const TQueryOptions& query_options) {
     const TSpillOptions& spill_options = query_options.spill_options;
     bool enable_spill_to_remote_storage =
             spill_options.__isset.enable_spill_to_remote_storage && spill_options.enable_spill_to_remote_storage;
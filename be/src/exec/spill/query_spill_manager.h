@@ -42,6 +42,8 @@ public:
     BlockManager* block_manager() const { return _block_manager.get(); }
 
 private:
+    Status _init_disk_block_manager(const TQueryOptions& query_options);
+
     TUniqueId _uid;
     std::unique_ptr<BlockManager> _block_manager;
     std::unique_ptr<DirManager> _remote_dir_manager;
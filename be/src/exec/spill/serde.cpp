@@ -16,12 +16,12 @@
 
 #include <cstring>
 
+#include "exec/spill/column_encoding.h"
 #include "exec/spill/options.h"
 #include "exec/spill/spiller.h"
 #include "gen_cpp/types.pb.h"
 #include "gutil/port.h"
 #include "runtime/runtime_state.h"
-#include "serde/column_array_serde.h"
 #include "serde/encode_context.h"
 #include "util/raw_container.h"
 
@@ -88,12 +88,11 @@ size_t ColumnarSerde::_max_serialized_size(const ChunkPtr& chunk) const {
     const auto& columns = chunk->columns();
     if (_encode_context == nullptr) {
         for (const auto& column : columns) {
-            total_size += serde::ColumnArraySerde::max_serialized_size(*column);
+            total_size += SpillColumnEncoding::max_serialized_size(*column, 0);
         }
     } else {
         for (size_t i = 0; i < columns.size(); i++) {
-            total_size +=
-                    serde::ColumnArraySerde::max_serialized_size(*columns[i], _encode_context->get_encode_level(i));
+            total_size += SpillColumnEncoding::max_serialized_size(*columns[i], _encode_context->get_encode_level(i));
         }
     }
     return total_size;
@@ -138,7 +137,7 @@ Status ColumnarSerde::serialize(RuntimeState* state, SerdeContext& ctx, const Ch
         int padding_size = 0;
         for (size_t i = 0; i < columns.size(); i++) {
             uint8_t* begin = buf;
-            buf = serde::ColumnArraySerde::serialize(*columns[i], buf, false, encode_levels[i]);
+            buf = SpillColumnEncoding::serialize(*columns[i], buf, encode_levels[i]);
             if (UNLIKELY(buf == nullptr)) {
                 return Status::InternalError("unsupported column occurs in spill serialize phase");
             }
@@ -148,6 +147,14 @@ Status ColumnarSerde::serialize(RuntimeState* state, SerdeContext& ctx, const Ch
             }
         }
         _update_encode_stats(column_stats);
+        uint64_t raw_bytes = 0;
+        uint64_t encoded_bytes = 0;
+        for (const auto& stats : column_stats) {
+            raw_bytes += stats.first;
+            encoded_bytes += stats.second;
+        }
+        COUNTER_UPDATE(_parent->metrics().serialize_raw_bytes, raw_bytes);
+        COUNTER_UPDATE(_parent->metrics().serialize_encoded_bytes, encoded_bytes);
         // total serialized size
         size_t content_length = buf - head;
         auto align_size = ALIGN_UP(content_length + padding_size, ALIGNED_SIZE);
@@ -192,7 +199,10 @@ StatusOr<ChunkUniquePtr> ColumnarSerde::deserialize(SerdeContext& ctx, BlockRead
     read_cursor += columns.size() * sizeof(uint32_t);
     SCOPED_TIMER(_parent->metrics().deserialize_timer);
     for (size_t i = 0; i < columns.size(); i++) {
-        read_cursor = serde::ColumnArraySerde::deserialize(read_cursor, columns[i].get(), false, encode_levels[i]);
+        read_cursor = SpillColumnEncoding::deserialize(read_cursor, columns[i].get(), encode_levels[i]);
+        if (UNLIKELY(read_cursor == nullptr)) {
+            return Status::InternalError("failed to deserialize spilled column");
+        }
     }
 
     TRACE_SPILL_LOG << "deserialize chunk from block: " << reader->debug_string()
@@ -14,6 +14,7 @@
 
 #include "exec/spill/spill_components.h"
 
+#include <algorithm>
 #include <any>
 #include <cstdint>
 #include <memory>
@@ -186,10 +187,15 @@ bool RawSpillerWriter::_need_compact_block() const {
 
 Status RawSpillerWriter::acquire_stream(const SpillPartitionInfo* partition,
                                         std::shared_ptr<SpillInputStream>* stream) {
-    return acquire_stream(stream);
+    // a skewed partition may be read several times, one time for each slice of the build side
+    return _acquire_stream(stream, options().read_shared || partition->skewed);
 }
 
 Status RawSpillerWriter::acquire_stream(std::shared_ptr<SpillInputStream>* stream) {
+    return _acquire_stream(stream, options().read_shared);
+}
+
+Status RawSpillerWriter::_acquire_stream(std::shared_ptr<SpillInputStream>* stream, bool read_shared) {
     std::shared_ptr<SpillInputStream> input_stream;
     const auto& serde = _spiller->serde();
     const auto& opts = options();
@@ -205,13 +211,59 @@ Status RawSpillerWriter::acquire_stream(std::shared_ptr<SpillInputStream>* strea
 
     if (_mem_table != nullptr && !_mem_table->is_empty()) {
         DCHECK(opts.is_unordered);
-        ASSIGN_OR_RETURN(auto mem_table_stream, _mem_table->as_input_stream(opts.read_shared));
+        ASSIGN_OR_RETURN(auto mem_table_stream, _mem_table->as_input_stream(read_shared));
         *stream = SpillInputStream::union_all(mem_table_stream, *stream);
     }
 
     return Status::OK();
 }
 
+void HashHeavyHitters::update(const uint32_t* hashes, size_t num_rows) {
+    size_t i = 0;
+    while (i < num_rows) {
+        // the rows of a hot key are usually adjacent, count them as a run
+        uint32_t hash = hashes[i];
+        size_t run = 1;
+        while (i + run < num_rows && hashes[i + run] == hash) {
+            run++;
+        }
+        i += run;
+
+        auto iter = std::find_if(_counters.begin(), _counters.end(),
+                                 [hash](const auto& counter) { return counter.first == hash; });
+        if (iter != _counters.end()) {
+            iter->second += run;
+            continue;
+        }
+        if (_counters.size() < kMaxCounters) {
+            _counters.emplace_back(hash, run);
+            continue;
+        }
+        // decrease all the counters by the weight of the new value, at most to the smallest counter
+        size_t min_count = std::min_element(_counters.begin(), _counters.end(), [](const auto& l, const auto& r) {
+                               return l.second < r.second;
+                           })->second;
+        size_t decrease = std::min(min_count, run);
+        for (auto& counter : _counters) {
+            counter.second -= decrease;
+        }
+        _counters.erase(std::remove_if(_counters.begin(), _counters.end(),
+                                       [](const auto& counter) { return counter.second == 0; }),
+                        _counters.end());
+        if (run > decrease) {
+            _counters.emplace_back(hash, run - decrease);
+        }
+    }
+}
+
+std::pair<uint32_t, size_t> HashHeavyHitters::top() const {
+    if (_counters.empty()) {
+        return {0, 0};
+    }
+    return *std::max_element(_counters.begin(), _counters.end(),
+                             [](const auto& l, const auto& r) { return l.second < r.second; });
+}
+
 PartitionedSpillerWriter::PartitionedSpillerWriter(Spiller* spiller, RuntimeState* state)
         : SpillerWriter(spiller, state), _mem_tracker(std::make_unique<MemTracker>(-1)) {}
 
@@ -256,6 +308,7 @@ void PartitionedSpillerWriter::reset_partition(const std::vector<const SpillPart
 
         _id_to_partitions.emplace(partition->partition_id, partition);
         partition->spill_writer = std::make_unique<RawSpillerWriter>(_spiller, _runtime_state, _mem_tracker.get());
+        partition->skewed = partitions[i]->skewed;
 
         _max_partition_id = std::max(partition->partition_id, _max_partition_id);
         _min_level = std::min(_min_level, partition->level);
@@ -341,8 +394,8 @@ Status PartitionedSpillerWriter::_choose_partitions_to_flush(bool is_final_flush
     if (options().splittable) {
         for (const auto& [pid, partition] : _id_to_partitions) {
             const auto& mem_table = partition->spill_writer->mem_table();
-            // partition not in memory
-            if (!partition->in_mem && partition->level < config::spill_max_partition_level &&
+            // partition not in memory, and splitting it can make it smaller
+            if (!partition->in_mem && !partition->skewed && partition->level < config::spill_max_partition_level &&
                 mem_table->mem_usage() + partition->bytes > options().spill_mem_table_bytes_size) {
                 RETURN_IF_ERROR(mem_table->done());
                 partition->in_mem = false;
@@ -514,21 +567,17 @@ Status PartitionedSpillerWriter::_split_input_partitions(workgroup::YieldContext
     auto io_task = std::any_cast<SpillIOTaskContextPtr>(yield_ctx.task_context_data);
     auto& flush_ctx = std::static_pointer_cast<PartitionedFlushContext>(io_task)->split_stage_ctx;
 
-    // TODO: check skew data here
     for (; flush_ctx.spliting_idx < splitting_partitions.size(); flush_ctx.spliting_idx++) {
         // split stage
         auto partition = splitting_partitions[flush_ctx.spliting_idx];
         if (flush_ctx.reader == nullptr) {
-            auto [left, right] = partition->split();
-            left->spill_writer = std::make_unique<RawSpillerWriter>(_spiller, _runtime_state, _mem_tracker.get());
-            left->in_mem = false;
-            left->spill_writer->prepare(_runtime_state);
-            left->spill_writer->acquire_mem_table();
-            right->in_mem = false;
-
-            right->spill_writer = std::make_unique<RawSpillerWriter>(_spiller, _runtime_state, _mem_tracker.get());
-            right->spill_writer->prepare(_runtime_state);
-            right->spill_writer->acquire_mem_table();
+            auto children = partition->split(_split_fanout_levels(partition));
+            for (auto& child : children) {
+                child->spill_writer = std::make_unique<RawSpillerWriter>(_spiller, _runtime_state, _mem_tracker.get());
+                child->in_mem = false;
+                child->spill_writer->prepare(_runtime_state);
+                child->spill_writer->acquire_mem_table();
+            }
 
             // write
             std::shared_ptr<SpillInputStream> stream;
@@ -538,22 +587,23 @@ Status PartitionedSpillerWriter::_split_input_partitions(workgroup::YieldContext
             reader->set_stream(std::move(stream));
 
             flush_ctx.reader = std::move(reader);
-            flush_ctx.left = std::move(left);
-            flush_ctx.right = std::move(right);
+            flush_ctx.children = std::move(children);
         }
 
-        auto st = _split_partition(yield_ctx, context, flush_ctx.reader.get(), partition, flush_ctx.left.get(),
-                                   flush_ctx.right.get());
+        auto st = _split_partition(yield_ctx, context, flush_ctx.reader.get(), partition, flush_ctx.children,
+                                   &flush_ctx.heavy_hitters);
         RETURN_IF_YIELD(yield_ctx.need_yield);
         RETURN_IF(!st.is_ok_or_eof(), st);
         TRACE_SPILL_LOG << "reader:" << flush_ctx.reader.get() << " read rows:" << flush_ctx.reader->read_rows();
-        DCHECK_EQ(flush_ctx.left->num_rows + flush_ctx.right->num_rows, partition->num_rows);
-
-        flush_ctx.left->spill_writer->acquire_mem_table();
-        flush_ctx.right->spill_writer->acquire_mem_table();
-
-        _add_partition(std::move(flush_ctx.right));
-        _add_partition(std::move(flush_ctx.left));
+        DCHECK_EQ(std::accumulate(flush_ctx.children.begin(), flush_ctx.children.end(), size_t(0),
+                                  [](size_t acc, const auto& child) { return acc + child->num_rows; }),
+                  partition->num_rows);
+
+        _mark_skewed_partitions(partition, flush_ctx.children, flush_ctx.heavy_hitters);
+        for (auto& child : flush_ctx.children) {
+            child->spill_writer->acquire_mem_table();
+            _add_partition(std::move(child));
+        }
 
         flush_ctx.reset_read_context();
     }
@@ -564,17 +614,43 @@ Status PartitionedSpillerWriter::_split_input_partitions(workgroup::YieldContext
     return Status::OK();
 }
 
+int32_t PartitionedSpillerWriter::_split_fanout_levels(const SpilledPartition* partition) const {
+    size_t budget = std::max<size_t>(options().spill_mem_table_bytes_size, 1);
+    int32_t levels = BitUtil::Log2Ceiling64((partition->bytes + budget - 1) / budget);
+    levels = std::min(levels, config::spill_max_partition_split_levels);
+    levels = std::min(levels, config::spill_max_partition_level - partition->level);
+    return std::max(levels, 1);
+}
+
+void PartitionedSpillerWriter::_mark_skewed_partitions(const SpilledPartition* partition,
+                                                       const std::vector<SpilledPartitionPtr>& children,
+                                                       const HashHeavyHitters& heavy_hitters) {
+    auto [hot_hash, hot_rows] = heavy_hitters.top();
+    if (hot_rows == 0) {
+        return;
+    }
+    int32_t num_levels = children.front()->level - partition->level;
+    auto& child = children[(hot_hash >> partition->level) & ((1 << num_levels) - 1)];
+    DCHECK_GE(child->num_rows, hot_rows);
+    // the rows of the hot key stay together no matter how many times the partition is split
+    size_t hot_bytes = child->bytes * hot_rows / child->num_rows;
+    if (hot_bytes > options().spill_mem_table_bytes_size) {
+        child->skewed = true;
+        COUNTER_UPDATE(_spiller->metrics().skewed_partitions, 1);
+        TRACE_SPILL_LOG << fmt::format("skewed partition [{}], hot hash [{}] rows [{}]", child->debug_string(),
+                                       hot_hash, hot_rows);
+    }
+}
+
 Status PartitionedSpillerWriter::_split_partition(workgroup::YieldContext& yield_ctx, SerdeContext& spill_ctx,
                                                   SpillerReader* reader, SpilledPartition* partition,
-                                                  SpilledPartition* left_partition, SpilledPartition* right_partition) {
+                                                  const std::vector<SpilledPartitionPtr>& children,
+                                                  HashHeavyHitters* heavy_hitters) {
     size_t current_level = partition->level;
-    auto left_mem_table = left_partition->spill_writer->mem_table();
-    auto right_mem_table = right_partition->spill_writer->mem_table();
+    const auto child_mask = static_cast<uint32_t>(children.size() - 1);
 
-    TRACE_SPILL_LOG << fmt::format(
-            "split partition [{}] to [{}] and [{}], left_mem_table_rows[{}], right_mem_table_rows[{}]",
-            partition->debug_string(), left_partition->debug_string(), right_partition->debug_string(),
-            left_mem_table->num_rows(), right_mem_table->num_rows());
+    TRACE_SPILL_LOG << fmt::format("split partition [{}] to [{}] partitions from [{}]", partition->debug_string(),
+                                   children.size(), children.front()->debug_string());
     Status st;
     {
         auto flush_partition = [this, &spill_ctx, &yield_ctx](SpilledPartition* partition) -> Status {
@@ -585,17 +661,34 @@ Status PartitionedSpillerWriter::_split_partition(workgroup::YieldContext& yield
             RETURN_IF_ERROR(mem_table->done());
             return this->spill_partition(yield_ctx, spill_ctx, partition);
         };
+        auto flush_children = [&]() -> Status {
+            for (const auto& child : children) {
+                RETURN_IF_ERROR(flush_partition(child.get()));
+                RETURN_IF(yield_ctx.need_yield, Status::OK());
+            }
+            return Status::OK();
+        };
+        auto children_mem_usage = [&]() {
+            size_t mem_usage = 0;
+            for (const auto& child : children) {
+                mem_usage += child->spill_writer->mem_table()->mem_usage();
+            }
+            return mem_usage;
+        };
 
         auto defer = DeferOp([&]() {
-            RETURN_IF(st = flush_partition(left_partition); !st.ok(), (void)0);
-            RETURN_IF(yield_ctx.need_yield, (void)0);
-            RETURN_IF(st = flush_partition(right_partition); !st.ok(), (void)0);
+            RETURN_IF(st = flush_children(); !st.ok(), (void)0);
             RETURN_IF(yield_ctx.need_yield, (void)0);
         });
         TRY_CATCH_ALLOC_SCOPE_START()
         while (true) {
             {
                 SCOPED_RAW_TIMER(&yield_ctx.time_spent_ns);
+                // with a large fan-out, the children can not hold all the data of the partition in memory
+                if (children_mem_usage() > options().spill_mem_table_bytes_size) {
+                    RETURN_IF_ERROR(flush_children());
+                    RETURN_IF_YIELD(yield_ctx.need_yield);
+                }
                 RETURN_IF_ERROR(reader->trigger_restore<SyncTaskExecutor>(_runtime_state, EmptyMemGuard{}));
                 if (!reader->has_output_data()) {
                     break;
@@ -606,45 +699,40 @@ Status PartitionedSpillerWriter::_split_partition(workgroup::YieldContext& yield
                 }
                 auto hash_column = down_cast<SpillHashColumn*>(chunk->columns().back().get());
                 const auto& hash_data = hash_column->get_data();
+                heavy_hitters->update(hash_data.data(), hash_data.size());
                 // hash data
                 std::vector<uint32_t> shuffle_result;
                 shuffle_result.resize(hash_data.size());
-                size_t left_channel_size = 0;
+                std::vector<uint32_t> channel_row_idx_start_points(children.size() + 1);
                 for (size_t i = 0; i < hash_data.size(); ++i) {
-                    shuffle_result[i] = hash_data[i] >> current_level & 0x01;
-                    left_channel_size += !shuffle_result[i];
+                    shuffle_result[i] = hash_data[i] >> current_level & child_mask;
+                    channel_row_idx_start_points[shuffle_result[i] + 1]++;
+                }
+                for (size_t i = 1; i < channel_row_idx_start_points.size(); ++i) {
+                    channel_row_idx_start_points[i] += channel_row_idx_start_points[i - 1];
                 }
-                size_t left_cursor = 0;
-                size_t right_cursor = left_channel_size;
                 std::vector<uint32_t> selection(hash_data.size());
+                std::vector<uint32_t> cursors(channel_row_idx_start_points.begin(),
+                                              channel_row_idx_start_points.end() - 1);
                 for (size_t i = 0; i < hash_data.size(); ++i) {
-                    if (shuffle_result[i] == 0) {
-                        selection[left_cursor++] = i;
-                    } else {
-                        selection[right_cursor++] = i;
-                    }
+                    selection[cursors[shuffle_result[i]]++] = i;
                 }
 
+                for (size_t c = 0; c < children.size(); ++c) {
+                    auto* child = children[c].get();
+                    uint32_t from = channel_row_idx_start_points[c];
+                    uint32_t size = channel_row_idx_start_points[c + 1] - from;
+                    if (size == 0) {
+                        continue;
+                    }
 #ifndef NDEBUG
-                for (size_t i = 0; i < left_cursor; i++) {
-                    DCHECK_EQ(hash_data[selection[i]] & left_partition->mask(),
-                              left_partition->partition_id & left_partition->mask());
-                }
-
-                for (size_t i = left_cursor; i < right_cursor; i++) {
-                    DCHECK_EQ(hash_data[selection[i]] & right_partition->mask(),
-                              right_partition->partition_id & right_partition->mask());
-                }
+                    for (size_t i = from; i < from + size; i++) {
+                        DCHECK_EQ(hash_data[selection[i]] & child->mask(), child->partition_id & child->mask());
+                    }
 #endif
-
-                if (left_channel_size > 0) {
-                    left_partition->num_rows += left_channel_size;
-                    RETURN_IF_ERROR(left_mem_table->append_selective(*chunk, selection.data(), 0, left_channel_size));
-                }
-                if (hash_data.size() != left_channel_size) {
-                    right_partition->num_rows += hash_data.size() - left_channel_size;
-                    RETURN_IF_ERROR(right_mem_table->append_selective(*chunk, selection.data(), left_channel_size,
-                                                                      hash_data.size() - left_channel_size));
+                    child->num_rows += size;
+                    RETURN_IF_ERROR(child->spill_writer->mem_table()->append_selective(*chunk, selection.data(), from,
+                                                                                       size));
                 }
             }
             BREAK_IF_YIELD(yield_ctx.wg, &yield_ctx.need_yield, yield_ctx.time_spent_ns);
@@ -193,6 +193,8 @@ private:
 
     bool _need_compact_block() const;
 
+    Status _acquire_stream(std::shared_ptr<SpillInputStream>* stream, bool read_shared);
+
     BlockGroupSet _block_group_set;
     MemTablePtr _mem_table;
     std::queue<MemTablePtr> _mem_table_pool;
@@ -203,18 +205,40 @@ private:
 struct SpilledPartition;
 using SpilledPartitionPtr = std::unique_ptr<SpilledPartition>;
 
+// Misra-Gries summary of the most frequent hash values, it finds the hot keys of a partition while the
+// partition is being split. The count of a hash value is under estimated by at most num_rows / (kMaxCounters + 1).
+class HashHeavyHitters {
+public:
+    static constexpr size_t kMaxCounters = 16;
+
+    void update(const uint32_t* hashes, size_t num_rows);
+
+    // the most frequent hash value and the lower bound of its count, {0, 0} if it is empty
+    std::pair<uint32_t, size_t> top() const;
+
+    void reset() { _counters.clear(); }
+
+private:
+    std::vector<std::pair<uint32_t, size_t>> _counters;
+};
+
 struct SpilledPartition : public SpillPartitionInfo {
     SpilledPartition(int32_t partition_id_) : SpillPartitionInfo(partition_id_) {}
 
-    // split partition to next level partition
-    std::pair<SpilledPartitionPtr, SpilledPartitionPtr> split() {
-        return {std::make_unique<SpilledPartition>(partition_id + level_elements()),
-                std::make_unique<SpilledPartition>(partition_id + level_elements() * 2)};
+    // split partition to 2^num_levels partitions of the level `level + num_levels`,
+    // the i-th child holds the rows whose hash bits [level, level + num_levels) equal to i
+    std::vector<SpilledPartitionPtr> split(int32_t num_levels) {
+        std::vector<SpilledPartitionPtr> children;
+        int32_t first_child = partition_id + (level_elements() << num_levels) - level_elements();
+        for (int32_t i = 0; i < (1 << num_levels); ++i) {
+            children.emplace_back(std::make_unique<SpilledPartition>(first_child + i * level_elements()));
+        }
+        return children;
     }
 
     std::string debug_string() {
-        return fmt::format("[id={},bytes={},mem_size={},num_rows={},in_mem={},is_spliting={}]", partition_id, bytes,
-                           mem_size, num_rows, in_mem, is_spliting);
+        return fmt::format("[id={},bytes={},mem_size={},num_rows={},in_mem={},is_spliting={},skewed={}]",
+                           partition_id, bytes, mem_size, num_rows, in_mem, is_spliting, skewed);
     }
 
     bool is_spliting = false;
@@ -312,12 +336,12 @@ public:
             SplitStageContext(SplitStageContext&&) = default;
             SplitStageContext& operator=(SplitStageContext&&) = default;
             size_t spliting_idx{};
-            SpilledPartitionPtr left;
-            SpilledPartitionPtr right;
+            std::vector<SpilledPartitionPtr> children;
+            HashHeavyHitters heavy_hitters;
             std::unique_ptr<SpillerReader> reader;
             void reset_read_context() {
-                left.reset();
-                right.reset();
+                children.clear();
+                heavy_hitters.reset();
                 reader.reset();
             }
         };
@@ -347,14 +371,23 @@ private:
                                    const std::vector<SpilledPartition*>& splitting_partitions);
 
     // split partition by hash
-    // hash-based partitioning can have significant degradation in the case of heavily skewed data.
+    // hash-based partitioning can have significant degradation in the case of heavily skewed data,
+    // the hot hash values are collected in heavy_hitters to find the children that can not be split any more.
     // TODO:
     // 1. We can actually split partitions based on blocks (they all belong to the same partition, but
     // can be executed in splitting out more parallel tasks). Process all blocks that hit this partition while processing the task
     // 2. If our input is ordered, we can use some sorting-based algorithm to split the partition. This way the probe side can do full streaming of the data
     Status _split_partition(workgroup::YieldContext& ctx, SerdeContext& context, SpillerReader* reader,
-                            SpilledPartition* partition, SpilledPartition* left_partition,
-                            SpilledPartition* right_partition);
+                            SpilledPartition* partition, const std::vector<SpilledPartitionPtr>& children,
+                            HashHeavyHitters* heavy_hitters);
+
+    // the number of levels to split a partition at once, chosen by the memory budget so that each child is
+    // expected to fit in memory
+    int32_t _split_fanout_levels(const SpilledPartition* partition) const;
+
+    // mark the children which are dominated by a hot key that alone exceeds the memory budget as skewed
+    void _mark_skewed_partitions(const SpilledPartition* partition, const std::vector<SpilledPartitionPtr>& children,
+                                 const HashHeavyHitters& heavy_hitters);
 
     void _add_partition(SpilledPartitionPtr&& partition);
     void _remove_partition(const SpilledPartition* partition);
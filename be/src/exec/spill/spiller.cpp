@@ -73,6 +73,8 @@ SpillProcessMetrics::SpillProcessMetrics(RuntimeProfile* profile, std::atomic_in
 
     serialize_timer = ADD_CHILD_TIMER(profile, "SerializeTime", parent);
     deserialize_timer = ADD_CHILD_TIMER(profile, "DeserializeTime", parent);
+    serialize_raw_bytes = ADD_CHILD_COUNTER(profile, "SerializeRawBytes", TUnit::BYTES, parent);
+    serialize_encoded_bytes = ADD_CHILD_COUNTER(profile, "SerializeEncodedBytes", TUnit::BYTES, parent);
     mem_table_peak_memory_usage = profile->AddHighWaterMarkCounter(
             "MemTablePeakMemoryBytes", TUnit::BYTES, RuntimeProfile::Counter::create_strategy(TUnit::BYTES), parent);
     input_stream_peak_memory_usage = profile->AddHighWaterMarkCounter(
@@ -82,6 +84,7 @@ SpillProcessMetrics::SpillProcessMetrics(RuntimeProfile* profile, std::atomic_in
     materialize_chunk_timer = ADD_CHILD_TIMER(profile, "MaterializeChunkTime", parent);
     shuffle_timer = ADD_CHILD_TIMER(profile, "ShuffleTime", parent);
     split_partition_timer = ADD_CHILD_TIMER(profile, "SplitPartitionTime", parent);
+    skewed_partitions = ADD_CHILD_COUNTER(profile, "SkewedPartitions", TUnit::UNIT, parent);
     restore_from_mem_table_rows = ADD_CHILD_COUNTER(profile, "RowsRestoreFromMemTable", TUnit::UNIT, parent);
     restore_from_mem_table_bytes = ADD_CHILD_COUNTER(profile, "BytesRestoreFromMemTable", TUnit::UNIT, parent);
     partition_writer_peak_memory_usage =
@@ -88,6 +88,9 @@ public:
     RuntimeProfile::Counter* serialize_timer = nullptr;
     // time spent to deserialize data after read it from disk
     RuntimeProfile::Counter* deserialize_timer = nullptr;
+    // data bytes of the spilled columns in memory and after encoded
+    RuntimeProfile::Counter* serialize_raw_bytes = nullptr;
+    RuntimeProfile::Counter* serialize_encoded_bytes = nullptr;
     // peak memory usage of mem table
     RuntimeProfile::HighWaterMarkCounter* mem_table_peak_memory_usage = nullptr;
     // peak memory usage of input stream
@@ -101,6 +104,8 @@ public:
     RuntimeProfile::Counter* shuffle_timer = nullptr;
     // time spent to split partitions, only used in join operator
     RuntimeProfile::Counter* split_partition_timer = nullptr;
+    // the number of partitions which are not split any more because of a hot key, only used in join operator
+    RuntimeProfile::Counter* skewed_partitions = nullptr;
     // data bytes restored from mem table in memory, only used in join operator
     RuntimeProfile::Counter* restore_from_mem_table_bytes = nullptr;
     // the number of rows restored from mem table in memory, only used in join operator
@@ -31,6 +31,8 @@
 #include "gutil/strings/util.h"
 #include "io/fd_input_stream.h"
 #include "io/io_profiler.h"
+#include "io/io_uring.h"
+#include "io/uring_input_stream.h"
 #include "testutil/sync_point.h"
 #include "util/errno.h"
 #include "util/slice.h"
@@ -136,6 +138,32 @@ static Status do_open(const string& filename, FileSystem::OpenMode mode, int* fd
     return Status::OK();
 }
 
+// Same as pwritev(2), but goes through the io_uring of the calling thread if it's enabled.
+static ssize_t do_pwritev(int fd, const struct iovec* iov, int iovcnt, off_t offset) {
+    io::IoUring* ring = config::enable_io_uring ? io::IoUring::thread_local_instance() : nullptr;
+    if (ring == nullptr) {
+        return pwritev(fd, iov, iovcnt, offset);
+    }
+    io::IoUring::Request req;
+    req.fd = fd;
+    req.is_write = true;
+    req.offset = offset;
+    req.iov = iov;
+    req.iov_count = iovcnt;
+    if (Status st = ring->submit_and_wait(&req, 1); !st.ok()) {
+        // The write may have been done partially, or still be in flight if the ring can't be drained, so don't
+        // retry it with pwritev.
+        LOG(WARNING) << "Failed to write by io_uring: " << st;
+        errno = EIO;
+        return -1;
+    }
+    if (req.result < 0) {
+        errno = static_cast<int>(-req.result);
+        return -1;
+    }
+    return req.result;
+}
+
 static Status do_writev_at(int fd, const string& filename, uint64_t offset, const Slice* data, size_t data_cnt,
                            size_t* bytes_written) {
     // Convert the results into the iovec vector to request
@@ -155,7 +183,7 @@ static Status do_writev_at(int fd, const string& filename, uint64_t offset, cons
         // Never request more than IOV_MAX in one request.
         size_t iov_count = std::min(data_cnt - completed_iov, static_cast<size_t>(IOV_MAX));
         ssize_t w;
-        RETRY_ON_EINTR(w, pwritev(fd, iov + completed_iov, iov_count, cur_offset));
+        RETRY_ON_EINTR(w, do_pwritev(fd, iov + completed_iov, iov_count, cur_offset));
         if (PREDICT_FALSE(w < 0)) {
             perror("TRACE pwritev");
             // An error: return a non-ok status.
@@ -364,6 +392,10 @@ public:
             fstream = std::make_unique<io::FdInputStream>(fd);
             fstream->set_close_on_delete(true);
         }
+        if (config::enable_io_uring && io::IoUring::is_supported()) {
+            auto uring_stream = std::make_unique<io::UringInputStream>(std::move(fstream));
+            return RandomAccessFile::from(std::move(uring_stream), fname, false, opts.encryption_info);
+        }
         return RandomAccessFile::from(std::move(fstream), fname, false, opts.encryption_info);
     }
 
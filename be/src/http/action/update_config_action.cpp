@@ -97,6 +97,12 @@ Status UpdateConfigAction::update_config(const std::string& name, const std::str
                 cache_limit = GlobalEnv::GetInstance()->check_storage_page_cache_size(cache_limit);
                 StoragePageCache::instance()->set_capacity(cache_limit);
             }
+            StoragePageCache::instance()->set_decoded_capacity(
+                    GlobalEnv::GetInstance()->get_storage_decoded_page_cache_size());
+        });
+        _config_callback.emplace("storage_decoded_page_cache_limit", [&]() {
+            StoragePageCache::instance()->set_decoded_capacity(
+                    GlobalEnv::GetInstance()->get_storage_decoded_page_cache_size());
         });
         _config_callback.emplace("datacache_mem_size", [&]() {
             int64_t mem_limit = MemInfo::physical_mem();
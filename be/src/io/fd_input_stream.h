@@ -57,6 +57,8 @@ public:
     // Otherwise, this is zero.
     int get_errno() const { return _errno; }
 
+    int fd() const { return _fd; }
+
 private:
     int _fd;
     int _errno;
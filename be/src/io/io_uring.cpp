@@ -0,0 +1,258 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "io/io_uring.h"
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#define STARROCKS_HAVE_IO_URING 1
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <cstring>
+
+#include "common/config.h"
+#include "common/logging.h"
+#include "io/io_error.h"
+
+namespace starrocks::io {
+
+#ifdef STARROCKS_HAVE_IO_URING
+
+static int sys_io_uring_setup(unsigned entries, struct io_uring_params* p) {
+    return static_cast<int>(::syscall(__NR_io_uring_setup, entries, p));
+}
+
+static int sys_io_uring_enter(int fd, unsigned to_submit, unsigned min_complete, unsigned flags) {
+    return static_cast<int>(::syscall(__NR_io_uring_enter, fd, to_submit, min_complete, flags, nullptr, 0));
+}
+
+template <typename T>
+static T* ring_field(void* ring, uint32_t offset) {
+    return reinterpret_cast<T*>(static_cast<char*>(ring) + offset);
+}
+
+Status IoUring::_init(uint32_t queue_depth) {
+    struct io_uring_params p;
+    memset(&p, 0, sizeof(p));
+    int fd = sys_io_uring_setup(queue_depth, &p);
+    if (fd < 0) {
+        return io_error("io_uring_setup", errno);
+    }
+    _ring_fd = fd;
+    _sq_entries = p.sq_entries;
+
+    _sq_ring_size = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+    _cq_ring_size = p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+    bool single_mmap = (p.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (single_mmap) {
+        _sq_ring_size = _cq_ring_size = std::max(_sq_ring_size, _cq_ring_size);
+    }
+    _sq_ring = ::mmap(nullptr, _sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd,
+                      IORING_OFF_SQ_RING);
+    if (_sq_ring == MAP_FAILED) {
+        _sq_ring = nullptr;
+        return io_error("mmap io_uring sq ring", errno);
+    }
+    if (single_mmap) {
+        _cq_ring = _sq_ring;
+    } else {
+        _cq_ring = ::mmap(nullptr, _cq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd,
+                          IORING_OFF_CQ_RING);
+        if (_cq_ring == MAP_FAILED) {
+            _cq_ring = nullptr;
+            return io_error("mmap io_uring cq ring", errno);
+        }
+    }
+    _sqes_size = p.sq_entries * sizeof(struct io_uring_sqe);
+    _sqes = ::mmap(nullptr, _sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+    if (_sqes == MAP_FAILED) {
+        _sqes = nullptr;
+        return io_error("mmap io_uring sqes", errno);
+    }
+
+    _sq_head = ring_field<unsigned>(_sq_ring, p.sq_off.head);
+    _sq_tail = ring_field<unsigned>(_sq_ring, p.sq_off.tail);
+    _sq_mask = ring_field<unsigned>(_sq_ring, p.sq_off.ring_mask);
+    _sq_array = ring_field<unsigned>(_sq_ring, p.sq_off.array);
+    _cq_head = ring_field<unsigned>(_cq_ring, p.cq_off.head);
+    _cq_tail = ring_field<unsigned>(_cq_ring, p.cq_off.tail);
+    _cq_mask = ring_field<unsigned>(_cq_ring, p.cq_off.ring_mask);
+    _cqes = ring_field<void>(_cq_ring, p.cq_off.cqes);
+    return Status::OK();
+}
+
+IoUring::~IoUring() {
+    if (_sqes != nullptr) {
+        ::munmap(_sqes, _sqes_size);
+    }
+    if (_cq_ring != nullptr && _cq_ring != _sq_ring) {
+        ::munmap(_cq_ring, _cq_ring_size);
+    }
+    if (_sq_ring != nullptr) {
+        ::munmap(_sq_ring, _sq_ring_size);
+    }
+    if (_ring_fd >= 0) {
+        ::close(_ring_fd);
+    }
+}
+
+size_t IoUring::_reap(Request* requests, size_t begin, size_t end) {
+    auto* cqes = static_cast<struct io_uring_cqe*>(_cqes);
+    size_t reaped = 0;
+    unsigned head = *_cq_head;
+    unsigned cq_tail = __atomic_load_n(_cq_tail, __ATOMIC_ACQUIRE);
+    for (; head != cq_tail; head++) {
+        const struct io_uring_cqe& cqe = cqes[head & *_cq_mask];
+        if (cqe.user_data < begin || cqe.user_data >= end) {
+            LOG(WARNING) << "Ignore the io_uring completion of unknown request " << cqe.user_data << ", expect ["
+                         << begin << ", " << end << ")";
+            continue;
+        }
+        requests[cqe.user_data].result = cqe.res;
+        reaped++;
+    }
+    __atomic_store_n(_cq_head, head, __ATOMIC_RELEASE);
+    return reaped;
+}
+
+void IoUring::_drain(Request* requests, size_t begin, size_t end, unsigned sq_tail_before, size_t completed) {
+    // The requests consumed by the kernel may still be reading or writing the buffers of the caller, wait for
+    // them before returning. The ones not consumed yet are dropped with the ring.
+    unsigned consumed = __atomic_load_n(_sq_head, __ATOMIC_ACQUIRE) - sq_tail_before;
+    while (completed < consumed) {
+        int ret = sys_io_uring_enter(_ring_fd, 0, 1, IORING_ENTER_GETEVENTS);
+        if (ret < 0 && errno != EINTR && errno != EAGAIN && errno != EBUSY) {
+            int err = errno;
+            LOG(WARNING) << "Failed to drain io_uring, " << consumed - completed
+                         << " requests are still in flight: " << std::strerror(err);
+            break;
+        }
+        completed += _reap(requests, begin, end);
+    }
+}
+
+Status IoUring::submit_and_wait(Request* requests, size_t count) {
+    if (_broken) {
+        return Status::InternalError("io_uring is broken by a previous failure");
+    }
+    auto* sqes = static_cast<struct io_uring_sqe*>(_sqes);
+    size_t submitted = 0;
+    while (submitted < count) {
+        // The completion queue is twice as large as the submission queue and all the
+        // completions are reaped before the next round, so it never overflows.
+        size_t batch = std::min<size_t>(count - submitted, _sq_entries);
+        const unsigned sq_tail_before = *_sq_tail;
+        unsigned tail = sq_tail_before;
+        for (size_t i = 0; i < batch; i++) {
+            const Request& r = requests[submitted + i];
+            unsigned index = tail & *_sq_mask;
+            struct io_uring_sqe* sqe = &sqes[index];
+            memset(sqe, 0, sizeof(*sqe));
+            sqe->opcode = r.is_write ? IORING_OP_WRITEV : IORING_OP_READV;
+            sqe->fd = r.fd;
+            sqe->off = r.offset;
+            sqe->addr = reinterpret_cast<uint64_t>(r.iov);
+            sqe->len = r.iov_count;
+            sqe->user_data = submitted + i;
+            _sq_array[index] = index;
+            tail++;
+        }
+        __atomic_store_n(_sq_tail, tail, __ATOMIC_RELEASE);
+
+        size_t completed = 0;
+        while (completed < batch) {
+            unsigned to_submit = tail - __atomic_load_n(_sq_head, __ATOMIC_ACQUIRE);
+            int ret = sys_io_uring_enter(_ring_fd, to_submit, 1, IORING_ENTER_GETEVENTS);
+            if (ret < 0 && errno != EINTR && errno != EAGAIN && errno != EBUSY) {
+                // The state of the ring is unknown, so it's never used again.
+                Status st = io_error("io_uring_enter", errno);
+                _broken = true;
+                completed += _reap(requests, submitted, submitted + batch);
+                _drain(requests, submitted, submitted + batch, sq_tail_before, completed);
+                return st;
+            }
+            completed += _reap(requests, submitted, submitted + batch);
+        }
+        submitted += batch;
+    }
+    return Status::OK();
+}
+
+StatusOr<std::unique_ptr<IoUring>> IoUring::create(uint32_t queue_depth) {
+    std::unique_ptr<IoUring> ring(new IoUring());
+    RETURN_IF_ERROR(ring->_init(queue_depth));
+    return std::move(ring);
+}
+
+bool IoUring::is_supported() {
+    static bool supported = []() {
+        auto ring_or = create(4);
+        if (!ring_or.ok()) {
+            LOG(WARNING) << "io_uring is not supported, fall back to blocking io: " << ring_or.status();
+            return false;
+        }
+        return true;
+    }();
+    return supported;
+}
+
+#else
+
+StatusOr<std::unique_ptr<IoUring>> IoUring::create(uint32_t queue_depth) {
+    return Status::NotSupported("io_uring is not supported on this platform");
+}
+
+bool IoUring::is_supported() {
+    return false;
+}
+
+IoUring::~IoUring() = default;
+
+Status IoUring::_init(uint32_t queue_depth) {
+    return Status::NotSupported("io_uring is not supported on this platform");
+}
+
+Status IoUring::submit_and_wait(Request* requests, size_t count) {
+    return Status::NotSupported("io_uring is not supported on this platform");
+}
+
+#endif
+
+IoUring* IoUring::thread_local_instance() {
+    static thread_local std::unique_ptr<IoUring> t_ring;
+    static thread_local bool t_initialized = false;
+    if (t_ring != nullptr && t_ring->_broken) {
+        // Tear down the broken ring, and the calling thread falls back to the blocking io from now on.
+        LOG(WARNING) << "Tear down the broken io_uring of the thread";
+        t_ring.reset();
+    }
+    if (!t_initialized) {
+        t_initialized = true;
+        if (is_supported()) {
+            auto ring_or = create(std::max(config::io_uring_queue_depth, 1));
+            if (ring_or.ok()) {
+                t_ring = std::move(ring_or).value();
+            } else {
+                LOG(WARNING) << "Failed to create io_uring: " << ring_or.status();
+            }
+        }
+    }
+    return t_ring.get();
+}
+
+} // namespace starrocks::io
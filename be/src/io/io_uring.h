@@ -0,0 +1,100 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <sys/uio.h>
+
+#include <cstdint>
+#include <memory>
+
+#include "common/statusor.h"
+
+namespace starrocks::io {
+
+// A minimal io_uring(7) wrapper talking to the kernel with raw syscalls, it only supports
+// submitting a batch of READV/WRITEV requests and waiting for all of them.
+//
+// A ring is not thread safe, use `thread_local_instance()` to get the ring of the calling
+// thread. When the kernel does not support io_uring, or it's forbidden by seccomp, the
+// callers should fall back to the blocking preadv/pwritev path.
+class IoUring {
+public:
+    struct Request {
+        int fd = -1;
+        bool is_write = false;
+        int64_t offset = 0;
+        const struct iovec* iov = nullptr;
+        int iov_count = 0;
+        // Set by `submit_and_wait()`: the number of bytes transferred, or -errno on failure.
+        // Like preadv/pwritev, a short transfer is not an error.
+        int64_t result = 0;
+    };
+
+    static StatusOr<std::unique_ptr<IoUring>> create(uint32_t queue_depth);
+
+    // Whether io_uring can be used in this process, the result is probed only once.
+    static bool is_supported();
+
+    // Returns the ring of the calling thread, created with `config::io_uring_queue_depth`
+    // on the first call, or nullptr if io_uring is not supported.
+    static IoUring* thread_local_instance();
+
+    ~IoUring();
+
+    IoUring(const IoUring&) = delete;
+    void operator=(const IoUring&) = delete;
+
+    // Submits all the |requests| and waits until all of them are completed. If |count| is
+    // larger than the queue depth, the requests are submitted in several rounds.
+    // Returns error only if the ring itself fails, the result of each request is stored
+    // in `Request::result`. A ring that failed is broken: the requests in flight are drained
+    // before returning, and the ring is never used again, `thread_local_instance()` tears it
+    // down and returns nullptr for the thread from then on.
+    Status submit_and_wait(Request* requests, size_t count);
+
+    uint32_t queue_depth() const { return _sq_entries; }
+
+private:
+    IoUring() = default;
+
+    Status _init(uint32_t queue_depth);
+
+    // Reaps the available completions of the requests [begin, end), and returns the number of them.
+    size_t _reap(Request* requests, size_t begin, size_t end);
+    // Waits for the requests consumed by the kernel after |sq_tail_before| to complete.
+    void _drain(Request* requests, size_t begin, size_t end, unsigned sq_tail_before, size_t completed);
+
+    int _ring_fd = -1;
+    bool _broken = false;
+
+    void* _sq_ring = nullptr;
+    size_t _sq_ring_size = 0;
+    void* _cq_ring = nullptr;
+    size_t _cq_ring_size = 0;
+    void* _sqes = nullptr;
+    size_t _sqes_size = 0;
+
+    uint32_t _sq_entries = 0;
+    unsigned* _sq_head = nullptr;
+    unsigned* _sq_tail = nullptr;
+    unsigned* _sq_mask = nullptr;
+    unsigned* _sq_array = nullptr;
+    unsigned* _cq_head = nullptr;
+    unsigned* _cq_tail = nullptr;
+    unsigned* _cq_mask = nullptr;
+    void* _cqes = nullptr;
+};
+
+} // namespace starrocks::io
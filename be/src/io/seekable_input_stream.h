@@ -14,12 +14,21 @@
 
 #pragma once
 
+#include <vector>
+
 #include "io/input_stream.h"
 
 namespace starrocks::io {
 
 class SeekableInputStream : public InputStream {
 public:
+    // One positional read of a batch, see `read_at_fully_batch()`.
+    struct ReadRequest {
+        int64_t offset;
+        void* out;
+        int64_t count;
+    };
+
     ~SeekableInputStream() override = default;
 
     // Repositions the offset of the InputStream to the argument |position|.
@@ -57,6 +66,17 @@ public:
     // ```
     virtual Status read_at_fully(int64_t offset, void* out, int64_t count);
 
+    // Read all the |requests| fully, each one has the same semantics as `read_at_fully()`.
+    // The output buffers must not overlap. Implementations may issue the requests concurrently,
+    // e.g, submit them to the kernel in one batch, so the order in which they are done is
+    // unspecified and the position of the stream is unspecified after the call.
+    //
+    // Default implementation:
+    // ```
+    //    for (auto& r : requests) RETURN_IF_ERROR(read_at_fully(r.offset, r.out, r.count));
+    // ```
+    virtual Status read_at_fully_batch(const std::vector<ReadRequest>& requests);
+
     // Return the total file size in bytes, or error.
     virtual StatusOr<int64_t> get_size() = 0;
 
@@ -218,20 +218,64 @@ Status SharedBufferedInputStream::get_bytes(const uint8_t** buffer, size_t offse
     if (sb.buffer.capacity() == 0) {
         RETURN_IF_ERROR(CurrentThread::mem_tracker()->check_mem_limit("read into shared buffer"));
         SCOPED_RAW_TIMER(&_shared_io_timer);
-        _shared_io_count += 1;
-        _shared_io_bytes += sb.size;
-        if (sb.size > sb.raw_size) {
-            // after called _deduplicate_shared_buffer(), sb.size maybe is larger than sb.raw_size
-            // we will count how many extra bytes we read because of alignment.
-            _shared_align_io_bytes += sb.size - sb.raw_size;
+        if (_options.max_batch_read_size > 0) {
+            RETURN_IF_ERROR(_batch_load_shared_buffers(shared_buffer));
+        } else {
+            _shared_io_count += 1;
+            _shared_io_bytes += sb.size;
+            if (sb.size > sb.raw_size) {
+                // after called _deduplicate_shared_buffer(), sb.size maybe is larger than sb.raw_size
+                // we will count how many extra bytes we read because of alignment.
+                _shared_align_io_bytes += sb.size - sb.raw_size;
+            }
+            sb.buffer.reserve(sb.size);
+            RETURN_IF_ERROR(_stream->read_at_fully(sb.offset, sb.buffer.data(), sb.size));
         }
-        sb.buffer.reserve(sb.size);
-        RETURN_IF_ERROR(_stream->read_at_fully(sb.offset, sb.buffer.data(), sb.size));
     }
     *buffer = sb.buffer.data() + offset - sb.offset;
     return Status::OK();
 }
 
+Status SharedBufferedInputStream::_batch_load_shared_buffers(const SharedBufferPtr& shared_buffer) {
+    // load |shared_buffer| together with the following unloaded shared buffers
+    std::vector<SharedBuffer*> buffers{shared_buffer.get()};
+    int64_t batch_size = shared_buffer->size;
+    auto iter = _map.find(shared_buffer->raw_offset + shared_buffer->raw_size);
+    if (iter != _map.end() && iter->second == shared_buffer) {
+        for (++iter; iter != _map.end(); ++iter) {
+            SharedBuffer* next = iter->second.get();
+            if (next->buffer.capacity() != 0) {
+                continue;
+            }
+            if (batch_size + next->size > _options.max_batch_read_size) {
+                break;
+            }
+            batch_size += next->size;
+            buffers.emplace_back(next);
+        }
+    }
+
+    std::vector<ReadRequest> requests;
+    requests.reserve(buffers.size());
+    for (SharedBuffer* sb : buffers) {
+        _shared_io_count += 1;
+        _shared_io_bytes += sb->size;
+        if (sb->size > sb->raw_size) {
+            _shared_align_io_bytes += sb->size - sb->raw_size;
+        }
+        sb->buffer.reserve(sb->size);
+        requests.push_back(ReadRequest{.offset = sb->offset, .out = sb->buffer.data(), .count = sb->size});
+    }
+    auto st = _stream->read_at_fully_batch(requests);
+    if (!st.ok()) {
+        // don't leave the buffers which look loaded but contain garbage
+        for (SharedBuffer* sb : buffers) {
+            std::vector<uint8_t>().swap(sb->buffer);
+        }
+    }
+    return st;
+}
+
 void SharedBufferedInputStream::release() {
     _map.clear();
 }
@@ -37,6 +37,9 @@ public:
         static constexpr int64_t MB = 1024 * 1024;
         int64_t max_dist_size = 1 * MB;
         int64_t max_buffer_size = 8 * MB;
+        // If greater than 0, a miss on a shared buffer also loads the following unloaded shared
+        // buffers with one `read_at_fully_batch()`, up to this many bytes in total.
+        int64_t max_batch_read_size = 0;
     };
     struct SharedBuffer {
         // request range
@@ -99,6 +102,7 @@ public:
 
 private:
     void _update_estimated_mem_usage();
+    Status _batch_load_shared_buffers(const SharedBufferPtr& shared_buffer);
     Status _sort_and_check_overlap(std::vector<IORange>& ranges);
     void _merge_small_ranges(const std::vector<IORange>& ranges);
     Status _set_io_ranges_all_columns(const std::vector<IORange>& ranges);
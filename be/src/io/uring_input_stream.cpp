@@ -0,0 +1,75 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "io/uring_input_stream.h"
+
+#include <cerrno>
+
+#include "io/io_error.h"
+#include "io/io_profiler.h"
+#include "io/io_uring.h"
+#include "util/stopwatch.hpp"
+
+namespace starrocks::io {
+
+Status UringInputStream::read_at_fully_batch(const std::vector<ReadRequest>& requests) {
+    IoUring* ring = requests.size() > 1 ? IoUring::thread_local_instance() : nullptr;
+    if (ring == nullptr) {
+        return SeekableInputStreamWrapper::read_at_fully_batch(requests);
+    }
+
+    MonotonicStopWatch watch;
+    watch.start();
+    std::vector<struct iovec> iovs(requests.size());
+    std::vector<IoUring::Request> pending(requests.size());
+    int64_t total_bytes = 0;
+    for (size_t i = 0; i < requests.size(); i++) {
+        const ReadRequest& r = requests[i];
+        iovs[i].iov_base = r.out;
+        iovs[i].iov_len = r.count;
+        pending[i].fd = _fd;
+        pending[i].offset = r.offset;
+        pending[i].iov = &iovs[i];
+        pending[i].iov_count = 1;
+        total_bytes += r.count;
+    }
+
+    while (!pending.empty()) {
+        RETURN_IF_ERROR(ring->submit_and_wait(pending.data(), pending.size()));
+        // resubmit the requests which are interrupted or partially done
+        size_t num_pending = 0;
+        for (auto& req : pending) {
+            if (req.result == -EINTR || req.result == -EAGAIN) {
+                pending[num_pending++] = req;
+            } else if (req.result < 0) {
+                return io_error("io_uring read", static_cast<int>(-req.result));
+            } else if (req.result == 0 && req.iov->iov_len > 0) {
+                return Status::IOError("can not read fully");
+            } else if (req.result < static_cast<int64_t>(req.iov->iov_len)) {
+                auto* iov = const_cast<struct iovec*>(req.iov);
+                iov->iov_base = static_cast<uint8_t*>(iov->iov_base) + req.result;
+                iov->iov_len -= req.result;
+                req.offset += req.result;
+                pending[num_pending++] = req;
+            }
+        }
+        pending.resize(num_pending);
+    }
+    IOProfiler::add_read(total_bytes, watch.elapsed_time());
+
+    const ReadRequest& last = requests.back();
+    return seek(last.offset + last.count);
+}
+
+} // namespace starrocks::io
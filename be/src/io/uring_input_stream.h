@@ -0,0 +1,41 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "io/fd_input_stream.h"
+
+namespace starrocks::io {
+
+// A FdInputStream whose batched reads are submitted to the io_uring of the calling thread
+// at once, instead of being issued one pread at a time. Single reads still use pread,
+// a ring round trip for one request is no cheaper than the syscall itself.
+//
+// Falls back to the FdInputStream if the io_uring of the calling thread is not available.
+class UringInputStream final : public SeekableInputStreamWrapper {
+public:
+    explicit UringInputStream(std::unique_ptr<FdInputStream> stream)
+            : SeekableInputStreamWrapper(stream.get(), kTakesOwnership), _fd(stream->fd()) {
+        (void)stream.release();
+    }
+
+    ~UringInputStream() override = default;
+
+    Status read_at_fully_batch(const std::vector<ReadRequest>& requests) override;
+
+private:
+    int _fd;
+};
+
+} // namespace starrocks::io
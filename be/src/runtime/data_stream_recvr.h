@@ -39,6 +39,7 @@
 #include "column/vectorized_fwd.h"
 #include "common/object_pool.h"
 #include "common/status.h"
+#include "exec/pipeline/pipeline_observer.h"
 #include "exec/sorting/merge_path.h"
 #include "gen_cpp/Types_types.h" // for TUniqueId
 #include "runtime/descriptors.h"
@@ -128,6 +129,9 @@ public:
 
     bool is_finished() const;
 
+    // Notifies the observers of the drivers when the chunks arrive or the senders finish.
+    pipeline::PipelineObservable* observable() { return &_observable; }
+
     bool is_data_ready();
 
     bool get_encode_level() const { return _encode_level; }
@@ -248,6 +252,8 @@ private:
 
     int _encode_level;
     bool _closed = false;
+
+    pipeline::PipelineObservable _observable;
 };
 
 } // end namespace starrocks
@@ -34,6 +34,7 @@
 
 #include "runtime/exec_env.h"
 
+#include <algorithm>
 #include <cctype>
 #include <memory>
 #include <thread>
@@ -259,7 +260,8 @@ void GlobalEnv::_reset_tracker() {
 void GlobalEnv::_init_storage_page_cache() {
     int64_t storage_cache_limit = get_storage_page_cache_size();
     storage_cache_limit = check_storage_page_cache_size(storage_cache_limit);
-    StoragePageCache::create_global_cache(page_cache_mem_tracker(), storage_cache_limit);
+    StoragePageCache::create_global_cache(page_cache_mem_tracker(), storage_cache_limit,
+                                          get_storage_decoded_page_cache_size());
 }
 
 int64_t GlobalEnv::get_storage_page_cache_size() {
@@ -270,6 +272,18 @@ int64_t GlobalEnv::get_storage_page_cache_size() {
     return ParseUtil::parse_mem_spec(config::storage_page_cache_limit.value(), mem_limit);
 }
 
+int64_t GlobalEnv::get_storage_decoded_page_cache_size() {
+    if (config::disable_storage_page_cache) {
+        return 0;
+    }
+    int64_t mem_limit = MemInfo::physical_mem();
+    if (process_mem_tracker()->has_limit()) {
+        mem_limit = process_mem_tracker()->limit();
+    }
+    // an invalid limit is parsed as -1, which disables the tier too.
+    return std::max<int64_t>(0, ParseUtil::parse_mem_spec(config::storage_decoded_page_cache_limit.value(), mem_limit));
+}
+
 int64_t GlobalEnv::check_storage_page_cache_size(int64_t storage_cache_limit) {
     if (storage_cache_limit > MemInfo::physical_mem()) {
         LOG(WARNING) << "Config storage_page_cache_limit is greater than memory size, config="
@@ -846,6 +860,7 @@ void ExecEnv::try_release_resource_before_core_dump() {
     auto* storage_page_cache = StoragePageCache::instance();
     if (storage_page_cache != nullptr && need_release("data_cache")) {
         storage_page_cache->set_capacity(0);
+        storage_page_cache->set_decoded_capacity(0);
         LOG(INFO) << "release storage page cache memory";
     }
     if (_block_cache != nullptr && need_release("data_cache")) {
@@ -152,6 +152,7 @@ public:
 
     int64_t get_storage_page_cache_size();
     int64_t check_storage_page_cache_size(int64_t storage_cache_limit);
+    int64_t get_storage_decoded_page_cache_size();
     static int64_t calc_max_query_memory(int64_t process_mem_limit, int64_t percent);
 
 private:
@@ -483,6 +483,12 @@ public:
 
     bool use_page_cache();
 
+    // The distance in rows of the software prefetches issued ahead of the hash table lookups, 0 disables them and
+    // a negative value lets each operator take its own default.
+    int32_t hash_table_prefetch_distance() const {
+        return _query_options.__isset.hash_table_prefetch_distance ? _query_options.hash_table_prefetch_distance : -1;
+    }
+
     bool enable_collect_table_level_scan_stats() const {
         return _query_options.__isset.enable_collect_table_level_scan_stats &&
                _query_options.enable_collect_table_level_scan_stats;
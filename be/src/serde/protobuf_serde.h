@@ -48,6 +48,17 @@ public:
     static StatusOr<ChunkPB> serialize_without_meta(const Chunk& chunk,
                                                     const std::shared_ptr<EncodeContext>& context = nullptr);
 
+    // The size of the buffer required by `serialize_to()`.
+    static int64_t max_serialized_data_size(const Chunk& chunk,
+                                            const std::shared_ptr<EncodeContext>& context = nullptr);
+
+    // Like `serialize()`, or `serialize_without_meta()` if |with_meta| is false, but write the data to |buff|
+    // instead of ChunkPB::data(), so the caller can hand the buffer over without copying it.
+    // |buff| must have max_serialized_data_size() bytes at least, and the size of the data written to it
+    // is set in ChunkPB::uncompressed_size().
+    static StatusOr<ChunkPB> serialize_to(const Chunk& chunk, uint8_t* buff, bool with_meta,
+                                          const std::shared_ptr<EncodeContext>& context = nullptr);
+
     // REQUIRE: the following fields of |chunk_pb| must be non-empty:
     //  - slot_id_map()
     //  - tuple_id_map()
@@ -55,6 +66,12 @@ public:
     //  - is_consts()
     static StatusOr<Chunk> deserialize(const RowDescriptor& row_desc, const ChunkPB& chunk_pb,
                                        const int encode_level = 0);
+
+private:
+    static void _serialize_meta(const Chunk& chunk, ChunkPB* chunk_pb);
+
+    static Status _serialize_data(const Chunk& chunk, const std::shared_ptr<EncodeContext>& context, uint8_t* buff,
+                                  ChunkPB* chunk_pb);
 };
 
 struct ProtobufChunkMeta {
@@ -79,6 +79,7 @@
 #include "storage/storage_engine.h"
 #include "storage/txn_manager.h"
 #include "util/failpoint/fail_point.h"
+#include "util/raw_container.h"
 #include "util/stopwatch.hpp"
 #include "util/thrift_util.h"
 #include "util/time.h"
@@ -186,8 +187,10 @@ void PInternalServiceImplBase<T>::_transmit_chunk(google::protobuf::RpcControlle
                 st = Status::InternalError(msg);
                 return;
             }
-            // also with copying due to the discontinuous memory in chunk
-            auto size = io_buf.cutn(chunk->mutable_data(), chunk->data_size());
+            // also with copying due to the discontinuous memory in chunk, the blocks received by brpc are
+            // small, while the chunk has to be deserialized from contiguous memory.
+            raw::stl_string_resize_uninitialized(chunk->mutable_data(), chunk->data_size());
+            auto size = io_buf.cutn(chunk->mutable_data()->data(), chunk->data_size());
             if (UNLIKELY(size != chunk->data_size())) {
                 auto msg = fmt::format("iobuf read {} != expected {}.", size, chunk->data_size());
                 LOG(WARNING) << msg;
@@ -207,4 +207,25 @@ inline uint64_t get_nibble_mask(uint8x16_t values) {
 
 #endif
 
+// Returns a 16-bit mask, the i-th bit of which is set if data[i] is equal to byte.
+inline uint32_t match_byte16(const uint8_t* data, uint8_t byte) {
+#if defined(__SSE2__)
+    const __m128i group = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+    return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8(static_cast<char>(byte)))));
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    const uint64_t nibbles = get_nibble_mask(vceqq_u8(vld1q_u8(data), vdupq_n_u8(byte)));
+    uint32_t mask = 0;
+    for (uint32_t i = 0; i < 16; i++) {
+        mask |= static_cast<uint32_t>((nibbles >> (i * 4)) & 1) << i;
+    }
+    return mask;
+#else
+    uint32_t mask = 0;
+    for (uint32_t i = 0; i < 16; i++) {
+        mask |= static_cast<uint32_t>(data[i] == byte) << i;
+    }
+    return mask;
+#endif
+}
+
 } // namespace SIMD
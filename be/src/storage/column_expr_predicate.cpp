@@ -1,8 +1,10 @@
 #include "storage/column_expr_predicate.h"
 
+#include <algorithm>
 #include <utility>
 
 #include "column/column_helper.h"
+#include "common/config.h"
 #include "common/status.h"
 #include "common/statusor.h"
 #include "exprs/binary_predicate.h"
@@ -17,6 +19,7 @@
 #include "runtime/runtime_state.h"
 #include "storage/column_predicate.h"
 #include "types/logical_type.h"
+#include "util/fsst_coding.h"
 
 namespace starrocks {
 
@@ -189,6 +192,70 @@ bool ColumnExprPredicate::ngram_bloom_filter(const BloomFilter* bf,
     return _expr_ctxs[0]->ngram_bloom_filter(bf, reader_options);
 }
 
+const std::string* ColumnExprPredicate::_get_like_prefix() const {
+    if (!_like_prefix_parsed) {
+        std::string prefix;
+        if (_parse_like_prefix(&prefix)) {
+            _like_prefix = std::move(prefix);
+        }
+        _like_prefix_parsed = true;
+    }
+    return _like_prefix.has_value() ? &_like_prefix.value() : nullptr;
+}
+
+bool ColumnExprPredicate::_parse_like_prefix(std::string* prefix) const {
+    if (_expr_ctxs.size() != 1 || type_info()->type() != TYPE_VARCHAR) {
+        return false;
+    }
+    Expr* expr = _expr_ctxs[0]->root();
+    if (expr->node_type() != TExprNodeType::FUNCTION_CALL || expr->get_num_children() != 2 ||
+        expr->get_child(0)->node_type() != TExprNodeType::SLOT_REF ||
+        expr->get_child(1)->node_type() != TExprNodeType::STRING_LITERAL) {
+        return false;
+    }
+    auto* function_call = down_cast<VectorizedFunctionCallExpr*>(expr);
+    if (LIKE_FN_NAME != boost::to_lower_copy(function_call->get_function_desc()->name)) {
+        return false;
+    }
+    auto* pattern_literal = dynamic_cast<VectorizedLiteral*>(expr->get_child(1));
+    if (pattern_literal == nullptr) {
+        return false;
+    }
+    auto pattern_column = pattern_literal->evaluate_checked(_expr_ctxs[0], nullptr);
+    if (!pattern_column.ok() || pattern_column.value()->only_null()) {
+        return false;
+    }
+    Slice pattern = pattern_column.value()->get(0).get_slice();
+    // 'prefix%' without any other wildcard or escape
+    if (pattern.size == 0 || pattern.data[pattern.size - 1] != '%') {
+        return false;
+    }
+    Slice body(pattern.data, pattern.size - 1);
+    for (size_t i = 0; i < body.size; i++) {
+        if (body.data[i] == '%' || body.data[i] == '_' || body.data[i] == '\\') {
+            return false;
+        }
+    }
+    prefix->assign(body.data, body.size);
+    return true;
+}
+
+bool ColumnExprPredicate::support_fsst_filter() const {
+    return _get_like_prefix() != nullptr;
+}
+
+Status ColumnExprPredicate::fsst_filter(const FsstSymbolTable& symbol_table, const Slice* codes, size_t count,
+                                        uint8_t* selection) const {
+    const std::string* prefix = _get_like_prefix();
+    if (prefix == nullptr) {
+        return Status::NotSupported("fsst filter is not supported");
+    }
+    for (size_t i = 0; i < count; i++) {
+        selection[i] &= symbol_table.starts_with(codes[i], *prefix);
+    }
+    return Status::OK();
+}
+
 Status ColumnExprPredicate::convert_to(const ColumnPredicate** output, const TypeInfoPtr& target_type_info,
                                        ObjectPool* obj_pool) const {
     TypeDescriptor input_type = TypeDescriptor::from_storage_type_info(target_type_info.get());
@@ -283,6 +350,165 @@ Status ColumnExprPredicate::try_to_rewrite_for_zone_map_filter(starrocks::Object
 
     return Status::OK();
 }
+
+// The opcode of `b op' a` which is equivalent to `a op b`.
+static TExprOpcode::type swap_binary_op(TExprOpcode::type op) {
+    switch (op) {
+    case TExprOpcode::LT:
+        return TExprOpcode::GT;
+    case TExprOpcode::LE:
+        return TExprOpcode::GE;
+    case TExprOpcode::GT:
+        return TExprOpcode::LT;
+    case TExprOpcode::GE:
+        return TExprOpcode::LE;
+    default:
+        return op;
+    }
+}
+
+// Return the name in the json path `$.name` or `name`, or empty if the path is not a single-level simple name,
+// which is the name of the flattened sub-column.
+static std::string single_level_json_path(const Slice& path) {
+    std::string name = path.to_string();
+    if (name.size() > 2 && name[0] == '$' && name[1] == '.') {
+        name = name.substr(2);
+    }
+    bool simple = !name.empty() && std::all_of(name.begin(), name.end(), [](char c) {
+        return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+    });
+    return simple ? name : std::string();
+}
+
+Status ColumnExprPredicate::try_to_rewrite_for_subfield_zone_map_filter(
+        starrocks::ObjectPool* pool, std::vector<const ColumnExprPredicate*>* output) const {
+    DCHECK(pool != nullptr);
+    DCHECK(output != nullptr);
+    if (!config::enable_subfield_zonemap || _expr_ctxs.size() != 1) {
+        return Status::OK();
+    }
+    Expr* root = _expr_ctxs[0]->root();
+    if (root->node_type() != TExprNodeType::BINARY_PRED || root->get_num_children() != 2) {
+        return Status::OK();
+    }
+    TExprOpcode::type op = root->op();
+    if (op != TExprOpcode::EQ && op != TExprOpcode::NE && op != TExprOpcode::LT && op != TExprOpcode::LE &&
+        op != TExprOpcode::GT && op != TExprOpcode::GE) {
+        return Status::OK();
+    }
+    Expr* subfield = root->get_child(0);
+    Expr* literal = root->get_child(1);
+    if (dynamic_cast<VectorizedLiteral*>(literal) == nullptr) {
+        std::swap(subfield, literal);
+        op = swap_binary_op(op);
+    }
+    if (dynamic_cast<VectorizedLiteral*>(literal) == nullptr) {
+        return Status::OK();
+    }
+    auto is_this_slot = [this](Expr* expr) {
+        return expr->node_type() == TExprNodeType::SLOT_REF &&
+               down_cast<ColumnRef*>(expr)->slot_id() == _slot_desc->id();
+    };
+
+    std::vector<std::string> path;
+    TypeDescriptor leaf_type = subfield->type();
+    switch (subfield->node_type()) {
+    case TExprNodeType::SUBFIELD_EXPR: {
+        // struct_col.a.b, all the levels are in one expression
+        std::vector<std::vector<std::string>> subfields;
+        if (subfield->get_num_children() != 1 || !is_this_slot(subfield->get_child(0)) ||
+            subfield->get_subfields(&subfields) != 1) {
+            return Status::OK();
+        }
+        path = std::move(subfields[0]);
+        break;
+    }
+    case TExprNodeType::FUNCTION_CALL: {
+        // get_json_int(json_col, '$.a')
+        auto* function_call = down_cast<VectorizedFunctionCallExpr*>(subfield);
+        if (function_call->get_function_desc() == nullptr || subfield->get_num_children() != 2 ||
+            !is_this_slot(subfield->get_child(0)) || subfield->get_child(0)->type().type != TYPE_JSON ||
+            dynamic_cast<VectorizedLiteral*>(subfield->get_child(1)) == nullptr) {
+            return Status::OK();
+        }
+        const std::string fn_name = boost::to_lower_copy(function_call->get_function_desc()->name);
+        if (fn_name != "get_json_int" && fn_name != "get_json_double" && fn_name != "get_json_string" &&
+            fn_name != "get_json_bool") {
+            return Status::OK();
+        }
+        auto json_path = subfield->get_child(1)->evaluate_checked(_expr_ctxs[0], nullptr);
+        if (!json_path.ok() || json_path.value()->only_null()) {
+            return Status::OK();
+        }
+        std::string name = single_level_json_path(json_path.value()->get(0).get_slice());
+        if (name.empty()) {
+            return Status::OK();
+        }
+        path.emplace_back(std::move(name));
+        break;
+    }
+    case TExprNodeType::MAP_ELEMENT_EXPR: {
+        // map_col[key] is NULL for the rows without the key, so only the rows with the key may satisfy
+        // the predicate, whatever the predicate on the value is.
+        if (subfield->get_num_children() != 2 || !is_this_slot(subfield->get_child(0)) ||
+            dynamic_cast<VectorizedLiteral*>(subfield->get_child(1)) == nullptr) {
+            return Status::OK();
+        }
+        path.emplace_back(kMapKeysSubfield);
+        leaf_type = subfield->get_child(0)->type().children[0];
+        literal = subfield->get_child(1);
+        op = TExprOpcode::EQ;
+        break;
+    }
+    default:
+        return Status::OK();
+    }
+    if (literal->type().type != leaf_type.type || !is_subfield_zone_map_type(leaf_type.type)) {
+        return Status::OK();
+    }
+    auto literal_value = literal->evaluate_checked(_expr_ctxs[0], nullptr);
+    if (!literal_value.ok() || literal_value.value()->only_null()) {
+        return Status::OK();
+    }
+
+    // build `subfield op literal` on the column of the subfield, and rewrite = to >= and <=
+    std::vector<TExprOpcode::type> leaf_ops;
+    if (op == TExprOpcode::EQ) {
+        leaf_ops = {TExprOpcode::LE, TExprOpcode::GE};
+    } else {
+        leaf_ops = {op};
+    }
+    for (TExprOpcode::type leaf_op : leaf_ops) {
+        TExprNode node;
+        node.node_type = TExprNodeType::BINARY_PRED;
+        node.type = root->type().to_thrift();
+        node.child_type = to_thrift(leaf_type.type);
+        node.__set_opcode(leaf_op);
+        Expr* leaf_root = VectorizedBinaryPredicateFactory::from_thrift(node);
+        if (leaf_root == nullptr) {
+            output->clear();
+            return Status::OK();
+        }
+        pool->add(leaf_root);
+        leaf_root->add_child(pool->add(new ColumnRef(leaf_type, _slot_desc->id())));
+        leaf_root->add_child(Expr::copy(pool, literal));
+        leaf_root->set_monotonic(true);
+
+        auto leaf_ctx = std::make_unique<ExprContext>(leaf_root);
+        RETURN_IF_ERROR(leaf_ctx->prepare(_state));
+        RETURN_IF_ERROR(leaf_ctx->open(_state));
+        ASSIGN_OR_RETURN(ColumnExprPredicate * new_pred,
+                         ColumnExprPredicate::make_column_expr_predicate(
+                                 get_type_info(leaf_type.type, leaf_type.precision, leaf_type.scale), _column_id,
+                                 _state, nullptr, _slot_desc));
+        new_pred = pool->add(new_pred);
+        new_pred->_add_expr_ctx(std::move(leaf_ctx));
+        new_pred->set_subfield_path(path);
+        output->emplace_back(new_pred);
+    }
+    return Status::OK();
+}
+
 Status ColumnExprPredicate::seek_inverted_index(const std::string& column_name, InvertedIndexIterator* iterator,
                                                 roaring::Roaring* row_bitmap) const {
     // Only support simple (NOT) LIKE/MATCH predicate for now
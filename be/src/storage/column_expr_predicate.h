@@ -1,3 +1,5 @@
+#include <optional>
+#include <string>
 #include <utility>
 
 #include "exprs/expr.h"
@@ -46,6 +48,10 @@ public:
     bool support_original_bloom_filter() const override { return false; }
     bool support_ngram_bloom_filter() const override { return _expr_ctxs[0]->support_ngram_bloom_filter(); }
     bool ngram_bloom_filter(const BloomFilter* bf, const NgramBloomFilterReaderOptions& reader_options) const override;
+    // Only `column LIKE 'prefix%'` is supported, which is evaluated as a prefix match on the compressed strings.
+    bool support_fsst_filter() const override;
+    Status fsst_filter(const FsstSymbolTable& symbol_table, const Slice* codes, size_t count,
+                       uint8_t* selection) const override;
     PredicateType type() const override { return PredicateType::kExpr; }
     bool can_vectorized() const override { return true; }
 
@@ -61,6 +67,12 @@ public:
     // otherwise, it will contain one or more predicates which form the conjunction normal form
     Status try_to_rewrite_for_zone_map_filter(starrocks::ObjectPool* pool,
                                               std::vector<const ColumnExprPredicate*>* output) const;
+    // try to rewrite the predicate on a subfield of the nested column, i.e. `struct_col.a.b op literal`,
+    // `get_json_xxx(json_col, '$.a') op literal` and `map_col[key] op literal`, to the predicates on the subfield,
+    // which are evaluated on the zone map index of the subfield, see ColumnPredicate::subfield_path().
+    // output is empty if the conditions of rewriting is not met.
+    Status try_to_rewrite_for_subfield_zone_map_filter(starrocks::ObjectPool* pool,
+                                                       std::vector<const ColumnExprPredicate*>* output) const;
     Status seek_inverted_index(const std::string& column_name, InvertedIndexIterator* iterator,
                                roaring::Roaring* row_bitmap) const override;
 
@@ -72,6 +84,11 @@ private:
 
     void _add_expr_ctxs(const std::vector<ExprContext*>& expr_ctxs);
 
+    // Return the prefix if this predicate is `column LIKE 'prefix%'` on a VARCHAR column, or nullptr otherwise.
+    // The pattern is parsed on the first call only.
+    const std::string* _get_like_prefix() const;
+    bool _parse_like_prefix(std::string* prefix) const;
+
     // Take ownership of this expression, not necessary to clone
     void _add_expr_ctx(std::unique_ptr<ExprContext> expr_ctx);
 
@@ -84,6 +101,8 @@ private:
     const SlotDescriptor* _slot_desc;
     bool _monotonic;
     mutable std::vector<uint8_t> _tmp_select;
+    mutable bool _like_prefix_parsed = false;
+    mutable std::optional<std::string> _like_prefix;
 };
 
 class ColumnTruePredicate : public ColumnPredicate {
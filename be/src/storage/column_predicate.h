@@ -15,6 +15,7 @@
 #pragma once
 
 #include <cstdint>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -47,6 +48,7 @@ class ExprContext;
 class RuntimeState;
 class SlotDescriptor;
 class BitmapIndexIterator;
+class FsstSymbolTable;
 struct NgramBloomFilterReaderOptions;
 } // namespace starrocks
 
@@ -168,6 +170,16 @@ public:
         return true;
     }
 
+    // Return true if this predicate can be evaluated on the strings compressed by FSST, see fsst_filter().
+    virtual bool support_fsst_filter() const { return false; }
+
+    // Evaluate this predicate on the |count| strings compressed into |codes| by |symbol_table|, and clear
+    // |selection[i]| if the i-th string doesn't satisfy it, without decompressing the strings.
+    virtual Status fsst_filter(const FsstSymbolTable& symbol_table, const Slice* codes, size_t count,
+                               uint8_t* selection) const {
+        return Status::NotSupported("fsst filter is not supported");
+    }
+
     virtual bool support_bitmap_filter() const { return false; }
 
     virtual Status seek_bitmap_dictionary(BitmapIndexIterator* iter, SparseRange<>* range) const {
@@ -193,6 +205,16 @@ public:
 
     void set_index_filter_only(bool is_index_only) { _is_index_filter_only = is_index_only; }
 
+    // The path of the subfield of a nested column this predicate is on, e.g. {"a", "b"} for `struct_col.a.b > 1`,
+    // or empty if it's on the whole column. Such predicates are rewritten from the expressions on the subfields
+    // only to prune the pages by the zone maps of the subfields, so they have the type of the subfield while
+    // column_id() is still the id of the nested column. See kMapKeysSubfield for the predicates on the keys of MAP.
+    const std::vector<std::string>& subfield_path() const { return _subfield_path; }
+
+    void set_subfield_path(std::vector<std::string> path) { _subfield_path = std::move(path); }
+
+    bool is_subfield_predicate() const { return !_subfield_path.empty(); }
+
     virtual PredicateType type() const = 0;
 
     // Constant value in the predicate. And this constant value might be adjusted according to schema.
@@ -230,8 +252,13 @@ protected:
     bool _is_index_filter_only = false;
     // If this predicate uses ExprContext*
     bool _is_expr_predicate = false;
+    std::vector<std::string> _subfield_path;
 };
 
+// The subfield path of the predicates on the keys of MAP columns, which are satisfied by the rows having some key
+// satisfying them, e.g. `key = 'k'` rewritten from `map_col['k'] = 1`.
+inline const std::string kMapKeysSubfield = "$keys";
+
 using PredicateList = std::vector<const ColumnPredicate*>;
 
 ColumnPredicate* new_column_eq_predicate(const TypeInfoPtr& type, ColumnId id, const Slice& operand);
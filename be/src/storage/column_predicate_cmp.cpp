@@ -26,6 +26,7 @@
 #include "storage/rowset/bloom_filter.h"
 #include "storage/types.h"
 #include "storage/zone_map_detail.h"
+#include "util/fsst_coding.h"
 #include "util/string_parser.hpp"
 
 namespace starrocks {
@@ -669,6 +670,22 @@ public:
         return bf->test_bytes(padded.data, padded.size);
     }
 
+    // The CHAR values are stored with the trailing zeros, so only VARCHAR is supported.
+    bool support_fsst_filter() const override { return field_type == TYPE_VARCHAR; }
+
+    Status fsst_filter(const FsstSymbolTable& symbol_table, const Slice* codes, size_t count,
+                       uint8_t* selection) const override {
+        // The compression is deterministic, so only the strings equal to the value are compressed into the same
+        // codes as the value.
+        faststring value_codes;
+        symbol_table.compress(this->_value, &value_codes);
+        Slice expected(value_codes.data(), value_codes.size());
+        for (size_t i = 0; i < count; i++) {
+            selection[i] &= (codes[i] == expected);
+        }
+        return Status::OK();
+    }
+
     bool support_bitmap_filter() const override { return true; }
 
     Status seek_bitmap_dictionary(BitmapIndexIterator* iter, SparseRange<>* range) const override {
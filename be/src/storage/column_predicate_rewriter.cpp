@@ -627,6 +627,10 @@ Status ZonemapPredicatesRewriter::_rewrite_column_expr_predicate(ObjectPool* poo
                                                                  std::vector<const ColumnExprPredicate*>& dst_preds) {
     DCHECK(src_pred != nullptr);
     const auto* column_expr_pred = down_cast<const ColumnExprPredicate*>(src_pred);
+    RETURN_IF_ERROR(column_expr_pred->try_to_rewrite_for_subfield_zone_map_filter(pool, &dst_preds));
+    if (!dst_preds.empty()) {
+        return Status::OK();
+    }
     return column_expr_pred->try_to_rewrite_for_zone_map_filter(pool, &dst_preds);
 }
 
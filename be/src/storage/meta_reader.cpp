@@ -28,13 +28,14 @@
 #include "storage/rowset/column_iterator.h"
 #include "storage/rowset/column_reader.h"
 #include "storage/rowset/rowset.h"
+#include "types/hll.h"
 #include "types/logical_type.h"
 #include "util/slice.h"
 
 namespace starrocks {
 
 std::vector<std::string> SegmentMetaCollecter::support_collect_fields = {"flat_json_meta", "dict_merge", "max", "min",
-                                                                         "count"};
+                                                                         "count", "ndv"};
 
 Status SegmentMetaCollecter::parse_field_and_colname(const std::string& item, std::string* field,
                                                      std::string* col_name) {
@@ -131,6 +132,10 @@ Status MetaReader::_fill_result_chunk(Chunk* chunk) {
             desc.children.emplace_back(item_desc);
             ColumnPtr column = ColumnHelper::create_column(desc, false);
             chunk->append_column(std::move(column), slot->id());
+        } else if (field == "ndv") {
+            // the sketch of each segment, merged by hll_union_agg() above the meta scan
+            ColumnPtr column = ColumnHelper::create_column(TypeDescriptor(TYPE_HLL), _has_count_agg);
+            chunk->append_column(std::move(column), slot->id());
         } else if (field == "flat_json_meta") {
             TypeDescriptor item_desc;
             item_desc.type = TYPE_VARCHAR;
@@ -229,6 +234,8 @@ Status SegmentMetaCollecter::_collect(const std::string& name, ColumnId cid, Col
         return _collect_count(column, type);
     } else if (name == "flat_json_meta") {
         return _collect_flat_json(cid, column);
+    } else if (name == "ndv") {
+        return _collect_ndv(cid, column, type);
     }
     return Status::NotSupported("Not Support Collect Meta: " + name);
 }
@@ -354,4 +361,24 @@ Status SegmentMetaCollecter::_collect_count(Column* column, LogicalType type) {
     return Status::OK();
 }
 
+// collect the ndv sketch written by NdvSketchWriter
+Status SegmentMetaCollecter::_collect_ndv(ColumnId cid, Column* column, LogicalType type) {
+    if (cid >= _segment->num_columns()) {
+        return Status::NotFound("");
+    }
+    const ColumnReader* col_reader = _segment->column(cid);
+    if (col_reader == nullptr || col_reader->ndv_sketch() == nullptr) {
+        return Status::NotFound(fmt::format("no ndv sketch in segment {}", _segment->file_name()));
+    }
+    if (col_reader->column_type() != type) {
+        return Status::InternalError("column type mismatch");
+    }
+    HyperLogLog hll;
+    if (!hll.deserialize(Slice(*col_reader->ndv_sketch()))) {
+        return Status::Corruption(fmt::format("invalid ndv sketch in segment {}", _segment->file_name()));
+    }
+    column->append_datum(Datum(&hll));
+    return Status::OK();
+}
+
 } // namespace starrocks
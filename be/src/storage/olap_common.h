@@ -247,6 +247,8 @@ struct OlapReaderStatistics {
     int64_t zone_map_filter_ns = 0;
     int64_t rows_key_range_filter_ns = 0;
     int64_t bf_filter_ns = 0;
+    int64_t fsst_filter_ns = 0;
+    int64_t delta_anchor_filter_ns = 0;
 
     int64_t segment_stats_filtered = 0;
     int64_t rows_key_range_filtered = 0;
@@ -254,11 +256,17 @@ struct OlapReaderStatistics {
     int64_t rows_key_range_num = 0;
     int64_t rows_stats_filtered = 0;
     int64_t rows_bf_filtered = 0;
+    // the rows filtered by the predicates evaluated on the FSST compressed strings
+    int64_t rows_fsst_filtered = 0;
+    // the rows filtered by the predicates evaluated on the anchors of the delta binary packed pages
+    int64_t rows_delta_anchor_filtered = 0;
     int64_t rows_del_filtered = 0;
     int64_t del_filter_ns = 0;
 
     int64_t total_pages_num = 0;
     int64_t cached_pages_num = 0;
+    // the data pages read from the decoded page tier of the page cache
+    int64_t decoded_cached_pages_num = 0;
 
     int64_t rows_bitmap_index_filtered = 0;
     int64_t bitmap_index_filter_timer = 0;
@@ -36,11 +36,17 @@
 
 #include <malloc.h>
 
+#include <string_view>
+
+#include "common/config.h"
+#include "common/logging.h"
 #include "runtime/current_thread.h"
 #include "runtime/mem_tracker.h"
 #include "util/defer_op.h"
 #include "util/lru_cache.h"
 #include "util/metrics.h"
+#include "util/murmur_hash3.h"
+#include "util/phmap/phmap.h"
 #include "util/starrocks_metrics.h"
 
 namespace starrocks {
@@ -48,12 +54,18 @@ namespace starrocks {
 METRIC_DEFINE_UINT_GAUGE(page_cache_lookup_count, MetricUnit::OPERATIONS);
 METRIC_DEFINE_UINT_GAUGE(page_cache_hit_count, MetricUnit::OPERATIONS);
 METRIC_DEFINE_UINT_GAUGE(page_cache_capacity, MetricUnit::BYTES);
+METRIC_DEFINE_DOUBLE_GAUGE(page_cache_hit_ratio, MetricUnit::PERCENT);
+METRIC_DEFINE_UINT_GAUGE(page_cache_admission_reject_count, MetricUnit::OPERATIONS);
+METRIC_DEFINE_UINT_GAUGE(page_cache_ghost_hit_count, MetricUnit::OPERATIONS);
+METRIC_DEFINE_UINT_GAUGE(decoded_page_cache_lookup_count, MetricUnit::OPERATIONS);
+METRIC_DEFINE_UINT_GAUGE(decoded_page_cache_hit_count, MetricUnit::OPERATIONS);
+METRIC_DEFINE_UINT_GAUGE(decoded_page_cache_capacity, MetricUnit::BYTES);
 
 StoragePageCache* StoragePageCache::_s_instance = nullptr;
 
-void StoragePageCache::create_global_cache(MemTracker* mem_tracker, size_t capacity) {
+void StoragePageCache::create_global_cache(MemTracker* mem_tracker, size_t capacity, size_t decoded_capacity) {
     if (_s_instance == nullptr) {
-        _s_instance = new StoragePageCache(mem_tracker, capacity);
+        _s_instance = new StoragePageCache(mem_tracker, capacity, decoded_capacity);
     }
 }
 
@@ -66,9 +78,10 @@ void StoragePageCache::release_global_cache() {
 
 void StoragePageCache::prune() {
     _cache->prune();
+    _decoded_cache->prune();
 }
 
-static void init_metrics() {
+static void init_metrics(CacheEvictionPolicy eviction_policy, bool tinylfu_admission) {
     StarRocksMetrics::instance()->metrics()->register_metric("page_cache_lookup_count", &page_cache_lookup_count);
     StarRocksMetrics::instance()->metrics()->register_hook("page_cache_lookup_count", []() {
         page_cache_lookup_count.set_value(StoragePageCache::instance()->get_lookup_count());
@@ -83,11 +96,69 @@ static void init_metrics() {
     StarRocksMetrics::instance()->metrics()->register_hook("page_cache_capacity", []() {
         page_cache_capacity.set_value(StoragePageCache::instance()->get_capacity());
     });
+
+    // The hit ratio is labeled by the policies, so that the policies can be compared across the backends.
+    MetricLabels policy_labels;
+    policy_labels.add("policy", cache_eviction_policy_name(eviction_policy))
+            .add("admission", tinylfu_admission ? "tinylfu" : "none");
+    StarRocksMetrics::instance()->metrics()->register_metric("page_cache_hit_ratio", policy_labels,
+                                                             &page_cache_hit_ratio);
+    StarRocksMetrics::instance()->metrics()->register_hook("page_cache_hit_ratio", []() {
+        uint64_t lookup_count = StoragePageCache::instance()->get_lookup_count();
+        uint64_t hit_count = StoragePageCache::instance()->get_hit_count();
+        page_cache_hit_ratio.set_value(lookup_count == 0 ? 0 : static_cast<double>(hit_count) / lookup_count);
+    });
+
+    StarRocksMetrics::instance()->metrics()->register_metric("page_cache_admission_reject_count",
+                                                             &page_cache_admission_reject_count);
+    StarRocksMetrics::instance()->metrics()->register_hook("page_cache_admission_reject_count", []() {
+        page_cache_admission_reject_count.set_value(StoragePageCache::instance()->get_admission_reject_count());
+    });
+
+    StarRocksMetrics::instance()->metrics()->register_metric("page_cache_ghost_hit_count", &page_cache_ghost_hit_count);
+    StarRocksMetrics::instance()->metrics()->register_hook("page_cache_ghost_hit_count", []() {
+        page_cache_ghost_hit_count.set_value(StoragePageCache::instance()->get_ghost_hit_count());
+    });
+
+    StarRocksMetrics::instance()->metrics()->register_metric("decoded_page_cache_lookup_count",
+                                                             &decoded_page_cache_lookup_count);
+    StarRocksMetrics::instance()->metrics()->register_hook("decoded_page_cache_lookup_count", []() {
+        decoded_page_cache_lookup_count.set_value(StoragePageCache::instance()->get_decoded_lookup_count());
+    });
+
+    StarRocksMetrics::instance()->metrics()->register_metric("decoded_page_cache_hit_count",
+                                                             &decoded_page_cache_hit_count);
+    StarRocksMetrics::instance()->metrics()->register_hook("decoded_page_cache_hit_count", []() {
+        decoded_page_cache_hit_count.set_value(StoragePageCache::instance()->get_decoded_hit_count());
+    });
+
+    StarRocksMetrics::instance()->metrics()->register_metric("decoded_page_cache_capacity",
+                                                             &decoded_page_cache_capacity);
+    StarRocksMetrics::instance()->metrics()->register_hook("decoded_page_cache_capacity", []() {
+        decoded_page_cache_capacity.set_value(StoragePageCache::instance()->get_decoded_capacity());
+    });
 }
 
-StoragePageCache::StoragePageCache(MemTracker* mem_tracker, size_t capacity)
-        : _mem_tracker(mem_tracker), _cache(new_lru_cache(capacity, ChargeMode::MEMSIZE)) {
-    init_metrics();
+static CacheOptions page_cache_options(size_t capacity) {
+    CacheOptions options;
+    options.capacity = capacity;
+    options.charge_mode = ChargeMode::MEMSIZE;
+    if (!parse_cache_eviction_policy(config::storage_page_cache_eviction_policy, &options.eviction_policy)) {
+        LOG(WARNING) << "unknown storage_page_cache_eviction_policy: " << config::storage_page_cache_eviction_policy
+                     << ", use lru instead";
+    }
+    options.tinylfu_admission = config::enable_storage_page_cache_tinylfu_admission;
+    return options;
+}
+
+StoragePageCache::StoragePageCache(MemTracker* mem_tracker, size_t capacity, size_t decoded_capacity)
+        : _mem_tracker(mem_tracker), _decoded_capacity(decoded_capacity) {
+    CacheOptions options = page_cache_options(capacity);
+    _cache.reset(new_cache(options));
+    // The decoded pages are evicted by the same policy as the raw pages, but within their own capacity.
+    options.capacity = decoded_capacity;
+    _decoded_cache.reset(new_cache(options));
+    init_metrics(options.eviction_policy, options.tinylfu_admission);
 }
 
 StoragePageCache::~StoragePageCache() = default;
@@ -111,6 +182,14 @@ uint64_t StoragePageCache::get_hit_count() {
     return _cache->get_hit_count();
 }
 
+uint64_t StoragePageCache::get_admission_reject_count() {
+    return _cache->get_admission_reject_count();
+}
+
+uint64_t StoragePageCache::get_ghost_hit_count() {
+    return _cache->get_ghost_hit_count();
+}
+
 bool StoragePageCache::adjust_capacity(int64_t delta, size_t min_capacity) {
 #ifndef BE_TEST
     SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(_mem_tracker);
@@ -149,4 +228,71 @@ void StoragePageCache::insert(const CacheKey& key, const Slice& data, PageCacheH
     *handle = PageCacheHandle(_cache.get(), lru_handle);
 }
 
+void PageCacheSegment::init(std::string_view path, int64_t file_size) {
+    std::string buf(path);
+    buf.append(reinterpret_cast<const char*>(&file_size), sizeof(file_size));
+    murmur_hash3_x64_128(buf.data(), static_cast<int>(buf.size()), 0, _id);
+}
+
+void StoragePageCache::drop_segments(const std::vector<const PageCacheSegment*>& segments) {
+    if (segments.empty()) {
+        return;
+    }
+    phmap::flat_hash_set<std::string_view> ids;
+    for (const auto* segment : segments) {
+        ids.emplace(segment->id(), PageCacheSegment::kIdSize);
+    }
+    // The key of a segment page is the id followed by the offset, see CacheKey.
+    auto pred = [&ids](const starrocks::CacheKey& key) {
+        return key.size() == PageCacheSegment::kIdSize + sizeof(int64_t) &&
+               ids.contains(std::string_view(key.data(), PageCacheSegment::kIdSize));
+    };
+#ifndef BE_TEST
+    SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(_mem_tracker);
+#endif
+    _cache->erase_if(pred);
+    _decoded_cache->erase_if(pred);
+}
+
+bool StoragePageCache::lookup_decoded(const CacheKey& key, PageCacheHandle* handle) {
+    auto* lru_handle = _decoded_cache->lookup(key.encode());
+    if (lru_handle == nullptr) {
+        return false;
+    }
+    *handle = PageCacheHandle(_decoded_cache.get(), lru_handle);
+    return true;
+}
+
+void StoragePageCache::insert_decoded(PageCacheSegment* segment, int64_t offset, void* value, size_t charge,
+                                      void (*deleter)(const starrocks::CacheKey& key, void* value),
+                                      PageCacheHandle* handle) {
+#ifndef BE_TEST
+    tls_thread_status.mem_release(charge);
+    SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(_mem_tracker);
+    tls_thread_status.mem_consume(charge);
+#endif
+    auto* lru_handle = _decoded_cache->insert(CacheKey(*segment, offset).encode(), value, charge, deleter);
+    *handle = PageCacheHandle(_decoded_cache.get(), lru_handle);
+}
+
+void StoragePageCache::set_decoded_capacity(size_t capacity) {
+#ifndef BE_TEST
+    SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(_mem_tracker);
+#endif
+    _decoded_cache->set_capacity(capacity);
+    _decoded_capacity.store(capacity, std::memory_order_relaxed);
+}
+
+size_t StoragePageCache::get_decoded_capacity() {
+    return _decoded_cache->get_capacity();
+}
+
+uint64_t StoragePageCache::get_decoded_lookup_count() {
+    return _decoded_cache->get_lookup_count();
+}
+
+uint64_t StoragePageCache::get_decoded_hit_count() {
+    return _decoded_cache->get_hit_count();
+}
+
 } // namespace starrocks
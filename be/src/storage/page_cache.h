@@ -34,13 +34,17 @@
 
 #pragma once
 
+#include <cstring>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <utility>
+#include <vector>
 
 #include "gutil/macros.h" // for DISALLOW_COPY
 #include "runtime/current_thread.h"
 #include "runtime/exec_env.h"
+#include "util/coding.h"
 #include "util/defer_op.h"
 #include "util/lru_cache.h"
 
@@ -49,12 +53,35 @@ namespace starrocks {
 class PageCacheHandle;
 class MemTracker;
 
+// The pages of a segment in the page cache.
+//
+// The pages of a segment are keyed by a 128-bit id hashed from the path and the size of the segment file instead of
+// the path itself, which makes a small key built without allocation. The id only depends on the file, so the pages
+// are still found after the segment is reloaded, e.g. after it is evicted from the metadata cache, and the size tells
+// apart the versions of a file rewritten in place by partial update. All the pages with the id are dropped at once
+// when the segment file is removed, whichever Segment instance read them.
+class PageCacheSegment {
+public:
+    static constexpr size_t kIdSize = 16;
+
+    PageCacheSegment() = default;
+
+    // Must be called before any page of the segment is read or inserted.
+    void init(std::string_view path, int64_t file_size);
+
+    const char* id() const { return _id; }
+
+    DISALLOW_COPY_AND_MOVE(PageCacheSegment);
+
+private:
+    char _id[kIdSize] = {};
+};
+
 // Page cache min size is 256MB
 static constexpr int64_t kcacheMinSize = 268435456;
 
 // Warpper around Cache, and used for cache page of column datas
 // in Segment.
-// TODO(zc): We should add some metric to see cache hit/miss rate.
 class StoragePageCache {
 public:
     virtual ~StoragePageCache();
@@ -62,23 +89,34 @@ public:
     // Each cached page corresponds to a specific offset within
     // a file.
     //
-    // TODO(zc): Now we use file name(std::string) as a part of
-    // key, which is not efficient. We should make it better later
+    // The pages of a segment are keyed by the page cache id of the segment, which makes a 24 bytes key encoded
+    // without allocation. The pages read without a segment, e.g. by the tests, are keyed by the file name instead.
     struct CacheKey {
-        CacheKey(std::string fname_, int64_t offset_) : fname(std::move(fname_)), offset(offset_) {}
-        std::string fname;
-        int64_t offset;
-
-        // Encode to a flat binary which can be used as LRUCache's key
-        std::string encode() const {
-            std::string key_buf(fname);
-            key_buf.append((char*)&offset, sizeof(offset));
-            return key_buf;
+        CacheKey(const PageCacheSegment& segment, int64_t offset) {
+            memcpy(_buf, segment.id(), PageCacheSegment::kIdSize);
+            encode_fixed64_le(reinterpret_cast<uint8_t*>(_buf + PageCacheSegment::kIdSize), offset);
         }
+
+        CacheKey(std::string fname, int64_t offset) : _fname_key(std::move(fname)) {
+            _fname_key.append((char*)&offset, sizeof(offset));
+            // never be as long as the key of a segment page.
+            if (_fname_key.size() == sizeof(_buf)) {
+                _fname_key.push_back('\0');
+            }
+        }
+
+        // Encode to a flat binary which can be used as LRUCache's key, which refers to the buffer of this key.
+        starrocks::CacheKey encode() const {
+            return _fname_key.empty() ? starrocks::CacheKey(_buf, sizeof(_buf)) : starrocks::CacheKey(_fname_key);
+        }
+
+    private:
+        char _buf[PageCacheSegment::kIdSize + sizeof(int64_t)];
+        std::string _fname_key;
     };
 
     // Create global instance of this class
-    static void create_global_cache(MemTracker* mem_tracker, size_t capacity);
+    static void create_global_cache(MemTracker* mem_tracker, size_t capacity, size_t decoded_capacity = 0);
 
     static void release_global_cache();
 
@@ -86,7 +124,7 @@ public:
     // Client should call create_global_cache before.
     static StoragePageCache* instance() { return _s_instance; }
 
-    StoragePageCache(MemTracker* mem_tracker, size_t capacity);
+    StoragePageCache(MemTracker* mem_tracker, size_t capacity, size_t decoded_capacity = 0);
 
     // Lookup the given page in the cache.
     //
@@ -104,6 +142,31 @@ public:
     // The in_memory page will have higher priority.
     void insert(const CacheKey& key, const Slice& data, PageCacheHandle* handle, bool in_memory = false);
 
+    // Drop all the raw and decoded pages of |segments|, which can not be read any more, e.g. their rowset is removed,
+    // instead of leaving them to be evicted by the newer pages. It scans all the entries of the cache once, so the
+    // segments removed together should be dropped in one call.
+    void drop_segments(const std::vector<const PageCacheSegment*>& segments);
+
+    // The decoded page tier, which has its own capacity, caches the data pages decoded into columns, so that the
+    // pages read frequently are not decoded again on each read. It is disabled if the capacity is 0.
+    bool decoded_cache_enabled() const { return _decoded_capacity.load(std::memory_order_relaxed) > 0; }
+
+    // Lookup the given decoded page, whose value is written into |handle|.
+    bool lookup_decoded(const CacheKey& key, PageCacheHandle* handle);
+
+    // Insert a decoded page of |segment| with the memory usage |charge|, which is deleted by |deleter| when it's
+    // evicted and released.
+    void insert_decoded(PageCacheSegment* segment, int64_t offset, void* value, size_t charge,
+                        void (*deleter)(const starrocks::CacheKey& key, void* value), PageCacheHandle* handle);
+
+    void set_decoded_capacity(size_t capacity);
+
+    size_t get_decoded_capacity();
+
+    uint64_t get_decoded_lookup_count();
+
+    uint64_t get_decoded_hit_count();
+
     size_t memory_usage() const { return _cache->get_memory_usage(); }
 
     void set_capacity(size_t capacity);
@@ -114,6 +177,10 @@ public:
 
     uint64_t get_hit_count();
 
+    uint64_t get_admission_reject_count();
+
+    uint64_t get_ghost_hit_count();
+
     bool adjust_capacity(int64_t delta, size_t min_capacity = 0);
 
     void prune();
@@ -123,6 +190,8 @@ private:
 
     MemTracker* _mem_tracker = nullptr;
     std::unique_ptr<Cache> _cache = nullptr;
+    std::unique_ptr<Cache> _decoded_cache = nullptr;
+    std::atomic<size_t> _decoded_capacity{0};
 };
 
 // A handle for StoragePageCache entry. This class make it easy to handle
@@ -157,6 +226,8 @@ public:
 
     Cache* cache() const { return _cache; }
     Slice data() const { return _cache->value_slice(_handle); }
+    // The value of a decoded page.
+    void* value() const { return _cache->value(_handle); }
 
 private:
     Cache* _cache = nullptr;
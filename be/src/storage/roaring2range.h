@@ -14,6 +14,10 @@
 
 #pragma once
 
+#include <algorithm>
+#include <utility>
+#include <vector>
+
 #include "storage/range.h"
 #include "storage/rowset/bitmap_range_iterator.h"
 
@@ -39,4 +43,40 @@ static inline Roaring range2roaring(const SparseRange<>& range) {
     return roaring;
 }
 
+// Intersect all the |bitmaps| at once, in the ascending order of their cardinalities, so that the intermediate
+// result is as small as possible and the intersection stops as soon as it is empty. The |bitmaps| are consumed.
+static inline Roaring roaring_and_many(std::vector<Roaring>& bitmaps) {
+    if (bitmaps.empty()) {
+        return Roaring();
+    }
+    std::vector<std::pair<uint64_t, Roaring*>> sorted;
+    sorted.reserve(bitmaps.size());
+    for (auto& bitmap : bitmaps) {
+        sorted.emplace_back(bitmap.cardinality(), &bitmap);
+    }
+    std::sort(sorted.begin(), sorted.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+    Roaring result = std::move(*sorted[0].second);
+    for (size_t i = 1; i < sorted.size() && !result.isEmpty(); i++) {
+        result &= *sorted[i].second;
+    }
+    return result;
+}
+
+// Union all the |bitmaps| at once by Roaring::fastunion, which ORs the containers lazily and computes their
+// cardinalities only once at the end, instead of after each of the pairwise unions. The |bitmaps| are consumed.
+static inline Roaring roaring_or_many(std::vector<Roaring>& bitmaps) {
+    if (bitmaps.empty()) {
+        return Roaring();
+    }
+    if (bitmaps.size() == 1) {
+        return std::move(bitmaps[0]);
+    }
+    std::vector<const Roaring*> inputs;
+    inputs.reserve(bitmaps.size());
+    for (const auto& bitmap : bitmaps) {
+        inputs.emplace_back(&bitmap);
+    }
+    return Roaring::fastunion(inputs.size(), inputs.data());
+}
+
 } // namespace starrocks
@@ -0,0 +1,243 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <vector>
+
+#include "column/column.h"
+#include "gutil/strings/substitute.h"
+#include "storage/range.h"
+#include "storage/rowset/options.h"
+#include "storage/rowset/page_builder.h"
+#include "storage/rowset/page_decoder.h"
+#include "storage/type_traits.h"
+#include "util/alp_coding.h"
+#include "util/coding.h"
+#include "util/faststring.h"
+
+namespace starrocks {
+
+// Page layout:
+//   number of values (uint32) | mode (uint8) | values
+// In the ALP mode, the values are encoded by vectors of AlpCoding::kVectorSize values, see util/alp_coding.h.
+// In the plain mode, the values are stored as is, which is used if ALP doesn't make the page smaller.
+static const size_t ALP_PAGE_HEADER_SIZE = sizeof(uint32_t) + sizeof(uint8_t);
+
+enum AlpPageMode : uint8_t { ALP_PAGE_PLAIN = 0, ALP_PAGE_ALP = 1 };
+
+template <LogicalType Type>
+class AlpPageBuilder final : public PageBuilder {
+public:
+    explicit AlpPageBuilder(const PageBuilderOptions& options)
+            : _max_count(std::max<uint32_t>(1, options.data_page_size / SIZE_OF_TYPE)) {
+        reset();
+    }
+
+    ~AlpPageBuilder() override = default;
+
+    bool is_page_full() override { return _count >= _max_count; }
+
+    uint32_t add(const uint8_t* vals, uint32_t count) override {
+        DCHECK(!_finished);
+        uint32_t to_add = std::min(_max_count - _count, count);
+        _values.append(vals, to_add * SIZE_OF_TYPE);
+        _count += to_add;
+        return to_add;
+    }
+
+    faststring* finish() override {
+        DCHECK(!_finished);
+        _finished = true;
+        const auto* values = reinterpret_cast<const CppType*>(_values.data());
+        _buffer.clear();
+        _buffer.resize(ALP_PAGE_HEADER_SIZE);
+        encode_fixed32_le(_buffer.data(), _count);
+        _buffer[sizeof(uint32_t)] = ALP_PAGE_ALP;
+        _encoder.sample(values, _count);
+        for (uint32_t offset = 0; offset < _count; offset += AlpCoding<CppType>::kVectorSize) {
+            uint32_t vector_count = std::min<uint32_t>(AlpCoding<CppType>::kVectorSize, _count - offset);
+            _encoder.encode_vector(values + offset, vector_count, &_buffer);
+        }
+        if (_buffer.size() >= ALP_PAGE_HEADER_SIZE + _values.size()) {
+            _buffer.resize(ALP_PAGE_HEADER_SIZE);
+            _buffer[sizeof(uint32_t)] = ALP_PAGE_PLAIN;
+            _buffer.append(_values.data(), _values.size());
+        }
+        return &_buffer;
+    }
+
+    void reset() override {
+        _count = 0;
+        _finished = false;
+        _values.clear();
+        _values.reserve(_max_count * SIZE_OF_TYPE);
+    }
+
+    uint32_t count() const override { return _count; }
+
+    uint64_t size() const override { return _values.size(); }
+
+    Status get_first_value(void* value) const override {
+        if (_count == 0) {
+            return Status::NotFound("page is empty");
+        }
+        memcpy(value, _values.data(), SIZE_OF_TYPE);
+        return Status::OK();
+    }
+
+    Status get_last_value(void* value) const override {
+        if (_count == 0) {
+            return Status::NotFound("page is empty");
+        }
+        memcpy(value, &_values[(_count - 1) * SIZE_OF_TYPE], SIZE_OF_TYPE);
+        return Status::OK();
+    }
+
+private:
+    using CppType = typename TypeTraits<Type>::CppType;
+    static_assert(Type == TYPE_FLOAT || Type == TYPE_DOUBLE, "unexpected field type");
+    enum { SIZE_OF_TYPE = TypeTraits<Type>::size };
+
+    const uint32_t _max_count;
+    uint32_t _count = 0;
+    bool _finished = false;
+    faststring _values;
+    faststring _buffer;
+    AlpCoding<CppType> _encoder;
+};
+
+template <LogicalType Type>
+class AlpPageDecoder final : public PageDecoder {
+public:
+    explicit AlpPageDecoder(Slice data) : _data(data) {}
+
+    ~AlpPageDecoder() override = default;
+
+    Status init() override {
+        CHECK(!_parsed);
+        if (_data.size < ALP_PAGE_HEADER_SIZE) {
+            return Status::Corruption("not enough bytes for the header of alp page");
+        }
+        _num_elements = decode_fixed32_le(reinterpret_cast<const uint8_t*>(_data.data));
+        _mode = _data.data[sizeof(uint32_t)];
+        if (_mode == ALP_PAGE_PLAIN) {
+            if (_data.size != ALP_PAGE_HEADER_SIZE + _num_elements * SIZE_OF_TYPE) {
+                return Status::Corruption("unexpected data size of alp page");
+            }
+        } else if (_mode == ALP_PAGE_ALP) {
+            // Locate the vectors, so that each of them can be decoded on demand.
+            const auto* data = reinterpret_cast<const uint8_t*>(_data.data);
+            size_t offset = ALP_PAGE_HEADER_SIZE;
+            for (uint32_t i = 0; i < _num_elements; i += kVectorSize) {
+                size_t vector_count = std::min<size_t>(kVectorSize, _num_elements - i);
+                size_t size = AlpCoding<CppType>::vector_size(data + offset, _data.size - offset, vector_count);
+                if (size == 0) {
+                    return Status::Corruption("the vector of alp page is broken");
+                }
+                _vector_offsets.push_back(offset);
+                offset += size;
+            }
+            if (offset != _data.size) {
+                return Status::Corruption("unexpected data size of alp page");
+            }
+        } else {
+            return Status::Corruption(strings::Substitute("unknown mode of alp page: $0", _mode));
+        }
+        _parsed = true;
+        return Status::OK();
+    }
+
+    Status seek_to_position_in_page(uint32_t pos) override {
+        DCHECK(_parsed) << "Must call init() firstly";
+        DCHECK_LE(pos, _num_elements);
+        _cur_index = pos;
+        return Status::OK();
+    }
+
+    Status next_batch(size_t* n, Column* dst) override {
+        SparseRange<> read_range;
+        uint32_t begin = current_index();
+        read_range.add(Range<>(begin, begin + *n));
+        RETURN_IF_ERROR(next_batch(read_range, dst));
+        *n = current_index() - begin;
+        return Status::OK();
+    }
+
+    Status next_batch(const SparseRange<>& range, Column* dst) override {
+        DCHECK(_parsed) << "Must call init() firstly";
+        size_t to_read = range.span_size();
+        if (PREDICT_FALSE(to_read == 0 || _cur_index >= _num_elements)) {
+            return Status::OK();
+        }
+        SparseRangeIterator<> iter = range.new_iterator();
+        while (iter.has_more() && _cur_index < _num_elements) {
+            _cur_index = iter.begin();
+            Range<> r = iter.next(to_read);
+            uint32_t end = std::min<uint32_t>(r.end(), _num_elements);
+            while (_cur_index < end) {
+                const CppType* values;
+                uint32_t num_values;
+                if (_mode == ALP_PAGE_PLAIN) {
+                    values = reinterpret_cast<const CppType*>(_data.data + ALP_PAGE_HEADER_SIZE) + _cur_index;
+                    num_values = end - _cur_index;
+                } else {
+                    uint32_t vector_index = _cur_index / kVectorSize;
+                    RETURN_IF_ERROR(_decode_vector(vector_index));
+                    uint32_t vector_start = vector_index * kVectorSize;
+                    values = _decoded_values + (_cur_index - vector_start);
+                    num_values = std::min<uint32_t>(end, vector_start + kVectorSize) - _cur_index;
+                }
+                int n = dst->append_numbers(values, num_values * SIZE_OF_TYPE);
+                DCHECK_EQ(num_values, n);
+                _cur_index += num_values;
+            }
+        }
+        return Status::OK();
+    }
+
+    uint32_t count() const override { return _num_elements; }
+
+    uint32_t current_index() const override { return _cur_index; }
+
+    EncodingTypePB encoding_type() const override { return ALP_ENCODING; }
+
+private:
+    using CppType = typename TypeTraits<Type>::CppType;
+    static_assert(Type == TYPE_FLOAT || Type == TYPE_DOUBLE, "unexpected field type");
+    enum { SIZE_OF_TYPE = TypeTraits<Type>::size };
+    static constexpr uint32_t kVectorSize = AlpCoding<CppType>::kVectorSize;
+
+    Status _decode_vector(uint32_t vector_index) {
+        if (_decoded_vector_index == vector_index) {
+            return Status::OK();
+        }
+        size_t vector_count = std::min<size_t>(kVectorSize, _num_elements - vector_index * kVectorSize);
+        const auto* data = reinterpret_cast<const uint8_t*>(_data.data) + _vector_offsets[vector_index];
+        RETURN_IF_ERROR(AlpCoding<CppType>::decode_vector(data, vector_count, _decoded_values));
+        _decoded_vector_index = vector_index;
+        return Status::OK();
+    }
+
+    Slice _data;
+    bool _parsed = false;
+    uint8_t _mode = ALP_PAGE_PLAIN;
+    uint32_t _num_elements = 0;
+    uint32_t _cur_index = 0;
+    std::vector<size_t> _vector_offsets;
+    int64_t _decoded_vector_index = -1;
+    CppType _decoded_values[kVectorSize];
+};
+
+} // namespace starrocks
@@ -36,11 +36,13 @@
 
 #include <memory>
 
+#include "common/config.h"
 #include "common/logging.h"
 #include "gutil/casts.h"
 #include "gutil/strings/substitute.h" // for Substitute
 #include "storage/chunk_helper.h"
 #include "storage/range.h"
+#include "storage/rowset/binary_fsst_page.h"
 #include "storage/rowset/bitshuffle_page.h"
 #include "util/slice.h" // for Slice
 #include "util/unaligned_access.h"
@@ -102,7 +104,7 @@ uint32_t BinaryDictPageBuilder::add(const uint8_t* vals, uint32_t count) {
         }
         return count;
     } else {
-        DCHECK_EQ(_encoding_type, PLAIN_ENCODING);
+        DCHECK(_encoding_type == PLAIN_ENCODING || _encoding_type == FSST_ENCODING);
         return _data_page_builder->add(vals, count);
     }
 }
@@ -119,9 +121,14 @@ faststring* BinaryDictPageBuilder::finish() {
 void BinaryDictPageBuilder::reset() {
     _finished = false;
     if (_encoding_type == DICT_ENCODING && _dict_builder->is_page_full()) {
-        _data_page_builder = std::make_unique<BinaryPlainPageBuilder>(_options);
+        if (config::enable_fsst_string_encoding) {
+            _data_page_builder = std::make_unique<BinaryFsstPageBuilder>(_options);
+            _encoding_type = FSST_ENCODING;
+        } else {
+            _data_page_builder = std::make_unique<BinaryPlainPageBuilder>(_options);
+            _encoding_type = PLAIN_ENCODING;
+        }
         _data_page_builder->reserve_head(BINARY_DICT_PAGE_HEADER_SIZE);
-        _encoding_type = PLAIN_ENCODING;
     } else {
         _data_page_builder->reset();
     }
@@ -196,6 +203,8 @@ Status BinaryDictPageDecoder<Type>::init() {
     } else if (_encoding_type == PLAIN_ENCODING) {
         DCHECK_EQ(_encoding_type, PLAIN_ENCODING);
         _data_page_decoder.reset(new BinaryPlainPageDecoder<Type>(_data));
+    } else if (_encoding_type == FSST_ENCODING) {
+        _data_page_decoder.reset(new BinaryFsstPageDecoder<Type>(_data));
     } else {
         LOG(WARNING) << "invalid encoding type:" << _encoding_type;
         return Status::Corruption(strings::Substitute("invalid encoding type:$0", _encoding_type));
@@ -229,7 +238,7 @@ Status BinaryDictPageDecoder<Type>::next_batch(size_t* n, Column* dst) {
 
 template <LogicalType Type>
 Status BinaryDictPageDecoder<Type>::next_batch(const SparseRange<>& range, Column* dst) {
-    if (_encoding_type == PLAIN_ENCODING) {
+    if (_encoding_type == PLAIN_ENCODING || _encoding_type == FSST_ENCODING) {
         return _data_page_decoder->next_batch(range, dst);
     }
 
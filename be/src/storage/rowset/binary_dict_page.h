@@ -58,9 +58,10 @@ namespace starrocks {
 // Either header + embedded codeword page, which can be encoded with any
 //        int PageBuilder, when mode_ = DICT_ENCODING.
 // Or     header + embedded BinaryPlainPage, when mode_ = PLAIN_ENCOING.
+// Or     header + embedded BinaryFsstPage, when mode_ = FSST_ENCODING.
 // Data pages start with mode_ = DICT_ENCODING, when the the size of dictionary
 // page go beyond the option_->dict_page_size, the subsequent data pages will switch
-// to string plain page automatically.
+// to string plain page automatically, or FSST page if enable_fsst_string_encoding is on.
 class BinaryDictPageBuilder final : public PageBuilder {
 public:
     explicit BinaryDictPageBuilder(const PageBuilderOptions& options);
@@ -90,6 +91,8 @@ public:
     // write, i.e, after `finish` has been called.
     bool all_dict_encoded() const override { return _encoding_type == DICT_ENCODING; }
 
+    bool is_compressed() const override { return _encoding_type == FSST_ENCODING; }
+
 private:
     struct HashOfSlice {
         // Enable heterogeneous lookup.
@@ -0,0 +1,209 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/rowset/binary_fsst_page.h"
+
+#include <cstring>
+
+#include "column/column.h"
+#include "common/config.h"
+#include "gutil/strings/substitute.h"
+#include "util/coding.h"
+#include "util/raw_container.h"
+
+namespace starrocks {
+
+BinaryFsstPageBuilder::BinaryFsstPageBuilder(const PageBuilderOptions& options) : _options(options) {
+    reset();
+}
+
+uint32_t BinaryFsstPageBuilder::add(const uint8_t* vals, uint32_t count) {
+    DCHECK(!_finished);
+    const auto* slices = reinterpret_cast<const Slice*>(vals);
+    for (uint32_t i = 0; i < count; i++) {
+        if (is_page_full()) {
+            return i;
+        }
+        _offsets.push_back(_values.size());
+        _values.append(slices[i].data, slices[i].size);
+        _size_estimate += slices[i].size + sizeof(uint32_t);
+    }
+    return count;
+}
+
+faststring* BinaryFsstPageBuilder::finish() {
+    DCHECK(!_finished);
+    _finished = true;
+    size_t num_elems = _offsets.size();
+    std::vector<Slice> strings;
+    strings.reserve(num_elems);
+    for (size_t i = 0; i < num_elems; i++) {
+        strings.emplace_back(_value_at(i));
+    }
+
+    std::vector<uint32_t> code_offsets(num_elems + 1);
+    auto compress = [&]() {
+        _codes.clear();
+        for (size_t i = 0; i < num_elems; i++) {
+            code_offsets[i] = _codes.size();
+            _symbol_table.compress(strings[i], &_codes);
+        }
+        code_offsets[num_elems] = _codes.size();
+    };
+    _symbol_table.train(strings.data(), num_elems);
+    compress();
+    // Keep the strings as they are if they are not compressible, e.g. the random ids.
+    if (_symbol_table.num_symbols() > 0 && _codes.size() >= _values.size()) {
+        _symbol_table.clear();
+        compress();
+    }
+
+    _buffer.clear();
+    _buffer.resize(_reserved_head_size);
+    put_fixed32_le(&_buffer, num_elems);
+    _symbol_table.serialize(&_buffer);
+    for (uint32_t offset : code_offsets) {
+        put_fixed32_le(&_buffer, offset);
+    }
+    _buffer.append(_codes.data(), _codes.size());
+
+    if (num_elems > 0) {
+        Slice first = _value_at(0);
+        Slice last = _value_at(num_elems - 1);
+        _first_value.assign_copy(reinterpret_cast<const uint8_t*>(first.data), first.size);
+        _last_value.assign_copy(reinterpret_cast<const uint8_t*>(last.data), last.size);
+    }
+    return &_buffer;
+}
+
+void BinaryFsstPageBuilder::reset() {
+    _offsets.clear();
+    _values.clear();
+    _values.reserve(_options.data_page_size == 0 ? config::data_page_size : _options.data_page_size);
+    _size_estimate = sizeof(uint32_t);
+    _finished = false;
+}
+
+Status BinaryFsstPageBuilder::get_first_value(void* value) const {
+    DCHECK(_finished);
+    if (_offsets.empty()) {
+        return Status::NotFound("page is empty");
+    }
+    *reinterpret_cast<Slice*>(value) = Slice(_first_value);
+    return Status::OK();
+}
+
+Status BinaryFsstPageBuilder::get_last_value(void* value) const {
+    DCHECK(_finished);
+    if (_offsets.empty()) {
+        return Status::NotFound("page is empty");
+    }
+    *reinterpret_cast<Slice*>(value) = Slice(_last_value);
+    return Status::OK();
+}
+
+template <LogicalType Type>
+Status BinaryFsstPageDecoder<Type>::init() {
+    RETURN_IF(_parsed, Status::OK());
+    const auto* data = reinterpret_cast<const uint8_t*>(_data.data);
+    if (_data.size < sizeof(uint32_t)) {
+        return Status::Corruption(
+                strings::Substitute("not enough bytes for header of fsst page, size: $0", _data.size));
+    }
+    _num_elems = decode_fixed32_le(data);
+    size_t offset = sizeof(uint32_t);
+    size_t table_size = _symbol_table.deserialize(data + offset, _data.size - offset);
+    if (table_size == 0) {
+        return Status::Corruption("invalid symbol table of fsst page");
+    }
+    offset += table_size;
+    size_t offsets_size = (static_cast<size_t>(_num_elems) + 1) * sizeof(uint32_t);
+    if (offset + offsets_size > _data.size) {
+        return Status::Corruption(strings::Substitute(
+                "not enough bytes for offsets of fsst page, num_elems: $0, size: $1", _num_elems, _data.size));
+    }
+    raw::stl_vector_resize_uninitialized(&_offsets, _num_elems + 1);
+    for (uint32_t i = 0; i <= _num_elems; i++) {
+        _offsets[i] = decode_fixed32_le(data + offset + i * sizeof(uint32_t));
+        if (i > 0 && _offsets[i] < _offsets[i - 1]) {
+            return Status::Corruption("offsets of fsst page are not ascending");
+        }
+    }
+    offset += offsets_size;
+    if (_offsets[0] != 0 || offset + _offsets[_num_elems] != _data.size) {
+        return Status::Corruption(
+                strings::Substitute("unexpected size of codes of fsst page: $0", _data.size - offset));
+    }
+    _codes = _data.data + offset;
+    _parsed = true;
+    return Status::OK();
+}
+
+template <LogicalType Type>
+Status BinaryFsstPageDecoder<Type>::next_batch(size_t* count, Column* dst) {
+    SparseRange<> read_range;
+    uint32_t begin = current_index();
+    read_range.add(Range<>(begin, begin + *count));
+    RETURN_IF_ERROR(next_batch(read_range, dst));
+    *count = current_index() - begin;
+    return Status::OK();
+}
+
+template <LogicalType Type>
+Status BinaryFsstPageDecoder<Type>::next_batch(const SparseRange<>& range, Column* dst) {
+    DCHECK(_parsed);
+    if (PREDICT_FALSE(_cur_idx >= _num_elems)) {
+        return Status::OK();
+    }
+    size_t to_read = std::min<size_t>(range.span_size(), _num_elems - _cur_idx);
+    // Reserve the buffer for all the strings first, so that the slices are not invalidated by reallocation.
+    size_t buffer_size = 0;
+    SparseRangeIterator<> iter = range.new_iterator();
+    size_t remaining = to_read;
+    while (remaining > 0) {
+        Range<> r = iter.next(remaining);
+        buffer_size += _symbol_table.decompress_bound(_offsets[r.end()] - _offsets[r.begin()]);
+        remaining -= r.span_size();
+    }
+    raw::stl_vector_resize_uninitialized(&_buffer, buffer_size);
+
+    std::vector<Slice> strs;
+    strs.reserve(to_read);
+    uint8_t* out = _buffer.data();
+    iter = range.new_iterator();
+    while (to_read > 0) {
+        _cur_idx = iter.begin();
+        Range<> r = iter.next(to_read);
+        size_t end = _cur_idx + r.span_size();
+        for (; _cur_idx < end; _cur_idx++) {
+            size_t size = _symbol_table.decompress(codes_at(_cur_idx), out);
+            if constexpr (Type == TYPE_CHAR) {
+                // Strip trailing '\x00'
+                size = strnlen(reinterpret_cast<const char*>(out), size);
+            }
+            strs.emplace_back(out, size);
+            out += _symbol_table.decompress_bound(codes_at(_cur_idx).size);
+        }
+        to_read -= r.span_size();
+    }
+    if (!dst->append_strings(strs)) {
+        return Status::InvalidArgument("Column::append_strings() not supported");
+    }
+    return Status::OK();
+}
+
+template class BinaryFsstPageDecoder<TYPE_CHAR>;
+template class BinaryFsstPageDecoder<TYPE_VARCHAR>;
+
+} // namespace starrocks
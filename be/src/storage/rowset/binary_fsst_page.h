@@ -0,0 +1,142 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Page encoding for strings compressed by FSST, see util/fsst_coding.h.
+//
+// The page consists of:
+//   num_elems (32-bit fixed)
+//   Symbol table:
+//     the symbol table trained on the strings of this page
+//   Offsets:
+//     (num_elems + 1) offsets (32-bit fixed) pointing to the beginning of the codes of each string, relative to
+//     the beginning of the codes, and the last one is the size of the codes.
+//   Codes:
+//     the compressed strings
+//
+// Each string can be decompressed alone, so only the strings read are decompressed, and the equality and prefix
+// predicates are evaluated on the codes.
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storage/range.h"
+#include "storage/rowset/options.h"
+#include "storage/rowset/page_builder.h"
+#include "storage/rowset/page_decoder.h"
+#include "types/logical_type.h"
+#include "util/faststring.h"
+#include "util/fsst_coding.h"
+
+namespace starrocks {
+
+class Column;
+
+class BinaryFsstPageBuilder final : public PageBuilder {
+public:
+    explicit BinaryFsstPageBuilder(const PageBuilderOptions& options);
+
+    void reserve_head(uint8_t head_size) override {
+        CHECK_EQ(0, _reserved_head_size);
+        _reserved_head_size = head_size;
+    }
+
+    bool is_page_full() override {
+        // data_page_size is 0, do not limit the page size
+        return (_options.data_page_size != 0) & (_size_estimate > _options.data_page_size);
+    }
+
+    uint32_t add(const uint8_t* vals, uint32_t count) override;
+
+    faststring* finish() override;
+
+    void reset() override;
+
+    uint32_t count() const override { return _offsets.size(); }
+
+    // The size of the strings before compression, which limits the page by the same size as the plain pages.
+    uint64_t size() const override { return _size_estimate; }
+
+    Status get_first_value(void* value) const override;
+
+    Status get_last_value(void* value) const override;
+
+    // The strings are read from the codes in place, which would be lost by compressing the page body again.
+    bool is_compressed() const override { return true; }
+
+private:
+    Slice _value_at(size_t idx) const {
+        size_t end = idx + 1 < _offsets.size() ? _offsets[idx + 1] : _values.size();
+        return {_values.data() + _offsets[idx], end - _offsets[idx]};
+    }
+
+    PageBuilderOptions _options;
+    uint8_t _reserved_head_size{0};
+    size_t _size_estimate{0};
+    // the strings added, before compression
+    faststring _values;
+    std::vector<uint32_t> _offsets;
+    FsstSymbolTable _symbol_table;
+    faststring _codes;
+    faststring _buffer;
+    faststring _first_value;
+    faststring _last_value;
+    bool _finished{false};
+};
+
+template <LogicalType Type>
+class BinaryFsstPageDecoder final : public PageDecoder {
+public:
+    explicit BinaryFsstPageDecoder(Slice data) : _data(data) {}
+
+    Status init() override;
+
+    Status seek_to_position_in_page(uint32_t pos) override {
+        DCHECK_LE(pos, _num_elems);
+        _cur_idx = pos;
+        return Status::OK();
+    }
+
+    Status next_batch(size_t* count, Column* dst) override;
+
+    Status next_batch(const SparseRange<>& range, Column* dst) override;
+
+    uint32_t count() const override { return _num_elems; }
+
+    uint32_t current_index() const override { return _cur_idx; }
+
+    EncodingTypePB encoding_type() const override { return FSST_ENCODING; }
+
+    const FsstSymbolTable& symbol_table() const { return _symbol_table; }
+
+    // Return the compressed string at |idx|.
+    Slice codes_at(uint32_t idx) const {
+        DCHECK_LT(idx, _num_elems);
+        return {_codes + _offsets[idx], _offsets[idx + 1] - _offsets[idx]};
+    }
+
+private:
+    Slice _data;
+    bool _parsed{false};
+    uint32_t _num_elems{0};
+    FsstSymbolTable _symbol_table;
+    std::vector<uint32_t> _offsets;
+    const char* _codes{nullptr};
+    uint32_t _cur_idx{0};
+    // the buffer of the decompressed strings of a batch
+    std::vector<uint8_t> _buffer;
+};
+
+} // namespace starrocks
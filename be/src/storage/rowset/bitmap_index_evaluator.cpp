@@ -324,14 +324,14 @@ struct BitmapIndexSeeker {
 struct BitmapIndexRetriver {
     template <CompoundNodeType Type>
     StatusOr<std::optional<Roaring>> operator()(const PredicateCompoundNode<Type>& node) const {
-        std::optional<Roaring> result_roaring;
-
         auto it = parent->_ctx.compound_node_to_context.find(&node);
         if (it == parent->_ctx.compound_node_to_context.end() || !it->second.used) {
-            return result_roaring;
+            return std::optional<Roaring>{};
         }
         const auto& node_ctx = it->second;
 
+        // Collect the bitmaps of all the columns and the children, and combine them at once.
+        std::vector<Roaring> bitmaps;
         for (const auto& [cid, col_ctx] : node_ctx.col_contexts) {
             auto* bitmap_iter = parent->_bitmap_index_iterators[cid];
 
@@ -342,8 +342,7 @@ struct BitmapIndexRetriver {
                 RETURN_IF_ERROR(bitmap_iter->read_null_bitmap(&null_bitmap));
                 roaring -= null_bitmap;
             }
-
-            _merge_roaring<Type>(result_roaring, roaring);
+            bitmaps.emplace_back(std::move(roaring));
         }
 
         for (const auto& child : node.compound_children()) {
@@ -351,22 +350,16 @@ struct BitmapIndexRetriver {
             if (!roaring.has_value()) {
                 continue;
             }
-            _merge_roaring<Type>(result_roaring, roaring.value());
+            bitmaps.emplace_back(std::move(roaring.value()));
         }
 
-        return result_roaring;
-    }
-
-    template <CompoundNodeType Type>
-    void _merge_roaring(std::optional<Roaring>& result_roaring, Roaring& roaring) const {
-        if (!result_roaring.has_value()) {
-            result_roaring = std::move(roaring);
+        if (bitmaps.empty()) {
+            return std::optional<Roaring>{};
+        }
+        if constexpr (Type == CompoundNodeType::AND) {
+            return std::optional<Roaring>{roaring_and_many(bitmaps)};
         } else {
-            if constexpr (Type == CompoundNodeType::AND) {
-                result_roaring.value() &= roaring;
-            } else {
-                result_roaring.value() |= roaring;
-            }
+            return std::optional<Roaring>{roaring_or_many(bitmaps)};
         }
     }
 
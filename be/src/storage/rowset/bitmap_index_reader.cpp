@@ -42,6 +42,7 @@
 #include "column/column_viewer.h"
 #include "storage/chunk_helper.h"
 #include "storage/range.h"
+#include "storage/roaring2range.h"
 #include "storage/types.h"
 
 namespace starrocks {
@@ -122,20 +123,23 @@ Status BitmapIndexIterator::read_bitmap(rowid_t ordinal, Roaring* result) {
 
 Status BitmapIndexIterator::read_union_bitmap(rowid_t from, rowid_t to, Roaring* result) {
     DCHECK(0 <= from && from <= to && to <= _reader->bitmap_nums());
-
-    for (rowid_t pos = from; pos < to; pos++) {
-        Roaring bitmap;
-        RETURN_IF_ERROR(read_bitmap(pos, &bitmap));
-        *result |= bitmap;
-    }
-    return Status::OK();
+    return read_union_bitmap(SparseRange<>(from, to), result);
 }
 
 Status BitmapIndexIterator::read_union_bitmap(const SparseRange<>& range, Roaring* result) {
+    // Read the bitmaps of all the dictionary values first, and union them at once.
+    std::vector<Roaring> bitmaps;
+    bitmaps.reserve(range.span_size() + 1);
     for (size_t i = 0; i < range.size(); i++) { // NOLINT
         const Range<>& r = range[i];
-        RETURN_IF_ERROR(read_union_bitmap(r.begin(), r.end(), result));
+        for (rowid_t pos = r.begin(); pos < r.end(); pos++) {
+            RETURN_IF_ERROR(read_bitmap(pos, &bitmaps.emplace_back()));
+        }
+    }
+    if (!result->isEmpty()) {
+        bitmaps.emplace_back(std::move(*result));
     }
+    *result = roaring_or_many(bitmaps);
     return Status::OK();
 }
 
@@ -34,8 +34,13 @@
 
 #include "storage/rowset/column_iterator.h"
 
+#include <algorithm>
+#include <optional>
+
 #include "column/fixed_length_column.h"
 #include "column/nullable_column.h"
+#include "storage/column_predicate.h"
+#include "storage/rowset/column_reader.h"
 
 namespace starrocks {
 
@@ -88,4 +93,66 @@ Status ColumnIterator::fetch_values_by_rowid(const rowid_t* rowids, size_t size,
     return Status::OK();
 }
 
+// Return the reader of the subfield of |reader| which |pred| can be evaluated on by the page zone map,
+// or nullptr if there is no such subfield.
+static ColumnReader* subfield_zone_map_reader(const ColumnReader* reader, const ColumnPredicate* pred) {
+    if (!pred->is_subfield_predicate()) {
+        return nullptr;
+    }
+    const auto& path = pred->subfield_path();
+    // the keys of MAP are not aligned with the rows, see MapColumnIterator
+    if (std::find(path.begin(), path.end(), kMapKeysSubfield) != path.end()) {
+        return nullptr;
+    }
+    ColumnReader* leaf = reader->subfield_reader(path);
+    if (leaf == nullptr || !leaf->has_zone_map() || leaf->column_type() != pred->type_info()->type()) {
+        return nullptr;
+    }
+    return leaf;
+}
+
+Status ColumnIterator::_get_row_ranges_by_subfield_zone_map(ColumnReader* reader, const ColumnIteratorOptions& opts,
+                                                            const std::vector<const ColumnPredicate*>& predicates,
+                                                            SparseRange<>* row_ranges,
+                                                            CompoundNodeType pred_relation) {
+    std::vector<std::pair<ColumnReader*, std::vector<const ColumnPredicate*>>> leaf_preds;
+    bool has_unresolved = false;
+    for (const ColumnPredicate* pred : predicates) {
+        ColumnReader* leaf = subfield_zone_map_reader(reader, pred);
+        if (leaf == nullptr) {
+            has_unresolved = true;
+            continue;
+        }
+        auto iter = std::find_if(leaf_preds.begin(), leaf_preds.end(),
+                                 [leaf](const auto& entry) { return entry.first == leaf; });
+        if (iter == leaf_preds.end()) {
+            leaf_preds.emplace_back(leaf, std::vector<const ColumnPredicate*>{pred});
+        } else {
+            iter->second.emplace_back(pred);
+        }
+    }
+    if (leaf_preds.empty() || (has_unresolved && pred_relation == CompoundNodeType::OR)) {
+        row_ranges->add({0, static_cast<rowid_t>(reader->num_rows())});
+        return Status::OK();
+    }
+
+    // The subfields are aligned with the rows of the nested column, so the row ranges of them are merged directly.
+    std::optional<SparseRange<>> hit_ranges;
+    for (const auto& [leaf, preds] : leaf_preds) {
+        ASSIGN_OR_RETURN(auto leaf_iter, leaf->new_iterator());
+        RETURN_IF_ERROR(leaf_iter->init(opts));
+        SparseRange<> leaf_ranges;
+        RETURN_IF_ERROR(leaf_iter->get_row_ranges_by_zone_map(preds, nullptr, &leaf_ranges, pred_relation));
+        if (!hit_ranges.has_value()) {
+            hit_ranges = std::move(leaf_ranges);
+        } else if (pred_relation == CompoundNodeType::AND) {
+            hit_ranges.value() &= leaf_ranges;
+        } else {
+            hit_ranges.value() |= leaf_ranges;
+        }
+    }
+    *row_ranges = std::move(hit_ranges.value());
+    return Status::OK();
+}
+
 } // namespace starrocks
@@ -179,6 +179,22 @@ public:
         return Status::OK();
     }
 
+    /// Only keep the rows in |row_ranges| which satisfy all the predicates in |predicates| supporting FSST filter,
+    /// which are evaluated on the compressed strings of the FSST encoded pages without decompression.
+    /// The rows of the other pages are kept.
+    virtual Status get_row_ranges_by_fsst_filter(const std::vector<const ColumnPredicate*>& predicates,
+                                                 SparseRange<>* row_ranges) {
+        return Status::OK();
+    }
+
+    /// Only keep the rows in |row_ranges| of the miniblocks which may satisfy all the predicates in |predicates|,
+    /// which is decided by the anchors of the DELTA_BINARY_PACKED pages in non-decreasing order without decoding.
+    /// Only the first and the last pages of each range are checked, and the rows of the other pages are kept.
+    virtual Status get_row_ranges_by_delta_anchors(const std::vector<const ColumnPredicate*>& predicates,
+                                                   SparseRange<>* row_ranges) {
+        return Status::OK();
+    }
+
     // return true iff all data pages of this column are encoded as dictionary encoding.
     // NOTE: the ColumnIterator must have been initialized with `check_dict_encoding`,
     // otherwise this method will always return false.
@@ -255,6 +271,12 @@ public:
     virtual Status fetch_subfield_by_rowid(const rowid_t* rowids, size_t size, Column* values) { return Status::OK(); }
 
 protected:
+    // Prune the rows of the nested column of |reader| by the page zone maps of its subfields, with the
+    // predicates on the subfields in |predicates|. The other predicates keep all the rows.
+    static Status _get_row_ranges_by_subfield_zone_map(ColumnReader* reader, const ColumnIteratorOptions& opts,
+                                                       const std::vector<const ColumnPredicate*>& predicates,
+                                                       SparseRange<>* row_ranges, CompoundNodeType pred_relation);
+
     ColumnIteratorOptions _opts;
     virtual ColumnReader* get_column_reader() { return nullptr; };
 };
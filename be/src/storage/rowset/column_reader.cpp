@@ -89,6 +89,10 @@ ColumnReader::~ColumnReader() {
                                  _segment_zone_map->SpaceUsedLong());
         _segment_zone_map.reset(nullptr);
     }
+    if (_ndv_sketch != nullptr) {
+        MEM_TRACKER_SAFE_RELEASE(GlobalEnv::GetInstance()->column_metadata_mem_tracker(), _ndv_sketch->capacity());
+        _ndv_sketch.reset(nullptr);
+    }
     if (_ordinal_index_meta != nullptr) {
         MEM_TRACKER_SAFE_RELEASE(GlobalEnv::GetInstance()->ordinal_index_mem_tracker(),
                                  _ordinal_index_meta->SpaceUsedLong());
@@ -187,6 +191,11 @@ Status ColumnReader::_init(ColumnMetaPB* meta, const TabletColumn* column) {
                 return Status::Corruption(fmt::format("Bad file {}: unknown index type", file_name()));
             }
         }
+        if (meta->has_ndv_sketch()) {
+            _ndv_sketch.reset(meta->release_ndv_sketch());
+            MEM_TRACKER_SAFE_CONSUME(GlobalEnv::GetInstance()->column_metadata_mem_tracker(), _ndv_sketch->capacity());
+            _meta_mem_usage.fetch_add(_ndv_sketch->capacity(), std::memory_order_relaxed);
+        }
         if (_ordinal_index == nullptr) {
             return Status::Corruption(
                     fmt::format("Bad file {}: missing ordinal index for column {}", file_name(), meta->column_id()));
@@ -339,6 +348,7 @@ Status ColumnReader::read_page(const ColumnIteratorOptions& iter_opts, const Pag
     opts.use_page_cache = iter_opts.use_page_cache;
     opts.encoding_type = _encoding_info->encoding();
     opts.kept_in_memory = false;
+    opts.page_cache_segment = _segment->page_cache_segment();
 
     return PageIO::read_and_decompress_page(opts, handle, page_body, footer);
 }
@@ -630,6 +640,45 @@ void ColumnReader::_update_sub_reader_pos(const TabletColumn* column, int pos) {
     _sub_reader_pos[{std::string(name), id}] = pos;
 }
 
+ColumnReader* ColumnReader::subfield_reader(const std::vector<std::string>& path) const {
+    if (path.empty()) {
+        return nullptr;
+    }
+    ColumnReader* reader = _subfield_reader(path[0]);
+    for (size_t i = 1; i < path.size() && reader != nullptr; i++) {
+        reader = reader->_subfield_reader(path[i]);
+    }
+    return reader;
+}
+
+ColumnReader* ColumnReader::_subfield_reader(const std::string& name) const {
+    if (_sub_readers == nullptr || _sub_readers->empty()) {
+        return nullptr;
+    }
+    size_t begin = 0;
+    size_t end = _sub_readers->size();
+    switch (_column_type) {
+    case TYPE_STRUCT:
+        // the null flags of struct are the last sub reader
+        end -= is_nullable() ? 1 : 0;
+        break;
+    case TYPE_JSON:
+        // the null flags of flat json are the first sub reader
+        begin += is_nullable() ? 1 : 0;
+        break;
+    case TYPE_MAP:
+        return name == kMapKeysSubfield ? (*_sub_readers)[0].get() : nullptr;
+    default:
+        return nullptr;
+    }
+    for (size_t i = begin; i < end; i++) {
+        if ((*_sub_readers)[i]->name() == name) {
+            return (*_sub_readers)[i].get();
+        }
+    }
+    return nullptr;
+}
+
 StatusOr<std::unique_ptr<ColumnIterator>> ColumnReader::_create_merge_struct_iter(ColumnAccessPath* path,
                                                                                   const TabletColumn* column) {
     DCHECK(_column_type == LogicalType::TYPE_STRUCT);
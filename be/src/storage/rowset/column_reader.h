@@ -144,6 +144,9 @@ public:
 
     ZoneMapPB* segment_zone_map() const { return _segment_zone_map.get(); }
 
+    // The serialized HyperLogLog of the not null values in the segment, nullptr if not written.
+    const std::string* ndv_sketch() const { return _ndv_sketch.get(); }
+
     PagePointer get_dict_page_pointer() const { return _dict_page_pointer; }
     LogicalType column_type() const { return _column_type; }
     bool has_all_dict_encoded() const { return _flags & kHasAllDictEncodedMask; }
@@ -186,6 +189,8 @@ public:
 
     uint32_t num_rows() const { return _segment->num_rows(); }
 
+    PageCacheSegment* page_cache_segment() const { return _segment->page_cache_segment(); }
+
     void print_debug_info() { _ordinal_index->print_debug_info(); }
 
     size_t mem_usage() const;
@@ -194,6 +199,11 @@ public:
 
     const std::vector<std::unique_ptr<ColumnReader>>* sub_readers() const { return _sub_readers.get(); }
 
+    // Return the reader of the nested subfield at |path|, e.g. {"a", "b"} for the field b of the struct field a,
+    // the flattened sub-column name for JSON, and kMapKeysSubfield for the keys of MAP.
+    // Return nullptr if there is no such subfield.
+    ColumnReader* subfield_reader(const std::vector<std::string>& path) const;
+
 private:
     const std::string& file_name() const { return _segment->file_name(); }
     template <bool is_original_bf>
@@ -232,6 +242,8 @@ private:
 
     void _update_sub_reader_pos(const TabletColumn* column, int pos);
 
+    ColumnReader* _subfield_reader(const std::string& name) const;
+
     // ColumnReader will be resident in memory. When there are many columns in the table,
     // the meta in ColumnReader takes up a lot of memory,
     // and now the content that is not needed in Meta is not saved to ColumnReader
@@ -257,6 +269,7 @@ private:
     std::unique_ptr<InvertedReader> _inverted_index;
 
     std::unique_ptr<ZoneMapPB> _segment_zone_map;
+    std::unique_ptr<std::string> _ndv_sketch;
 
     using SubReaderList = std::vector<std::unique_ptr<ColumnReader>>;
     std::unique_ptr<SubReaderList> _sub_readers;
@@ -47,6 +47,7 @@
 #include "simd/simd.h"
 #include "storage/index/inverted/inverted_index_option.h"
 #include "storage/index/inverted/inverted_plugin_factory.h"
+#include "storage/rowset/alp_page.h"
 #include "storage/rowset/array_column_writer.h"
 #include "storage/rowset/bitmap_index_writer.h"
 #include "storage/rowset/bitshuffle_page.h"
@@ -55,6 +56,7 @@
 #include "storage/rowset/encoding_info.h"
 #include "storage/rowset/json_column_writer.h"
 #include "storage/rowset/map_column_writer.h"
+#include "storage/rowset/ndv_sketch_writer.h"
 #include "storage/rowset/options.h"
 #include "storage/rowset/ordinal_page_index.h"
 #include "storage/rowset/page_builder.h"
@@ -260,23 +262,21 @@ private:
     ColumnPtr _buf_column = nullptr;
 };
 
-class DictColumnWriter final : public ColumnWriter {
+// Buffer the first rows of a column until there are enough of them to speculate its encoding, then set the
+// encoding of the scalar column writer and write all the rows through it.
+class SpeculateColumnWriter : public ColumnWriter {
 public:
-    DictColumnWriter(const ColumnWriterOptions& opts, TypeInfoPtr type_info,
-                     std::unique_ptr<ScalarColumnWriter> column_writer);
+    SpeculateColumnWriter(const ColumnWriterOptions& opts, TypeInfoPtr type_info,
+                          std::unique_ptr<ScalarColumnWriter> column_writer);
 
-    ~DictColumnWriter() override = default;
+    ~SpeculateColumnWriter() override = default;
 
     Status init() override { return _scalar_column_writer->init(); };
 
     Status append(const Column& column) override;
 
     // Speculate encoding and reset encoding
-    Status speculate_column_and_set_encoding(const Column& column);
-
-    // Speculate encoding
-    template <LogicalType Type>
-    inline EncodingTypePB speculate_encoding(const Column& column);
+    virtual Status speculate_column_and_set_encoding(const Column& column) = 0;
 
     Status finish_current_page() override { return _scalar_column_writer->finish_current_page(); };
 
@@ -297,12 +297,44 @@ public:
 
     uint64_t total_mem_footprint() const override { return _scalar_column_writer->total_mem_footprint(); }
 
-private:
+protected:
+    // Set the encoding if the column is finished without any row to speculate it by.
+    virtual Status set_encoding_without_rows() { return Status::OK(); }
+
     std::unique_ptr<ScalarColumnWriter> _scalar_column_writer;
+
+private:
     bool _is_speculated = false;
     ColumnPtr _buf_column = nullptr;
 };
 
+class DictColumnWriter final : public SpeculateColumnWriter {
+public:
+    using SpeculateColumnWriter::SpeculateColumnWriter;
+
+    ~DictColumnWriter() override = default;
+
+    Status speculate_column_and_set_encoding(const Column& column) override;
+
+    // Speculate encoding
+    template <LogicalType Type>
+    inline EncodingTypePB speculate_encoding(const Column& column);
+};
+
+// Speculate the encoding of FLOAT/DOUBLE columns by the first chunk, which is ALP if it makes the sampled values
+// small enough, and bitshuffle otherwise.
+class FloatColumnWriter final : public SpeculateColumnWriter {
+public:
+    using SpeculateColumnWriter::SpeculateColumnWriter;
+
+    ~FloatColumnWriter() override = default;
+
+    Status speculate_column_and_set_encoding(const Column& column) override;
+
+protected:
+    Status set_encoding_without_rows() override { return _scalar_column_writer->set_encoding(BIT_SHUFFLE); }
+};
+
 StatusOr<std::unique_ptr<ColumnWriter>> ColumnWriter::create(const ColumnWriterOptions& opts,
                                                              const TabletColumn* column, WritableFile* wfile) {
     TypeInfoPtr type_info = get_type_info(*column);
@@ -314,13 +346,20 @@ StatusOr<std::unique_ptr<ColumnWriter>> ColumnWriter::create(const ColumnWriterO
         auto column_writer = std::make_unique<ScalarColumnWriter>(str_opts, type_info, wfile);
         return std::make_unique<StringColumnWriter>(str_opts, std::move(type_info), std::move(column_writer));
     } else if (enable_non_string_column_dict_encoding() &&
-               numeric_types_support_dict_encoding(delegate_type(column->type()))) {
+               numeric_types_support_dict_encoding(delegate_type(column->type())) &&
+               opts.meta->encoding() != DELTA_BINARY_PACKED) {
         DCHECK(column->type() != TYPE_VARCHAR);
         DCHECK(column->type() != TYPE_CHAR);
         ColumnWriterOptions dict_opts = opts;
         dict_opts.need_speculate_encoding = true;
         auto column_writer = std::make_unique<ScalarColumnWriter>(dict_opts, type_info, wfile);
         return std::make_unique<DictColumnWriter>(dict_opts, std::move(type_info), std::move(column_writer));
+    } else if (enable_alp_float_encoding() &&
+               (column->type() == LogicalType::TYPE_FLOAT || column->type() == LogicalType::TYPE_DOUBLE)) {
+        ColumnWriterOptions float_opts = opts;
+        float_opts.need_speculate_encoding = true;
+        auto column_writer = std::make_unique<ScalarColumnWriter>(float_opts, type_info, wfile);
+        return std::make_unique<FloatColumnWriter>(float_opts, std::move(type_info), std::move(column_writer));
     } else if (column->type() == LogicalType::TYPE_JSON) {
         auto column_writer = std::make_unique<ScalarColumnWriter>(opts, type_info, wfile);
         return create_json_column_writer(opts, std::move(type_info), wfile, std::move(column_writer));
@@ -439,6 +478,10 @@ Status ScalarColumnWriter::init() {
             RETURN_IF_ERROR(_inverted_index_builder->init());
         }
     }
+    if (_opts.need_ndv_sketch) {
+        _ndv_sketch_builder = NdvSketchWriter::create(type_info());
+        _has_index_builder |= _ndv_sketch_builder != nullptr;
+    }
     return Status::OK();
 }
 
@@ -465,6 +508,9 @@ uint64_t ScalarColumnWriter::estimate_buffer_size() {
     if (_inverted_index_builder != nullptr) {
         size += _inverted_index_builder->size();
     }
+    if (_ndv_sketch_builder != nullptr) {
+        size += _ndv_sketch_builder->size();
+    }
     return size;
 }
 
@@ -477,6 +523,9 @@ Status ScalarColumnWriter::finish() {
     RETURN_IF_ERROR(finish_current_page());
     _opts.meta->set_num_rows(_next_rowid);
     _opts.meta->set_total_mem_footprint(_total_mem_footprint);
+    if (_ndv_sketch_builder != nullptr) {
+        _ndv_sketch_builder->finish(_opts.meta);
+    }
     return Status::OK();
 }
 
@@ -632,10 +681,12 @@ Status ScalarColumnWriter::finish_current_page() {
         // for page format v2 or above, use the encoding type of config::null_encoding
         data_page_footer->set_null_encoding(_null_map_builder_v2->null_encoding());
     }
-    // trying to compress page body
+    // trying to compress page body, unless it is compressed by the encoding already
     faststring compressed_body;
-    RETURN_IF_ERROR(
-            PageIO::compress_page_body(_compress_codec, _opts.compression_min_space_saving, body, &compressed_body));
+    if (!_page_builder->is_compressed()) {
+        RETURN_IF_ERROR(PageIO::compress_page_body(_compress_codec, _opts.compression_min_space_saving, body,
+                                                   &compressed_body));
+    }
     if (compressed_body.size() == 0) {
         // page body is uncompressed
         double space_saving =
@@ -781,11 +832,13 @@ Status ScalarColumnWriter::append(const uint8_t* data, const uint8_t* null_flags
                     INDEX_ADD_NULLS(_bitmap_index_builder, run);
                     INDEX_ADD_NULLS(_bloom_filter_index_builder, run);
                     INDEX_ADD_NULLS(_inverted_index_builder, run);
+                    INDEX_ADD_NULLS(_ndv_sketch_builder, run);
                 } else {
                     INDEX_ADD_VALUES(_zone_map_index_builder, pdata, run);
                     INDEX_ADD_VALUES(_bitmap_index_builder, pdata, run);
                     INDEX_ADD_VALUES(_bloom_filter_index_builder, pdata, run);
                     INDEX_ADD_VALUES(_inverted_index_builder, pdata, run);
+                    INDEX_ADD_VALUES(_ndv_sketch_builder, pdata, run);
                 }
                 pdata += type_info()->size() * run;
             }
@@ -794,6 +847,7 @@ Status ScalarColumnWriter::append(const uint8_t* data, const uint8_t* null_flags
             INDEX_ADD_VALUES(_bitmap_index_builder, data, num_written);
             INDEX_ADD_VALUES(_bloom_filter_index_builder, data, num_written);
             INDEX_ADD_VALUES(_inverted_index_builder, data, num_written);
+            INDEX_ADD_VALUES(_ndv_sketch_builder, data, num_written);
         }
 
         _next_rowid += num_written;
@@ -876,7 +930,7 @@ inline EncodingTypePB StringColumnWriter::speculate_string_encoding(const Binary
             size_t hash = SliceHash()(bin_col.get_slice(i));
             hash_set.insert(hash);
             if (hash_set.size() > max_card) {
-                return PLAIN_ENCODING;
+                return config::enable_fsst_string_encoding ? FSST_ENCODING : PLAIN_ENCODING;
             }
         }
     }
@@ -932,12 +986,40 @@ Status StringColumnWriter::check_string_lengths(const Column& column) {
     return Status::OK();
 }
 
-DictColumnWriter::DictColumnWriter(const ColumnWriterOptions& opts, TypeInfoPtr type_info,
-                                   std::unique_ptr<ScalarColumnWriter> column_writer)
+// The estimated size of the values encoded by ALP is compared with their plain size, as ALP degenerates into
+// storing the values as is for the values of a high precision, e.g. the results of divisions.
+template <LogicalType Type>
+static EncodingTypePB speculate_float_encoding(const Column& column) {
+    using ColumnType = typename RunTimeTypeTraits<Type>::ColumnType;
+    using CppType = typename RunTimeTypeTraits<Type>::CppType;
+    const ColumnType* float_col;
+    if (column.is_nullable()) {
+        const auto& data_col = down_cast<const NullableColumn&>(column).data_column();
+        float_col = &down_cast<ColumnType&>(*data_col);
+    } else {
+        float_col = &down_cast<const ColumnType&>(column);
+    }
+    if (!enable_alp_float_encoding() || float_col->empty()) {
+        return BIT_SHUFFLE;
+    }
+
+    const auto& values = float_col->get_data();
+    AlpCoding<CppType> coding;
+    coding.sample(values.data(), values.size());
+    size_t alp_bits = coding.estimate_bits(values.data(), values.size());
+    size_t plain_bits = values.size() * sizeof(CppType) * 8;
+    if (alp_bits <= plain_bits * config::alp_encoding_ratio_for_float_column) {
+        return ALP_ENCODING;
+    }
+    return BIT_SHUFFLE;
+}
+
+SpeculateColumnWriter::SpeculateColumnWriter(const ColumnWriterOptions& opts, TypeInfoPtr type_info,
+                                             std::unique_ptr<ScalarColumnWriter> column_writer)
         : ColumnWriter(std::move(type_info), opts.meta->length(), opts.meta->is_nullable()),
           _scalar_column_writer(std::move(column_writer)) {}
 
-Status DictColumnWriter::append(const Column& column) {
+Status SpeculateColumnWriter::append(const Column& column) {
     if (_is_speculated) {
         return _scalar_column_writer->append(column);
     }
@@ -970,7 +1052,27 @@ Status DictColumnWriter::append(const Column& column) {
     return Status::OK();
 }
 
-inline Status DictColumnWriter::speculate_column_and_set_encoding(const Column& column) {
+Status SpeculateColumnWriter::finish() {
+    if (_is_speculated) {
+        return _scalar_column_writer->finish();
+    }
+
+    _is_speculated = true;
+    if (_buf_column != nullptr) {
+        RETURN_IF_ERROR(speculate_column_and_set_encoding(*_buf_column));
+        Status st = _scalar_column_writer->append(*_buf_column);
+        _buf_column.reset();
+        if (!st.ok()) {
+            return st;
+        }
+    } else {
+        RETURN_IF_ERROR(set_encoding_without_rows());
+    }
+
+    return _scalar_column_writer->finish();
+}
+
+Status DictColumnWriter::speculate_column_and_set_encoding(const Column& column) {
     Status st;
     EncodingTypePB detect_encoding;
     LogicalType logicalType = delegate_type(type_info()->type());
@@ -1035,6 +1137,9 @@ inline EncodingTypePB DictColumnWriter::speculate_encoding(const Column& column)
             CppType value = numerical_col->get_data()[i];
             hash_set.insert(value);
             if (hash_set.size() > max_card) {
+                if constexpr (Type == TYPE_FLOAT || Type == TYPE_DOUBLE) {
+                    return speculate_float_encoding<Type>(column);
+                }
                 return BIT_SHUFFLE;
             }
         }
@@ -1043,22 +1148,19 @@ inline EncodingTypePB DictColumnWriter::speculate_encoding(const Column& column)
     return DICT_ENCODING;
 }
 
-Status DictColumnWriter::finish() {
-    if (_is_speculated) {
-        return _scalar_column_writer->finish();
-    }
-
-    _is_speculated = true;
-    if (_buf_column != nullptr) {
-        RETURN_IF_ERROR(speculate_column_and_set_encoding(*_buf_column));
-        Status st = _scalar_column_writer->append(*_buf_column);
-        _buf_column.reset();
-        if (!st.ok()) {
-            return st;
-        }
+Status FloatColumnWriter::speculate_column_and_set_encoding(const Column& column) {
+    EncodingTypePB detect_encoding;
+    switch (type_info()->type()) {
+    case TYPE_FLOAT:
+        detect_encoding = speculate_float_encoding<TYPE_FLOAT>(column);
+        break;
+    case TYPE_DOUBLE:
+        detect_encoding = speculate_float_encoding<TYPE_DOUBLE>(column);
+        break;
+    default:
+        return Status::InternalError(strings::Substitute("$0 type should not use alp encoding", type_info()->type()));
     }
-
-    return _scalar_column_writer->finish();
+    return _scalar_column_writer->set_encoding(detect_encoding);
 }
 
 } // namespace starrocks
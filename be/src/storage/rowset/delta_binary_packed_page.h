@@ -0,0 +1,304 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include "column/column.h"
+#include "gutil/strings/substitute.h"
+#include "storage/range.h"
+#include "storage/rowset/options.h"
+#include "storage/rowset/page_builder.h"
+#include "storage/rowset/page_decoder.h"
+#include "storage/type_traits.h"
+#include "util/coding.h"
+#include "util/delta_binary_packed_coding.h"
+#include "util/faststring.h"
+
+namespace starrocks {
+
+// Page layout:
+//   number of values (uint32) | flags (uint8) | last value (int64) | miniblock headers | packed deltas
+// The values are encoded by miniblocks, see util/delta_binary_packed_coding.h. The headers of all the miniblocks
+// come first, so that the anchors are binary searched, and any position is seeked to by decoding one miniblock.
+//
+// If the flag DELTA_PAGE_NON_DECREASING is set, the values of the page are in non-decreasing order, so all the
+// values of a miniblock are between its anchor and the anchor of the next miniblock, or the last value of the page.
+static const size_t DELTA_PAGE_HEADER_SIZE = sizeof(uint32_t) + sizeof(uint8_t) + sizeof(int64_t);
+
+enum DeltaPageFlags : uint8_t { DELTA_PAGE_NON_DECREASING = 1 };
+
+template <LogicalType Type>
+class DeltaBinaryPackedPageBuilder final : public PageBuilder {
+public:
+    explicit DeltaBinaryPackedPageBuilder(const PageBuilderOptions& options)
+            : _max_count(std::max<uint32_t>(1, options.data_page_size / SIZE_OF_TYPE)) {
+        reset();
+    }
+
+    ~DeltaBinaryPackedPageBuilder() override = default;
+
+    bool is_page_full() override { return _count >= _max_count; }
+
+    uint32_t add(const uint8_t* vals, uint32_t count) override {
+        DCHECK(!_finished);
+        uint32_t to_add = std::min(_max_count - _count, count);
+        _values.append(vals, to_add * SIZE_OF_TYPE);
+        _count += to_add;
+        return to_add;
+    }
+
+    faststring* finish() override {
+        DCHECK(!_finished);
+        _finished = true;
+        const auto* values = reinterpret_cast<const CppType*>(_values.data());
+        uint8_t flags = std::is_sorted(values, values + _count) ? DELTA_PAGE_NON_DECREASING : 0;
+        int64_t last_value = _count > 0 ? values[_count - 1] : 0;
+
+        _buffer.clear();
+        _buffer.resize(DELTA_PAGE_HEADER_SIZE);
+        encode_fixed32_le(_buffer.data(), _count);
+        _buffer[sizeof(uint32_t)] = flags;
+        memcpy(_buffer.data() + sizeof(uint32_t) + sizeof(uint8_t), &last_value, sizeof(int64_t));
+        _packed.clear();
+        for (uint32_t offset = 0; offset < _count; offset += kMiniBlockSize) {
+            uint32_t miniblock_count = std::min<uint32_t>(kMiniBlockSize, _count - offset);
+            auto header = Coding::encode_miniblock(values + offset, miniblock_count, &_packed);
+            Coding::put_header(header, &_buffer);
+        }
+        _buffer.append(_packed.data(), _packed.size());
+        return &_buffer;
+    }
+
+    void reset() override {
+        _count = 0;
+        _finished = false;
+        _values.clear();
+        _values.reserve(_max_count * SIZE_OF_TYPE);
+    }
+
+    uint32_t count() const override { return _count; }
+
+    uint64_t size() const override { return _values.size(); }
+
+    Status get_first_value(void* value) const override {
+        if (_count == 0) {
+            return Status::NotFound("page is empty");
+        }
+        memcpy(value, _values.data(), SIZE_OF_TYPE);
+        return Status::OK();
+    }
+
+    Status get_last_value(void* value) const override {
+        if (_count == 0) {
+            return Status::NotFound("page is empty");
+        }
+        memcpy(value, &_values[(_count - 1) * SIZE_OF_TYPE], SIZE_OF_TYPE);
+        return Status::OK();
+    }
+
+private:
+    using CppType = typename TypeTraits<Type>::CppType;
+    using Coding = DeltaBinaryPackedCoding<CppType>;
+    enum { SIZE_OF_TYPE = TypeTraits<Type>::size };
+    static constexpr uint32_t kMiniBlockSize = Coding::kMiniBlockSize;
+
+    const uint32_t _max_count;
+    uint32_t _count = 0;
+    bool _finished = false;
+    faststring _values;
+    faststring _packed;
+    faststring _buffer;
+};
+
+template <LogicalType Type>
+class DeltaBinaryPackedPageDecoder final : public PageDecoder {
+public:
+    using CppType = typename TypeTraits<Type>::CppType;
+    using Coding = DeltaBinaryPackedCoding<CppType>;
+    static constexpr uint32_t kMiniBlockSize = Coding::kMiniBlockSize;
+
+    explicit DeltaBinaryPackedPageDecoder(Slice data) : _data(data) {}
+
+    ~DeltaBinaryPackedPageDecoder() override = default;
+
+    Status init() override {
+        CHECK(!_parsed);
+        if (_data.size < DELTA_PAGE_HEADER_SIZE) {
+            return Status::Corruption("not enough bytes for the header of delta binary packed page");
+        }
+        const auto* data = reinterpret_cast<const uint8_t*>(_data.data);
+        _num_elements = decode_fixed32_le(data);
+        _flags = data[sizeof(uint32_t)];
+        memcpy(&_last_value, data + sizeof(uint32_t) + sizeof(uint8_t), sizeof(int64_t));
+
+        uint32_t num_miniblocks = (_num_elements + kMiniBlockSize - 1) / kMiniBlockSize;
+        size_t offset = DELTA_PAGE_HEADER_SIZE + num_miniblocks * Coding::kMiniBlockHeaderSize;
+        if (offset > _data.size) {
+            return Status::Corruption("not enough bytes for the miniblocks of delta binary packed page");
+        }
+        _headers.resize(num_miniblocks);
+        _packed_offsets.resize(num_miniblocks);
+        for (uint32_t i = 0; i < num_miniblocks; i++) {
+            _headers[i] = Coding::get_header(data + DELTA_PAGE_HEADER_SIZE + i * Coding::kMiniBlockHeaderSize);
+            if (_headers[i].bit_width > 64) {
+                return Status::Corruption(strings::Substitute("invalid bit width of delta binary packed page: $0",
+                                                              _headers[i].bit_width));
+            }
+            _packed_offsets[i] = offset;
+            offset += Coding::packed_size(_miniblock_count(i), _headers[i].bit_width);
+        }
+        if (offset != _data.size) {
+            return Status::Corruption("unexpected data size of delta binary packed page");
+        }
+        _parsed = true;
+        return Status::OK();
+    }
+
+    // Seeking doesn't decode anything, and the miniblock of |pos| is decoded from its anchor on reading.
+    Status seek_to_position_in_page(uint32_t pos) override {
+        DCHECK(_parsed) << "Must call init() firstly";
+        DCHECK_LE(pos, _num_elements);
+        _cur_index = pos;
+        return Status::OK();
+    }
+
+    // Only the pages in non-decreasing order, e.g. the pages of the sort key and the indexes, are supported.
+    Status seek_at_or_after_value(const void* value, bool* exact_match) override {
+        DCHECK(_parsed) << "Must call init() firstly";
+        if (!is_non_decreasing()) {
+            return Status::NotSupported("seek_at_or_after_value of the page not in order");
+        }
+        CppType target;
+        memcpy(&target, value, sizeof(CppType));
+        // the first miniblock whose anchor >= target, and the value is in it or in the one before it
+        auto it = std::lower_bound(_headers.begin(), _headers.end(), target,
+                                   [](const auto& header, CppType v) { return anchor_of(header) < v; });
+        uint32_t miniblock = it - _headers.begin();
+        if (miniblock > 0) {
+            uint32_t prev = miniblock - 1;
+            _decode_miniblock(prev);
+            const CppType* end = _decoded_values + _miniblock_count(prev);
+            const CppType* pos = std::lower_bound(_decoded_values, end, target);
+            if (pos != end) {
+                _cur_index = prev * kMiniBlockSize + (pos - _decoded_values);
+                *exact_match = (*pos == target);
+                return Status::OK();
+            }
+        }
+        if (miniblock == _headers.size()) {
+            return Status::NotFound("not found");
+        }
+        _cur_index = miniblock * kMiniBlockSize;
+        *exact_match = (anchor(miniblock) == target);
+        return Status::OK();
+    }
+
+    Status next_batch(size_t* n, Column* dst) override {
+        SparseRange<> read_range;
+        uint32_t begin = current_index();
+        read_range.add(Range<>(begin, begin + *n));
+        RETURN_IF_ERROR(next_batch(read_range, dst));
+        *n = current_index() - begin;
+        return Status::OK();
+    }
+
+    Status next_batch(const SparseRange<>& range, Column* dst) override {
+        DCHECK(_parsed) << "Must call init() firstly";
+        size_t to_read = range.span_size();
+        if (PREDICT_FALSE(to_read == 0 || _cur_index >= _num_elements)) {
+            return Status::OK();
+        }
+        SparseRangeIterator<> iter = range.new_iterator();
+        while (iter.has_more() && _cur_index < _num_elements) {
+            _cur_index = iter.begin();
+            Range<> r = iter.next(to_read);
+            uint32_t end = std::min<uint32_t>(r.end(), _num_elements);
+            while (_cur_index < end) {
+                uint32_t miniblock = _cur_index / kMiniBlockSize;
+                uint32_t miniblock_start = miniblock * kMiniBlockSize;
+                uint32_t miniblock_count = _miniblock_count(miniblock);
+                uint32_t num_values = std::min<uint32_t>(end, miniblock_start + miniblock_count) - _cur_index;
+                if (num_values == miniblock_count) {
+                    // the whole miniblock is read, decode it into the column directly
+                    const size_t ori_size = dst->size();
+                    dst->resize(ori_size + num_values);
+                    auto* p = reinterpret_cast<CppType*>(dst->mutable_raw_data()) + ori_size;
+                    Coding::decode_miniblock(_headers[miniblock], _packed_data(miniblock), miniblock_count, p);
+                } else {
+                    _decode_miniblock(miniblock);
+                    int n = dst->append_numbers(_decoded_values + (_cur_index - miniblock_start),
+                                                num_values * SIZE_OF_TYPE);
+                    DCHECK_EQ(num_values, n);
+                }
+                _cur_index += num_values;
+            }
+        }
+        return Status::OK();
+    }
+
+    uint32_t count() const override { return _num_elements; }
+
+    uint32_t current_index() const override { return _cur_index; }
+
+    EncodingTypePB encoding_type() const override { return DELTA_BINARY_PACKED; }
+
+    bool is_non_decreasing() const { return (_flags & DELTA_PAGE_NON_DECREASING) != 0; }
+
+    uint32_t num_miniblocks() const { return _headers.size(); }
+
+    // The first value of the |miniblock|.
+    CppType anchor(uint32_t miniblock) const { return anchor_of(_headers[miniblock]); }
+
+    CppType last_value() const { return static_cast<CppType>(_last_value); }
+
+private:
+    enum { SIZE_OF_TYPE = TypeTraits<Type>::size };
+
+    static CppType anchor_of(const typename Coding::MiniBlockHeader& header) {
+        return static_cast<CppType>(header.anchor);
+    }
+
+    uint32_t _miniblock_count(uint32_t miniblock) const {
+        return std::min<uint32_t>(kMiniBlockSize, _num_elements - miniblock * kMiniBlockSize);
+    }
+
+    const uint8_t* _packed_data(uint32_t miniblock) const {
+        return reinterpret_cast<const uint8_t*>(_data.data) + _packed_offsets[miniblock];
+    }
+
+    void _decode_miniblock(uint32_t miniblock) {
+        if (_decoded_miniblock == miniblock) {
+            return;
+        }
+        Coding::decode_miniblock(_headers[miniblock], _packed_data(miniblock), _miniblock_count(miniblock),
+                                 _decoded_values);
+        _decoded_miniblock = miniblock;
+    }
+
+    Slice _data;
+    bool _parsed = false;
+    uint8_t _flags = 0;
+    int64_t _last_value = 0;
+    uint32_t _num_elements = 0;
+    uint32_t _cur_index = 0;
+    std::vector<typename Coding::MiniBlockHeader> _headers;
+    std::vector<size_t> _packed_offsets;
+    int64_t _decoded_miniblock = -1;
+    CppType _decoded_values[kMiniBlockSize];
+};
+
+} // namespace starrocks
@@ -56,6 +56,27 @@ inline bool enable_non_string_column_dict_encoding() {
     return std::abs(config::dictionary_encoding_ratio_for_non_string_column - 0) > epsilon;
 }
 
+inline bool enable_alp_float_encoding() {
+    double epsilon = 0.0001;
+    return config::alp_encoding_ratio_for_float_column > epsilon;
+}
+
+// The types of the sort key columns encoded by DELTA_BINARY_PACKED if enable_delta_binary_packed_sort_key_encoding
+// is on. DATE_V1 and DATETIME_V1 are legacy types, and LARGEINT is rarely a sort key, so they are not included.
+inline bool delta_binary_packed_sort_key_type(LogicalType type) {
+    switch (type) {
+    case TYPE_TINYINT:
+    case TYPE_SMALLINT:
+    case TYPE_INT:
+    case TYPE_BIGINT:
+    case TYPE_DATE:
+    case TYPE_DATETIME:
+        return true;
+    default:
+        return false;
+    }
+}
+
 // We dont make TYPE_TINYINT support dict encoding. The reason is that TYPE_TINYINT is only have
 // 256 different values, that is too small to make our speculation mechanism work. And according
 // test results, when TINY_INT column is encoded using dict, the space usage is not necessarily
@@ -97,6 +97,7 @@ Status IndexedColumnReader::read_page(const IndexReadOptions& opts, const PagePo
     page_opts.use_page_cache = opts.use_page_cache;
     page_opts.kept_in_memory = opts.kept_in_memory;
     page_opts.encoding_type = _encoding_info->encoding();
+    page_opts.page_cache_segment = opts.page_cache_segment;
     return PageIO::read_and_decompress_page(page_opts, handle, body, footer);
 }
 
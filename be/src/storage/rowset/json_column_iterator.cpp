@@ -265,8 +265,7 @@ Status JsonFlatColumnIterator::seek_to_ordinal(ordinal_t ord) {
 Status JsonFlatColumnIterator::get_row_ranges_by_zone_map(const std::vector<const ColumnPredicate*>& predicates,
                                                           const ColumnPredicate* del_predicate,
                                                           SparseRange<>* row_ranges, CompoundNodeType pred_relation) {
-    row_ranges->add({0, static_cast<rowid_t>(_reader->num_rows())});
-    return Status::OK();
+    return _get_row_ranges_by_subfield_zone_map(_reader, _opts, predicates, row_ranges, pred_relation);
 }
 
 class JsonDynamicFlatIterator final : public ColumnIterator {
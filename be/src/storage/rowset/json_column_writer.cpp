@@ -209,6 +209,7 @@ Status FlatJsonColumnWriter::finish() {
             }
 
             opts.need_flat = false;
+            opts.need_zone_map = config::enable_subfield_zonemap && is_subfield_zone_map_type(_flat_types[i]);
 
             TabletColumn col(StorageAggregateType::STORAGE_AGGREGATE_NONE, _flat_types[i], true);
             ASSIGN_OR_RETURN(auto fw, ColumnWriter::create(opts, &col, _wfile));
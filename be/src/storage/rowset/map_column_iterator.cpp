@@ -14,10 +14,13 @@
 
 #include "storage/rowset/map_column_iterator.h"
 
+#include <optional>
+
 #include "column/column_access_path.h"
 #include "column/const_column.h"
 #include "column/map_column.h"
 #include "column/nullable_column.h"
+#include "storage/column_predicate.h"
 #include "storage/rowset/scalar_column_iterator.h"
 
 namespace starrocks {
@@ -33,6 +36,7 @@ MapColumnIterator::MapColumnIterator(ColumnReader* reader, std::unique_ptr<Colum
           _path(std::move(path)) {}
 
 Status MapColumnIterator::init(const ColumnIteratorOptions& opts) {
+    _sub_opts = opts;
     if (_nulls != nullptr) {
         RETURN_IF_ERROR(_nulls->init(opts));
     }
@@ -308,4 +312,81 @@ Status MapColumnIterator::seek_to_ordinal(ordinal_t ord) {
     return Status::OK();
 }
 
+// Return the row in [lo, hi) which |element| belongs to, that is the last row whose first element is not after
+// |element|, the first element of the row |lo| must not be after |element|. The offsets are binary searched by
+// seeking, so only the pages on the search path are read instead of all the offsets.
+static StatusOr<rowid_t> row_of_element(ColumnIterator* offsets, ordinal_t element, rowid_t lo, rowid_t hi) {
+    lo++;
+    while (lo < hi) {
+        rowid_t mid = lo + (hi - lo) / 2;
+        RETURN_IF_ERROR(offsets->seek_to_ordinal_and_calc_element_ordinal(mid));
+        if (static_cast<ordinal_t>(offsets->element_ordinal()) <= element) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo - 1;
+}
+
+// Keep the rows which have any element in |element_ranges|. The empty and null maps between the elements of
+// a range are kept too, which is fine for pruning.
+static Status element_ranges_to_row_ranges(ColumnIterator* offsets, const SparseRange<>& element_ranges,
+                                           rowid_t num_rows, SparseRange<>* row_ranges) {
+    rowid_t row = 0;
+    for (size_t i = 0; i < element_ranges.size(); i++) {
+        ASSIGN_OR_RETURN(rowid_t first, row_of_element(offsets, element_ranges[i].begin(), row, num_rows));
+        ASSIGN_OR_RETURN(row, row_of_element(offsets, element_ranges[i].end() - 1, first, num_rows));
+        row_ranges->add({first, row + 1});
+    }
+    return Status::OK();
+}
+
+Status MapColumnIterator::get_row_ranges_by_zone_map(const std::vector<const ColumnPredicate*>& predicates,
+                                                     const ColumnPredicate* del_predicate, SparseRange<>* row_ranges,
+                                                     CompoundNodeType pred_relation) {
+    const ColumnReader* keys_reader = (*_reader->sub_readers())[0].get();
+    std::vector<const ColumnPredicate*> key_preds;
+    for (const ColumnPredicate* pred : predicates) {
+        const auto& path = pred->subfield_path();
+        if (path.size() == 1 && path[0] == kMapKeysSubfield && keys_reader->has_zone_map() &&
+            keys_reader->column_type() == pred->type_info()->type()) {
+            key_preds.emplace_back(pred);
+        }
+    }
+    const auto num_rows = static_cast<rowid_t>(_reader->num_rows());
+    if (key_preds.empty() || (key_preds.size() < predicates.size() && pred_relation == CompoundNodeType::OR)) {
+        row_ranges->add({0, num_rows});
+        return Status::OK();
+    }
+
+    // The sizes of the maps are stored as the offsets, the rows of the elements are found by the element
+    // ordinals in the footers of the offsets pages.
+    ASSIGN_OR_RETURN(auto offsets_iter, _reader->sub_readers()->back()->new_iterator());
+    RETURN_IF_ERROR(offsets_iter->init(_sub_opts));
+
+    if (pred_relation == CompoundNodeType::OR) {
+        // A row satisfies any of the predicates if any of its keys does.
+        SparseRange<> element_ranges;
+        RETURN_IF_ERROR(_keys->get_row_ranges_by_zone_map(key_preds, nullptr, &element_ranges, pred_relation));
+        return element_ranges_to_row_ranges(offsets_iter.get(), element_ranges, num_rows, row_ranges);
+    }
+    // The predicates of AND may be satisfied by the different keys of a row, so they are mapped to the rows
+    // one by one.
+    std::optional<SparseRange<>> hit_ranges;
+    for (const ColumnPredicate* pred : key_preds) {
+        SparseRange<> element_ranges;
+        RETURN_IF_ERROR(_keys->get_row_ranges_by_zone_map({pred}, nullptr, &element_ranges, pred_relation));
+        SparseRange<> pred_row_ranges;
+        RETURN_IF_ERROR(element_ranges_to_row_ranges(offsets_iter.get(), element_ranges, num_rows, &pred_row_ranges));
+        if (!hit_ranges.has_value()) {
+            hit_ranges = std::move(pred_row_ranges);
+        } else {
+            hit_ranges.value() &= pred_row_ranges;
+        }
+    }
+    *row_ranges = std::move(hit_ranges.value());
+    return Status::OK();
+}
+
 } // namespace starrocks
@@ -44,6 +44,12 @@ public:
 
     Status fetch_values_by_rowid(const rowid_t* rowids, size_t size, Column* values) override;
 
+    // Prune the rows by the page zone map of the keys, with the predicates on kMapKeysSubfield in |predicates|.
+    // A row is kept if any of its keys may satisfy the predicates.
+    Status get_row_ranges_by_zone_map(const std::vector<const ColumnPredicate*>& predicates,
+                                      const ColumnPredicate* del_predicate, SparseRange<>* row_ranges,
+                                      CompoundNodeType pred_relation) override;
+
     ColumnReader* get_column_reader() override { return _reader; }
 
 private:
@@ -57,6 +63,10 @@ private:
 
     bool _access_keys;
     bool _access_values;
+
+    // The options to read the sub columns. They are not kept in _opts, because the map column has no pages
+    // to coalesce the io of.
+    ColumnIteratorOptions _sub_opts;
 };
 
 } // namespace starrocks
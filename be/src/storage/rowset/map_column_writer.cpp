@@ -14,6 +14,7 @@
 
 #include "column/map_column.h"
 #include "column/nullable_column.h"
+#include "common/config.h"
 #include "common/status.h"
 #include "gutil/casts.h"
 #include "storage/rowset/column_writer.h"
@@ -41,7 +42,7 @@ public:
 
     Status finish_current_page() override;
 
-    Status write_zone_map() override { return Status::OK(); }
+    Status write_zone_map() override { return _keys_writer->write_zone_map(); }
 
     Status write_bitmap_index() override { return Status::OK(); }
 
@@ -70,7 +71,9 @@ StatusOr<std::unique_ptr<ColumnWriter>> create_map_column_writer(const ColumnWri
         const TabletColumn& key_column = column->subcolumn(0);
         ColumnWriterOptions key_options;
         key_options.meta = opts.meta->mutable_children_columns(0);
-        key_options.need_zone_map = false;
+        // the zone maps of the keys prune the rows by the predicates on the values of some key, e.g. `m['k'] = 1`
+        key_options.need_zone_map = opts.need_zone_map && config::enable_subfield_zonemap &&
+                                    is_subfield_zone_map_type(key_column.type());
         key_options.need_bloom_filter = key_column.is_bf_column();
         key_options.need_bitmap_index = key_column.has_bitmap_index();
         if (key_column.type() == LogicalType::TYPE_ARRAY) {
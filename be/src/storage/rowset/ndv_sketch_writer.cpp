@@ -0,0 +1,86 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/rowset/ndv_sketch_writer.h"
+
+#include "gen_cpp/segment.pb.h"
+#include "storage/types.h"
+#include "util/hash_util.hpp"
+#include "util/raw_container.h"
+#include "util/slice.h"
+
+namespace starrocks {
+
+bool NdvSketchWriter::is_supported_type(LogicalType type) {
+    switch (type) {
+    case TYPE_BOOLEAN:
+    case TYPE_TINYINT:
+    case TYPE_SMALLINT:
+    case TYPE_INT:
+    case TYPE_BIGINT:
+    case TYPE_LARGEINT:
+    case TYPE_FLOAT:
+    case TYPE_DOUBLE:
+    case TYPE_DATE:
+    case TYPE_DATETIME:
+    case TYPE_DECIMALV2:
+    case TYPE_DECIMAL32:
+    case TYPE_DECIMAL64:
+    case TYPE_DECIMAL128:
+    case TYPE_CHAR:
+    case TYPE_VARCHAR:
+        return true;
+    default:
+        return false;
+    }
+}
+
+std::unique_ptr<NdvSketchWriter> NdvSketchWriter::create(const TypeInfo* type_info) {
+    LogicalType type = type_info->type();
+    if (!is_supported_type(type)) {
+        return nullptr;
+    }
+    bool is_string = type == TYPE_CHAR || type == TYPE_VARCHAR;
+    return std::unique_ptr<NdvSketchWriter>(new NdvSketchWriter(is_string, type_info->size()));
+}
+
+void NdvSketchWriter::add_values(const void* values, size_t count) {
+    // The hash of 0 is skipped as ndv() does.
+    if (_is_string) {
+        const auto* slices = reinterpret_cast<const Slice*>(values);
+        for (size_t i = 0; i < count; i++) {
+            uint64_t hash = HashUtil::murmur_hash64A(slices[i].data, slices[i].size, HashUtil::MURMUR_SEED);
+            if (hash != 0) {
+                _hll.update(hash);
+            }
+        }
+    } else {
+        const auto* data = reinterpret_cast<const uint8_t*>(values);
+        for (size_t i = 0; i < count; i++) {
+            uint64_t hash = HashUtil::murmur_hash64A(data + i * _value_size, _value_size, HashUtil::MURMUR_SEED);
+            if (hash != 0) {
+                _hll.update(hash);
+            }
+        }
+    }
+}
+
+void NdvSketchWriter::finish(ColumnMetaPB* meta) const {
+    std::string sketch;
+    raw::make_room(&sketch, _hll.max_serialized_size());
+    sketch.resize(_hll.serialize(reinterpret_cast<uint8_t*>(sketch.data())));
+    meta->set_ndv_sketch(std::move(sketch));
+}
+
+} // namespace starrocks
@@ -0,0 +1,60 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "types/hll.h"
+#include "types/logical_type.h"
+
+namespace starrocks {
+
+class ColumnMetaPB;
+class TypeInfo;
+
+// NdvSketchWriter builds the HyperLogLog of the not null values of a column in a segment, which is stored in
+// the column meta of the segment footer.
+//
+// The values are hashed in the same way as ndv() and approx_count_distinct(), so the sketches of all the
+// segments are merged by hll_union_agg() into the NDV of the column without reading any data page.
+class NdvSketchWriter {
+public:
+    // Return nullptr if the values of |type_info| are not supported.
+    static std::unique_ptr<NdvSketchWriter> create(const TypeInfo* type_info);
+
+    // The fixed length types and the strings, whose values in the segment are hashed as the values in the
+    // columns of the query. DECIMAL, DATE_V1 and DATETIME_V1 are stored in a different format, so they are
+    // not supported.
+    static bool is_supported_type(LogicalType type);
+
+    void add_values(const void* values, size_t count);
+
+    void add_nulls(uint32_t count) {}
+
+    uint64_t size() const { return _hll.mem_usage(); }
+
+    void finish(ColumnMetaPB* meta) const;
+
+private:
+    NdvSketchWriter(bool is_string, size_t value_size) : _is_string(is_string), _value_size(value_size) {}
+
+    const bool _is_string;
+    const size_t _value_size;
+    HyperLogLog _hll;
+};
+
+} // namespace starrocks
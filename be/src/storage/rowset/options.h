@@ -62,6 +62,8 @@ public:
     //RandomAccessFile* read_file = nullptr;
     io::SeekableInputStream* read_file = nullptr;
     OlapReaderStatistics* stats = nullptr;
+    // the segment of the index pages in the page cache
+    PageCacheSegment* page_cache_segment = nullptr;
 };
 
 } // namespace starrocks
@@ -119,6 +119,7 @@ Status OrdinalIndexReader::_do_load(const IndexReadOptions& opts, const OrdinalI
     page_opts.stats = opts.stats;
     page_opts.use_page_cache = opts.use_page_cache;
     page_opts.kept_in_memory = opts.kept_in_memory;
+    page_opts.page_cache_segment = opts.page_cache_segment;
 
     // read index page
     PageHandle page_handle;
@@ -113,6 +113,11 @@ public:
     // this information is used for doing low-cardinality string column read optimization.
     virtual bool all_dict_encoded() const { return false; }
 
+    // Return true if the page is compressed by the encoding itself, and then the page body is not compressed by the
+    // compression codec of the column again.
+    // This method could only be called between finish() and reset().
+    virtual bool is_compressed() const { return false; }
+
 private:
     PageBuilder(const PageBuilder&) = delete;
     const PageBuilder& operator=(const PageBuilder&) = delete;
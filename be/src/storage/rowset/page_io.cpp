@@ -140,7 +140,10 @@ Status PageIO::read_and_decompress_page(const PageReadOptions& opts, PageHandle*
 
     auto cache = StoragePageCache::instance();
     PageCacheHandle cache_handle;
-    StoragePageCache::CacheKey cache_key(opts.read_file->filename(), opts.page_pointer.offset);
+    // The pages of a segment are keyed by its page cache id, which is much cheaper to build than the file name.
+    auto cache_key = opts.page_cache_segment != nullptr
+                             ? StoragePageCache::CacheKey(*opts.page_cache_segment, opts.page_pointer.offset)
+                             : StoragePageCache::CacheKey(opts.read_file->filename(), opts.page_pointer.offset);
     if (opts.use_page_cache && cache->lookup(cache_key, &cache_handle)) {
         // we find page in cache, use it
         *handle = PageHandle(std::move(cache_handle));
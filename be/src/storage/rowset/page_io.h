@@ -69,6 +69,8 @@ struct PageReadOptions {
     bool kept_in_memory = false;
     // page encoding type
     EncodingTypePB encoding_type = UNKNOWN_ENCODING;
+    // the segment of the page in the page cache, the page is keyed by the file name if it's null
+    PageCacheSegment* page_cache_segment = nullptr;
 
     void sanity_check() const {
         CHECK_NOTNULL(read_file);
@@ -41,6 +41,8 @@
 #include "column/nullable_column.h"
 #include "common/status.h"
 #include "gutil/strings/substitute.h"
+#include "storage/chunk_helper.h"
+#include "storage/page_cache.h"
 #include "storage/rowset/binary_dict_page.h"
 #include "storage/rowset/bitshuffle_page.h"
 #include "storage/rowset/encoding_info.h"
@@ -208,6 +210,14 @@ public:
         return Status::OK();
     }
 
+    StatusOr<Slice> null_flags() const override {
+        // the values of the null rows are not stored
+        if (_has_null) {
+            return Status::NotSupported("null flags are not supported by page format v1");
+        }
+        return Slice();
+    }
+
 private:
     friend Status parse_page_v1(std::unique_ptr<ParsedPage>* result, PageHandle handle, const Slice& body,
                                 const DataPageFooterPB& footer, const EncodingInfo* encoding,
@@ -302,6 +312,8 @@ public:
         return Status::OK();
     }
 
+    StatusOr<Slice> null_flags() const override { return Slice(_null_flags.data(), _null_flags.size()); }
+
 private:
     friend Status parse_page_v2(std::unique_ptr<ParsedPage>* result, PageHandle handle, const Slice& body,
                                 const DataPageFooterPB& footer, const EncodingInfo* encoding,
@@ -408,4 +420,178 @@ Status parse_page(std::unique_ptr<ParsedPage>* result, PageHandle handle, const
     return Status::InternalError(strings::Substitute("Unknown page format version $0", version));
 }
 
+namespace {
+// The rows of a data page decoded into a column, which is the value of the decoded page tier of the page cache.
+struct DecodedPageData {
+    // The values or the dictionary codes of all the rows, including the null ones.
+    ColumnPtr data;
+    // The null flags, or null if no row is null.
+    NullColumnPtr null_flags;
+    bool dict_codes = false;
+    EncodingTypePB encoding_type = UNKNOWN_ENCODING;
+    ordinal_t first_ordinal = 0;
+    uint64_t num_rows = 0;
+    ordinal_t corresponding_element_ordinal = 0;
+
+    size_t memory_usage() const {
+        return sizeof(*this) + data->memory_usage() + (null_flags != nullptr ? null_flags->memory_usage() : 0);
+    }
+};
+
+void delete_decoded_page_data(const CacheKey& /*key*/, void* value) {
+    delete static_cast<DecodedPageData*>(value);
+}
+} // namespace
+
+// A page reading the rows decoded by a previous read from the decoded page tier of the page cache, which appends the
+// decoded rows to the columns as they are.
+class DecodedPage final : public ParsedPage {
+public:
+    DecodedPage(PageCacheHandle handle, const PagePointer& page_pointer, uint32_t page_index,
+                DictDecodeFunc dict_decode)
+            : _handle(std::move(handle)),
+              _data(static_cast<const DecodedPageData*>(_handle.value())),
+              _dict_decode(std::move(dict_decode)) {
+        _page_index = page_index;
+        _page_pointer = page_pointer;
+        _first_ordinal = _data->first_ordinal;
+        _num_rows = _data->num_rows;
+        _corresponding_element_ordinal = _data->corresponding_element_ordinal;
+    }
+
+    ~DecodedPage() override = default;
+
+    EncodingTypePB encoding_type() const override { return _data->encoding_type; }
+
+    Status seek(ordinal_t offset) override {
+        DCHECK_LE(offset, _num_rows);
+        _offset_in_page = offset;
+        return Status::OK();
+    }
+
+    Status read(Column* column, size_t* count) override {
+        *count = std::min(*count, remaining());
+        RETURN_IF_ERROR(_append(column, _offset_in_page, *count, _data->dict_codes));
+        _offset_in_page += *count;
+        return Status::OK();
+    }
+
+    Status read(Column* column, const SparseRange<>& range) override {
+        return _read(column, range, _data->dict_codes);
+    }
+
+    Status read_dict_codes(Column* column, size_t* count) override {
+        DCHECK(_data->dict_codes);
+        *count = std::min(*count, remaining());
+        RETURN_IF_ERROR(_append(column, _offset_in_page, *count, false));
+        _offset_in_page += *count;
+        return Status::OK();
+    }
+
+    Status read_dict_codes(Column* column, const SparseRange<>& range) override {
+        DCHECK(_data->dict_codes);
+        return _read(column, range, false);
+    }
+
+private:
+    Status _read(Column* column, const SparseRange<>& range, bool decode_words) {
+        DCHECK_LE(range.end(), _num_rows);
+        SparseRangeIterator<> iter = range.new_iterator();
+        size_t to_read = range.span_size();
+        while (to_read > 0) {
+            Range<> r = iter.next(to_read);
+            RETURN_IF_ERROR(_append(column, r.begin(), r.span_size(), decode_words));
+            to_read -= r.span_size();
+        }
+        _offset_in_page = range.end();
+        return Status::OK();
+    }
+
+    // Append |count| rows from |offset|, and decode the dictionary codes into the words if |decode_words|.
+    Status _append(Column* dst, size_t offset, size_t count, bool decode_words) const {
+        Column* data_dst = dst;
+        NullableColumn* nullable_dst = nullptr;
+        if (dst->is_nullable()) {
+            nullable_dst = down_cast<NullableColumn*>(dst);
+            data_dst = nullable_dst->data_column().get();
+        } else {
+            DCHECK(_data->null_flags == nullptr);
+        }
+
+        if (decode_words) {
+            const auto* codes = reinterpret_cast<const int32_t*>(_data->data->raw_data()) + offset;
+            RETURN_IF_ERROR(_dict_decode(codes, count, data_dst));
+        } else {
+            size_t type_size = _data->data->type_size();
+            (void)data_dst->append_numbers(_data->data->raw_data() + offset * type_size, count * type_size);
+        }
+
+        if (nullable_dst != nullptr) {
+            if (_data->null_flags != nullptr) {
+                (void)nullable_dst->null_column()->append_numbers(_data->null_flags->raw_data() + offset, count);
+            } else {
+                nullable_dst->null_column()->append_default(count);
+            }
+            nullable_dst->update_has_null();
+        }
+        return Status::OK();
+    }
+
+    PageCacheHandle _handle;
+    const DecodedPageData* _data;
+    DictDecodeFunc _dict_decode;
+};
+
+Status decode_and_cache_page(std::unique_ptr<ParsedPage>* page, LogicalType type, bool nullable, bool dict_codes,
+                             PageCacheSegment* segment, DictDecodeFunc dict_decode) {
+    ParsedPage* parsed = page->get();
+    DCHECK_EQ(0, parsed->offset());
+    auto column = ChunkHelper::column_from_field_type(type, nullable);
+    column->reserve(parsed->num_rows());
+    size_t count = parsed->num_rows();
+    if (dict_codes) {
+        RETURN_IF_ERROR(parsed->read_dict_codes(column.get(), &count));
+    } else {
+        RETURN_IF_ERROR(parsed->read(column.get(), &count));
+    }
+    if (count != parsed->num_rows()) {
+        return Status::Corruption(fmt::format("decoded {} rows from a page of {} rows", count, parsed->num_rows()));
+    }
+
+    auto decoded = std::make_unique<DecodedPageData>();
+    if (column->is_nullable()) {
+        auto* nullable_column = down_cast<NullableColumn*>(column.get());
+        decoded->data = nullable_column->data_column();
+        if (nullable_column->has_null()) {
+            decoded->null_flags = nullable_column->null_column();
+        }
+    } else {
+        decoded->data = std::move(column);
+    }
+    decoded->dict_codes = dict_codes;
+    decoded->encoding_type = parsed->encoding_type();
+    decoded->first_ordinal = parsed->first_ordinal();
+    decoded->num_rows = parsed->num_rows();
+    decoded->corresponding_element_ordinal = parsed->corresponding_element_ordinal();
+
+    PagePointer page_pointer = parsed->page_pointer();
+    uint32_t page_index = parsed->page_index();
+    size_t charge = decoded->memory_usage();
+    PageCacheHandle handle;
+    StoragePageCache::instance()->insert_decoded(segment, page_pointer.offset, decoded.release(), charge,
+                                                 delete_decoded_page_data, &handle);
+    *page = std::make_unique<DecodedPage>(std::move(handle), page_pointer, page_index, std::move(dict_decode));
+    return Status::OK();
+}
+
+std::unique_ptr<ParsedPage> lookup_decoded_page(PageCacheSegment* segment, const PagePointer& page_pointer,
+                                                uint32_t page_index, DictDecodeFunc dict_decode) {
+    PageCacheHandle handle;
+    if (!StoragePageCache::instance()->lookup_decoded(StoragePageCache::CacheKey(*segment, page_pointer.offset),
+                                                      &handle)) {
+        return nullptr;
+    }
+    return std::make_unique<DecodedPage>(std::move(handle), page_pointer, page_index, std::move(dict_decode));
+}
+
 } // namespace starrocks
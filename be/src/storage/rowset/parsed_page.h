@@ -34,21 +34,24 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
 
+#include "common/statusor.h"
 #include "storage/range.h"
 #include "storage/rowset/common.h" // ordinal_t
 #include "storage/rowset/page_decoder.h"
 #include "storage/rowset/page_pointer.h"
+#include "types/logical_type.h"
+#include "util/slice.h"
 
 namespace starrocks {
-class Slice;
-class Status;
 class Column;
 class DataPageFooterPB;
 class EncodingInfo;
 class PageHandle;
 class PagePointer;
+class PageCacheSegment;
 
 class ParsedPage {
 public:
@@ -81,7 +84,7 @@ public:
     size_t remaining() const { return _num_rows - _offset_in_page; }
 
     // Return the encoding type of this page.
-    EncodingTypePB encoding_type() const { return _data_decoder->encoding_type(); }
+    virtual EncodingTypePB encoding_type() const { return _data_decoder->encoding_type(); }
 
     // Set the page offset indicator to the specified position |offset|.
     // The |offset| is relative to first_ordinal(), and it should less than num_rows().
@@ -112,6 +115,11 @@ public:
 
     virtual Status read_dict_codes(Column* column, const SparseRange<>& range) = 0;
 
+    // Return the null flags of the rows of this page, one byte for each row, or an empty slice if there is no null.
+    // NotSupported is returned if the values of the null rows are not stored by the data decoder, i.e. the i-th
+    // value of the data decoder is not the value of the i-th row.
+    virtual StatusOr<Slice> null_flags() const { return Status::NotSupported("null flags are not supported"); }
+
 protected:
     uint32_t _page_index{0};
     uint64_t _num_rows{0};
@@ -130,4 +138,18 @@ Status parse_page(std::unique_ptr<ParsedPage>* result, PageHandle handle, const
                   const DataPageFooterPB& footer, const EncodingInfo* encoding, const PagePointer& page_pointer,
                   uint32_t page_index);
 
+// Decodes the dictionary codes into the words of the dictionary.
+using DictDecodeFunc = std::function<Status(const int32_t* codes, size_t size, Column* words)>;
+
+// Read all the rows of |*page|, which has not been read, as the values of |type|, or the dictionary codes if
+// |dict_codes| is true, and insert them into the decoded page tier of the page cache as a page of |segment|.
+// On success, |*page| is replaced by a page reading the decoded rows without decoding, which decodes the dictionary
+// codes into the words by |dict_decode| if the values are read.
+Status decode_and_cache_page(std::unique_ptr<ParsedPage>* page, LogicalType type, bool nullable, bool dict_codes,
+                             PageCacheSegment* segment, DictDecodeFunc dict_decode);
+
+// Return the page of |segment| in the decoded page tier of the page cache, or null if it is not cached.
+std::unique_ptr<ParsedPage> lookup_decoded_page(PageCacheSegment* segment, const PagePointer& page_pointer,
+                                                uint32_t page_index, DictDecodeFunc dict_decode);
+
 } // namespace starrocks
@@ -219,20 +219,19 @@ public:
         if (PREDICT_FALSE(_cur_index >= _num_elements)) {
             return Status::OK();
         }
-        CppType value{};
-
         size_t to_read =
                 std::min(static_cast<size_t>(range.span_size()), static_cast<size_t>(_num_elements - _cur_index));
         SparseRangeIterator<> iter = range.new_iterator();
         while (to_read > 0) {
             RETURN_IF_ERROR(seek_to_position_in_page(iter.begin()));
             Range<> r = iter.next(to_read);
-            for (size_t i = 0; i < r.span_size(); ++i) {
-                if (PREDICT_FALSE(!_rle_decoder.Get(&value))) {
-                    return Status::Corruption("RLE decode failed");
-                }
-                [[maybe_unused]] int p = dst->append_numbers(&value, sizeof(value));
-                DCHECK_EQ(1, p);
+            // decode into the column directly
+            const size_t ori_size = dst->size();
+            dst->resize(ori_size + r.span_size());
+            auto* p = reinterpret_cast<CppType*>(dst->mutable_raw_data()) + ori_size;
+            if (PREDICT_FALSE(_rle_decoder.GetBatch(p, r.span_size()) != r.span_size())) {
+                dst->resize(ori_size);
+                return Status::Corruption("RLE decode failed");
             }
             _cur_index += r.span_size();
             to_read -= r.span_size();
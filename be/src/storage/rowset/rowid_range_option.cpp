@@ -14,6 +14,7 @@
 
 #include "storage/rowset/rowid_range_option.h"
 
+#include <algorithm>
 #include <utility>
 
 #include "storage/rowset/base_rowset.h"
@@ -51,4 +52,98 @@ RowidRangeOption::SegmentSplit RowidRangeOption::get_segment_rowid_range(const B
     return segment_it->second;
 }
 
+SplittableRowidRange::SplittableRowidRange(const RowsetId& rowset_id, uint32_t segment_id, uint32_t begin,
+                                           uint32_t end, SparseRangePtr rowid_range)
+        : _rowset_id(rowset_id),
+          _segment_id(segment_id),
+          _rowid_range(std::move(rowid_range)),
+          _range(_pack(begin, std::max(begin, end))) {}
+
+uint32_t SplittableRowidRange::claim(uint32_t to) {
+    uint64_t range = _range.load();
+    uint32_t begin;
+    uint32_t end;
+    do {
+        begin = _begin_of(range);
+        end = _end_of(range);
+        if (to <= begin) {
+            return end;
+        }
+    } while (!_range.compare_exchange_weak(range, _pack(std::min(to, end), end)));
+    return end;
+}
+
+uint32_t SplittableRowidRange::num_pending_rows() const {
+    uint64_t range = _range.load();
+    return _end_of(range) - _begin_of(range);
+}
+
+bool SplittableRowidRange::split(uint32_t min_rows, SparseRange<>* split_range) {
+    min_rows = std::max<uint32_t>(min_rows, 1);
+    // The scanner claims the rows from the begin, and the idle scanner takes the half at the end.
+    uint64_t range = _range.load();
+    uint32_t begin;
+    uint32_t mid;
+    uint32_t end;
+    do {
+        begin = _begin_of(range);
+        end = _end_of(range);
+        if (end - begin < 2 * min_rows) {
+            return false;
+        }
+        mid = begin + (end - begin) / 2;
+    } while (!_range.compare_exchange_weak(range, _pack(begin, mid)));
+
+    *split_range = SparseRange<>(mid, end);
+    if (_rowid_range != nullptr) {
+        *split_range &= *_rowid_range;
+    }
+    return true;
+}
+
+SplittableRowidRangePtr RowidRangeSplitter::add_segment(const RowsetId& rowset_id, uint32_t segment_id,
+                                                        uint32_t num_rows, SparseRangePtr rowid_range) {
+    uint32_t begin = 0;
+    uint32_t end = num_rows;
+    if (rowid_range != nullptr) {
+        begin = rowid_range->empty() ? 0 : rowid_range->begin();
+        end = rowid_range->empty() ? 0 : std::min(num_rows, rowid_range->end());
+    }
+    auto range = std::make_shared<SplittableRowidRange>(rowset_id, segment_id, begin, end, std::move(rowid_range));
+    std::lock_guard<std::mutex> l(_mutex);
+    _segments.emplace_back(range);
+    return range;
+}
+
+bool RowidRangeSplitter::could_split(uint32_t min_rows) const {
+    std::lock_guard<std::mutex> l(_mutex);
+    return std::any_of(_segments.begin(), _segments.end(), [min_rows](const SplittableRowidRangePtr& segment) {
+        return segment->num_pending_rows() >= 2 * std::max<uint32_t>(min_rows, 1);
+    });
+}
+
+RowidRangeOptionPtr RowidRangeSplitter::split(uint32_t min_rows) {
+    std::lock_guard<std::mutex> l(_mutex);
+    // Retry with the next largest one if the scanner has claimed the rows of the largest segment in the meantime.
+    std::vector<std::pair<uint32_t, SplittableRowidRange*>> segments;
+    segments.reserve(_segments.size());
+    for (const auto& segment : _segments) {
+        segments.emplace_back(segment->num_pending_rows(), segment.get());
+    }
+    std::sort(segments.begin(), segments.end(),
+              [](const auto& lhs, const auto& rhs) { return lhs.first > rhs.first; });
+    for (const auto& entry : segments) {
+        auto* segment = entry.second;
+        auto split_range = std::make_shared<SparseRange<>>();
+        if (!segment->split(min_rows, split_range.get())) {
+            continue;
+        }
+        auto rowid_range_option = std::make_shared<RowidRangeOption>();
+        rowid_range_option->rowid_range_per_segment_per_rowset[segment->rowset_id()].emplace(
+                segment->segment_id(), RowidRangeOption::SegmentSplit{std::move(split_range), false});
+        return rowid_range_option;
+    }
+    return nullptr;
+}
+
 } // namespace starrocks
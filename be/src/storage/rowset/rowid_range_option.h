@@ -14,7 +14,12 @@
 
 #pragma once
 
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <vector>
 
 #include "storage/olap_common.h"
 #include "storage/range.h"
@@ -47,4 +52,68 @@ public:
     RowsetRowidRangeMap rowid_range_per_segment_per_rowset;
 };
 
+using RowidRangeOptionPtr = std::shared_ptr<RowidRangeOption>;
+
+// The pending rowids [begin, end) of a segment being scanned in the ascending order of rowid. The scanner claims the
+// rows from `begin` before reading them, and an idle scanner of the same scan could split off the tail half of the
+// pending rows at the same time, which the scanner will not read anymore.
+class SplittableRowidRange {
+public:
+    SplittableRowidRange(const RowsetId& rowset_id, uint32_t segment_id, uint32_t begin, uint32_t end,
+                         SparseRangePtr rowid_range);
+
+    // Claim the pending rows before `to` for the scanner, and return the end of the rows owned by the scanner, which
+    // may be less than `to` if the tail has been split off.
+    uint32_t claim(uint32_t to);
+    // Claim all the pending rows, when the scanner finishes the segment or doesn't read it in the order of rowid.
+    void claim_all() { claim(std::numeric_limits<uint32_t>::max()); }
+
+    uint32_t num_pending_rows() const;
+
+    // Split off the tail half of the pending rows, if both halves have at least `min_rows` rows.
+    // Return false if the pending rows are not enough to be split.
+    bool split(uint32_t min_rows, SparseRange<>* split_range);
+
+    const RowsetId& rowset_id() const { return _rowset_id; }
+    uint32_t segment_id() const { return _segment_id; }
+
+private:
+    static uint64_t _pack(uint32_t begin, uint32_t end) { return (static_cast<uint64_t>(begin) << 32) | end; }
+    static uint32_t _begin_of(uint64_t range) { return static_cast<uint32_t>(range >> 32); }
+    static uint32_t _end_of(uint64_t range) { return static_cast<uint32_t>(range); }
+
+    const RowsetId _rowset_id;
+    const uint32_t _segment_id;
+    // The rowid range of the segment assigned to the scanner, null means the whole segment.
+    const SparseRangePtr _rowid_range;
+    std::atomic<uint64_t> _range;
+};
+
+using SplittableRowidRangePtr = std::shared_ptr<SplittableRowidRange>;
+
+// The segments being scanned by a tablet reader, whose pending rows could be split off by the idle scanners of the
+// same scan. See WorkStealingMorselQueue.
+class RowidRangeSplitter {
+public:
+    RowidRangeSplitter() = default;
+
+    // Called when the iterator of a segment is created. `rowid_range` is the rowid range of the segment assigned to
+    // the reader, null means the whole segment.
+    SplittableRowidRangePtr add_segment(const RowsetId& rowset_id, uint32_t segment_id, uint32_t num_rows,
+                                        SparseRangePtr rowid_range);
+
+    // Whether split() could split off the rows of a segment now.
+    bool could_split(uint32_t min_rows) const;
+
+    // Split off the tail half of the pending rows of the segment with the most pending rows, if both halves have at
+    // least `min_rows` rows. Return null if no segment could be split.
+    RowidRangeOptionPtr split(uint32_t min_rows);
+
+private:
+    mutable std::mutex _mutex;
+    std::vector<SplittableRowidRangePtr> _segments;
+};
+
+using RowidRangeSplitterPtr = std::shared_ptr<RowidRangeSplitter>;
+
 } // namespace starrocks
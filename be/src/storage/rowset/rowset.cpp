@@ -50,6 +50,7 @@
 #include "storage/empty_iterator.h"
 #include "storage/index/index_descriptor.h"
 #include "storage/merge_iterator.h"
+#include "storage/page_cache.h"
 #include "storage/projection_iterator.h"
 #include "storage/rowset/metadata_cache.h"
 #include "storage/rowset/rowid_range_option.h"
@@ -328,6 +329,20 @@ Status Rowset::remove() {
             }
         }
     }
+    if (StoragePageCache::instance() != nullptr) {
+        // The pages of the removed segments can not be read any more, drop them instead of leaving them to be
+        // evicted by the newer pages.
+        std::vector<SegmentSharedPtr> segments;
+        {
+            std::lock_guard<std::mutex> l(_lock);
+            segments = _segments;
+        }
+        std::vector<const PageCacheSegment*> page_cache_segments;
+        for (const auto& segment : segments) {
+            page_cache_segments.emplace_back(segment->page_cache_segment());
+        }
+        StoragePageCache::instance()->drop_segments(page_cache_segments);
+    }
     for (int i = 0, sz = num_delete_files(); i < sz; ++i) {
         std::string path = segment_del_file_path(_rowset_path, rowset_id(), i);
         auto st = fs->delete_file(path);
@@ -751,9 +766,18 @@ Status Rowset::get_segment_iterators(const Schema& schema, const RowsetReadOptio
         } else {
             seg_options.is_first_split_of_segment = true;
         }
+        if (options.rowid_range_splitter != nullptr) {
+            seg_options.splittable_rowid_range = options.rowid_range_splitter->add_segment(
+                    rowset_id(), seg_ptr->id(), seg_ptr->num_rows(),
+                    options.rowid_range_option != nullptr ? seg_options.rowid_range_option : nullptr);
+        }
 
         auto res = seg_ptr->new_iterator(segment_schema, seg_options);
         if (res.status().is_end_of_file()) {
+            // nothing of the segment is left to be split off.
+            if (seg_options.splittable_rowid_range != nullptr) {
+                seg_options.splittable_rowid_range->claim_all();
+            }
             continue;
         }
         if (!res.ok()) {
@@ -41,9 +41,11 @@ class DeletePredicates;
 class ChunkPredicate;
 struct RowidRangeOption;
 struct ShortKeyRangesOption;
+class RowidRangeSplitter;
 
 class RowsetReadOptions {
     using RowidRangeOptionPtr = std::shared_ptr<RowidRangeOption>;
+    using RowidRangeSplitterPtr = std::shared_ptr<RowidRangeSplitter>;
     using ShortKeyRangesOptionPtr = std::shared_ptr<ShortKeyRangesOption>;
     using PredicateList = std::vector<const ColumnPredicate*>;
 
@@ -78,6 +80,8 @@ public:
 
     RowidRangeOptionPtr rowid_range_option = nullptr;
     ShortKeyRangesOptionPtr short_key_ranges_option = nullptr;
+    // If not null, the segments being read are registered to it, so that their pending rows could be split off.
+    RowidRangeSplitterPtr rowid_range_splitter = nullptr;
 
     OlapRuntimeScanRangePruner runtime_range_pruner;
 
@@ -35,11 +35,15 @@
 #include "storage/rowset/scalar_column_iterator.h"
 
 #include "storage/column_predicate.h"
+#include "storage/page_cache.h"
 #include "storage/rowset/binary_dict_page.h"
+#include "storage/rowset/binary_fsst_page.h"
 #include "storage/rowset/bitshuffle_page.h"
 #include "storage/rowset/column_reader.h"
+#include "storage/rowset/delta_binary_packed_page.h"
 #include "storage/rowset/dict_page.h"
 #include "storage/rowset/encoding_info.h"
+#include "storage/zone_map_detail.h"
 #include "util/bitmap.h"
 
 namespace starrocks {
@@ -57,6 +61,7 @@ Status ScalarColumnIterator::init(const ColumnIteratorOptions& opts) {
     index_opts.lake_io_opts = opts.lake_io_opts;
     index_opts.read_file = _opts.read_file;
     index_opts.stats = _opts.stats;
+    index_opts.page_cache_segment = _reader->page_cache_segment();
     RETURN_IF_ERROR(_reader->load_ordinal_index(index_opts));
     _opts.stats->total_columns_data_page_count += _reader->num_data_pages();
 
@@ -207,7 +212,7 @@ Status ScalarColumnIterator::next_batch(size_t* n, Column* dst) {
             RETURN_IF_ERROR(_load_next_page(&eos));
             if (eos) {
                 // release shareBufferStream
-                if (config::io_coalesce_lake_read_enable && _opts.is_io_coalesce) {
+                if (_opts.is_io_coalesce) {
                     auto shared_buffer_stream = dynamic_cast<io::SharedBufferedInputStream*>(_opts.read_file);
                     if (shared_buffer_stream != nullptr) {
                         shared_buffer_stream->release();
@@ -251,7 +256,7 @@ Status ScalarColumnIterator::next_batch(const SparseRange<>& range, Column* dst)
             RETURN_IF_ERROR(_load_next_page(&eos));
             if (eos) {
                 // release shareBufferStream
-                if (config::io_coalesce_lake_read_enable && _opts.is_io_coalesce) {
+                if (_opts.is_io_coalesce) {
                     auto shared_buffer_stream = dynamic_cast<io::SharedBufferedInputStream*>(_opts.read_file);
                     if (shared_buffer_stream != nullptr) {
                         shared_buffer_stream->release();
@@ -352,13 +357,83 @@ Status ScalarColumnIterator::_do_init_dict_decoder() {
     return Status::OK();
 }
 
+// The fixed-length types whose pages can be decoded into the values, which are appended to the columns as they are.
+static bool is_decodable_to_values(LogicalType type) {
+    switch (type) {
+    case TYPE_BOOLEAN:
+    case TYPE_TINYINT:
+    case TYPE_SMALLINT:
+    case TYPE_INT:
+    case TYPE_BIGINT:
+    case TYPE_LARGEINT:
+    case TYPE_FLOAT:
+    case TYPE_DOUBLE:
+    case TYPE_DATE:
+    case TYPE_DATETIME:
+    case TYPE_DECIMALV2:
+    case TYPE_DECIMAL32:
+    case TYPE_DECIMAL64:
+    case TYPE_DECIMAL128:
+        return true;
+    default:
+        return false;
+    }
+}
+
+ScalarColumnIterator::DecodedPageMode ScalarColumnIterator::_decoded_page_mode() const {
+    auto* cache = StoragePageCache::instance();
+    if (!_opts.use_page_cache || cache == nullptr || !cache->decoded_cache_enabled()) {
+        return DecodedPageMode::NONE;
+    }
+    LogicalType type = _reader->column_type();
+    if (is_decodable_to_values(type)) {
+        return DecodedPageMode::VALUES;
+    }
+    // The words are decoded from the codes on reading the values, so the codes are cached only if the column can be
+    // read as the dictionary codes.
+    if (is_string_type(type) && _all_dict_encoded) {
+        return DecodedPageMode::DICT_CODES;
+    }
+    return DecodedPageMode::NONE;
+}
+
 Status ScalarColumnIterator::_read_data_page(const OrdinalPageIndexIterator& iter) {
-    PageHandle handle;
-    Slice page_body;
-    PageFooterPB footer;
-    RETURN_IF_ERROR(_reader->read_page(_opts, iter.page(), &handle, &page_body, &footer));
-    RETURN_IF_ERROR(parse_page(&_page, std::move(handle), page_body, footer.data_page_footer(),
-                               _reader->encoding_info(), iter.page(), iter.page_index()));
+    DecodedPageMode decoded_page_mode = _decoded_page_mode();
+    DictDecodeFunc dict_decode;
+    if (decoded_page_mode == DecodedPageMode::DICT_CODES) {
+        dict_decode = [this](const int32_t* codes, size_t size, Column* words) {
+            return decode_dict_codes(codes, size, words);
+        };
+    }
+    if (decoded_page_mode != DecodedPageMode::NONE) {
+        auto page = lookup_decoded_page(_reader->page_cache_segment(), iter.page(), iter.page_index(), dict_decode);
+        if (page != nullptr) {
+            _opts.stats->total_pages_num++;
+            _opts.stats->decoded_cached_pages_num++;
+            _page = std::move(page);
+            return Status::OK();
+        }
+    }
+
+    // Reuse the page parsed by the range filters, and the pages before it are not read any more.
+    std::unique_ptr<ParsedPage> filtered_page;
+    while (!_filtered_pages.empty() && _filtered_pages.begin()->first <= iter.page_index()) {
+        auto node = _filtered_pages.extract(_filtered_pages.begin());
+        _filtered_pages_bytes -= node.mapped()->page_pointer().size;
+        if (node.key() == iter.page_index()) {
+            filtered_page = std::move(node.mapped());
+        }
+    }
+    if (filtered_page != nullptr) {
+        _page = std::move(filtered_page);
+    } else {
+        PageHandle handle;
+        Slice page_body;
+        PageFooterPB footer;
+        RETURN_IF_ERROR(_reader->read_page(_opts, iter.page(), &handle, &page_body, &footer));
+        RETURN_IF_ERROR(parse_page(&_page, std::move(handle), page_body, footer.data_page_footer(),
+                                   _reader->encoding_info(), iter.page(), iter.page_index()));
+    }
 
     // dictionary page is read when the first data page that uses it is read,
     // this is to optimize the memory usage: when there is no query on one column, we could
@@ -368,6 +443,14 @@ Status ScalarColumnIterator::_read_data_page(const OrdinalPageIndexIterator& ite
     if (_init_dict_decoder_func != nullptr) {
         RETURN_IF_ERROR((this->*_init_dict_decoder_func)());
     }
+
+    if (decoded_page_mode == DecodedPageMode::VALUES) {
+        RETURN_IF_ERROR(decode_and_cache_page(&_page, _reader->column_type(), _reader->is_nullable(), false,
+                                              _reader->page_cache_segment(), nullptr));
+    } else if (decoded_page_mode == DecodedPageMode::DICT_CODES && _page->encoding_type() == DICT_ENCODING) {
+        RETURN_IF_ERROR(decode_and_cache_page(&_page, TYPE_INT, _reader->is_nullable(), true,
+                                              _reader->page_cache_segment(), std::move(dict_decode)));
+    }
     return Status::OK();
 }
 
@@ -386,8 +469,12 @@ Status ScalarColumnIterator::get_row_ranges_by_zone_map(const std::vector<const
         opts.lake_io_opts = _opts.lake_io_opts;
         opts.read_file = _opts.read_file;
         opts.stats = _opts.stats;
+        opts.page_cache_segment = _reader->page_cache_segment();
         RETURN_IF_ERROR(_reader->zone_map_filter(predicates, del_predicate, &_delete_partial_satisfied_pages.value(),
                                                  row_ranges, opts, pred_relation));
+    } else if (_reader->column_type() == TYPE_JSON) {
+        // the flat json column is read as a whole, prune by the zone maps of the flattened sub-columns
+        return _get_row_ranges_by_subfield_zone_map(_reader, _opts, predicates, row_ranges, pred_relation);
     } else {
         row_ranges->add({0, static_cast<rowid_t>(_reader->num_rows())});
     }
@@ -427,6 +514,7 @@ Status ScalarColumnIterator::get_row_ranges_by_bloom_filter(const std::vector<co
     opts.lake_io_opts = _opts.lake_io_opts;
     opts.read_file = _opts.read_file;
     opts.stats = _opts.stats;
+    opts.page_cache_segment = _reader->page_cache_segment();
     // filter data using bloom filter or ngram bloom filter
     if (support_original_bloom_filter) {
         RETURN_IF_ERROR(_reader->original_bloom_filter(predicates, row_ranges, opts));
@@ -436,6 +524,207 @@ Status ScalarColumnIterator::get_row_ranges_by_bloom_filter(const std::vector<co
     return Status::OK();
 }
 
+Status ScalarColumnIterator::get_row_ranges_by_fsst_filter(const std::vector<const ColumnPredicate*>& predicates,
+                                                           SparseRange<>* row_ranges) {
+    // Only the columns encoded by FSST as a whole are filtered, because whether the data pages of a dictionary
+    // encoded column fall back to FSST is unknown until they are read.
+    RETURN_IF(_reader->encoding_info()->encoding() != FSST_ENCODING, Status::OK());
+    RETURN_IF(_reader->column_type() != TYPE_VARCHAR || row_ranges->empty(), Status::OK());
+    std::vector<const ColumnPredicate*> fsst_predicates;
+    for (const auto* pred : predicates) {
+        if (pred->support_fsst_filter()) {
+            fsst_predicates.emplace_back(pred);
+        }
+    }
+    RETURN_IF(fsst_predicates.empty(), Status::OK());
+
+    SparseRange<> result;
+    std::vector<Slice> codes;
+    std::vector<uint8_t> selection;
+    OrdinalPageIndexIterator iter;
+    RETURN_IF_ERROR(_reader->seek_at_or_before(row_ranges->begin(), &iter));
+    for (; iter.valid() && iter.first_ordinal() < row_ranges->end(); iter.next()) {
+        const ordinal_t first_ordinal = iter.first_ordinal();
+        SparseRange<> page_ranges = row_ranges->intersection(SparseRange<>(first_ordinal, iter.last_ordinal() + 1));
+        if (page_ranges.empty()) {
+            continue;
+        }
+        PageHandle handle;
+        Slice page_body;
+        PageFooterPB footer;
+        std::unique_ptr<ParsedPage> page;
+        RETURN_IF_ERROR(_reader->read_page(_opts, iter.page(), &handle, &page_body, &footer));
+        RETURN_IF_ERROR(parse_page(&page, std::move(handle), page_body, footer.data_page_footer(),
+                                   _reader->encoding_info(), iter.page(), iter.page_index()));
+        auto null_flags = page->null_flags();
+        if (!null_flags.ok()) {
+            result |= page_ranges;
+            _keep_filtered_page(std::move(page));
+            continue;
+        }
+        bool page_selected = false;
+        const auto* decoder = down_cast<BinaryFsstPageDecoder<TYPE_VARCHAR>*>(page->data_decoder());
+        for (size_t k = 0; k < page_ranges.size(); k++) {
+            const Range<>& r = page_ranges[k];
+            const size_t n = r.span_size();
+            const uint32_t begin = r.begin() - first_ordinal;
+            codes.resize(n);
+            selection.assign(n, 1);
+            for (size_t i = 0; i < n; i++) {
+                codes[i] = decoder->codes_at(begin + i);
+            }
+            for (const auto* pred : fsst_predicates) {
+                RETURN_IF_ERROR(pred->fsst_filter(decoder->symbol_table(), codes.data(), n, selection.data()));
+            }
+            if (!null_flags->empty()) {
+                const auto* is_null = reinterpret_cast<const uint8_t*>(null_flags->data) + begin;
+                for (size_t i = 0; i < n; i++) {
+                    selection[i] &= !is_null[i];
+                }
+            }
+            for (size_t i = 0; i < n;) {
+                if (!selection[i]) {
+                    i++;
+                    continue;
+                }
+                size_t j = i + 1;
+                while (j < n && selection[j]) {
+                    j++;
+                }
+                result.add(Range<>(r.begin() + i, r.begin() + j));
+                page_selected = true;
+                i = j;
+            }
+        }
+        // The page having the rows selected is read again on reading the rows.
+        if (page_selected) {
+            _keep_filtered_page(std::move(page));
+        }
+    }
+    *row_ranges = std::move(result);
+    return Status::OK();
+}
+
+void ScalarColumnIterator::_keep_filtered_page(std::unique_ptr<ParsedPage> page) {
+    const size_t page_size = page->page_pointer().size;
+    if (_filtered_pages_bytes + page_size > kMaxFilteredPagesBytes) {
+        return;
+    }
+    uint32_t page_index = page->page_index();
+    if (_filtered_pages.emplace(page_index, std::move(page)).second) {
+        _filtered_pages_bytes += page_size;
+    }
+}
+
+Status ScalarColumnIterator::get_row_ranges_by_delta_anchors(const std::vector<const ColumnPredicate*>& predicates,
+                                                             SparseRange<>* row_ranges) {
+    RETURN_IF(_reader->encoding_info()->encoding() != DELTA_BINARY_PACKED || row_ranges->empty(), Status::OK());
+    // The type of the predicate may be different from the data type, e.g. a BIGINT predicate on an INT column, and
+    // only the predicates of the data type are evaluated on the anchors.
+    std::vector<const ColumnPredicate*> anchor_predicates;
+    for (const auto* pred : predicates) {
+        if (pred->type_info()->type() == _reader->column_type()) {
+            anchor_predicates.emplace_back(pred);
+        }
+    }
+    RETURN_IF(anchor_predicates.empty(), Status::OK());
+
+    switch (_reader->column_type()) {
+    case TYPE_TINYINT:
+        return _get_row_ranges_by_delta_anchors<TYPE_TINYINT>(anchor_predicates, row_ranges);
+    case TYPE_SMALLINT:
+        return _get_row_ranges_by_delta_anchors<TYPE_SMALLINT>(anchor_predicates, row_ranges);
+    case TYPE_INT:
+        return _get_row_ranges_by_delta_anchors<TYPE_INT>(anchor_predicates, row_ranges);
+    case TYPE_BIGINT:
+        return _get_row_ranges_by_delta_anchors<TYPE_BIGINT>(anchor_predicates, row_ranges);
+    case TYPE_DATE:
+        return _get_row_ranges_by_delta_anchors<TYPE_DATE>(anchor_predicates, row_ranges);
+    case TYPE_DATETIME:
+        return _get_row_ranges_by_delta_anchors<TYPE_DATETIME>(anchor_predicates, row_ranges);
+    default:
+        return Status::OK();
+    }
+}
+
+template <LogicalType Type>
+Status ScalarColumnIterator::_get_row_ranges_by_delta_anchors(const std::vector<const ColumnPredicate*>& predicates,
+                                                              SparseRange<>* row_ranges) {
+    using CppType = typename CppTypeTraits<Type>::CppType;
+    using Decoder = DeltaBinaryPackedPageDecoder<Type>;
+    auto to_datum = [](CppType v) {
+        if constexpr (Type == TYPE_DATE) {
+            return Datum(DateValue{v});
+        } else if constexpr (Type == TYPE_DATETIME) {
+            return Datum(TimestampValue{v});
+        } else {
+            return Datum(v);
+        }
+    };
+
+    // The pages in the middle of a range are usually satisfied as a whole, e.g. by a range predicate on the sort
+    // key, so only the pages at the boundaries of the ranges are checked.
+    std::vector<ordinal_t> boundaries;
+    for (size_t i = 0; i < row_ranges->size(); i++) {
+        boundaries.emplace_back((*row_ranges)[i].begin());
+        boundaries.emplace_back((*row_ranges)[i].end() - 1);
+    }
+    auto boundary = boundaries.begin();
+
+    SparseRange<> kept;
+    OrdinalPageIndexIterator iter;
+    RETURN_IF_ERROR(_reader->seek_at_or_before(row_ranges->begin(), &iter));
+    for (; iter.valid() && iter.first_ordinal() < row_ranges->end(); iter.next()) {
+        const ordinal_t first_ordinal = iter.first_ordinal();
+        const ordinal_t end_ordinal = iter.last_ordinal() + 1;
+        while (boundary != boundaries.end() && *boundary < first_ordinal) {
+            ++boundary;
+        }
+        if (boundary == boundaries.end() || *boundary >= end_ordinal) {
+            kept.add(Range<>(first_ordinal, end_ordinal));
+            continue;
+        }
+        // The anchors of a boundary page are only known after parsing it, and the page is kept for reading the rows
+        // if any of its miniblocks are kept.
+        PageHandle handle;
+        Slice page_body;
+        PageFooterPB footer;
+        std::unique_ptr<ParsedPage> page;
+        RETURN_IF_ERROR(_reader->read_page(_opts, iter.page(), &handle, &page_body, &footer));
+        RETURN_IF_ERROR(parse_page(&page, std::move(handle), page_body, footer.data_page_footer(),
+                                   _reader->encoding_info(), iter.page(), iter.page_index()));
+        auto null_flags = page->null_flags();
+        const auto* decoder = down_cast<Decoder*>(page->data_decoder());
+        if (!null_flags.ok() || !decoder->is_non_decreasing()) {
+            kept.add(Range<>(first_ordinal, end_ordinal));
+            _keep_filtered_page(std::move(page));
+            continue;
+        }
+        bool page_kept = false;
+        const auto* is_null = reinterpret_cast<const uint8_t*>(null_flags->data);
+        for (uint32_t i = 0; i < decoder->num_miniblocks(); i++) {
+            const uint32_t begin = i * Decoder::kMiniBlockSize;
+            const uint32_t end = std::min<uint32_t>(begin + Decoder::kMiniBlockSize, decoder->count());
+            // The values of the null rows are in order too, so the values of the rows of the miniblock are between
+            // its anchor and the next anchor.
+            CppType max = i + 1 < decoder->num_miniblocks() ? decoder->anchor(i + 1) : decoder->last_value();
+            bool has_null = !null_flags->empty() && std::any_of(is_null + begin, is_null + end, [](uint8_t v) {
+                                return v != 0;
+                            });
+            ZoneMapDetail detail(to_datum(decoder->anchor(i)), to_datum(max), has_null);
+            if (std::ranges::all_of(predicates, [&](const auto* pred) { return pred->zone_map_filter(detail); })) {
+                kept.add(Range<>(first_ordinal + begin, first_ordinal + end));
+                page_kept = true;
+            }
+        }
+        if (page_kept) {
+            _keep_filtered_page(std::move(page));
+        }
+    }
+    *row_ranges = row_ranges->intersection(kept);
+    return Status::OK();
+}
+
 int ScalarColumnIterator::dict_lookup(const Slice& word) {
     DCHECK(all_page_dict_encoded());
     return (this->*_dict_lookup_func)(word);
@@ -34,6 +34,8 @@
 
 #pragma once
 
+#include <map>
+
 #include "column/fixed_length_column.h"
 #include "storage/range.h"
 #include "storage/rowset/column_iterator.h"
@@ -74,6 +76,12 @@ public:
     Status get_row_ranges_by_bloom_filter(const std::vector<const ColumnPredicate*>& predicates,
                                           SparseRange<>* range) override;
 
+    Status get_row_ranges_by_fsst_filter(const std::vector<const ColumnPredicate*>& predicates,
+                                         SparseRange<>* row_ranges) override;
+
+    Status get_row_ranges_by_delta_anchors(const std::vector<const ColumnPredicate*>& predicates,
+                                           SparseRange<>* row_ranges) override;
+
     bool all_page_dict_encoded() const override { return _all_dict_encoded; }
 
     Status fetch_all_dict_words(std::vector<Slice>* words) const override;
@@ -103,9 +111,15 @@ public:
     int dict_size() override;
 
 private:
+    // How the data pages are cached by the decoded page tier of the page cache.
+    enum class DecodedPageMode { NONE, VALUES, DICT_CODES };
+
     static Status _seek_to_pos_in_page(ParsedPage* page, ordinal_t offset_in_page);
     Status _load_next_page(bool* eos);
     Status _read_data_page(const OrdinalPageIndexIterator& iter);
+    // Keep the page parsed by the range filters to be reused on reading the rows, if there is room for it.
+    void _keep_filtered_page(std::unique_ptr<ParsedPage> page);
+    DecodedPageMode _decoded_page_mode() const;
 
     template <LogicalType Type>
     int _do_dict_lookup(const Slice& word);
@@ -131,6 +145,10 @@ private:
     template <LogicalType Type>
     Status _load_dict_page();
 
+    template <LogicalType Type>
+    Status _get_row_ranges_by_delta_anchors(const std::vector<const ColumnPredicate*>& predicates,
+                                            SparseRange<>* row_ranges);
+
     bool _contains_deleted_row(uint32_t page_index) const;
 
     ColumnReader* _reader;
@@ -141,6 +159,12 @@ private:
     // 3. When _page is null, it means that this reader can not be read.
     std::unique_ptr<ParsedPage> _page;
 
+    // The pages parsed by the range filters, e.g. the FSST filter, keyed by the page index. They are reused by
+    // _read_data_page() instead of being read and parsed again, and at most kMaxFilteredPagesBytes of them are kept.
+    std::map<uint32_t, std::unique_ptr<ParsedPage>> _filtered_pages;
+    size_t _filtered_pages_bytes = 0;
+    static constexpr size_t kMaxFilteredPagesBytes = 8 * 1024 * 1024;
+
     // keep dict page decoder
     std::unique_ptr<PageDecoder> _dict_decoder;
 
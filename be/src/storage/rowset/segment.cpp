@@ -88,9 +88,13 @@ StatusOr<std::shared_ptr<Segment>> Segment::open(std::shared_ptr<FileSystem> fs,
 
 StatusOr<size_t> Segment::parse_segment_footer(RandomAccessFile* read_file, SegmentFooterPB* footer,
                                                size_t* footer_length_hint,
-                                               const FooterPointerPB* partial_rowset_footer) {
+                                               const FooterPointerPB* partial_rowset_footer,
+                                               size_t* file_size_out) {
     // Footer := SegmentFooterPB, FooterPBSize(4), FooterPBChecksum(4), MagicNumber(4)
     ASSIGN_OR_RETURN(auto file_size, read_file->get_size());
+    if (file_size_out != nullptr) {
+        *file_size_out = file_size;
+    }
 
     if (file_size < 12) {
         return Status::Corruption(
@@ -241,7 +245,10 @@ Status Segment::_open(size_t* footer_length_hint, const FooterPointerPB* partial
     }
 
     ASSIGN_OR_RETURN(auto read_file, _fs->new_random_access_file(opts, _segment_file_info));
-    RETURN_IF_ERROR(Segment::parse_segment_footer(read_file.get(), &footer, footer_length_hint, partial_rowset_footer));
+    size_t file_size = 0;
+    RETURN_IF_ERROR(Segment::parse_segment_footer(read_file.get(), &footer, footer_length_hint, partial_rowset_footer,
+                                                  &file_size));
+    _page_cache_segment.init(_segment_file_info.path, file_size);
     RETURN_IF_ERROR(_create_column_readers(&footer));
     _num_rows = footer.num_rows();
     _short_key_index_page = PagePointer(footer.short_key_index_page());
@@ -278,12 +285,20 @@ struct SegmentZoneMapPruner {
                                                                : parent->_tablet_schema->column(column_id);
         const auto column_unique_id = tablet_column.unique_id();
 
-        if (const auto it = parent->_column_readers.find(column_unique_id); it == parent->_column_readers.end()) {
+        const auto it = parent->_column_readers.find(column_unique_id);
+        if (it == parent->_column_readers.end()) {
             return false;
-        } else {
-            return it->second->has_zone_map() && !it->second->segment_zone_map_filter({col_pred}) &&
-                   (tablet_column.is_key() || parent->_use_segment_zone_map_filter(read_options));
         }
+        const ColumnReader* reader = it->second.get();
+        if (col_pred->is_subfield_predicate()) {
+            // the segment zone map of the subfield, e.g. no key of MAP in the segment satisfies the predicate
+            reader = reader->subfield_reader(col_pred->subfield_path());
+            if (reader == nullptr || reader->column_type() != col_pred->type_info()->type()) {
+                return false;
+            }
+        }
+        return reader->has_zone_map() && !reader->segment_zone_map_filter({col_pred}) &&
+               (tablet_column.is_key() || parent->_use_segment_zone_map_filter(read_options));
     }
     bool operator()(const PredicateAndNode& node) const {
         return std::any_of(node.children().begin(), node.children().end(),
@@ -369,6 +384,7 @@ Status Segment::_load_index(const LakeIOOptions& lake_io_opts) {
     opts.read_file = read_file.get();
     opts.page_pointer = _short_key_index_page;
     opts.codec = nullptr; // short key index page uses NO_COMPRESSION for now
+    opts.page_cache_segment = &_page_cache_segment;
     OlapReaderStatistics tmp_stats;
     opts.stats = &tmp_stats;
 
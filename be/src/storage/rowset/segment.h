@@ -90,9 +90,11 @@ public:
                                                    const LakeIOOptions& lake_io_opts = {},
                                                    lake::TabletManager* tablet_manager = nullptr);
 
+    // |file_size| is set to the size of the segment file if it's not null.
     static StatusOr<size_t> parse_segment_footer(RandomAccessFile* read_file, SegmentFooterPB* footer,
                                                  size_t* footer_length_hint,
-                                                 const FooterPointerPB* partial_rowset_footer);
+                                                 const FooterPointerPB* partial_rowset_footer,
+                                                 size_t* file_size = nullptr);
 
     static Status write_segment_footer(WritableFile* write_file, const SegmentFooterPB& footer);
 
@@ -220,6 +222,8 @@ public:
 
     const FileEncryptionInfo* encryption_info() const { return _encryption_info.get(); };
 
+    PageCacheSegment* page_cache_segment() { return &_page_cache_segment; }
+
     DISALLOW_COPY_AND_MOVE(Segment);
 
 private:
@@ -300,6 +304,9 @@ private:
 
     std::unique_ptr<FileEncryptionInfo> _encryption_info;
 
+    // The pages of this segment in the page cache, which are keyed by the path and the size of the segment file.
+    PageCacheSegment _page_cache_segment;
+
     // for cloud native tablet
     lake::TabletManager* _tablet_manager = nullptr;
     // used to guarantee that segment will be opened at most once in a thread-safe way
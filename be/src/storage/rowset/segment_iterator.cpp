@@ -29,6 +29,7 @@
 #include "glog/logging.h"
 #include "gutil/casts.h"
 #include "gutil/stl_util.h"
+#include "io/io_uring.h"
 #include "io/shared_buffered_input_stream.h"
 #include "segment_options.h"
 #include "simd/simd.h"
@@ -205,6 +206,8 @@ private:
 
     Status _init();
     Status _try_to_update_ranges_by_runtime_filter();
+    // Drop the rows from `end` from the scan range, which have been split off and are read by another scanner.
+    void _drop_rows_split_off(rowid_t end);
     Status _do_get_next(Chunk* result, vector<rowid_t>* rowid);
 
     template <bool check_global_dict>
@@ -214,6 +217,8 @@ private:
     StatusOr<SparseRange<>> _get_row_ranges_by_short_key_ranges();
     Status _get_row_ranges_by_zone_map();
     Status _get_row_ranges_by_bloom_filter();
+    Status _get_row_ranges_by_fsst_filter();
+    Status _get_row_ranges_by_delta_anchors();
     Status _get_row_ranges_by_rowid_range();
 
     uint32_t segment_id() const { return _segment->id(); }
@@ -446,6 +451,8 @@ Status SegmentIterator::_init() {
     RETURN_IF_ERROR(_apply_bitmap_index());
     RETURN_IF_ERROR(_get_row_ranges_by_zone_map());
     RETURN_IF_ERROR(_get_row_ranges_by_bloom_filter());
+    RETURN_IF_ERROR(_get_row_ranges_by_fsst_filter());
+    RETURN_IF_ERROR(_get_row_ranges_by_delta_anchors());
     RETURN_IF_ERROR(_apply_inverted_index());
     if (apply_del_vec_after_all_index_filter) {
         RETURN_IF_ERROR(_apply_del_vector());
@@ -456,13 +463,23 @@ Status SegmentIterator::_init() {
     RETURN_IF_ERROR(_init_context());
     _init_column_predicates();
 
+    // The rows are claimed chunk by chunk when they are read in the ascending order of rowid, see _read().
+    // Otherwise, all the rows not split off yet are claimed at once.
+    if (_opts.splittable_rowid_range != nullptr && (!_opts.asc_hint || _scan_range.empty())) {
+        _opts.splittable_rowid_range->claim_all();
+    }
+
+    _range_iter = _scan_range.new_iterator();
+    if (_opts.splittable_rowid_range != nullptr && !_scan_range.empty()) {
+        _drop_rows_split_off(_opts.splittable_rowid_range->claim(_scan_range.begin()));
+    }
+
     // reverse scan_range
     if (!_opts.asc_hint) {
         _scan_range.split_and_revese(config::desc_hint_split_range, config::vector_chunk_size);
+        _range_iter = _scan_range.new_iterator();
     }
 
-    _range_iter = _scan_range.new_iterator();
-
     for (auto column_index : _io_coalesce_column_index) {
         RETURN_IF_ERROR(_column_iterators[column_index]->convert_sparse_range_to_io_range(_scan_range));
     }
@@ -493,6 +510,17 @@ Status SegmentIterator::_try_to_update_ranges_by_runtime_filter() {
             _opts.stats->raw_rows_read);
 }
 
+void SegmentIterator::_drop_rows_split_off(rowid_t end) {
+    if (!_range_iter.has_more() || end >= _scan_range.end()) {
+        return;
+    }
+    SparseRange<> res;
+    res.set_sorted(_scan_range.is_sorted());
+    _range_iter = _range_iter.intersection(SparseRange<>(0, end), &res);
+    std::swap(res, _scan_range);
+    _range_iter.set_range(&_scan_range);
+}
+
 StatusOr<std::shared_ptr<Segment>> SegmentIterator::_get_dcg_segment(uint32_t ucid) {
     // iterate dcg from new ver to old ver
     for (const auto& dcg : _dcgs) {
@@ -573,14 +601,18 @@ Status SegmentIterator::_init_column_iterator_by_cid(const ColumnId cid, const C
             opts.encryption_info = *encryption_info;
         }
         ASSIGN_OR_RETURN(auto rfile, _opts.fs->new_random_access_file(opts, _segment->file_info()));
-        if (config::io_coalesce_lake_read_enable && !_segment->is_default_column(col) &&
-            _segment->lake_tablet_manager() != nullptr) {
+        bool is_lake_segment = _segment->lake_tablet_manager() != nullptr;
+        // For the local segments, coalesce the page reads only to submit them to io_uring in batch
+        bool use_io_uring = !is_lake_segment && config::enable_io_uring && io::IoUring::is_supported();
+        if (((config::io_coalesce_lake_read_enable && is_lake_segment) || use_io_uring) &&
+            !_segment->is_default_column(col)) {
             ASSIGN_OR_RETURN(auto file_size, rfile->get_size());
             auto shared_buffered_input_stream =
                     std::make_unique<io::SharedBufferedInputStream>(rfile->stream(), _segment->file_name(), file_size);
             auto options = io::SharedBufferedInputStream::CoalesceOptions{
                     .max_dist_size = config::io_coalesce_read_max_distance_size,
-                    .max_buffer_size = config::io_coalesce_read_max_buffer_size};
+                    .max_buffer_size = config::io_coalesce_read_max_buffer_size,
+                    .max_batch_read_size = use_io_uring ? config::io_coalesce_read_max_buffer_size : 0};
             shared_buffered_input_stream->set_coalesce_options(options);
             iter_opts.read_file = shared_buffered_input_stream.get();
             iter_opts.is_io_coalesce = true;
@@ -1088,6 +1120,20 @@ inline Status SegmentIterator::_read(Chunk* chunk, vector<rowid_t>* rowids, size
     }
 
     _range_iter.next_range(n, &range);
+    if (_opts.splittable_rowid_range != nullptr) {
+        // The rows from `end` have been split off, and nothing is left to read after them in the ascending order.
+        const rowid_t end = _opts.splittable_rowid_range->claim(range.end());
+        if (end < range.end()) {
+            range &= SparseRange<>(0, end);
+            _drop_rows_split_off(end);
+        }
+        if (!_range_iter.has_more()) {
+            _opts.splittable_rowid_range->claim_all();
+        }
+        if (range.empty()) {
+            return Status::OK();
+        }
+    }
     read_num += range.span_size();
 
     {
@@ -1832,6 +1878,7 @@ Status SegmentIterator::_apply_bitmap_index() {
             opts.lake_io_opts = _opts.lake_io_opts;
             opts.read_file = _column_files[cid].get();
             opts.stats = _opts.stats;
+            opts.page_cache_segment = segment_ptr->page_cache_segment();
 
             BitmapIndexIterator* bitmap_iter = nullptr;
             RETURN_IF_ERROR(segment_ptr->new_bitmap_index_iterator(ucid, opts, &bitmap_iter));
@@ -2049,6 +2096,48 @@ Status SegmentIterator::_get_row_ranges_by_bloom_filter() {
     return Status::OK();
 }
 
+// Evaluate the equality and prefix predicates on the compressed strings of the FSST encoded columns, so that the
+// strings of the rows filtered out are never decompressed.
+Status SegmentIterator::_get_row_ranges_by_fsst_filter() {
+    RETURN_IF(_scan_range.empty(), Status::OK());
+    RETURN_IF(_opts.pred_tree.empty(), Status::OK());
+
+    SCOPED_RAW_TIMER(&_opts.stats->fsst_filter_ns);
+
+    const size_t prev_size = _scan_range.span_size();
+    // Only the column predicates of the root, which are in conjunction with all the others, are used.
+    for (const auto& [cid, col_preds] : _opts.pred_tree.get_immediate_column_predicate_map()) {
+        RETURN_IF_ERROR(_column_iterators[cid]->get_row_ranges_by_fsst_filter(col_preds, &_scan_range));
+        if (_scan_range.empty()) {
+            break;
+        }
+    }
+    _opts.stats->rows_fsst_filtered += prev_size - _scan_range.span_size();
+
+    return Status::OK();
+}
+
+// Evaluate the predicates on the anchors of the miniblocks of the DELTA_BINARY_PACKED pages in order, which narrows
+// the rows of the sort key columns down to the miniblocks without decoding them.
+Status SegmentIterator::_get_row_ranges_by_delta_anchors() {
+    RETURN_IF(_scan_range.empty(), Status::OK());
+    RETURN_IF(_opts.pred_tree.empty(), Status::OK());
+
+    SCOPED_RAW_TIMER(&_opts.stats->delta_anchor_filter_ns);
+
+    const size_t prev_size = _scan_range.span_size();
+    // Only the column predicates of the root, which are in conjunction with all the others, are used.
+    for (const auto& [cid, col_preds] : _opts.pred_tree.get_immediate_column_predicate_map()) {
+        RETURN_IF_ERROR(_column_iterators[cid]->get_row_ranges_by_delta_anchors(col_preds, &_scan_range));
+        if (_scan_range.empty()) {
+            break;
+        }
+    }
+    _opts.stats->rows_delta_anchor_filtered += prev_size - _scan_range.span_size();
+
+    return Status::OK();
+}
+
 Status SegmentIterator::_get_row_ranges_by_rowid_range() {
     DCHECK_EQ(0, _scan_range.span_size());
 
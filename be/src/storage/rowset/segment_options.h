@@ -45,6 +45,8 @@ struct RowidRangeOption;
 using RowidRangeOptionPtr = std::shared_ptr<RowidRangeOption>;
 struct ShortKeyRangeOption;
 using ShortKeyRangeOptionPtr = std::shared_ptr<ShortKeyRangeOption>;
+class SplittableRowidRange;
+using SplittableRowidRangePtr = std::shared_ptr<SplittableRowidRange>;
 
 class SegmentReadOptions {
 public:
@@ -88,6 +90,8 @@ public:
     bool is_first_split_of_segment = true;
     SparseRangePtr rowid_range_option = nullptr;
     std::vector<ShortKeyRangeOptionPtr> short_key_ranges;
+    // The rows of the segment that are not read yet, which could be split off and read by another scanner.
+    SplittableRowidRangePtr splittable_rowid_range = nullptr;
 
     OlapRuntimeScanRangePruner runtime_range_pruner;
 
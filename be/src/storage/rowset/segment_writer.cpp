@@ -48,6 +48,8 @@
 #include "storage/index/index_descriptor.h"
 #include "storage/row_store_encoder.h"
 #include "storage/rowset/column_writer.h" // ColumnWriter
+#include "storage/rowset/encoding_info.h"
+#include "storage/rowset/ndv_sketch_writer.h"
 #include "storage/rowset/page_io.h"
 #include "storage/seek_tuple.h"
 #include "storage/short_key_index.h"
@@ -156,6 +158,10 @@ Status SegmentWriter::init(const std::vector<uint32_t>& column_indexes, bool has
         } else {
             _init_column_meta(opts.meta, column_index, column);
         }
+        if (config::enable_delta_binary_packed_sort_key_encoding && column.is_sort_key() &&
+            delta_binary_packed_sort_key_type(column.type())) {
+            opts.meta->set_encoding(DELTA_BINARY_PACKED);
+        }
 
         // now we create zone map for key columns
         // and not support zone map for array type.
@@ -172,6 +178,7 @@ Status SegmentWriter::init(const std::vector<uint32_t>& column_indexes, bool has
         opts.need_bloom_filter = column.is_bf_column();
         opts.need_bitmap_index = column.has_bitmap_index();
         opts.need_inverted_index = _tablet_schema->has_index(column.unique_id(), GIN);
+        opts.need_ndv_sketch = config::enable_segment_ndv_sketch && NdvSketchWriter::is_supported_type(column.type());
 
         RETURN_IF_ERROR(_tablet_schema->get_indexes_for_column(column.unique_id(), &opts.tablet_index));
         if (opts.need_inverted_index) {
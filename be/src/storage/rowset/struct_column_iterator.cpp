@@ -56,6 +56,12 @@ public:
 
     Status fetch_subfield_by_rowid(const rowid_t* rowids, size_t size, Column* values) override;
 
+    Status get_row_ranges_by_zone_map(const std::vector<const ColumnPredicate*>& predicates,
+                                      const ColumnPredicate* del_predicate, SparseRange<>* row_ranges,
+                                      CompoundNodeType pred_relation) override {
+        return _get_row_ranges_by_subfield_zone_map(_reader, _sub_opts, predicates, row_ranges, pred_relation);
+    }
+
     ColumnReader* get_column_reader() override { return _reader; }
 
 private:
@@ -69,6 +75,10 @@ private:
     std::vector<ColumnIterator*> _access_iters;
     std::unordered_map<int, int> _access_index_map;
     ordinal_t _current_ordinal = 0;
+
+    // The options to read the fields. They are not kept in _opts, because the struct column has no pages
+    // to coalesce the io of.
+    ColumnIteratorOptions _sub_opts;
 };
 
 StatusOr<std::unique_ptr<ColumnIterator>> create_struct_iter(ColumnReader* _reader,
@@ -85,6 +95,7 @@ StructColumnIterator::StructColumnIterator(ColumnReader* reader, std::unique_ptr
         : _reader(reader), _null_iter(std::move(null_iter)), _field_iters(std::move(field_iters)), _path(path) {}
 
 Status StructColumnIterator::init(const ColumnIteratorOptions& opts) {
+    _sub_opts = opts;
     if (_null_iter != nullptr) {
         RETURN_IF_ERROR(_null_iter->init(opts));
     }
@@ -16,6 +16,7 @@
 
 #include "column/nullable_column.h"
 #include "column/struct_column.h"
+#include "common/config.h"
 #include "common/status.h"
 #include "gutil/casts.h"
 
@@ -41,7 +42,7 @@ public:
 
     Status finish_current_page() override;
 
-    Status write_zone_map() override { return Status::OK(); }
+    Status write_zone_map() override;
 
     Status write_bitmap_index() override { return Status::OK(); }
 
@@ -68,7 +69,10 @@ StatusOr<std::unique_ptr<ColumnWriter>> create_struct_column_writer(const Column
         const TabletColumn& field_column = column->subcolumn(i);
         ColumnWriterOptions value_options;
         value_options.meta = opts.meta->mutable_children_columns(i);
-        value_options.need_zone_map = false;
+        // the leaf fields, and the fields of the nested structs, have their own zone maps
+        value_options.need_zone_map =
+                opts.need_zone_map && config::enable_subfield_zonemap &&
+                (field_column.type() == TYPE_STRUCT || is_subfield_zone_map_type(field_column.type()));
         value_options.need_bloom_filter = field_column.is_bf_column();
         value_options.need_bitmap_index = field_column.has_bitmap_index();
         ASSIGN_OR_RETURN(auto field_writer, ColumnWriter::create(value_options, &field_column, wfile));
@@ -189,6 +193,13 @@ Status StructColumnWriter::write_ordinal_index() {
     return Status::OK();
 }
 
+Status StructColumnWriter::write_zone_map() {
+    for (auto& writer : _field_writers) {
+        RETURN_IF_ERROR(writer->write_zone_map());
+    }
+    return Status::OK();
+}
+
 Status StructColumnWriter::finish_current_page() {
     if (is_nullable()) {
         RETURN_IF_ERROR(_null_writer->finish_current_page());
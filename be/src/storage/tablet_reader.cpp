@@ -297,6 +297,11 @@ Status TabletReader::get_segment_iterators(const TabletReaderParams& params, std
     rs_opts.meta = _tablet->data_dir()->get_meta();
     rs_opts.rowid_range_option = params.rowid_range_option;
     rs_opts.short_key_ranges_option = params.short_key_ranges_option;
+    // The rows of a segment could be split off only if the segments are read one by one rather than merged.
+    if (!is_compaction(params.reader_type) && !params.sorted_by_keys_per_tablet &&
+        (keys_type == PRIMARY_KEYS || keys_type == DUP_KEYS || (keys_type == UNIQUE_KEYS && params.skip_aggregation))) {
+        rs_opts.rowid_range_splitter = params.rowid_range_splitter;
+    }
     if (keys_type == PRIMARY_KEYS || keys_type == DUP_KEYS) {
         rs_opts.asc_hint = _is_asc_hint;
     }
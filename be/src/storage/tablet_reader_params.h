@@ -37,6 +37,8 @@ struct RowidRangeOption;
 using RowidRangeOptionPtr = std::shared_ptr<RowidRangeOption>;
 struct ShortKeyRangesOption;
 using ShortKeyRangesOptionPtr = std::shared_ptr<ShortKeyRangesOption>;
+class RowidRangeSplitter;
+using RowidRangeSplitterPtr = std::shared_ptr<RowidRangeSplitter>;
 struct OlapScanRange;
 
 static inline std::unordered_set<uint32_t> EMPTY_FILTERED_COLUMN_IDS;
@@ -79,6 +81,8 @@ struct TabletReaderParams {
 
     RowidRangeOptionPtr rowid_range_option = nullptr;
     ShortKeyRangesOptionPtr short_key_ranges_option = nullptr;
+    // Used by the idle scanners of the same scan to split off the rows not read yet, see WorkStealingMorselQueue.
+    RowidRangeSplitterPtr rowid_range_splitter = nullptr;
 
     bool sorted_by_keys_per_tablet = false;
     OlapRuntimeScanRangePruner runtime_range_pruner;
@@ -173,6 +173,24 @@ inline bool is_complex_metric_type(LogicalType type) {
     }
 }
 
+// Whether the leaf subfields of STRUCT, the flattened sub-columns of JSON and the keys of MAP of this type have
+// page zone maps.
+inline bool is_subfield_zone_map_type(LogicalType type) {
+    switch (type) {
+    case TYPE_STRUCT:
+    case TYPE_ARRAY:
+    case TYPE_MAP:
+    case TYPE_JSON:
+    case TYPE_VARBINARY:
+    case TYPE_OBJECT:
+    case TYPE_PERCENTILE:
+    case TYPE_HLL:
+        return false;
+    default:
+        return true;
+    }
+}
+
 constexpr bool is_enumeration_type(LogicalType type) {
     switch (type) {
     case TYPE_TINYINT:
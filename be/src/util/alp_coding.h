@@ -0,0 +1,330 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+#include "common/status.h"
+#include "util/bit_stream_utils.inline.h"
+#include "util/faststring.h"
+
+namespace starrocks {
+
+// ALP (Adaptive Lossless floating-Point) coding.
+//
+// Most of the floating point values stored in the tables are decimals of a limited precision, e.g. 12.34,
+// which can be encoded losslessly as the integer round(12.34 * 10^e * 10^-f) with the exponent e = 2 and the
+// factor f = 0, and decoded back by 1234 * 10^f * 10^-e. The values are encoded by vectors of kVectorSize,
+// the integers of each vector are encoded by frame-of-reference and bit-packing, and the values which are
+// not decoded back to the same bits (e.g. NaN, inf, -0.0 and the values of a higher precision) are stored
+// as exceptions.
+//
+// The exponent and factor of each vector are chosen by sampling: `sample` finds the best combinations of
+// the sampled vectors, and `encode_vector` tries those on the samples of each vector.
+//
+// Vector layout:
+//   exponent (uint8) | factor (uint8) | bit width (uint8) | number of exceptions (uint16) | base (Int) |
+//   bit-packed integers | exception positions (uint16 * number of exceptions) | exceptions (T * number of exceptions)
+// The values are scaled in double for both FLOAT and DOUBLE, as multiplying a float by the inexact 10^-e in float
+// doesn't decode most of the decimals back, e.g. 1234 * 0.01f != 12.34f.
+template <typename T>
+struct AlpTraits {};
+
+template <>
+struct AlpTraits<double> {
+    using Int = int64_t;
+    static constexpr int kMaxExponent = 18;
+    static constexpr double kEncodingUpperLimit = 2251799813685248.0; // 2^51
+};
+
+template <>
+struct AlpTraits<float> {
+    using Int = int32_t;
+    static constexpr int kMaxExponent = 10;
+    static constexpr double kEncodingUpperLimit = 1073741824.0; // 2^30
+};
+
+template <typename T>
+class AlpCoding {
+public:
+    using Traits = AlpTraits<T>;
+    using Int = typename Traits::Int;
+    using UInt = std::make_unsigned_t<Int>;
+
+    static constexpr size_t kVectorSize = 1024;
+    static constexpr size_t kVectorHeaderSize = 5 + sizeof(Int);
+
+    // Decode the integer |n| with the exponent |e| and the factor |f|.
+    static T decode_value(Int n, int e, int f) {
+        return static_cast<T>(static_cast<double>(n) * kExp10[f] * kFrac10[e]);
+    }
+
+    // Encode |value| with the exponent |e| and the factor |f|, and return false if it's an exception.
+    static bool encode_value(T value, int e, int f, Int* n) {
+        double scaled = static_cast<double>(value) * kExp10[e] * kFrac10[f];
+        // NaN and inf fail the check as well.
+        if (!(std::abs(scaled) < Traits::kEncodingUpperLimit)) {
+            return false;
+        }
+        *n = static_cast<Int>((scaled + kMagicNumber) - kMagicNumber);
+        T decoded = decode_value(*n, e, f);
+        return memcmp(&decoded, &value, sizeof(T)) == 0;
+    }
+
+    // Return the encoded size of the vector of |count| values at |data| whose size is |size|,
+    // or 0 if the vector is broken.
+    static size_t vector_size(const uint8_t* data, size_t size, size_t count) {
+        if (size < kVectorHeaderSize) {
+            return 0;
+        }
+        int e = data[0];
+        int f = data[1];
+        int bit_width = data[2];
+        uint16_t num_exceptions;
+        memcpy(&num_exceptions, data + 3, sizeof(uint16_t));
+        if (e > Traits::kMaxExponent || f > e || bit_width > static_cast<int>(sizeof(Int) * 8) ||
+            num_exceptions > count) {
+            return 0;
+        }
+        size_t vector_size = kVectorHeaderSize + BitUtil::Ceil(count * bit_width, 8) +
+                             num_exceptions * (sizeof(uint16_t) + sizeof(T));
+        return vector_size <= size ? vector_size : 0;
+    }
+
+    // Decode the vector of |count| values at |data|, which must have been checked by `vector_size`, to |out|.
+    // Return Corruption if the position of an exception is out of the vector.
+    static Status decode_vector(const uint8_t* data, size_t count, T* __restrict__ out) {
+        DCHECK_LE(count, kVectorSize);
+        int e = data[0];
+        int f = data[1];
+        int bit_width = data[2];
+        uint16_t num_exceptions;
+        memcpy(&num_exceptions, data + 3, sizeof(uint16_t));
+        UInt base;
+        memcpy(&base, data + 5, sizeof(Int));
+        data += kVectorHeaderSize;
+
+        UInt ints[kVectorSize];
+        size_t packed_size = BitUtil::Ceil(count * bit_width, 8);
+        if (bit_width == 0) {
+            std::fill(ints, ints + count, 0);
+        } else {
+            BitPacking::UnpackValues(bit_width, data, packed_size, count, ints);
+        }
+        data += packed_size;
+        // The loop is vectorized by the compiler.
+        const double exp10 = kExp10[f];
+        const double frac10 = kFrac10[e];
+        for (size_t i = 0; i < count; i++) {
+            out[i] = static_cast<T>(static_cast<double>(static_cast<Int>(ints[i] + base)) * exp10 * frac10);
+        }
+
+        const uint8_t* exception_values = data + num_exceptions * sizeof(uint16_t);
+        for (size_t i = 0; i < num_exceptions; i++) {
+            uint16_t pos;
+            memcpy(&pos, data + i * sizeof(uint16_t), sizeof(uint16_t));
+            if (UNLIKELY(pos >= count)) {
+                return Status::Corruption(
+                        fmt::format("position of alp exception {} is out of the vector of {} values", pos, count));
+            }
+            memcpy(&out[pos], exception_values + i * sizeof(T), sizeof(T));
+        }
+        return Status::OK();
+    }
+
+    // Choose the combinations of the exponent and factor tried by `encode_vector` by sampling the |count| values.
+    void sample(const T* values, size_t count) {
+        _combinations.clear();
+        size_t num_vectors = (count + kVectorSize - 1) / kVectorSize;
+        size_t vector_step = std::max<size_t>(1, num_vectors / kMaxSampledVectors);
+        int counts[Traits::kMaxExponent + 1][Traits::kMaxExponent + 1] = {};
+        for (size_t v = 0; v < num_vectors; v += vector_step) {
+            size_t vector_count = std::min(kVectorSize, count - v * kVectorSize);
+            Combination best = _best_combination(values + v * kVectorSize, vector_count);
+            counts[best.e][best.f]++;
+        }
+        std::vector<std::pair<int, Combination>> candidates;
+        for (int e = 0; e <= Traits::kMaxExponent; e++) {
+            for (int f = 0; f <= e; f++) {
+                if (counts[e][f] > 0) {
+                    candidates.emplace_back(counts[e][f], Combination{e, f});
+                }
+            }
+        }
+        std::stable_sort(candidates.begin(), candidates.end(),
+                         [](const auto& a, const auto& b) { return a.first > b.first; });
+        for (size_t i = 0; i < candidates.size() && i < kMaxCombinations; i++) {
+            _combinations.emplace_back(candidates[i].second);
+        }
+        if (_combinations.empty()) {
+            _combinations.push_back(Combination{0, 0});
+        }
+    }
+
+    // Estimate the encoded bits of the sampled values with the combinations chosen by `sample`.
+    size_t estimate_bits(const T* values, size_t count) const {
+        size_t bits = 0;
+        for (size_t offset = 0; offset < count; offset += kVectorSize) {
+            size_t vector_count = std::min(kVectorSize, count - offset);
+            size_t vector_bits = SIZE_MAX;
+            for (const auto& c : _combinations) {
+                vector_bits = std::min(vector_bits, _estimate_bits(values + offset, vector_count, c));
+            }
+            bits += vector_bits;
+        }
+        return bits;
+    }
+
+    // Encode the vector of at most kVectorSize values, and append it to |buf|.
+    void encode_vector(const T* values, size_t count, faststring* buf) {
+        DCHECK_LE(count, kVectorSize);
+        DCHECK(!_combinations.empty());
+        Combination c = _combinations[0];
+        if (_combinations.size() > 1) {
+            size_t min_bits = SIZE_MAX;
+            for (const auto& candidate : _combinations) {
+                size_t bits = _estimate_bits(values, count, candidate);
+                if (bits < min_bits) {
+                    min_bits = bits;
+                    c = candidate;
+                }
+            }
+        }
+
+        Int ints[kVectorSize];
+        _exception_positions.clear();
+        for (size_t i = 0; i < count; i++) {
+            if (!encode_value(values[i], c.e, c.f, &ints[i])) {
+                _exception_positions.push_back(i);
+            }
+        }
+        // Replace the exceptions by a valid integer, so that they don't widen the frame.
+        Int placeholder = 0;
+        for (size_t i = 0, j = 0; i < count; i++) {
+            if (j < _exception_positions.size() && _exception_positions[j] == i) {
+                j++;
+            } else {
+                placeholder = ints[i];
+                break;
+            }
+        }
+        for (uint16_t pos : _exception_positions) {
+            ints[pos] = placeholder;
+        }
+        Int min = count > 0 ? *std::min_element(ints, ints + count) : 0;
+        Int max = count > 0 ? *std::max_element(ints, ints + count) : 0;
+        int bit_width = _bit_width(static_cast<UInt>(max) - static_cast<UInt>(min));
+
+        auto e = static_cast<uint8_t>(c.e);
+        auto f = static_cast<uint8_t>(c.f);
+        auto width = static_cast<uint8_t>(bit_width);
+        auto num_exceptions = static_cast<uint16_t>(_exception_positions.size());
+        buf->append(&e, sizeof(e));
+        buf->append(&f, sizeof(f));
+        buf->append(&width, sizeof(width));
+        buf->append(&num_exceptions, sizeof(num_exceptions));
+        buf->append(&min, sizeof(min));
+        if (bit_width > 0) {
+            _packed.clear();
+            BitWriter writer(&_packed);
+            for (size_t i = 0; i < count; i++) {
+                writer.PutValue(static_cast<UInt>(ints[i]) - static_cast<UInt>(min), bit_width);
+            }
+            writer.Flush();
+            DCHECK_EQ(BitUtil::Ceil(count * bit_width, 8), _packed.size());
+            buf->append(_packed.data(), _packed.size());
+        }
+        buf->append(_exception_positions.data(), _exception_positions.size() * sizeof(uint16_t));
+        for (uint16_t pos : _exception_positions) {
+            buf->append(&values[pos], sizeof(T));
+        }
+    }
+
+private:
+    struct Combination {
+        int e;
+        int f;
+    };
+
+    // The values in (-2^51, 2^51) are rounded to the nearest integer by adding and subtracting 2^52 + 2^51.
+    static constexpr double kMagicNumber = 6755399441055744.0;
+    static constexpr double kExp10[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8, 1e9,
+                                        1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18};
+    static constexpr double kFrac10[] = {1e0,   1e-1,  1e-2,  1e-3,  1e-4,  1e-5,  1e-6,  1e-7,  1e-8, 1e-9,
+                                         1e-10, 1e-11, 1e-12, 1e-13, 1e-14, 1e-15, 1e-16, 1e-17, 1e-18};
+
+    static constexpr size_t kMaxSampledVectors = 8;
+    static constexpr size_t kSampleSize = 32;
+    static constexpr size_t kMaxCombinations = 5;
+
+    static int _bit_width(uint64_t range) { return range == 0 ? 0 : 64 - __builtin_clzll(range); }
+
+    // Estimate the encoded bits of the vector with the combination |c| by the kSampleSize values sampled from it.
+    static size_t _estimate_bits(const T* values, size_t count, Combination c) {
+        // The stride is odd, so that the sampled values don't alias with the alternating patterns of the values.
+        size_t step = std::max<size_t>(1, count / kSampleSize) | 1;
+        size_t num_sampled = 0;
+        size_t num_exceptions = 0;
+        Int min = 0;
+        Int max = 0;
+        for (size_t i = 0; i < count; i += step) {
+            num_sampled++;
+            Int n;
+            if (!encode_value(values[i], c.e, c.f, &n)) {
+                num_exceptions++;
+                continue;
+            }
+            if (num_sampled - num_exceptions == 1) {
+                min = max = n;
+            } else {
+                min = std::min(min, n);
+                max = std::max(max, n);
+            }
+        }
+        size_t bit_width = _bit_width(static_cast<UInt>(max) - static_cast<UInt>(min));
+        return (bit_width * num_sampled + num_exceptions * (sizeof(uint16_t) + sizeof(T)) * 8) * count / num_sampled;
+    }
+
+    // Find the combination encoding the sampled values of the vector into the fewest bits.
+    static Combination _best_combination(const T* values, size_t count) {
+        Combination best{0, 0};
+        size_t min_bits = SIZE_MAX;
+        // Prefer the smaller exponent and factor on ties, which are less likely to lose the precision
+        // on the values not sampled.
+        for (int e = 0; e <= Traits::kMaxExponent; e++) {
+            for (int f = 0; f <= e; f++) {
+                size_t bits = _estimate_bits(values, count, Combination{e, f});
+                if (bits < min_bits) {
+                    min_bits = bits;
+                    best = Combination{e, f};
+                }
+            }
+        }
+        return best;
+    }
+
+    std::vector<Combination> _combinations{Combination{0, 0}};
+    std::vector<uint16_t> _exception_positions;
+    faststring _packed;
+};
+
+} // namespace starrocks
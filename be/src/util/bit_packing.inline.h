@@ -34,6 +34,8 @@
 
 // the implement of BitPacking is from impala
 
+#pragma once
+
 #include <boost/preprocessor/repetition/repeat_from_to.hpp>
 
 #include "util/bit_packing.h"
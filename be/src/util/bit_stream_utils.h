@@ -118,6 +118,12 @@ public:
     template <typename T>
     bool GetValue(int num_bits, T* v);
 
+    // Gets the next 'num_values' values, and returns the number of values read, which is less than 'num_values'
+    // if there are not enough bytes left. The values from the first byte boundary are unpacked in bulk, see
+    // BitUnpacking.
+    template <typename T>
+    int GetBatch(int num_bits, T* v, int num_values);
+
     // Reads a 'num_bytes'-sized value from the buffer and stores it in 'v'. T needs to be a
     // little-endian native type and big enough to store 'num_bytes'. The value is assumed
     // to be byte-aligned so the stream will be advanced to the start of the next byte
@@ -39,6 +39,7 @@
 #include "util/alignment.h"
 #include "util/bit_packing.inline.h"
 #include "util/bit_stream_utils.h"
+#include "util/bit_unpacking.h"
 
 using starrocks::BitUtil;
 
@@ -144,6 +145,29 @@ inline bool BitReader::GetValue(int num_bits, T* v) {
     return true;
 }
 
+template <typename T>
+inline int BitReader::GetBatch(int num_bits, T* v, int num_values) {
+    DCHECK_LE(num_bits, 64);
+    DCHECK_LE(num_bits, sizeof(T) * 8);
+
+    int i = 0;
+    // Read the values one by one up to the byte boundary.
+    for (; i < num_values && (bit_offset_ % 8) != 0; ++i) {
+        if (PREDICT_FALSE(!GetValue(num_bits, v + i))) return i;
+    }
+    if (i == num_values) return i;
+
+    int byte_offset = position() / 8;
+    int bytes_left = max_bytes_ - byte_offset;
+    int64_t to_read = num_values - i;
+    if (num_bits > 0) {
+        to_read = std::min<int64_t>(to_read, static_cast<int64_t>(bytes_left) * 8 / num_bits);
+    }
+    BitUnpacking::unpack_lsb(buffer_ + byte_offset, bytes_left, num_bits, to_read, v + i);
+    SeekToBit(position() + to_read * num_bits);
+    return i + to_read;
+}
+
 inline void BitReader::Rewind(int num_bits) {
     bit_offset_ -= num_bits;
     if (bit_offset_ >= 0) {
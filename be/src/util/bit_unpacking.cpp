@@ -0,0 +1,258 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "util/bit_unpacking.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "glog/logging.h"
+#include "simd/multi_version.h"
+
+namespace starrocks {
+
+// A value of up to this many bits is covered by the 8 bytes starting at its first byte, as it starts at one of
+// the lowest 8 bits.
+static constexpr int kMaxBitsInWord = 64 - 7;
+// Same as above, for the 4 bytes starting at its first byte.
+static constexpr int kMaxBitsInHalfWord = 32 - 7;
+
+// The number of values in [0, num_values) whose first |load_bytes| bytes are all in the input.
+static inline size_t num_safe_values(size_t in_bytes, int bit_width, size_t num_values, size_t load_bytes) {
+    if (in_bytes < load_bytes) {
+        return 0;
+    }
+    return std::min(num_values, ((in_bytes - load_bytes) * 8 + 7) / bit_width + 1);
+}
+
+// Unpack the MSB-first values in [begin, num_values) one by one.
+template <typename T>
+static inline void unpack_msb_scalar(const uint8_t* in, size_t in_bytes, int bit_width, size_t begin,
+                                     size_t num_values, T* out) {
+    size_t i = begin;
+    size_t bit = i * bit_width;
+    // The values up to kMaxBitsInWord bits are in the 8 bytes starting at their first byte, and the wider ones
+    // take the 9th byte too.
+    size_t load_bytes = bit_width <= kMaxBitsInWord ? sizeof(uint64_t) : sizeof(uint64_t) + 1;
+    size_t safe_values = num_safe_values(in_bytes, bit_width, num_values, load_bytes);
+    for (; i < safe_values; i++, bit += bit_width) {
+        uint64_t word;
+        memcpy(&word, in + bit / 8, sizeof(word));
+        uint64_t value = __builtin_bswap64(word) << (bit % 8);
+        if (load_bytes > sizeof(uint64_t)) {
+            value |= in[bit / 8 + sizeof(uint64_t)] >> (8 - bit % 8);
+        }
+        out[i] = static_cast<T>(value >> (64 - bit_width));
+    }
+    // Copy the last bytes into a zero-padded buffer, so that nothing after the input is read.
+    for (; i < num_values; i++, bit += bit_width) {
+        uint8_t buffer[sizeof(uint64_t) + 1] = {0};
+        memcpy(buffer, in + bit / 8, std::min(sizeof(buffer), in_bytes - bit / 8));
+        uint64_t word;
+        memcpy(&word, buffer, sizeof(word));
+        uint64_t value = (__builtin_bswap64(word) << (bit % 8)) | (buffer[sizeof(uint64_t)] >> (8 - bit % 8));
+        out[i] = static_cast<T>(value >> (64 - bit_width));
+    }
+}
+
+// Unpack the LSB-first values in [begin, num_values) by BitPacking, which starts at a byte boundary.
+template <typename T>
+static inline void unpack_lsb_scalar(const uint8_t* in, size_t in_bytes, int bit_width, size_t begin,
+                                     size_t num_values, T* out) {
+    // The values of every 8 values start at a byte boundary.
+    begin = begin / 8 * 8;
+    size_t offset = begin * bit_width / 8;
+    BitPacking::UnpackValues(bit_width, in + offset, in_bytes - offset, num_values - begin, out + begin);
+}
+
+template <bool MSB, typename T>
+static inline void unpack_scalar(const uint8_t* in, size_t in_bytes, int bit_width, size_t begin, size_t num_values,
+                                 T* out) {
+    if constexpr (MSB) {
+        unpack_msb_scalar(in, in_bytes, bit_width, begin, num_values, out);
+    } else {
+        unpack_lsb_scalar(in, in_bytes, bit_width, begin, num_values, out);
+    }
+}
+
+// The kernels below unpack the first values in [0, num_values) by whole vectors, and return the number of values
+// unpacked. The caller makes sure that |bit_width| fits the word of each lane and that the words of all the
+// |num_values| values are in the input.
+
+MFV_AVX512(size_t unpack64_impl(const uint8_t* in, int bit_width, bool msb, size_t num_values, uint64_t* out) {
+    const __m512i mask = _mm512_set1_epi64(bit_width == 64 ? ~0ULL : (1ULL << bit_width) - 1);
+    const __m512i seven = _mm512_set1_epi64(7);
+    const __m512i step = _mm512_set1_epi64(8LL * bit_width);
+    const __m128i right_shift = _mm_cvtsi32_si128(64 - bit_width);
+    // Reverse the bytes of each 64-bit lane.
+    const __m512i bswap = _mm512_set4_epi32(0x08090a0b, 0x0c0d0e0f, 0x00010203, 0x04050607);
+    const long long w = bit_width;
+    __m512i bits = _mm512_setr_epi64(0, w, 2 * w, 3 * w, 4 * w, 5 * w, 6 * w, 7 * w);
+    size_t i = 0;
+    for (; i + 8 <= num_values; i += 8) {
+        __m512i words = _mm512_i64gather_epi64(_mm512_srli_epi64(bits, 3), in, 1);
+        __m512i shifts = _mm512_and_si512(bits, seven);
+        if (msb) {
+            words = _mm512_srl_epi64(_mm512_sllv_epi64(_mm512_shuffle_epi8(words, bswap), shifts), right_shift);
+        } else {
+            words = _mm512_and_si512(_mm512_srlv_epi64(words, shifts), mask);
+        }
+        _mm512_storeu_si512(out + i, words);
+        bits = _mm512_add_epi64(bits, step);
+    }
+    return i;
+})
+
+MFV_AVX2(size_t unpack64_impl(const uint8_t* in, int bit_width, bool msb, size_t num_values, uint64_t* out) {
+    const __m256i mask = _mm256_set1_epi64x(bit_width == 64 ? ~0ULL : (1ULL << bit_width) - 1);
+    const __m256i seven = _mm256_set1_epi64x(7);
+    const __m256i step = _mm256_set1_epi64x(4LL * bit_width);
+    const __m128i right_shift = _mm_cvtsi32_si128(64 - bit_width);
+    const __m256i bswap = _mm256_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1,
+                                           0, 15, 14, 13, 12, 11, 10, 9, 8);
+    __m256i bits = _mm256_setr_epi64x(0, bit_width, 2LL * bit_width, 3LL * bit_width);
+    size_t i = 0;
+    for (; i + 4 <= num_values; i += 4) {
+        __m256i words = _mm256_i64gather_epi64(reinterpret_cast<const long long*>(in), _mm256_srli_epi64(bits, 3), 1);
+        __m256i shifts = _mm256_and_si256(bits, seven);
+        if (msb) {
+            words = _mm256_srl_epi64(_mm256_sllv_epi64(_mm256_shuffle_epi8(words, bswap), shifts), right_shift);
+        } else {
+            words = _mm256_and_si256(_mm256_srlv_epi64(words, shifts), mask);
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), words);
+        bits = _mm256_add_epi64(bits, step);
+    }
+    return i;
+})
+
+MFV_DEFAULT(size_t unpack64_impl(const uint8_t* in, int bit_width, bool msb, size_t num_values, uint64_t* out) {
+    return 0;
+})
+
+// |bit_width| is at most kMaxBitsInHalfWord, so that each value is read by a 32-bit lane.
+MFV_AVX512(size_t unpack32_impl(const uint8_t* in, int bit_width, bool msb, size_t num_values, uint32_t* out) {
+    const __m512i mask = _mm512_set1_epi32((1U << bit_width) - 1);
+    const __m512i seven = _mm512_set1_epi32(7);
+    const __m512i step = _mm512_set1_epi32(16 * bit_width);
+    const __m128i right_shift = _mm_cvtsi32_si128(32 - bit_width);
+    // Reverse the bytes of each 32-bit lane.
+    const __m512i bswap = _mm512_set4_epi32(0x0c0d0e0f, 0x08090a0b, 0x04050607, 0x00010203);
+    __m512i bits = _mm512_mullo_epi32(_mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15),
+                                      _mm512_set1_epi32(bit_width));
+    size_t i = 0;
+    for (; i + 16 <= num_values; i += 16) {
+        __m512i words = _mm512_i32gather_epi32(_mm512_srli_epi32(bits, 3), in, 1);
+        __m512i shifts = _mm512_and_si512(bits, seven);
+        if (msb) {
+            words = _mm512_srl_epi32(_mm512_sllv_epi32(_mm512_shuffle_epi8(words, bswap), shifts), right_shift);
+        } else {
+            words = _mm512_and_si512(_mm512_srlv_epi32(words, shifts), mask);
+        }
+        _mm512_storeu_si512(out + i, words);
+        bits = _mm512_add_epi32(bits, step);
+    }
+    return i;
+})
+
+MFV_AVX2(size_t unpack32_impl(const uint8_t* in, int bit_width, bool msb, size_t num_values, uint32_t* out) {
+    const __m256i mask = _mm256_set1_epi32((1U << bit_width) - 1);
+    const __m256i seven = _mm256_set1_epi32(7);
+    const __m256i step = _mm256_set1_epi32(8 * bit_width);
+    const __m128i right_shift = _mm_cvtsi32_si128(32 - bit_width);
+    const __m256i bswap = _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12, 3, 2, 1, 0, 7, 6, 5,
+                                           4, 11, 10, 9, 8, 15, 14, 13, 12);
+    __m256i bits = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(bit_width));
+    size_t i = 0;
+    for (; i + 8 <= num_values; i += 8) {
+        __m256i words = _mm256_i32gather_epi32(reinterpret_cast<const int*>(in), _mm256_srli_epi32(bits, 3), 1);
+        __m256i shifts = _mm256_and_si256(bits, seven);
+        if (msb) {
+            words = _mm256_srl_epi32(_mm256_sllv_epi32(_mm256_shuffle_epi8(words, bswap), shifts), right_shift);
+        } else {
+            words = _mm256_and_si256(_mm256_srlv_epi32(words, shifts), mask);
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), words);
+        bits = _mm256_add_epi32(bits, step);
+    }
+    return i;
+})
+
+MFV_DEFAULT(size_t unpack32_impl(const uint8_t* in, int bit_width, bool msb, size_t num_values, uint32_t* out) {
+    return 0;
+})
+
+template <bool MSB>
+static void unpack(const uint8_t* in, size_t in_bytes, int bit_width, size_t num_values, uint64_t* out) {
+    DCHECK_LE(bit_width, 64);
+    if (bit_width == 0) {
+        std::fill(out, out + num_values, 0);
+        return;
+    }
+    size_t i = 0;
+    if (bit_width <= kMaxBitsInWord) {
+        i = unpack64_impl(in, bit_width, MSB, num_safe_values(in_bytes, bit_width, num_values, sizeof(uint64_t)),
+                          out);
+    }
+    unpack_scalar<MSB>(in, in_bytes, bit_width, i, num_values, out);
+}
+
+template <bool MSB>
+static void unpack(const uint8_t* in, size_t in_bytes, int bit_width, size_t num_values, uint32_t* out) {
+    DCHECK_LE(bit_width, 32);
+    if (bit_width == 0) {
+        std::fill(out, out + num_values, 0);
+        return;
+    }
+    size_t i = 0;
+    // The bit offsets of the values are kept in the 32-bit lanes.
+    if (bit_width <= kMaxBitsInHalfWord && in_bytes < (1UL << 28)) {
+        i = unpack32_impl(in, bit_width, MSB, num_safe_values(in_bytes, bit_width, num_values, sizeof(uint32_t)),
+                          out);
+    } else if (bit_width > kMaxBitsInHalfWord) {
+        // Unpack the wider values by the 64-bit lanes, and narrow them.
+        constexpr size_t kBatchSize = 256;
+        uint64_t buffer[kBatchSize];
+        size_t safe_values = num_safe_values(in_bytes, bit_width, num_values, sizeof(uint64_t));
+        while (i < safe_values) {
+            // Each batch starts at a byte boundary, as kBatchSize is a multiple of 8.
+            size_t n = unpack64_impl(in + i * bit_width / 8, bit_width, MSB, std::min(kBatchSize, safe_values - i),
+                                     buffer);
+            if (n == 0) {
+                break;
+            }
+            std::copy(buffer, buffer + n, out + i);
+            i += n;
+        }
+    }
+    unpack_scalar<MSB>(in, in_bytes, bit_width, i, num_values, out);
+}
+
+void BitUnpacking::unpack_lsb(const uint8_t* in, size_t in_bytes, int bit_width, size_t num_values, uint32_t* out) {
+    unpack<false>(in, in_bytes, bit_width, num_values, out);
+}
+
+void BitUnpacking::unpack_lsb(const uint8_t* in, size_t in_bytes, int bit_width, size_t num_values, uint64_t* out) {
+    unpack<false>(in, in_bytes, bit_width, num_values, out);
+}
+
+void BitUnpacking::unpack_msb(const uint8_t* in, size_t in_bytes, int bit_width, size_t num_values, uint32_t* out) {
+    unpack<true>(in, in_bytes, bit_width, num_values, out);
+}
+
+void BitUnpacking::unpack_msb(const uint8_t* in, size_t in_bytes, int bit_width, size_t num_values, uint64_t* out) {
+    unpack<true>(in, in_bytes, bit_width, num_values, out);
+}
+
+} // namespace starrocks
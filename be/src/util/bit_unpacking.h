@@ -0,0 +1,61 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "util/bit_packing.inline.h"
+
+namespace starrocks {
+
+// Unpack the bit-packed integers with the AVX-512/AVX2 kernels chosen at runtime, see simd/multi_version.h.
+//
+// Two bit orders are supported:
+//  - LSB first: the values are packed from the least significant bit of each byte, as BitWriter and BitPacking do,
+//    which is used by the RLE pages.
+//  - MSB first: the values are packed from the most significant bit of each byte, and the most significant bit of
+//    each value comes first, which is used by the frame of reference pages.
+//
+// Each value i is read by loading the 8 (or 4) bytes starting at byte (i * bit_width / 8) and shifting them, so
+// the SIMD kernels gather the words of 8 or 16 values at once. The values whose words would cross the end of the
+// input are read by the scalar code, so nothing after the |in_bytes| bytes of the input is read.
+class BitUnpacking {
+public:
+    // Unpack |num_values| values of |bit_width| bits from |in| into |out|. |in| must have at least
+    // ceil(num_values * bit_width / 8) bytes, and 0 <= bit_width <= the number of bits of the output type.
+    static void unpack_lsb(const uint8_t* in, size_t in_bytes, int bit_width, size_t num_values, uint32_t* out);
+    static void unpack_lsb(const uint8_t* in, size_t in_bytes, int bit_width, size_t num_values, uint64_t* out);
+
+    static void unpack_msb(const uint8_t* in, size_t in_bytes, int bit_width, size_t num_values, uint32_t* out);
+    static void unpack_msb(const uint8_t* in, size_t in_bytes, int bit_width, size_t num_values, uint64_t* out);
+
+    // Same as above, for any integer type of at most 64 bits. The 32-bit and 64-bit types are unpacked in place,
+    // and the other types fall back to BitPacking.
+    template <typename T>
+    static void unpack_lsb(const uint8_t* in, size_t in_bytes, int bit_width, size_t num_values, T* out) {
+        static_assert(sizeof(T) <= sizeof(uint64_t), "only the integers of at most 64 bits are supported");
+        if constexpr (std::is_integral_v<T> && sizeof(T) == sizeof(uint32_t)) {
+            unpack_lsb(in, in_bytes, bit_width, num_values, reinterpret_cast<uint32_t*>(out));
+        } else if constexpr (std::is_integral_v<T> && sizeof(T) == sizeof(uint64_t)) {
+            unpack_lsb(in, in_bytes, bit_width, num_values, reinterpret_cast<uint64_t*>(out));
+        } else {
+            BitPacking::UnpackValues(bit_width, in, in_bytes, num_values, out);
+        }
+    }
+};
+
+} // namespace starrocks
@@ -80,6 +80,15 @@ public:
     /// remain stable.
     static int get_current_core();
 
+    /// Returns the maximum number of NUMA nodes that will be online in the system.
+    static int get_max_num_numa_nodes() { return max_num_numa_nodes_; }
+
+    /// Returns the cores belonging to the NUMA node 'node', which is in range [0, get_max_num_numa_nodes()).
+    static const std::vector<int>& get_cores_of_numa_node(int node) {
+        DCHECK(node >= 0 && node < max_num_numa_nodes_);
+        return numa_node_to_cores_[node];
+    }
+
     static std::string debug_string();
 
 private:
@@ -0,0 +1,160 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#include "util/bit_stream_utils.inline.h"
+#include "util/bit_unpacking.h"
+#include "util/bit_util.h"
+#include "util/faststring.h"
+
+namespace starrocks {
+
+// Delta binary packed coding of the integers, in the spirit of the DELTA_BINARY_PACKED encoding of Parquet.
+//
+// The values are encoded by miniblocks of kMiniBlockSize values. The first value of each miniblock is stored as
+// its anchor, and the deltas between the consecutive values, minus the minimum delta of the miniblock, are
+// bit-packed with the bit width of the largest of them. So the nearly monotonic values, e.g. the event time and
+// the auto increment id, are encoded in a few bits each, and each miniblock is decoded on its own.
+//
+// All the arithmetic wraps around in 64 bits, so the deltas of any values of at most 64 bits are encoded.
+//
+// Miniblock header:
+//   anchor (int64) | min delta (int64) | bit width (uint8)
+// followed by the (count - 1) packed deltas elsewhere, least significant bit first.
+template <typename T>
+class DeltaBinaryPackedCoding {
+public:
+    static_assert(std::is_integral_v<T> && sizeof(T) <= sizeof(int64_t), "only the integers of at most 64 bits");
+
+    static constexpr uint32_t kMiniBlockSize = 128;
+    static constexpr size_t kMiniBlockHeaderSize = 2 * sizeof(int64_t) + sizeof(uint8_t);
+
+    struct MiniBlockHeader {
+        int64_t anchor = 0;
+        int64_t min_delta = 0;
+        uint8_t bit_width = 0;
+    };
+
+    static size_t packed_size(size_t count, int bit_width) {
+        return count == 0 ? 0 : BitUtil::Ceil((count - 1) * bit_width, 8);
+    }
+
+    static void put_header(const MiniBlockHeader& header, faststring* buf) {
+        buf->append(&header.anchor, sizeof(header.anchor));
+        buf->append(&header.min_delta, sizeof(header.min_delta));
+        buf->append(&header.bit_width, sizeof(header.bit_width));
+    }
+
+    static MiniBlockHeader get_header(const uint8_t* data) {
+        MiniBlockHeader header;
+        memcpy(&header.anchor, data, sizeof(header.anchor));
+        memcpy(&header.min_delta, data + sizeof(int64_t), sizeof(header.min_delta));
+        header.bit_width = data[2 * sizeof(int64_t)];
+        return header;
+    }
+
+    // Encode the |count| values, at most kMiniBlockSize, and append the packed deltas to |buf|.
+    static MiniBlockHeader encode_miniblock(const T* values, size_t count, faststring* buf) {
+        DCHECK(count > 0 && count <= kMiniBlockSize);
+        MiniBlockHeader header;
+        header.anchor = values[0];
+        if (count == 1) {
+            return header;
+        }
+        uint64_t deltas[kMiniBlockSize];
+        int64_t min_delta = std::numeric_limits<int64_t>::max();
+        for (size_t i = 1; i < count; i++) {
+            deltas[i - 1] = static_cast<uint64_t>(values[i]) - static_cast<uint64_t>(values[i - 1]);
+            min_delta = std::min(min_delta, static_cast<int64_t>(deltas[i - 1]));
+        }
+        uint64_t max_delta = 0;
+        for (size_t i = 0; i < count - 1; i++) {
+            deltas[i] -= static_cast<uint64_t>(min_delta);
+            max_delta |= deltas[i];
+        }
+        header.min_delta = min_delta;
+        header.bit_width = max_delta == 0 ? 0 : 64 - __builtin_clzll(max_delta);
+        if (header.bit_width > 0) {
+            size_t offset = buf->size();
+            BitWriter writer(buf);
+            for (size_t i = 0; i < count - 1; i++) {
+                writer.PutValue(deltas[i], header.bit_width);
+            }
+            writer.Flush();
+            DCHECK_EQ(packed_size(count, header.bit_width), buf->size() - offset);
+        }
+        return header;
+    }
+
+    // Decode the miniblock of |count| values, whose packed deltas are at |packed|, to |out|.
+    static void decode_miniblock(const MiniBlockHeader& header, const uint8_t* packed, size_t count,
+                                 T* __restrict__ out) {
+        DCHECK(count > 0 && count <= kMiniBlockSize);
+        uint64_t values[kMiniBlockSize];
+        values[0] = static_cast<uint64_t>(header.anchor);
+        if (header.bit_width == 0) {
+            std::fill(values + 1, values + count, static_cast<uint64_t>(header.min_delta));
+        } else {
+            BitUnpacking::unpack_lsb(packed, packed_size(count, header.bit_width), header.bit_width, count - 1,
+                                     values + 1);
+            // The loop is vectorized by the compiler.
+            const auto min_delta = static_cast<uint64_t>(header.min_delta);
+            for (size_t i = 1; i < count; i++) {
+                values[i] += min_delta;
+            }
+        }
+        prefix_sum(values, count);
+        for (size_t i = 0; i < count; i++) {
+            out[i] = static_cast<T>(values[i]);
+        }
+    }
+
+    // Replace each of the |count| values with the sum of it and all the values before it.
+    static void prefix_sum(uint64_t* values, size_t count) {
+        size_t i = 0;
+#ifdef __AVX2__
+        // Sum the 4 lanes of each vector in 2 steps of shifting by 1 and 2 lanes, and add the sum of the values
+        // before them, which is broadcast from the last lane of the previous vector.
+        __m256i carry = _mm256_setzero_si256();
+        const __m256i zero = _mm256_setzero_si256();
+        for (; i + 4 <= count; i += 4) {
+            __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + i));
+            __m256i shifted = _mm256_blend_epi32(_mm256_permute4x64_epi64(x, 0x90), zero, 0x03);
+            x = _mm256_add_epi64(x, shifted);
+            shifted = _mm256_blend_epi32(_mm256_permute4x64_epi64(x, 0x40), zero, 0x0F);
+            x = _mm256_add_epi64(_mm256_add_epi64(x, shifted), carry);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(values + i), x);
+            carry = _mm256_permute4x64_epi64(x, 0xFF);
+        }
+#endif
+        uint64_t sum = i == 0 ? 0 : values[i - 1];
+        for (; i < count; i++) {
+            sum += values[i];
+            values[i] = sum;
+        }
+    }
+};
+
+} // namespace starrocks
@@ -37,6 +37,7 @@
 #include <algorithm>
 #include <cstring>
 
+#include "util/bit_unpacking.h"
 #include "util/bit_util.h"
 #include "util/coding.h"
 
@@ -282,7 +283,6 @@ bool ForDecoder<T>::init() {
     return true;
 }
 
-// todo(kks): improve this method by SIMD instructions
 // The reverse of bit_pack method, get original integer data list from packed bits
 // param[in] input: the packed bits need to unpack
 // param[in] in_num: the integer number in packed bits
@@ -290,20 +290,34 @@ bool ForDecoder<T>::init() {
 // param[out] output: the original integer data list
 template <typename T>
 void ForDecoder<T>::bit_unpack(const uint8_t* input, uint8_t in_num, int bit_width, T* output) {
-    unsigned char in_mask = 0x80;
-    int bit_index = 0;
-    while (in_num > 0) {
-        *output = 0;
-        for (int i = 0; i < bit_width; i++) {
-            if (bit_index > 7) {
-                input++;
-                bit_index = 0;
+    size_t in_bytes = BitUtil::Ceil(in_num * bit_width, 8);
+    if constexpr (sizeof(T) == sizeof(uint64_t)) {
+        BitUnpacking::unpack_msb(input, in_bytes, bit_width, in_num, reinterpret_cast<uint64_t*>(output));
+    } else if constexpr (sizeof(T) == sizeof(uint32_t)) {
+        BitUnpacking::unpack_msb(input, in_bytes, bit_width, in_num, reinterpret_cast<uint32_t*>(output));
+    } else if constexpr (sizeof(T) < sizeof(uint32_t)) {
+        uint32_t values[std::numeric_limits<uint8_t>::max()];
+        BitUnpacking::unpack_msb(input, in_bytes, bit_width, in_num, values);
+        for (uint8_t i = 0; i < in_num; i++) {
+            output[i] = values[i];
+        }
+    } else {
+        // 128-bit integers
+        unsigned char in_mask = 0x80;
+        int bit_index = 0;
+        while (in_num > 0) {
+            *output = 0;
+            for (int i = 0; i < bit_width; i++) {
+                if (bit_index > 7) {
+                    input++;
+                    bit_index = 0;
+                }
+                *output |= ((T)((*input & (in_mask >> bit_index)) >> (7 - bit_index))) << (bit_width - i - 1);
+                bit_index++;
             }
-            *output |= ((T)((*input & (in_mask >> bit_index)) >> (7 - bit_index))) << (bit_width - i - 1);
-            bit_index++;
+            output++;
+            in_num--;
         }
-        output++;
-        in_num--;
     }
 }
 
@@ -337,18 +351,17 @@ void ForDecoder<T>::decode_current_frame(T* output) {
         bit_unpack(_buffer + delta_offset, current_frame_size, bit_width, output);
     } else {
         bool is_ascending = _storage_formats[_current_decoded_frame] == 1;
-        std::vector<T> delta_values(current_frame_size);
-        bit_unpack(_buffer + delta_offset, current_frame_size, bit_width, delta_values.data());
+        // unpack the deltas into the output, and restore the values in place
+        bit_unpack(_buffer + delta_offset, current_frame_size, bit_width, output);
         if (is_ascending) {
             T pre_value = min;
             for (uint8_t i = 0; i < current_frame_size; i++) {
-                T value = delta_values[i] + pre_value;
-                output[i] = value;
-                pre_value = value;
+                pre_value = output[i] + pre_value;
+                output[i] = pre_value;
             }
         } else {
             for (uint8_t i = 0; i < current_frame_size; i++) {
-                output[i] = delta_values[i] + min;
+                output[i] = output[i] + min;
             }
         }
     }
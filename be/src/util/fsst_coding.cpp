@@ -0,0 +1,243 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "util/fsst_coding.h"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace starrocks {
+
+// The symbol table is trained on a sample of at most this many bytes.
+static constexpr size_t kSampleBytes = 16 * 1024;
+// Each round compresses the sample by the current table, and picks the symbols and the concatenations of the
+// adjacent symbols with the highest gains as the new table, so the symbols grow longer round by round.
+static constexpr int kTrainRounds = 5;
+
+static inline uint64_t load_word(const uint8_t* p, size_t remaining) {
+    uint64_t word = 0;
+    memcpy(&word, p, std::min(remaining, FsstSymbolTable::kMaxSymbolLength));
+    return word;
+}
+
+static inline uint64_t symbol_mask(size_t length) {
+    return length >= FsstSymbolTable::kMaxSymbolLength ? ~0ULL : (1ULL << (length * 8)) - 1;
+}
+
+void FsstSymbolTable::clear() {
+    _num_symbols = 0;
+    memset(_symbols, 0, sizeof(_symbols));
+    memset(_lengths, 0, sizeof(_lengths));
+    _build_buckets();
+}
+
+void FsstSymbolTable::_build_buckets() {
+    uint16_t counts[256] = {0};
+    for (size_t code = 0; code < _num_symbols; code++) {
+        counts[_symbols[code] & 0xFF]++;
+    }
+    _bucket_begin[0] = 0;
+    for (int b = 0; b < 256; b++) {
+        _bucket_begin[b + 1] = _bucket_begin[b] + counts[b];
+    }
+    uint16_t next[256];
+    memcpy(next, _bucket_begin, sizeof(next));
+    for (size_t code = 0; code < _num_symbols; code++) {
+        _bucket_codes[next[_symbols[code] & 0xFF]++] = code;
+    }
+    for (int b = 0; b < 256; b++) {
+        std::sort(_bucket_codes + _bucket_begin[b], _bucket_codes + _bucket_begin[b + 1],
+                  [this](uint8_t lhs, uint8_t rhs) {
+                      return _lengths[lhs] != _lengths[rhs] ? _lengths[lhs] > _lengths[rhs] : lhs < rhs;
+                  });
+    }
+}
+
+// Return the code of the longest symbol which |p| starts with, or -1 if there is none.
+static inline int find_symbol(const uint8_t* p, size_t remaining, const uint64_t* symbols, const uint8_t* lengths,
+                              const uint16_t* bucket_begin, const uint8_t* bucket_codes) {
+    uint64_t word = load_word(p, remaining);
+    for (uint16_t i = bucket_begin[*p]; i < bucket_begin[*p + 1]; i++) {
+        uint8_t code = bucket_codes[i];
+        size_t length = lengths[code];
+        if (length <= remaining && ((word ^ symbols[code]) & symbol_mask(length)) == 0) {
+            return code;
+        }
+    }
+    return -1;
+}
+
+void FsstSymbolTable::train(const Slice* strings, size_t count) {
+    clear();
+    size_t total_bytes = 0;
+    for (size_t i = 0; i < count; i++) {
+        total_bytes += strings[i].size;
+    }
+    if (total_bytes == 0) {
+        return;
+    }
+    // Sample the strings evenly across the input.
+    std::vector<Slice> sample;
+    size_t stride = (total_bytes + kSampleBytes - 1) / kSampleBytes;
+    size_t sample_bytes = 0;
+    for (size_t i = 0; i < count && sample_bytes < kSampleBytes; i += stride) {
+        Slice s(strings[i].data, std::min(strings[i].size, kSampleBytes - sample_bytes));
+        sample.push_back(s);
+        sample_bytes += s.size;
+    }
+
+    std::unordered_map<std::string, size_t> gains;
+    std::vector<std::pair<std::string, size_t>> candidates;
+    for (int round = 0; round < kTrainRounds; round++) {
+        gains.clear();
+        for (const Slice& s : sample) {
+            const auto* p = reinterpret_cast<const uint8_t*>(s.data);
+            const uint8_t* end = p + s.size;
+            const uint8_t* prev = nullptr;
+            while (p < end) {
+                int code = find_symbol(p, end - p, _symbols, _lengths, _bucket_begin, _bucket_codes);
+                size_t length = code >= 0 ? _lengths[code] : 1;
+                gains[std::string(reinterpret_cast<const char*>(p), length)] += length;
+                // the previous symbol is adjacent to the current one.
+                if (prev != nullptr && static_cast<size_t>(p + length - prev) <= kMaxSymbolLength) {
+                    gains[std::string(reinterpret_cast<const char*>(prev), p + length - prev)] += p + length - prev;
+                }
+                prev = p;
+                p += length;
+            }
+        }
+
+        candidates.assign(gains.begin(), gains.end());
+        size_t num_symbols = std::min(kMaxSymbols, candidates.size());
+        // Break the ties by the bytes, so that the table is the same for the same input.
+        std::partial_sort(candidates.begin(), candidates.begin() + num_symbols, candidates.end(),
+                          [](const auto& lhs, const auto& rhs) {
+                              return lhs.second != rhs.second ? lhs.second > rhs.second : lhs.first < rhs.first;
+                          });
+        _num_symbols = num_symbols;
+        memset(_symbols, 0, sizeof(_symbols));
+        memset(_lengths, 0, sizeof(_lengths));
+        for (size_t code = 0; code < num_symbols; code++) {
+            const std::string& symbol = candidates[code].first;
+            memcpy(&_symbols[code], symbol.data(), symbol.size());
+            _lengths[code] = symbol.size();
+        }
+        _build_buckets();
+    }
+}
+
+void FsstSymbolTable::serialize(faststring* dst) const {
+    dst->push_back(static_cast<char>(_num_symbols));
+    dst->append(_lengths, _num_symbols);
+    for (size_t code = 0; code < _num_symbols; code++) {
+        dst->append(&_symbols[code], _lengths[code]);
+    }
+}
+
+size_t FsstSymbolTable::deserialize(const uint8_t* data, size_t size) {
+    clear();
+    if (size < 1 || size < 1 + data[0]) {
+        return 0;
+    }
+    size_t num_symbols = data[0];
+    size_t offset = 1 + num_symbols;
+    for (size_t code = 0; code < num_symbols; code++) {
+        size_t length = data[1 + code];
+        if (length == 0 || length > kMaxSymbolLength || offset + length > size) {
+            clear();
+            return 0;
+        }
+        memcpy(&_symbols[code], data + offset, length);
+        _lengths[code] = length;
+        offset += length;
+    }
+    _num_symbols = num_symbols;
+    _build_buckets();
+    return offset;
+}
+
+void FsstSymbolTable::compress(const Slice& str, faststring* dst) const {
+    if (_num_symbols == 0) {
+        dst->append(str.data, str.size);
+        return;
+    }
+    const auto* p = reinterpret_cast<const uint8_t*>(str.data);
+    const uint8_t* end = p + str.size;
+    while (p < end) {
+        int code = find_symbol(p, end - p, _symbols, _lengths, _bucket_begin, _bucket_codes);
+        if (code >= 0) {
+            dst->push_back(static_cast<char>(code));
+            p += _lengths[code];
+        } else {
+            dst->push_back(static_cast<char>(kEscapeCode));
+            dst->push_back(static_cast<char>(*p++));
+        }
+    }
+}
+
+size_t FsstSymbolTable::decompress(const Slice& codes, uint8_t* dst) const {
+    if (_num_symbols == 0) {
+        memcpy(dst, codes.data, codes.size);
+        return codes.size;
+    }
+    const auto* p = reinterpret_cast<const uint8_t*>(codes.data);
+    const uint8_t* end = p + codes.size;
+    uint8_t* out = dst;
+    while (p < end) {
+        uint8_t code = *p++;
+        if (code == kEscapeCode) {
+            if (p == end) {
+                break;
+            }
+            *out++ = *p++;
+        } else {
+            // The unknown codes of a broken string are decoded as the empty symbols.
+            memcpy(out, &_symbols[code], sizeof(uint64_t));
+            out += _lengths[code];
+        }
+    }
+    return out - dst;
+}
+
+bool FsstSymbolTable::starts_with(const Slice& codes, const Slice& prefix) const {
+    if (_num_symbols == 0) {
+        return codes.starts_with(prefix);
+    }
+    const auto* p = reinterpret_cast<const uint8_t*>(codes.data);
+    const uint8_t* end = p + codes.size;
+    const auto* expected = reinterpret_cast<const uint8_t*>(prefix.data);
+    size_t matched = 0;
+    while (matched < prefix.size && p < end) {
+        uint8_t code = *p++;
+        if (code == kEscapeCode) {
+            if (p == end || *p++ != expected[matched]) {
+                return false;
+            }
+            matched++;
+        } else {
+            size_t length = std::min<size_t>(_lengths[code], prefix.size - matched);
+            if (memcmp(&_symbols[code], expected + matched, length) != 0) {
+                return false;
+            }
+            matched += length;
+        }
+    }
+    return matched == prefix.size;
+}
+
+} // namespace starrocks
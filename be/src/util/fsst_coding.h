@@ -0,0 +1,87 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "util/faststring.h"
+#include "util/slice.h"
+
+namespace starrocks {
+
+// FSST (Fast Static Symbol Table) compresses the strings by replacing the frequent substrings of up to 8 bytes,
+// the symbols, by 1-byte codes. A byte not covered by any symbol is escaped, i.e. written as kEscapeCode followed
+// by the byte itself. As the symbol table is shared by the strings, each string can be decompressed alone.
+//
+// The compression is deterministic: the longest symbol matching the remaining bytes is always chosen. So two
+// strings are equal iff they are compressed into the same codes by the same table, and the equality predicates
+// can be evaluated on the codes without decompression.
+//
+// A table without any symbol keeps the strings as they are, which is used if the strings are not compressible.
+class FsstSymbolTable {
+public:
+    static constexpr size_t kMaxSymbolLength = 8;
+    static constexpr size_t kMaxSymbols = 255;
+    static constexpr uint8_t kEscapeCode = 255;
+
+    FsstSymbolTable() { clear(); }
+
+    // Remove all the symbols, i.e. the strings will be stored as they are.
+    void clear();
+
+    // Build the symbol table from the strings, which are sampled if they are too many.
+    void train(const Slice* strings, size_t count);
+
+    size_t num_symbols() const { return _num_symbols; }
+
+    // Layout: number of symbols (uint8) | the lengths of the symbols (uint8 each) | the bytes of the symbols
+    void serialize(faststring* dst) const;
+
+    // Return the number of bytes read, or 0 if |data| is not a valid symbol table.
+    size_t deserialize(const uint8_t* data, size_t size);
+
+    // Append the codes of |str| to |dst|.
+    void compress(const Slice& str, faststring* dst) const;
+
+    // The maximum size of the string decompressed from |codes_size| bytes of codes, and the minimum size of the
+    // buffer passed to decompress(), which writes 8 bytes for each symbol.
+    size_t decompress_bound(size_t codes_size) const {
+        return _num_symbols == 0 ? codes_size : codes_size * kMaxSymbolLength;
+    }
+
+    // Decompress |codes| into |dst|, which has at least decompress_bound(codes.size) bytes, and return the size of
+    // the string.
+    size_t decompress(const Slice& codes, uint8_t* dst) const;
+
+    // Return true if the string compressed into |codes| starts with |prefix|. Only the symbols covering the prefix
+    // are decoded, and it returns on the first mismatch.
+    bool starts_with(const Slice& codes, const Slice& prefix) const;
+
+private:
+    // Build the lookup buckets of compress() from the symbols.
+    void _build_buckets();
+
+    size_t _num_symbols = 0;
+    // The bytes of the symbols padded with zeros, so that a symbol is copied by a single 8-byte store.
+    uint64_t _symbols[kMaxSymbols];
+    uint8_t _lengths[kMaxSymbols];
+    // The codes of the symbols starting with byte b are _bucket_codes[_bucket_begin[b], _bucket_begin[b + 1]),
+    // the longer symbols first.
+    uint16_t _bucket_begin[257];
+    uint8_t _bucket_codes[kMaxSymbols];
+};
+
+} // namespace starrocks
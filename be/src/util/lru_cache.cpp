@@ -6,6 +6,7 @@
 
 #include <rapidjson/document.h>
 
+#include <algorithm>
 #include <cstdio>
 #include <cstdlib>
 #include <sstream>
@@ -97,6 +98,22 @@ LRUHandle* HandleTable::remove(const CacheKey& key, uint32_t hash) {
     return result;
 }
 
+void HandleTable::remove_if(const std::function<bool(const LRUHandle*)>& pred, std::vector<LRUHandle*>* removed) {
+    for (uint32_t i = 0; i < _length; i++) {
+        LRUHandle** ptr = &_list[i];
+        while (*ptr != nullptr) {
+            LRUHandle* h = *ptr;
+            if (pred(h)) {
+                *ptr = h->next_hash;
+                --_elems;
+                removed->push_back(h);
+            } else {
+                ptr = &h->next_hash;
+            }
+        }
+    }
+}
+
 LRUHandle** HandleTable::_find_pointer(const CacheKey& key, uint32_t hash) {
     LRUHandle** ptr = &_list[hash & (_length - 1)];
 
@@ -150,10 +167,56 @@ bool HandleTable::_resize() {
     return true;
 }
 
+void FrequencySketch::resize(size_t num_counters) {
+    _row_size = kMinCountersPerRow;
+    while (_row_size < num_counters) {
+        _row_size *= 2;
+    }
+    _counters.assign(_row_size * kDepth, 0);
+    _num_increments = 0;
+    _sample_size = _row_size * 10;
+}
+
+size_t FrequencySketch::_index_of(uint32_t hash, int row) const {
+    static constexpr uint64_t kSeeds[kDepth] = {0xc3a5c85c97cb3127ULL, 0xb492b66fbe98f273ULL, 0x9ae16a3b2f90404fULL,
+                                                0xcbf29ce484222325ULL};
+    uint64_t h = (static_cast<uint64_t>(hash) + kSeeds[row]) * 0x9e3779b97f4a7c15ULL;
+    return row * _row_size + ((h >> 32) & (_row_size - 1));
+}
+
+void FrequencySketch::increment(uint32_t hash) {
+    for (int row = 0; row < kDepth; row++) {
+        uint8_t& counter = _counters[_index_of(hash, row)];
+        counter += counter < kMaxCount;
+    }
+    if (++_num_increments >= _sample_size) {
+        _halve();
+    }
+}
+
+uint32_t FrequencySketch::estimate(uint32_t hash) const {
+    uint8_t count = kMaxCount;
+    for (int row = 0; row < kDepth; row++) {
+        count = std::min(count, _counters[_index_of(hash, row)]);
+    }
+    return count;
+}
+
+void FrequencySketch::_halve() {
+    for (auto& counter : _counters) {
+        counter >>= 1;
+    }
+    _num_increments /= 2;
+}
+
 LRUCache::LRUCache() {
     // Make empty circular linked list
     _lru.next = &_lru;
     _lru.prev = &_lru;
+    _small.next = &_small;
+    _small.prev = &_small;
+    _main.next = &_main;
+    _main.prev = &_main;
 }
 
 LRUCache::~LRUCache() noexcept {
@@ -185,7 +248,7 @@ void LRUCache::set_capacity(size_t capacity) {
     {
         std::lock_guard l(_mutex);
         _capacity = capacity;
-        _evict_from_lru(0, &last_ref_list);
+        _evict(0, &last_ref_list);
     }
 
     for (auto entry : last_ref_list) {
@@ -197,6 +260,14 @@ void LRUCache::set_charge_mode(ChargeMode charge_mode) {
     _charge_mode = charge_mode;
 }
 
+void LRUCache::set_eviction_policy(CacheEvictionPolicy eviction_policy) {
+    _eviction_policy = eviction_policy;
+}
+
+void LRUCache::set_tinylfu_admission(bool tinylfu_admission) {
+    _tinylfu_admission = tinylfu_admission;
+}
+
 uint64_t LRUCache::get_lookup_count() const {
     std::lock_guard l(_mutex);
     return _lookup_count;
@@ -207,6 +278,16 @@ uint64_t LRUCache::get_hit_count() const {
     return _hit_count;
 }
 
+uint64_t LRUCache::get_admission_reject_count() const {
+    std::lock_guard l(_mutex);
+    return _admission_reject_count;
+}
+
+uint64_t LRUCache::get_ghost_hit_count() const {
+    std::lock_guard l(_mutex);
+    return _ghost_hit_count;
+}
+
 size_t LRUCache::get_usage() const {
     std::lock_guard l(_mutex);
     return _usage;
@@ -220,11 +301,17 @@ size_t LRUCache::get_capacity() const {
 Cache::Handle* LRUCache::lookup(const CacheKey& key, uint32_t hash) {
     std::lock_guard l(_mutex);
     ++_lookup_count;
+    if (_tinylfu_admission) {
+        _sketch.increment(hash);
+    }
     LRUHandle* e = _table.lookup(key, hash);
     if (e != nullptr) {
         // we get it from _table, so in_cache must be true
         DCHECK(e->in_cache);
-        if (e->refs == 1) {
+        if (_is_s3fifo()) {
+            // the entry stays in its queue
+            e->freq += e->freq < kMaxFrequency;
+        } else if (e->refs == 1) {
             // only in LRU free list, remove it from list
             _lru_remove(e);
         }
@@ -249,12 +336,15 @@ void LRUCache::release(Cache::Handle* handle) {
             // only exists in cache
             if (_usage > _capacity) {
                 // take this opportunity and remove the item
+                if (_is_s3fifo()) {
+                    _queue_remove(e);
+                }
                 _table.remove(e->key(), e->hash);
                 e->in_cache = false;
                 _unref(e);
                 _usage -= e->charge;
                 last_ref = true;
-            } else {
+            } else if (!_is_s3fifo()) {
                 // put it to LRU free list
                 _lru_append(&_lru, e);
             }
@@ -267,6 +357,17 @@ void LRUCache::release(Cache::Handle* handle) {
     }
 }
 
+void LRUCache::_evict(size_t charge, std::vector<LRUHandle*>* deleted) {
+    if (_is_s3fifo()) {
+        // 1. evict normal cache entries
+        _evict_from_queues(charge, false, deleted);
+        // 2. evict durable cache entries if need
+        _evict_from_queues(charge, true, deleted);
+    } else {
+        _evict_from_lru(charge, deleted);
+    }
+}
+
 void LRUCache::_evict_from_lru(size_t charge, std::vector<LRUHandle*>* deleted) {
     LRUHandle* cur = &_lru;
     // 1. evict normal cache entries
@@ -298,6 +399,116 @@ void LRUCache::_evict_one_entry(LRUHandle* e) {
     _usage -= e->charge;
 }
 
+void LRUCache::_queue_append(LRUHandle* e) {
+    if (e->in_main_queue) {
+        _lru_append(&_main, e);
+    } else {
+        _lru_append(&_small, e);
+        _small_usage += e->charge;
+    }
+}
+
+void LRUCache::_queue_remove(LRUHandle* e) {
+    if (!e->in_main_queue) {
+        _small_usage -= e->charge;
+    }
+    _lru_remove(e);
+}
+
+void LRUCache::_evict_queued_entry(LRUHandle* e) {
+    DCHECK(e->in_cache);
+    DCHECK(e->refs == 1);
+    _table.remove(e->key(), e->hash);
+    e->in_cache = false;
+    _unref(e);
+    _usage -= e->charge;
+}
+
+// Evict from the small queue when it takes more than kSmallQueueRatio of the capacity, and from the main queue
+// otherwise. The oldest entry of the small queue is moved to the main queue if it has been accessed since insertion,
+// and the oldest entry of the main queue is reinserted with a decremented frequency if its frequency is not zero.
+// The entries in use, and the durable ones unless |evict_durable|, are kept in their queues.
+void LRUCache::_evict_from_queues(size_t charge, bool evict_durable, std::vector<LRUHandle*>* deleted) {
+    // An entry is moved at most kMaxFrequency + 1 times before being evicted unless it's kept, so the loop ends even
+    // if all the entries are kept.
+    size_t max_moves = static_cast<size_t>(_table.size()) * (kMaxFrequency + 2);
+    while (_usage + charge > _capacity && max_moves-- > 0) {
+        const bool small_empty = _small.next == &_small;
+        const bool main_empty = _main.next == &_main;
+        if (small_empty && main_empty) {
+            break;
+        }
+        const bool from_small = !small_empty && (main_empty || _small_usage > _capacity * kSmallQueueRatio);
+        LRUHandle* e = from_small ? _small.next : _main.next;
+        _queue_remove(e);
+        if (e->refs > 1 || (!evict_durable && e->priority == CachePriority::DURABLE)) {
+            _queue_append(e);
+        } else if (e->freq > 0) {
+            if (from_small) {
+                e->in_main_queue = true;
+            } else {
+                e->freq--;
+            }
+            _queue_append(e);
+        } else {
+            _evict_queued_entry(e);
+            if (from_small) {
+                _ghost_insert(e->hash);
+            }
+            deleted->push_back(e);
+        }
+    }
+}
+
+void LRUCache::_ghost_insert(uint32_t hash) {
+    if (_ghost_hashes.size() < _table.size()) {
+        size_t size = 16;
+        while (size < _table.size() * 2) {
+            size *= 2;
+        }
+        _ghost_hashes.assign(size, 0);
+    }
+    if (!_ghost_hashes.empty()) {
+        _ghost_hashes[hash & (_ghost_hashes.size() - 1)] = hash;
+    }
+}
+
+bool LRUCache::_ghost_remove(uint32_t hash) {
+    if (_ghost_hashes.empty()) {
+        return false;
+    }
+    uint32_t& slot = _ghost_hashes[hash & (_ghost_hashes.size() - 1)];
+    if (slot != hash || hash == 0) {
+        return false;
+    }
+    slot = 0;
+    return true;
+}
+
+LRUHandle* LRUCache::_next_victim() {
+    if (!_is_s3fifo()) {
+        return _lru.next != &_lru ? _lru.next : nullptr;
+    }
+    const bool small_empty = _small.next == &_small;
+    if (!small_empty && (_main.next == &_main || _small_usage > _capacity * kSmallQueueRatio)) {
+        return _small.next;
+    }
+    return _main.next != &_main ? _main.next : nullptr;
+}
+
+// TinyLFU rejects the new entry if it needs to evict an entry looked up at least as frequently, unless the key is
+// already in the cache.
+bool LRUCache::_admit(const CacheKey& key, uint32_t hash, CachePriority priority, size_t charge) {
+    if (!_tinylfu_admission || priority == CachePriority::DURABLE || _usage + charge <= _capacity) {
+        return true;
+    }
+    LRUHandle* victim = _next_victim();
+    if (victim == nullptr || _table.lookup(key, hash) != nullptr) {
+        return true;
+    }
+    return _sketch.estimate(hash) > _sketch.estimate(victim->hash);
+}
+
 Cache::Handle* LRUCache::insert(const CacheKey& key, uint32_t hash, void* value, size_t charge,
                                 void (*deleter)(const CacheKey& key, void* value), CachePriority priority,
                                 size_t value_size) {
@@ -312,27 +523,55 @@ Cache::Handle* LRUCache::insert(const CacheKey& key, uint32_t hash, void* value,
     e->in_cache = true;
     e->priority = priority;
     e->value_size = value_size;
+    e->freq = priority == CachePriority::DURABLE ? kMaxFrequency : 0;
+    e->in_main_queue = priority == CachePriority::DURABLE;
     memcpy(e->key_data, key.data(), key.size());
     std::vector<LRUHandle*> last_ref_list;
     {
         std::lock_guard l(_mutex);
 
-        // Free the space following strict LRU policy until enough space
-        // is freed or the lru list is empty
-        _evict_from_lru(charge, &last_ref_list);
+        if (!_admit(key, hash, priority, charge)) {
+            // The rejected entry is only referenced by the returned handle, and it's charged until released, as the
+            // erased entries in use.
+            ++_admission_reject_count;
+            e->in_cache = false;
+            e->refs = 1;
+            _usage += charge;
+            return reinterpret_cast<Cache::Handle*>(e);
+        }
+        if (_tinylfu_admission && _table.size() * 2 > _sketch.num_counters_per_row()) {
+            // the frequencies are lost, which only happens when the cache is warming up.
+            _sketch.resize(_table.size() * 2);
+        }
+
+        // Free the space following the eviction policy until enough space
+        // is freed or no entry can be evicted
+        _evict(charge, &last_ref_list);
 
         // insert into the cache
         // note that the cache might get larger than its capacity if not enough
         // space was freed
         auto old = _table.insert(e);
         _usage += charge;
+        if (_is_s3fifo()) {
+            if (!e->in_main_queue && _ghost_remove(hash)) {
+                ++_ghost_hit_count;
+                e->in_main_queue = true;
+            }
+            _queue_append(e);
+        }
         if (old != nullptr) {
             old->in_cache = false;
+            if (_is_s3fifo()) {
+                _queue_remove(old);
+            }
             if (_unref(old)) {
                 _usage -= old->charge;
-                // old is on LRU because it's in cache and its reference count
-                // was just 1 (Unref returned 0)
-                _lru_remove(old);
+                if (!_is_s3fifo()) {
+                    // old is on LRU because it's in cache and its reference count
+                    // was just 1 (Unref returned 0)
+                    _lru_remove(old);
+                }
                 last_ref_list.push_back(old);
             }
         }
@@ -354,10 +593,13 @@ void LRUCache::erase(const CacheKey& key, uint32_t hash) {
         std::lock_guard l(_mutex);
         e = _table.remove(key, hash);
         if (e != nullptr) {
+            if (_is_s3fifo()) {
+                _queue_remove(e);
+            }
             last_ref = _unref(e);
             if (last_ref) {
                 _usage -= e->charge;
-                if (e->in_cache) {
+                if (e->in_cache && !_is_s3fifo()) {
                     // locate in free list
                     _lru_remove(e);
                 }
@@ -371,10 +613,48 @@ void LRUCache::erase(const CacheKey& key, uint32_t hash) {
     }
 }
 
+size_t LRUCache::erase_if(const std::function<bool(const CacheKey& key)>& pred) {
+    std::vector<LRUHandle*> removed;
+    std::vector<LRUHandle*> last_ref_list;
+    {
+        std::lock_guard l(_mutex);
+        _table.remove_if([&pred](const LRUHandle* e) { return pred(e->key()); }, &removed);
+        // the same as erase().
+        for (LRUHandle* e : removed) {
+            if (_is_s3fifo()) {
+                _queue_remove(e);
+            }
+            if (_unref(e)) {
+                _usage -= e->charge;
+                if (e->in_cache && !_is_s3fifo()) {
+                    _lru_remove(e);
+                }
+                last_ref_list.push_back(e);
+            }
+            e->in_cache = false;
+        }
+    }
+    for (auto entry : last_ref_list) {
+        entry->free();
+    }
+    return removed.size();
+}
+
 int LRUCache::prune() {
     std::vector<LRUHandle*> last_ref_list;
     {
         std::lock_guard l(_mutex);
+        for (LRUHandle* queue : {&_small, &_main}) {
+            for (LRUHandle* e = queue->next; e != queue;) {
+                LRUHandle* next = e->next;
+                if (e->refs == 1) {
+                    _queue_remove(e);
+                    _evict_queued_entry(e);
+                    last_ref_list.push_back(e);
+                }
+                e = next;
+            }
+        }
         while (_lru.next != &_lru) {
             LRUHandle* old = _lru.next;
             DCHECK(old->in_cache);
@@ -410,6 +690,17 @@ ShardedLRUCache::ShardedLRUCache(size_t capacity, ChargeMode charge_mode)
     }
 }
 
+ShardedLRUCache::ShardedLRUCache(const CacheOptions& options)
+        : _last_id(0), _capacity(options.capacity), _charge_mode(options.charge_mode) {
+    const size_t per_shard = (_capacity + (kNumShards - 1)) / kNumShards;
+    for (auto& _shard : _shards) {
+        _shard.set_eviction_policy(options.eviction_policy);
+        _shard.set_tinylfu_admission(options.tinylfu_admission);
+        _shard.set_capacity(per_shard);
+        _shard.set_charge_mode(_charge_mode);
+    }
+}
+
 void ShardedLRUCache::_set_capacity(size_t capacity) {
     const size_t per_shard = (capacity + (kNumShards - 1)) / kNumShards;
     for (auto& _shard : _shards) {
@@ -456,6 +747,14 @@ void ShardedLRUCache::erase(const CacheKey& key) {
     _shards[_shard(hash)].erase(key, hash);
 }
 
+size_t ShardedLRUCache::erase_if(const std::function<bool(const CacheKey& key)>& pred) {
+    size_t num_erased = 0;
+    for (auto& shard : _shards) {
+        num_erased += shard.erase_if(pred);
+    }
+    return num_erased;
+}
+
 void* ShardedLRUCache::value(Handle* handle) {
     return reinterpret_cast<LRUHandle*>(handle)->value;
 }
@@ -502,6 +801,14 @@ size_t ShardedLRUCache::get_hit_count() const {
     return _get_stat(&LRUCache::get_hit_count);
 }
 
+size_t ShardedLRUCache::get_admission_reject_count() const {
+    return _get_stat(&LRUCache::get_admission_reject_count);
+}
+
+size_t ShardedLRUCache::get_ghost_hit_count() const {
+    return _get_stat(&LRUCache::get_ghost_hit_count);
+}
+
 void ShardedLRUCache::get_cache_status(rapidjson::Document* document) {
     size_t shard_count = sizeof(_shards) / sizeof(LRUCache);
 
@@ -532,6 +839,10 @@ void ShardedLRUCache::get_cache_status(rapidjson::Document* document) {
         }
 
         shard_info.AddMember("hit_ratio", hit_ratio, document->GetAllocator());
+        shard_info.AddMember("admission_reject_count",
+                             static_cast<double>(_shards[i].get_admission_reject_count()), document->GetAllocator());
+        shard_info.AddMember("ghost_hit_count", static_cast<double>(_shards[i].get_ghost_hit_count()),
+                             document->GetAllocator());
         document->PushBack(shard_info, document->GetAllocator());
     }
 }
@@ -540,4 +851,29 @@ Cache* new_lru_cache(size_t capacity, ChargeMode charge_mode) {
     return new ShardedLRUCache(capacity, charge_mode);
 }
 
+Cache* new_cache(const CacheOptions& options) {
+    return new ShardedLRUCache(options);
+}
+
+bool parse_cache_eviction_policy(const std::string& name, CacheEvictionPolicy* policy) {
+    if (name == "lru") {
+        *policy = CacheEvictionPolicy::LRU;
+    } else if (name == "s3fifo") {
+        *policy = CacheEvictionPolicy::S3FIFO;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+const char* cache_eviction_policy_name(CacheEvictionPolicy policy) {
+    switch (policy) {
+    case CacheEvictionPolicy::LRU:
+        return "lru";
+    case CacheEvictionPolicy::S3FIFO:
+        return "s3fifo";
+    }
+    return "unknown";
+}
+
 } // namespace starrocks
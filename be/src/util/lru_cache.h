@@ -8,6 +8,7 @@
 
 #include <cstdint>
 #include <cstring>
+#include <functional>
 #include <mutex>
 #include <string>
 #include <string_view>
@@ -27,10 +28,37 @@ enum class ChargeMode {
     MEMSIZE = 1
 };
 
+enum class CacheEvictionPolicy {
+    // Evict the least recently used entry.
+    LRU = 0,
+    // S3-FIFO: the new entries are inserted into a small FIFO queue, and only the ones accessed again before leaving
+    // it are moved to the main FIFO queue, so that the entries accessed only once, e.g. by a big scan, are evicted
+    // quickly without flushing the working set. The keys evicted from the small queue are remembered by a ghost
+    // queue, and are inserted into the main queue directly when inserted again.
+    S3FIFO = 1
+};
+
+struct CacheOptions {
+    size_t capacity = 0;
+    ChargeMode charge_mode = ChargeMode::VALUESIZE;
+    CacheEvictionPolicy eviction_policy = CacheEvictionPolicy::LRU;
+    // Whether to filter the new entries by TinyLFU, which admits a new entry only if it has been looked up more
+    // frequently than the entry to evict for it, as estimated by a frequency sketch of the recent lookups.
+    bool tinylfu_admission = false;
+};
+
 // Create a new cache with a fixed size capacity.  This implementation
 // of Cache uses a least-recently-used eviction policy.
 extern Cache* new_lru_cache(size_t capacity, ChargeMode charge_mode = ChargeMode::VALUESIZE);
 
+// Create a new cache with the eviction and admission policies of |options|.
+extern Cache* new_cache(const CacheOptions& options);
+
+// Parse the name of the eviction policy, i.e. "lru" or "s3fifo", and return false if it's unknown.
+extern bool parse_cache_eviction_policy(const std::string& name, CacheEvictionPolicy* policy);
+
+extern const char* cache_eviction_policy_name(CacheEvictionPolicy policy);
+
 class CacheKey {
 public:
     CacheKey() = default;
@@ -170,6 +198,10 @@ public:
     // to it have been released.
     virtual void erase(const CacheKey& key) = 0;
 
+    // Erase all the entries whose keys satisfy |pred|, which visits every entry of the cache. Like erase(), the
+    // entries in use are kept around until their handles are released. Return the number of the entries erased.
+    virtual size_t erase_if(const std::function<bool(const CacheKey& key)>& pred) = 0;
+
     // Return a new numeric id.  May be used by multiple clients who are
     // sharing the same cache to partition the key space.  Typically the
     // client will allocate a new id at startup and prepend the id to
@@ -190,6 +222,10 @@ public:
     virtual size_t get_memory_usage() const = 0;
     virtual size_t get_lookup_count() const = 0;
     virtual size_t get_hit_count() const = 0;
+    // The number of the new entries rejected by the admission filter.
+    virtual size_t get_admission_reject_count() const = 0;
+    // The number of the new entries inserted into the main queue of S3-FIFO directly by the ghost queue.
+    virtual size_t get_ghost_hit_count() const = 0;
 
     //  Decrease or increase cache capacity.
     virtual bool adjust_capacity(int64_t delta, size_t min_capacity = 0) = 0;
@@ -214,6 +250,10 @@ typedef struct LRUHandle {
     uint32_t hash; // Hash of key(); used for fast sharding and comparisons
     CachePriority priority = CachePriority::NORMAL;
     size_t value_size;
+    // Used by S3-FIFO only: the number of accesses capped by LRUCache::kMaxFrequency, which is decremented each time
+    // the entry is reinserted into the main queue, and whether the entry is in the main queue or the small queue.
+    uint8_t freq;
+    bool in_main_queue;
     char key_data[1]; // Beginning of key
 
     CacheKey key() const {
@@ -251,6 +291,11 @@ public:
 
     LRUHandle* remove(const CacheKey& key, uint32_t hash);
 
+    // Remove all the entries satisfying |pred|, which are appended to |removed|.
+    void remove_if(const std::function<bool(const LRUHandle*)>& pred, std::vector<LRUHandle*>* removed);
+
+    uint32_t size() const { return _elems; }
+
 private:
     // The tablet consists of an array of buckets where each bucket is
     // a linked list of cache entries that hash into the bucket.
@@ -265,9 +310,42 @@ private:
     bool _resize();
 };
 
+// A count-min sketch of small saturating counters, which estimates the access frequencies of the recent keys for
+// the TinyLFU admission. All the counters are halved once the number of increments reaches 10 times the number of
+// counters per row, so that the old accesses fade out.
+class FrequencySketch {
+public:
+    FrequencySketch() { resize(kMinCountersPerRow); }
+
+    // Reset the sketch to have at least |num_counters| counters per row.
+    void resize(size_t num_counters);
+    size_t num_counters_per_row() const { return _row_size; }
+
+    void increment(uint32_t hash);
+    uint32_t estimate(uint32_t hash) const;
+
+private:
+    static constexpr int kDepth = 4;
+    static constexpr uint8_t kMaxCount = 15;
+    static constexpr size_t kMinCountersPerRow = 1024;
+
+    size_t _index_of(uint32_t hash, int row) const;
+    void _halve();
+
+    std::vector<uint8_t> _counters;
+    size_t _row_size = 0;
+    size_t _num_increments = 0;
+    size_t _sample_size = 0;
+};
+
 // A single shard of sharded cache.
 class LRUCache {
 public:
+    // The cap of the access frequency of the entries of S3-FIFO.
+    static constexpr uint8_t kMaxFrequency = 3;
+    // The share of the capacity taken by the small queue of S3-FIFO.
+    static constexpr double kSmallQueueRatio = 0.1;
+
     LRUCache();
     ~LRUCache() noexcept;
 
@@ -276,6 +354,10 @@ public:
 
     void set_charge_mode(ChargeMode charge_mode);
 
+    // Must be set before use.
+    void set_eviction_policy(CacheEvictionPolicy eviction_policy);
+    void set_tinylfu_admission(bool tinylfu_admission);
+
     // Like Cache methods, but with an extra "hash" parameter.
     Cache::Handle* insert(const CacheKey& key, uint32_t hash, void* value, size_t charge,
                           void (*deleter)(const CacheKey& key, void* value),
@@ -283,20 +365,37 @@ public:
     Cache::Handle* lookup(const CacheKey& key, uint32_t hash);
     void release(Cache::Handle* handle);
     void erase(const CacheKey& key, uint32_t hash);
+    size_t erase_if(const std::function<bool(const CacheKey& key)>& pred);
     int prune();
 
     uint64_t get_lookup_count() const;
     uint64_t get_hit_count() const;
+    uint64_t get_admission_reject_count() const;
+    uint64_t get_ghost_hit_count() const;
     size_t get_usage() const;
     size_t get_capacity() const;
 
 private:
+    bool _is_s3fifo() const { return _eviction_policy == CacheEvictionPolicy::S3FIFO; }
     void _lru_remove(LRUHandle* e);
     void _lru_append(LRUHandle* list, LRUHandle* e);
     bool _unref(LRUHandle* e);
+    void _evict(size_t charge, std::vector<LRUHandle*>* deleted);
     void _evict_from_lru(size_t charge, std::vector<LRUHandle*>* deleted);
     void _evict_one_entry(LRUHandle* e);
 
+    // S3-FIFO, where all the entries in the cache are in one of the queues, including the ones in use.
+    void _queue_append(LRUHandle* e);
+    void _queue_remove(LRUHandle* e);
+    void _evict_from_queues(size_t charge, bool evict_durable, std::vector<LRUHandle*>* deleted);
+    void _evict_queued_entry(LRUHandle* e);
+    void _ghost_insert(uint32_t hash);
+    bool _ghost_remove(uint32_t hash);
+
+    // TinyLFU.
+    LRUHandle* _next_victim();
+    bool _admit(const CacheKey& key, uint32_t hash, CachePriority priority, size_t charge);
+
     // Initialized before use.
     size_t _capacity{0};
 
@@ -315,6 +414,22 @@ private:
 
     uint64_t _lookup_count{0};
     uint64_t _hit_count{0};
+
+    CacheEvictionPolicy _eviction_policy = CacheEvictionPolicy::LRU;
+    // Dummy heads of the small and main queues of S3-FIFO.
+    // prev is the newest entry, and next is the oldest entry.
+    LRUHandle _small;
+    LRUHandle _main;
+    size_t _small_usage{0};
+    // The ghost queue of S3-FIFO, approximated by a table of the hashes of the keys recently evicted from the small
+    // queue, where a newer hash overwrites the older one in the same slot. It has about as many slots as the entries
+    // in the cache, and 0 means an empty slot.
+    std::vector<uint32_t> _ghost_hashes;
+    uint64_t _ghost_hit_count{0};
+
+    bool _tinylfu_admission = false;
+    FrequencySketch _sketch;
+    uint64_t _admission_reject_count{0};
 };
 
 static const int kNumShardBits = 5;
@@ -323,12 +438,14 @@ static const int kNumShards = 1 << kNumShardBits;
 class ShardedLRUCache : public Cache {
 public:
     explicit ShardedLRUCache(size_t capacity, ChargeMode charge_mode = ChargeMode::VALUESIZE);
+    explicit ShardedLRUCache(const CacheOptions& options);
     ~ShardedLRUCache() override = default;
     Handle* insert(const CacheKey& key, void* value, size_t charge, void (*deleter)(const CacheKey& key, void* value),
                    CachePriority priority = CachePriority::NORMAL, size_t value_size = 0) override;
     Handle* lookup(const CacheKey& key) override;
     void release(Handle* handle) override;
     void erase(const CacheKey& key) override;
+    size_t erase_if(const std::function<bool(const CacheKey& key)>& pred) override;
     void* value(Handle* handle) override;
     Slice value_slice(Handle* handle) override;
     uint64_t new_id() override;
@@ -339,6 +456,8 @@ public:
     size_t get_capacity() const override;
     uint64_t get_lookup_count() const override;
     uint64_t get_hit_count() const override;
+    uint64_t get_admission_reject_count() const override;
+    uint64_t get_ghost_hit_count() const override;
     bool adjust_capacity(int64_t delta, size_t min_capacity = 0) override;
 
 private:
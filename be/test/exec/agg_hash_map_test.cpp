@@ -17,6 +17,7 @@
 #include <gtest/gtest.h>
 
 #include <any>
+#include <set>
 
 #include "column/column_helper.h"
 #include "column/datum.h"
@@ -154,6 +155,149 @@ TEST(HashMapTest, Insert) {
     }
 }
 
+TEST(HashMapTest, PrefetchSerializedKey) {
+    const int chunk_size = 4096;
+    const int num_groups = 20000;
+    for (size_t prefetch_dist : {static_cast<size_t>(0), AGG_HASH_MAP_DEFAULT_PREFETCH_DIST}) {
+        RuntimeProfile profile("dummy");
+        AggStatistics statis(&profile);
+        SerializedKeyAggHashMap<PhmapSeed1> key(chunk_size, &statis);
+        key.prefetch_dist = prefetch_dist;
+        MemPool pool;
+        Buffer<AggDataPtr> agg_states(chunk_size);
+        auto allocate_func = [&pool](auto& key) { return pool.allocate(16); };
+
+        // every group must get the same state whether its rows are looked up with prefetches or not.
+        std::vector<AggDataPtr> group_states(num_groups, nullptr);
+        for (int round = 0; round < 3; round++) {
+            for (int from = 0; from < num_groups; from += chunk_size) {
+                int count = std::min(chunk_size, num_groups - from);
+                Columns key_columns;
+                key_columns.emplace_back(ColumnHelper::create_column(TypeDescriptor(TYPE_INT), false));
+                key_columns.emplace_back(ColumnHelper::create_column(TypeDescriptor(TYPE_INT), true));
+                for (int i = 0; i < count; i++) {
+                    int32_t group = static_cast<int64_t>(from + i) * 7919 % num_groups;
+                    key_columns[0]->append_datum(Datum(group));
+                    key_columns[1]->append_datum(Datum(group / 2));
+                }
+                key.build_hash_map(count, key_columns, &pool, allocate_func, &agg_states);
+                for (int i = 0; i < count; i++) {
+                    int32_t group = static_cast<int64_t>(from + i) * 7919 % num_groups;
+                    if (group_states[group] == nullptr) {
+                        group_states[group] = agg_states[i];
+                    } else {
+                        ASSERT_EQ(group_states[group], agg_states[i]);
+                    }
+                }
+            }
+        }
+        ASSERT_EQ(static_cast<size_t>(num_groups), key.hash_map.size());
+        if (prefetch_dist == 0) {
+            ASSERT_EQ(0, statis.pipelined_probe_rows->value());
+        } else {
+            ASSERT_GE(statis.pipelined_probe_rows->value(), 2 * num_groups);
+        }
+    }
+}
+
+TEST(HashMapTest, InlineSliceWithHash) {
+    std::string short_str = "short string";
+    std::string long_str = "a string which is longer than 16 bytes";
+    TInlineSliceWithHash<PhmapSeed1> short_key(Slice(short_str));
+    TInlineSliceWithHash<PhmapSeed1> long_key(Slice(long_str));
+    ASSERT_TRUE(short_key.is_inline());
+    ASSERT_FALSE(long_key.is_inline());
+    ASSERT_EQ(Slice(short_str), short_key.to_slice());
+    ASSERT_EQ(Slice(long_str), long_key.to_slice());
+    ASSERT_EQ(SliceHashWithSeed<PhmapSeed1>()(Slice(long_str)), long_key.hash);
+
+    // the inline bytes of key are compared, instead of the bytes of source string.
+    std::string short_copy = short_str;
+    ASSERT_EQ(short_key, TInlineSliceWithHash<PhmapSeed1>(Slice(short_copy)));
+    short_copy[0] = 'S';
+    ASSERT_EQ(short_key.to_slice(), Slice(short_str));
+    ASSERT_FALSE(short_key == TInlineSliceWithHash<PhmapSeed1>(Slice(short_copy)));
+    ASSERT_FALSE(short_key == TInlineSliceWithHash<PhmapSeed1>(Slice(short_str.data(), short_str.size() - 1)));
+    ASSERT_EQ(long_key, TInlineSliceWithHash<PhmapSeed1>(Slice(std::string(long_str))));
+}
+
+TEST(HashMapTest, OneInlineStringKey) {
+    const int chunk_size = 4096;
+    const int num_groups = 10000;
+    // make the groups be a mix of inline and long strings
+    auto group_key = [](int group) {
+        return group % 2 == 0 ? std::to_string(group) : std::string(20, 'x') + std::to_string(group);
+    };
+
+    for (bool nullable : {false, true}) {
+        RuntimeProfile profile("dummy");
+        AggStatistics statis(&profile);
+        NullOneInlineStringAggHashMap<PhmapSeed1> null_key(chunk_size, &statis);
+        OneInlineStringAggHashMap<PhmapSeed1> key(chunk_size, &statis);
+        MemPool pool;
+        Buffer<AggDataPtr> agg_states(chunk_size);
+        auto allocate_func = [&pool](auto& key) { return pool.allocate(16); };
+
+        std::vector<AggDataPtr> group_states(num_groups, nullptr);
+        AggDataPtr null_state = nullptr;
+        for (int round = 0; round < 2; round++) {
+            for (int from = 0; from < num_groups; from += chunk_size) {
+                int count = std::min(chunk_size, num_groups - from);
+                Columns key_columns{ColumnHelper::create_column(TypeDescriptor(TYPE_VARCHAR), nullable)};
+                std::vector<std::string> strs(count);
+                for (int i = 0; i < count; i++) {
+                    int group = static_cast<int64_t>(from + i) * 7919 % num_groups;
+                    strs[i] = group_key(group);
+                    if (nullable && group % 10 == 0) {
+                        key_columns[0]->append_nulls(1);
+                    } else {
+                        key_columns[0]->append_datum(Datum(Slice(strs[i])));
+                    }
+                }
+                if (nullable) {
+                    null_key.build_hash_map(count, key_columns, &pool, allocate_func, &agg_states);
+                } else {
+                    key.build_hash_map(count, key_columns, &pool, allocate_func, &agg_states);
+                }
+                for (int i = 0; i < count; i++) {
+                    int group = static_cast<int64_t>(from + i) * 7919 % num_groups;
+                    AggDataPtr& expected = nullable && group % 10 == 0 ? null_state : group_states[group];
+                    if (expected == nullptr) {
+                        expected = agg_states[i];
+                    } else {
+                        ASSERT_EQ(expected, agg_states[i]);
+                    }
+                }
+            }
+        }
+
+        auto check_keys = [&](auto& hash_map_with_key, size_t expected_groups) {
+            ASSERT_EQ(expected_groups, hash_map_with_key.hash_map.size());
+            for (const auto& [k, v] : hash_map_with_key.hash_map) {
+                hash_map_with_key.results.emplace_back(k);
+            }
+            Columns key_columns{ColumnHelper::create_column(TypeDescriptor(TYPE_VARCHAR), nullable)};
+            hash_map_with_key.insert_keys_to_columns(hash_map_with_key.results, key_columns,
+                                                     hash_map_with_key.results.size());
+            ASSERT_EQ(expected_groups, key_columns[0]->size());
+            std::set<std::string> groups;
+            for (size_t i = 0; i < key_columns[0]->size(); i++) {
+                ASSERT_FALSE(key_columns[0]->is_null(i));
+                groups.insert(key_columns[0]->get(i).get_slice().to_string());
+            }
+            for (int group = 0; group < num_groups; group++) {
+                ASSERT_EQ(!nullable || group % 10 != 0, groups.count(group_key(group)) > 0);
+            }
+        };
+        if (nullable) {
+            ASSERT_NE(nullptr, null_key.get_null_key_data());
+            check_keys(null_key, num_groups - num_groups / 10);
+        } else {
+            check_keys(key, num_groups);
+        }
+    }
+}
+
 TEST(HashMapTest, TwoLevelConvert) {
     std::vector<std::string> keys(1000);
     for (int i = 0; i < 1000; i++) {
@@ -0,0 +1,125 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/exec_node.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "column/chunk.h"
+#include "column/fixed_length_column.h"
+#include "column/nullable_column.h"
+#include "common/config.h"
+#include "exprs/column_ref.h"
+#include "exprs/expr_context.h"
+#include "runtime/runtime_state.h"
+#include "testutil/assert.h"
+
+namespace starrocks {
+
+class EvalConjunctsTest : public ::testing::Test {
+public:
+    void SetUp() override { _old_max_selectivity = config::selection_vector_conjunct_eval_max_selectivity; }
+    void TearDown() override { config::selection_vector_conjunct_eval_max_selectivity = _old_max_selectivity; }
+
+protected:
+    static constexpr int kNumRows = 100;
+
+    // slot 1 is true on every 4th row, slot 2 is true on every 8th row and null on every 3rd row,
+    // and slot 3 holds the row number.
+    ChunkPtr _create_chunk() {
+        auto chunk = std::make_shared<Chunk>();
+        auto c1 = BooleanColumn::create();
+        auto c2 = BooleanColumn::create();
+        auto c2_null = NullColumn::create();
+        auto c3 = Int32Column::create();
+        for (int i = 0; i < kNumRows; i++) {
+            c1->append(i % 4 == 0);
+            c2->append(i % 8 == 0);
+            c2_null->append(i % 3 == 0);
+            c3->append(i);
+        }
+        chunk->append_column(c1, 1);
+        chunk->append_column(NullableColumn::create(c2, c2_null), 2);
+        chunk->append_column(c3, 3);
+        return chunk;
+    }
+
+    std::vector<ExprContext*> _create_conjuncts(const std::vector<SlotId>& slot_ids) {
+        std::vector<ExprContext*> ctxs;
+        for (SlotId slot_id : slot_ids) {
+            auto* expr = _pool.add(new ColumnRef(TypeDescriptor(TYPE_BOOLEAN), slot_id));
+            ctxs.emplace_back(_pool.add(new ExprContext(expr)));
+        }
+        CHECK(Expr::prepare(ctxs, &_runtime_state).ok());
+        CHECK(Expr::open(ctxs, &_runtime_state).ok());
+        return ctxs;
+    }
+
+    static std::vector<int32_t> _row_numbers(const ChunkPtr& chunk) {
+        const auto& data = down_cast<Int32Column*>(chunk->get_column_by_slot_id(3).get())->get_data();
+        return {data.begin(), data.end()};
+    }
+
+    double _old_max_selectivity = 0;
+    RuntimeState _runtime_state;
+    ObjectPool _pool;
+};
+
+TEST_F(EvalConjunctsTest, test_selection_vector) {
+    std::vector<int32_t> expected;
+    for (int i = 0; i < kNumRows; i++) {
+        if (i % 8 == 0 && i % 3 != 0) {
+            expected.emplace_back(i);
+        }
+    }
+
+    // the first conjunct selects 25% rows, and the second one is evaluated on the selected rows only.
+    for (double max_selectivity : {0.0, 0.1, 0.5}) {
+        config::selection_vector_conjunct_eval_max_selectivity = max_selectivity;
+        auto chunk = _create_chunk();
+        auto ctxs = _create_conjuncts({1, 2});
+        ASSERT_OK(ExecNode::eval_conjuncts(ctxs, chunk.get()));
+        ASSERT_EQ(3u, chunk->num_columns());
+        ASSERT_EQ(expected.size(), chunk->num_rows());
+        ASSERT_EQ(expected, _row_numbers(chunk));
+        Expr::close(ctxs, &_runtime_state);
+    }
+}
+
+TEST_F(EvalConjunctsTest, test_selection_vector_refine) {
+    config::selection_vector_conjunct_eval_max_selectivity = 0.5;
+
+    // the conjuncts selecting all the rows of the compact chunk are skipped, and slot 2 refines the selection.
+    auto chunk = _create_chunk();
+    auto ctxs = _create_conjuncts({1, 1, 2, 1});
+    ASSERT_OK(ExecNode::eval_conjuncts(ctxs, chunk.get()));
+    ASSERT_EQ(std::vector<int32_t>({8, 16, 32, 40, 56, 64, 80, 88}), _row_numbers(chunk));
+    Expr::close(ctxs, &_runtime_state);
+
+    // no row passes all the conjuncts.
+    chunk = _create_chunk();
+    auto c4 = BooleanColumn::create();
+    for (int i = 0; i < kNumRows; i++) {
+        c4->append(i % 4 == 1);
+    }
+    chunk->append_column(c4, 4);
+    ctxs = _create_conjuncts({1, 4});
+    ASSERT_OK(ExecNode::eval_conjuncts(ctxs, chunk.get()));
+    ASSERT_EQ(0u, chunk->num_rows());
+    Expr::close(ctxs, &_runtime_state);
+}
+
+} // namespace starrocks
@@ -20,6 +20,7 @@
 #include "runtime/exec_env.h"
 #include "runtime/mem_tracker.h"
 #include "testutil/assert.h"
+#include "util/defer_op.h"
 
 namespace starrocks {
 class JoinHashMapTest : public ::testing::Test {
@@ -940,6 +941,52 @@ TEST_F(JoinHashMapTest, CalcBucketNums) {
     }
 }
 
+// NOLINTNEXTLINE
+TEST_F(JoinHashMapTest, CalcBucketNumsWithTags) {
+    Buffer<int32_t> data{1, 2, 3, 4};
+    Buffer<uint32_t> buckets{0, 0, 0, 0};
+    Buffer<uint8_t> tags{0, 0, 0, 0};
+
+    JoinHashMapHelper::calc_bucket_nums<int32_t>(data, 16, &buckets, 0, 4, tags.data());
+    for (size_t i = 0; i < buckets.size(); i++) {
+        size_t hash = JoinKeyHash<int32_t>()(data[i]);
+        ASSERT_EQ(buckets[i], hash & 15);
+        // the tag comes from the bits just above the bucket
+        ASSERT_EQ(tags[i], static_cast<uint8_t>((hash >> 4) | 0x80));
+    }
+}
+
+// NOLINTNEXTLINE
+TEST_F(JoinHashMapTest, LinearProbingFindSlot) {
+    ASSERT_EQ(LinearProbingHelper::calc_slot_size(1), LinearProbingHelper::kTagGroupSize);
+    ASSERT_EQ(LinearProbingHelper::calc_slot_size(16), 32);
+    ASSERT_EQ(LinearProbingHelper::calc_slot_size(17), 64);
+
+    const uint32_t slot_size = LinearProbingHelper::kTagGroupSize * 2;
+    Buffer<uint8_t> tags(slot_size + LinearProbingHelper::kTagGroupSize - 1, 0);
+    Buffer<uint32_t> first(slot_size, 0);
+    auto equal_to = [&](uint32_t key) { return [key](uint32_t row) { return row == key; }; };
+
+    // fill all the slots from the home slot 30, so the probe sequence wraps around.
+    for (uint32_t key = 1; key <= slot_size; key++) {
+        bool found = true;
+        uint32_t slot = LinearProbingHelper::find_slot(tags.data(), first.data(), slot_size, 30, 0x81,
+                                                       equal_to(key), &found);
+        ASSERT_FALSE(found);
+        ASSERT_EQ(slot, (30 + key - 1) % slot_size);
+        LinearProbingHelper::set_tag(&tags, slot_size, slot, 0x81);
+        first[slot] = key;
+    }
+
+    bool found = false;
+    ASSERT_EQ(LinearProbingHelper::find_slot(tags.data(), first.data(), slot_size, 30, 0x81, equal_to(3), &found), 0);
+    ASSERT_TRUE(found);
+    // the table is full, so the probe stops after visiting all the slots instead of spinning.
+    ASSERT_EQ(LinearProbingHelper::find_slot(tags.data(), first.data(), slot_size, 30, 0x81, equal_to(100), &found),
+              LinearProbingHelper::kNoSlot);
+    ASSERT_FALSE(found);
+}
+
 // NOLINTNEXTLINE
 TEST_F(JoinHashMapTest, GetHashKey) {
     auto c1 = JoinHashMapTest::create_int32_column(2, 0);
@@ -1126,6 +1173,47 @@ TEST_F(JoinHashMapTest, JoinBuildProbeFuncNullable) {
     }
 }
 
+// NOLINTNEXTLINE
+TEST_F(JoinHashMapTest, PipelinedLookupBucketHeads) {
+    JoinHashTableItems table_items;
+    HashTableProbeState probe_state;
+
+    auto type = TypeDescriptor::from_logical_type(LogicalType::TYPE_INT);
+    auto build_column = ColumnHelper::create_column(type, true);
+    build_column->append_default();
+    build_column->append(*JoinHashMapTest::create_int32_nullable_column(10, 0), 0, 10);
+    auto probe_column = JoinHashMapTest::create_int32_nullable_column(10, 0);
+    table_items.first.resize(16, 0);
+    table_items.key_columns.emplace_back(build_column);
+    table_items.bucket_size = 16;
+    table_items.row_count = 10;
+    table_items.next.resize(11);
+    probe_state.probe_row_count = 10;
+    probe_state.buckets.resize(config::vector_chunk_size);
+    probe_state.next.resize(config::vector_chunk_size, 0);
+    Columns probe_columns{probe_column};
+    probe_state.key_columns = &probe_columns;
+
+    JoinBuildFunc<TYPE_INT>::prepare(nullptr, &table_items);
+    JoinProbeFunc<TYPE_INT>::prepare(_runtime_state.get(), &probe_state);
+    JoinBuildFunc<TYPE_INT>::construct_hash_table(_runtime_state.get(), &table_items, &probe_state);
+    JoinProbeFunc<TYPE_INT>::lookup_init(table_items, &probe_state);
+    Buffer<uint32_t> expected_next(probe_state.next.begin(), probe_state.next.begin() + 10);
+
+    // the pipelined lookup must find the same bucket heads with any prefetch distance.
+    const auto& build_data = JoinBuildFunc<TYPE_INT>::get_key_data(table_items);
+    for (uint32_t distance : {1, 4, 16}) {
+        probe_state.next.assign(config::vector_chunk_size, 0);
+        probe_state.prefetch_distance = distance;
+        probe_state.prefetch_build_keys = reinterpret_cast<const uint8_t*>(build_data.data());
+        probe_state.prefetch_build_key_size = sizeof(int32_t);
+        JoinProbeFunc<TYPE_INT>::lookup_init(table_items, &probe_state);
+        for (size_t i = 0; i < 10; i++) {
+            ASSERT_EQ(expected_next[i], probe_state.next[i]);
+        }
+    }
+}
+
 // NOLINTNEXTLINE
 TEST_F(JoinHashMapTest, DirectMappingJoinBuildProbeFunc) {
     TDescriptorTableBuilder row_desc_builder;
@@ -2031,6 +2119,66 @@ TEST_F(JoinHashMapTest, FixedSizeJoinHashTable) {
     hash_table.close();
 }
 
+// NOLINTNEXTLINE
+TEST_F(JoinHashMapTest, LinearProbingFixedSizeJoinHashTable) {
+    config::vector_chunk_size = 4096;
+    auto old_min_rows = config::hash_join_linear_probing_min_rows;
+    DeferOp defer([&]() { config::hash_join_linear_probing_min_rows = old_min_rows; });
+    config::hash_join_linear_probing_min_rows = 0;
+
+    TDescriptorTableBuilder row_desc_builder;
+    add_tuple_descriptor(&row_desc_builder, LogicalType::TYPE_INT, false);
+    add_tuple_descriptor(&row_desc_builder, LogicalType::TYPE_INT, false);
+
+    auto probe_row_desc = create_probe_desc(&row_desc_builder);
+    auto build_row_desc = create_build_desc(&row_desc_builder);
+
+    HashTableParam param = create_table_param(TJoinOp::INNER_JOIN, 6);
+    param.join_keys.emplace_back(JoinKeyDesc{&_int_type, false, nullptr});
+    param.join_keys.emplace_back(JoinKeyDesc{&_int_type, false, nullptr});
+    param.probe_row_desc = probe_row_desc.get();
+    param.build_row_desc = build_row_desc.get();
+
+    JoinHashTable hash_table;
+    hash_table.create(param);
+
+    // every build key appears twice
+    for (int i = 0; i < 2; i++) {
+        auto build_chunk = create_int32_build_chunk(10, 0, false);
+        Columns build_key_columns{build_chunk->columns()[0], build_chunk->columns()[1]};
+        hash_table.append_chunk(build_chunk, build_key_columns);
+    }
+    ASSERT_OK(hash_table.build(_runtime_state.get()));
+
+    const auto* table_items = hash_table.table_items();
+    ASSERT_TRUE(table_items->enable_linear_probing);
+    ASSERT_EQ(table_items->tags.size(), table_items->bucket_size + LinearProbingHelper::kTagGroupSize - 1);
+    // a slot only holds the rows of one key
+    ASSERT_EQ(SIMD::count_nonzero(table_items->first), 10);
+    // the load factor is at most 0.5
+    ASSERT_GE(table_items->bucket_size, (table_items->row_count + 1) * 2);
+
+    // only the probe keys 8 and 9 are in the hash table
+    auto probe_chunk = create_int32_probe_chunk(5, 8, false);
+    Columns probe_key_columns{probe_chunk->columns()[0], probe_chunk->columns()[1]};
+
+    ChunkPtr result_chunk = std::make_shared<Chunk>();
+    bool eos = false;
+    ASSERT_OK(hash_table.probe(_runtime_state.get(), probe_key_columns, &probe_chunk, &result_chunk, &eos));
+
+    ASSERT_EQ(result_chunk->num_columns(), 6);
+    ASSERT_EQ(result_chunk->num_rows(), 4);
+    for (size_t i = 0; i < 4; i++) {
+        int32_t key = 8 + i / 2;
+        ASSERT_EQ(result_chunk->get_column_by_slot_id(0)->get(i).get_int32(), key);
+        ASSERT_EQ(result_chunk->get_column_by_slot_id(2)->get(i).get_int32(), key + 20);
+        ASSERT_EQ(result_chunk->get_column_by_slot_id(3)->get(i).get_int32(), key);
+        ASSERT_EQ(result_chunk->get_column_by_slot_id(5)->get(i).get_int32(), key + 20);
+    }
+
+    hash_table.close();
+}
+
 // NOLINTNEXTLINE
 TEST_F(JoinHashMapTest, SerializeJoinHashTable) {
     TDescriptorTableBuilder row_desc_builder;
@@ -0,0 +1,310 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/scan/morsel.h"
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <set>
+
+#include "common/config.h"
+#include "storage/rowset/rowid_range_option.h"
+#include "testutil/assert.h"
+#include "util/defer_op.h"
+
+namespace starrocks::pipeline {
+
+// The plan node id of a morsel identifies it in these tests.
+static Morsels create_morsels(int32_t from, int32_t count) {
+    Morsels morsels;
+    for (int32_t id = from; id < from + count; id++) {
+        morsels.emplace_back(std::make_unique<ScanMorsel>(id, TScanRange()));
+    }
+    return morsels;
+}
+
+static Morsels create_olap_morsels(int32_t from, int32_t count) {
+    Morsels morsels;
+    for (int32_t id = from; id < from + count; id++) {
+        TScanRange scan_range;
+        scan_range.__set_internal_scan_range(TInternalScanRange());
+        scan_range.internal_scan_range.__set_tablet_id(100 + id);
+        scan_range.internal_scan_range.__set_version("1");
+        morsels.emplace_back(std::make_unique<ScanMorsel>(id, scan_range));
+    }
+    return morsels;
+}
+
+static std::unique_ptr<IndividualMorselQueueFactory> create_factory(const std::vector<int32_t>& num_morsels_per_driver,
+                                                                    bool could_local_shuffle, bool fixed = false) {
+    std::map<int, MorselQueuePtr> queue_per_driver_seq;
+    int32_t from = 0;
+    for (size_t i = 0; i < num_morsels_per_driver.size(); i++) {
+        auto morsels = create_morsels(from, num_morsels_per_driver[i]);
+        if (fixed) {
+            queue_per_driver_seq.emplace(i, std::make_unique<FixedMorselQueue>(std::move(morsels)));
+        } else {
+            queue_per_driver_seq.emplace(i, std::make_unique<DynamicMorselQueue>(std::move(morsels)));
+        }
+        from += num_morsels_per_driver[i];
+    }
+    return std::make_unique<IndividualMorselQueueFactory>(std::move(queue_per_driver_seq), could_local_shuffle);
+}
+
+static std::vector<int32_t> drain(MorselQueue* queue) {
+    std::vector<int32_t> ids;
+    while (!queue->empty()) {
+        ASSIGN_OR_ABORT(auto morsel, queue->try_get());
+        if (morsel != nullptr) {
+            ids.emplace_back(morsel->get_plan_node_id());
+        }
+    }
+    return ids;
+}
+
+TEST(MorselQueueTest, DynamicMorselQueueSteal) {
+    DynamicMorselQueue queue(create_morsels(0, 5));
+
+    // the thief takes the half at the tail.
+    Morsels stolen;
+    ASSERT_EQ(3u, queue.steal(&stolen));
+    ASSERT_EQ(3u, stolen.size());
+    for (int32_t i = 0; i < 3; i++) {
+        ASSERT_EQ(2 + i, stolen[i]->get_plan_node_id());
+    }
+    ASSERT_EQ(std::vector<int32_t>({0, 1}), drain(&queue));
+
+    stolen.clear();
+    ASSERT_EQ(0u, queue.steal(&stolen));
+    ASSERT_TRUE(stolen.empty());
+
+    // the queue attached to a ticket checker is never stolen from.
+    DynamicMorselQueue cached_queue(create_morsels(0, 5));
+    cached_queue.set_ticket_checker(std::make_shared<query_cache::TicketChecker>());
+    ASSERT_EQ(0u, cached_queue.steal(&stolen));
+}
+
+TEST(MorselQueueTest, FixedMorselQueueSteal) {
+    FixedMorselQueue queue(create_morsels(0, 5));
+    ASSIGN_OR_ABORT(auto morsel, queue.try_get());
+    ASSERT_EQ(0, morsel->get_plan_node_id());
+
+    // the thief takes the half at the tail.
+    Morsels stolen;
+    ASSERT_EQ(2u, queue.steal(&stolen));
+    ASSERT_EQ(3, stolen[0]->get_plan_node_id());
+    ASSERT_EQ(4, stolen[1]->get_plan_node_id());
+    ASSERT_EQ(1u, queue.steal(&stolen));
+    ASSERT_EQ(2, stolen[2]->get_plan_node_id());
+    ASSERT_EQ(std::vector<int32_t>({1}), drain(&queue));
+    ASSERT_EQ(0u, queue.steal(&stolen));
+    ASSERT_EQ(5u, queue.num_original_morsels());
+}
+
+TEST(MorselQueueTest, FixedMorselQueueStealOlapTablets) {
+    FixedMorselQueue queue(create_olap_morsels(0, 4));
+
+    // the morsels of OLAP tablets can't be stolen before their rowsets are captured.
+    Morsels stolen;
+    ASSERT_FALSE(queue.has_stealable_morsels());
+    ASSERT_EQ(0u, queue.steal(&stolen));
+
+    std::vector<std::vector<BaseRowsetSharedPtr>> tablet_rowsets(4);
+    tablet_rowsets[3].resize(3);
+    queue.set_tablet_rowsets(tablet_rowsets);
+    ASSERT_TRUE(queue.has_stealable_morsels());
+    ASSERT_EQ(2u, queue.steal(&stolen));
+    ASSERT_EQ(2, stolen[0]->get_plan_node_id());
+    ASSERT_EQ(3u, down_cast<ScanMorsel*>(stolen[1].get())->rowsets().size());
+    ASSERT_EQ(std::vector<int32_t>({0, 1}), drain(&queue));
+}
+
+TEST(MorselQueueTest, WorkStealingFixedMorselQueue) {
+    bool old_enable_steal = config::enable_scan_morsel_stealing;
+    config::enable_scan_morsel_stealing = true;
+    DeferOp defer([&]() { config::enable_scan_morsel_stealing = old_enable_steal; });
+
+    auto factory = create_factory({1, 8, 0}, true, true);
+    auto* queue0 = factory->create(0);
+    auto* queue1 = factory->create(1);
+    auto* queue2 = factory->create(2);
+    ASSERT_EQ("work_stealing_fixed_morsel_queue", queue0->name());
+    ASSERT_EQ(MorselQueue::Type::FIXED, queue0->type());
+
+    // driver 2 has no morsel at all, and takes half of the morsels of driver 0 and then driver 1.
+    ASSIGN_OR_ABORT(auto morsel, queue2->try_get());
+    ASSERT_EQ(0, morsel->get_plan_node_id());
+    ASSIGN_OR_ABORT(morsel, queue2->try_get());
+    ASSERT_EQ(5, morsel->get_plan_node_id());
+    ASSERT_EQ(5u, queue2->num_stolen_morsels());
+
+    std::set<int32_t> ids{0, 5};
+    for (auto* queue : {queue0, queue1, queue2}) {
+        for (int32_t id : drain(queue)) {
+            ASSERT_TRUE(ids.insert(id).second);
+        }
+    }
+    ASSERT_EQ(9u, ids.size());
+    ASSERT_TRUE(queue0->empty());
+    ASSERT_TRUE(queue1->empty());
+    ASSERT_TRUE(queue2->empty());
+}
+
+TEST(MorselQueueTest, WorkStealing) {
+    bool old_enable_steal = config::enable_scan_morsel_stealing;
+    config::enable_scan_morsel_stealing = true;
+    DeferOp defer([&]() { config::enable_scan_morsel_stealing = old_enable_steal; });
+
+    // driver 1 owns a skewed tablet, which has been split into 16 morsels.
+    auto factory = create_factory({1, 16, 2}, true);
+    auto* queue0 = factory->create(0);
+    auto* queue1 = factory->create(1);
+    auto* queue2 = factory->create(2);
+    ASSERT_EQ("work_stealing_dynamic_morsel_queue", queue0->name());
+    ASSERT_EQ(MorselQueue::Type::DYNAMIC, queue0->type());
+    ASSERT_EQ(19u, factory->num_original_morsels());
+
+    // driver 1 scans its first morsel.
+    ASSIGN_OR_ABORT(auto morsel, queue1->try_get());
+    ASSERT_EQ(1, morsel->get_plan_node_id());
+
+    // driver 0 runs out of its own morsel, and then takes half of the remaining morsels of driver 1.
+    ASSIGN_OR_ABORT(morsel, queue0->try_get());
+    ASSERT_EQ(0, morsel->get_plan_node_id());
+    ASSIGN_OR_ABORT(morsel, queue0->try_get());
+    ASSERT_EQ(9, morsel->get_plan_node_id());
+    ASSERT_EQ(8u, queue0->num_stolen_morsels());
+
+    std::set<int32_t> ids{0, 1, 9};
+    for (auto* queue : {queue2, queue1, queue0}) {
+        for (int32_t id : drain(queue)) {
+            ASSERT_TRUE(ids.insert(id).second);
+        }
+    }
+    ASSERT_EQ(19u, ids.size());
+    ASSERT_TRUE(queue0->empty());
+    ASSERT_TRUE(queue1->empty());
+    ASSERT_TRUE(queue2->empty());
+    ASSERT_GT(queue2->num_stolen_morsels(), 0u);
+    ASSERT_EQ(0u, queue1->num_stolen_morsels());
+}
+
+TEST(MorselQueueTest, WorkStealingUnstealableVictim) {
+    bool old_enable_steal = config::enable_scan_morsel_stealing;
+    config::enable_scan_morsel_stealing = true;
+    DeferOp defer([&]() { config::enable_scan_morsel_stealing = old_enable_steal; });
+
+    std::map<int, MorselQueuePtr> queue_per_driver_seq;
+    queue_per_driver_seq.emplace(0, std::make_unique<FixedMorselQueue>(Morsels()));
+    queue_per_driver_seq.emplace(1, std::make_unique<FixedMorselQueue>(create_olap_morsels(0, 4)));
+    IndividualMorselQueueFactory factory(std::move(queue_per_driver_seq), true);
+    auto* queue0 = factory.create(0);
+    auto* queue1 = factory.create(1);
+
+    // the rowsets of driver 1 are not captured yet, so driver 0 has nothing to wait for.
+    ASSERT_TRUE(queue0->empty());
+    ASSIGN_OR_ABORT(auto morsel, queue0->try_get());
+    ASSERT_EQ(nullptr, morsel);
+
+    queue1->set_tablet_rowsets(std::vector<std::vector<BaseRowsetSharedPtr>>(4));
+    ASSERT_FALSE(queue0->empty());
+    ASSIGN_OR_ABORT(morsel, queue0->try_get());
+    ASSERT_EQ(2, morsel->get_plan_node_id());
+}
+
+TEST(MorselQueueTest, WorkStealingSplitRunningMorsel) {
+    bool old_enable_steal = config::enable_scan_morsel_stealing;
+    config::enable_scan_morsel_stealing = true;
+    DeferOp defer([&]() { config::enable_scan_morsel_stealing = old_enable_steal; });
+    const uint32_t min_rows = config::tablet_internal_parallel_min_splitted_scan_rows;
+
+    std::map<int, MorselQueuePtr> queue_per_driver_seq;
+    queue_per_driver_seq.emplace(0, std::make_unique<FixedMorselQueue>(create_olap_morsels(0, 1)));
+    queue_per_driver_seq.emplace(1, std::make_unique<FixedMorselQueue>(Morsels()));
+    IndividualMorselQueueFactory factory(std::move(queue_per_driver_seq), true, true);
+    auto* queue0 = factory.create(0);
+    auto* queue1 = factory.create(1);
+    queue0->set_tablet_rowsets(std::vector<std::vector<BaseRowsetSharedPtr>>(1));
+
+    // driver 0 scans the only tablet.
+    ASSIGN_OR_ABORT(auto morsel, queue0->try_get());
+    ASSERT_EQ(0, morsel->get_plan_node_id());
+    TabletReaderParams params;
+    morsel->init_tablet_reader_params(&params);
+    ASSERT_NE(nullptr, params.rowid_range_splitter);
+
+    // the segment is not opened yet, so nothing could be split off.
+    ASSERT_TRUE(queue1->empty());
+
+    RowsetId rowset_id;
+    rowset_id.init(10);
+    auto segment = params.rowid_range_splitter->add_segment(rowset_id, 1, 8 * min_rows, nullptr);
+    ASSERT_EQ(8 * min_rows, segment->claim(min_rows));
+    ASSERT_FALSE(queue1->empty());
+
+    // driver 1 splits off the tail half of the pending rows [min_rows, 8 * min_rows).
+    ASSIGN_OR_ABORT(auto split, queue1->try_get());
+    ASSERT_NE(nullptr, split);
+    ASSERT_EQ(1u, queue1->num_stolen_morsels());
+    TabletReaderParams split_params;
+    split->init_tablet_reader_params(&split_params);
+    ASSERT_NE(nullptr, split_params.rowid_range_option);
+    auto& split_range = split_params.rowid_range_option->rowid_range_per_segment_per_rowset[rowset_id][1];
+    ASSERT_EQ(SparseRange<>(min_rows * 9 / 2, 8 * min_rows), *split_range.row_id_range);
+    ASSERT_EQ(min_rows * 9 / 2, segment->claim(8 * min_rows));
+
+    // the split could be split again by driver 0 after its own morsel is done.
+    ASSERT_NE(nullptr, split_params.rowid_range_splitter);
+    split_params.rowid_range_splitter->add_segment(rowset_id, 1, 8 * min_rows, split_range.row_id_range);
+    morsel.reset();
+    params.rowid_range_splitter.reset();
+    ASSERT_TRUE(queue1->empty());
+    ASSERT_FALSE(queue0->empty());
+    ASSIGN_OR_ABORT(morsel, queue0->try_get());
+    ASSERT_NE(nullptr, morsel);
+    ASSIGN_OR_ABORT(morsel, queue0->try_get());
+    ASSERT_EQ(nullptr, morsel);
+}
+
+TEST(MorselQueueTest, NoWorkStealing) {
+    bool old_enable_steal = config::enable_scan_morsel_stealing;
+    config::enable_scan_morsel_stealing = true;
+    DeferOp defer([&]() { config::enable_scan_morsel_stealing = old_enable_steal; });
+
+    // the morsels bound to the drivers, such as the buckets of the colocate join, are never stolen.
+    {
+        auto factory = create_factory({1, 4}, false);
+        ASSERT_EQ("dynamic_morsel_queue", factory->create(0)->name());
+        ASSERT_EQ(std::vector<int32_t>({0}), drain(factory->create(0)));
+    }
+
+    // the queues used by the query cache are never stolen from.
+    {
+        auto factory = create_factory({1, 4}, true);
+        for (int i = 0; i < 2; i++) {
+            factory->create(i)->set_ticket_checker(std::make_shared<query_cache::TicketChecker>());
+        }
+        ASSERT_EQ(std::vector<int32_t>({0}), drain(factory->create(0)));
+        ASSERT_EQ(4u, drain(factory->create(1)).size());
+    }
+
+    config::enable_scan_morsel_stealing = false;
+    {
+        auto factory = create_factory({1, 4}, true);
+        ASSERT_EQ(std::vector<int32_t>({0}), drain(factory->create(0)));
+    }
+}
+
+} // namespace starrocks::pipeline
@@ -17,10 +17,12 @@
 #include <gtest/gtest.h>
 
 #include <thread>
+#include <unordered_set>
 
 #include "exec/pipeline/pipeline_fwd.h"
 #include "exec/workgroup/work_group.h"
 #include "testutil/parallel_test.h"
+#include "util/defer_op.h"
 
 namespace starrocks::pipeline {
 
@@ -305,4 +307,114 @@ TEST_F(WorkGroupDriverQueueTest, test_take_close) {
     consumer_thread->join();
 }
 
+TEST(ShardedDriverQueueTest, test_basic) {
+    ShardedDriverQueue queue(4);
+    DeferOp defer([] { PartitionedDriverQueue::bind_current_thread(0); });
+
+    QueryContext query_ctx;
+    std::vector<DriverPtr> drivers;
+    for (int i = 0; i < 64; i++) {
+        auto driver = std::make_shared<PipelineDriver>(_gen_operators(), &query_ctx, nullptr, nullptr, i);
+        _set_driver_level(driver.get(), 1);
+        queue.update_statistics(driver.get());
+        queue.put_back(driver.get());
+        drivers.emplace_back(std::move(driver));
+    }
+    ASSERT_EQ(64u, queue.size());
+
+    // The cancelled driver is taken first from its shard.
+    queue.cancel(drivers[10].get());
+
+    // The thread of the shard 1 takes the drivers of its own shard, and steals from the others after that.
+    PartitionedDriverQueue::bind_current_thread(1);
+    std::unordered_set<DriverRawPtr> out_drivers;
+    for (int i = 0; i < 64; i++) {
+        auto maybe_driver = queue.take(true);
+        ASSERT_TRUE(maybe_driver.ok());
+        ASSERT_TRUE(out_drivers.insert(maybe_driver.value()).second);
+    }
+    ASSERT_EQ(0u, queue.size());
+    ASSERT_GT(queue.num_stolen_drivers(), 0);
+
+    auto maybe_driver = queue.take(false);
+    ASSERT_TRUE(maybe_driver.ok());
+    ASSERT_EQ(nullptr, maybe_driver.value());
+
+    queue.close();
+    ASSERT_TRUE(queue.take(true).status().is_cancelled());
+}
+
+static std::shared_ptr<FragmentContext> _gen_fragment_ctx(int64_t instance_id_lo) {
+    auto fragment_ctx = std::make_shared<FragmentContext>();
+    TUniqueId instance_id;
+    instance_id.__set_hi(0);
+    instance_id.__set_lo(instance_id_lo);
+    fragment_ctx->set_fragment_instance_id(instance_id);
+    return fragment_ctx;
+}
+
+TEST(NumaAwareDriverQueueTest, test_steal) {
+    NumaAwareDriverQueue queue(2);
+    DeferOp defer([] { NumaAwareDriverQueue::bind_current_thread(0); });
+
+    // The drivers of the fragment instance 0 belong to the node 0, and the instance 1 belongs to the node 1.
+    QueryContext query_ctx;
+    auto fragment_ctx0 = _gen_fragment_ctx(0);
+    auto fragment_ctx1 = _gen_fragment_ctx(1);
+    auto driver01 = std::make_shared<PipelineDriver>(_gen_operators(), &query_ctx, fragment_ctx0.get(), nullptr, -1);
+    auto driver02 = std::make_shared<PipelineDriver>(_gen_operators(), &query_ctx, fragment_ctx0.get(), nullptr, -1);
+    auto driver11 = std::make_shared<PipelineDriver>(_gen_operators(), &query_ctx, fragment_ctx1.get(), nullptr, -1);
+    for (auto* driver : {driver01.get(), driver02.get(), driver11.get()}) {
+        _set_driver_level(driver, 1);
+        queue.update_statistics(driver);
+        queue.put_back(driver);
+    }
+    ASSERT_EQ(3u, queue.size());
+
+    // The thread of the node 1 takes the driver of its own node first, and then steals the drivers of the node 0.
+    NumaAwareDriverQueue::bind_current_thread(1);
+    std::vector<DriverRawPtr> out_drivers = {driver11.get(), driver01.get(), driver02.get()};
+    for (auto* out_driver : out_drivers) {
+        auto maybe_driver = queue.take(false);
+        ASSERT_TRUE(maybe_driver.ok());
+        ASSERT_EQ(out_driver, maybe_driver.value());
+    }
+    ASSERT_EQ(2, queue.num_stolen_drivers());
+    ASSERT_EQ(0u, queue.size());
+
+    auto maybe_driver = queue.take(false);
+    ASSERT_TRUE(maybe_driver.ok());
+    ASSERT_EQ(nullptr, maybe_driver.value());
+}
+
+TEST(NumaAwareDriverQueueTest, test_take_block) {
+    NumaAwareDriverQueue queue(2);
+
+    QueryContext query_ctx;
+    auto fragment_ctx1 = _gen_fragment_ctx(1);
+    auto driver11 = std::make_shared<PipelineDriver>(_gen_operators(), &query_ctx, fragment_ctx1.get(), nullptr, -1);
+    _set_driver_level(driver11.get(), 1);
+
+    // The idle thread of the node 0 is woken up by the driver of the node 1, since no thread of the node 1 is waiting.
+    auto consumer_thread = std::make_shared<std::thread>([&queue, &driver11] {
+        NumaAwareDriverQueue::bind_current_thread(0);
+        auto maybe_driver = queue.take(true);
+        ASSERT_TRUE(maybe_driver.ok());
+        ASSERT_EQ(driver11.get(), maybe_driver.value());
+
+        maybe_driver = queue.take(true);
+        ASSERT_TRUE(maybe_driver.status().is_cancelled());
+    });
+
+    sleep(1);
+    queue.update_statistics(driver11.get());
+    queue.put_back(driver11.get());
+
+    sleep(1);
+    queue.close();
+
+    consumer_thread->join();
+    ASSERT_EQ(1, queue.num_stolen_drivers());
+}
+
 } // namespace starrocks::pipeline
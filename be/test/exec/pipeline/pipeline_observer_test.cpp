@@ -0,0 +1,111 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/pipeline_observer.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "exec/pipeline/pipeline_driver_poller.h"
+#include "exec/pipeline/pipeline_driver_queue.h"
+#include "exprs/runtime_filter_bank.h"
+
+namespace starrocks::pipeline {
+
+TEST(PipelineObserverTest, test_consume_event) {
+    PipelineObserver observer;
+    ASSERT_FALSE(observer.consume_event());
+
+    // The notifications before the consumption are merged into one event.
+    observer.notify();
+    observer.notify();
+    ASSERT_TRUE(observer.consume_event());
+    ASSERT_FALSE(observer.consume_event());
+}
+
+TEST(PipelineObserverTest, test_observable) {
+    auto observer1 = std::make_shared<PipelineObserver>();
+    auto observer2 = std::make_shared<PipelineObserver>();
+    PipelineObservable observable;
+    observable.add_observer(observer1);
+    observable.add_observer(observer2);
+
+    observable.notify_observers();
+    ASSERT_TRUE(observer1->consume_event());
+    ASSERT_TRUE(observer2->consume_event());
+
+    // The observer outlives the observable state.
+    {
+        PipelineObservable tmp_observable;
+        tmp_observable.add_observer(observer1);
+        tmp_observable.notify_observers();
+    }
+    ASSERT_TRUE(observer1->consume_event());
+    ASSERT_FALSE(observer2->consume_event());
+}
+
+TEST(PipelineObserverTest, test_remove_observer) {
+    auto observer1 = std::make_shared<PipelineObserver>();
+    auto observer2 = std::make_shared<PipelineObserver>();
+    PipelineObservable observable;
+    observable.add_observer(observer1);
+    observable.add_observer(observer2);
+
+    // The finalized driver unregisters its observer, and is not notified anymore.
+    observable.remove_observer(observer1);
+    observable.remove_observer(observer1);
+    observable.notify_observers();
+    ASSERT_FALSE(observer1->consume_event());
+    ASSERT_TRUE(observer2->consume_event());
+}
+
+TEST(PipelineObserverTest, test_global_runtime_filter_arrives) {
+    auto observer = std::make_shared<PipelineObserver>();
+    RuntimeFilterProbeDescriptor rf_desc;
+    rf_desc.observable()->add_observer(observer);
+    ASSERT_FALSE(observer->consume_event());
+
+    starrocks::RuntimeBloomFilter<TYPE_INT> rf;
+    rf_desc.set_runtime_filter(&rf);
+    ASSERT_TRUE(observer->consume_event());
+    rf_desc.observable()->remove_observer(observer);
+}
+
+TEST(PipelineObserverTest, test_notify_from_other_threads) {
+    QuerySharedDriverQueue driver_queue;
+    PipelineDriverPoller poller(&driver_queue);
+    poller.start();
+
+    // The notification wakes up the poller which has no blocked driver.
+    auto observer = std::make_shared<PipelineObserver>();
+    observer->attach_poller(&poller);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; i++) {
+        threads.emplace_back([&observer] {
+            for (int j = 0; j < 1000; j++) {
+                observer->notify();
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    ASSERT_TRUE(observer->consume_event());
+    ASSERT_EQ(0u, poller.blocked_driver_queue_len());
+
+    poller.shutdown();
+}
+
+} // namespace starrocks::pipeline
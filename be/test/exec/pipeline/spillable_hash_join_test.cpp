@@ -0,0 +1,385 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "column/chunk.h"
+#include "column/fixed_length_column.h"
+#include "exec/pipeline/fragment_context.h"
+#include "exec/pipeline/hashjoin/hash_joiner_factory.h"
+#include "exec/pipeline/hashjoin/spillable_hash_join_build_operator.h"
+#include "exec/pipeline/hashjoin/spillable_hash_join_probe_operator.h"
+#include "exec/pipeline/noop_sink_operator.h"
+#include "exec/pipeline/pipeline.h"
+#include "exec/pipeline/query_context.h"
+#include "exec/pipeline/spill_process_channel.h"
+#include "exec/pipeline/spill_process_operator.h"
+#include "exprs/column_ref.h"
+#include "exprs/expr_context.h"
+#include "pipeline_test_base.h"
+#include "runtime/descriptor_helper.h"
+#include "testutil/assert.h"
+#include "util/uid_util.h"
+
+namespace starrocks::pipeline {
+
+// the slots of the probe side are (k, v) = (0, 1), and those of the build side are (k, v) = (2, 3)
+static constexpr SlotId kProbeKeySlotId = 0;
+static constexpr SlotId kProbeValueSlotId = 1;
+static constexpr SlotId kBuildKeySlotId = 2;
+static constexpr SlotId kBuildValueSlotId = 3;
+
+static constexpr int32_t kSpillMemTableSize = 64 * 1024;
+static constexpr int32_t kHotKey = 7;
+static constexpr int32_t kHotRows = 30000;
+
+using Rows = std::vector<std::pair<int32_t, int32_t>>;
+
+struct JoinOutput {
+    std::vector<std::string> rows;
+    int64_t skewed_build_slices = 0;
+};
+
+class RowsSourceOperator final : public SourceOperator {
+public:
+    RowsSourceOperator(OperatorFactory* factory, int32_t id, int32_t plan_node_id, int32_t driver_sequence,
+                       std::vector<ChunkPtr> chunks)
+            : SourceOperator(factory, id, "rows_source", plan_node_id, false, driver_sequence),
+              _chunks(std::move(chunks)) {}
+    ~RowsSourceOperator() override = default;
+
+    bool has_output() const override { return _index < _chunks.size(); }
+    bool is_finished() const override { return !has_output(); }
+
+    Status push_chunk(RuntimeState* state, const ChunkPtr& chunk) override {
+        return Status::InternalError("Shouldn't push chunk to source operator");
+    }
+    StatusOr<ChunkPtr> pull_chunk(RuntimeState* state) override { return _chunks[_index++]; }
+
+private:
+    std::vector<ChunkPtr> _chunks;
+    size_t _index = 0;
+};
+
+class RowsSourceOperatorFactory final : public SourceOperatorFactory {
+public:
+    RowsSourceOperatorFactory(int32_t id, int32_t plan_node_id, std::vector<ChunkPtr> chunks)
+            : SourceOperatorFactory(id, "rows_source", plan_node_id), _chunks(std::move(chunks)) {}
+    ~RowsSourceOperatorFactory() override = default;
+
+    OperatorPtr create(int32_t degree_of_parallelism, int32_t driver_sequence) override {
+        return std::make_shared<RowsSourceOperator>(this, _id, _plan_node_id, driver_sequence, _chunks);
+    }
+    SourceOperatorFactory::AdaptiveState adaptive_initial_state() const override { return AdaptiveState::ACTIVE; }
+
+private:
+    std::vector<ChunkPtr> _chunks;
+};
+
+// Keep the created probe operator, so that its counters can be read before the fragment is released.
+class TestHashJoinProbeOperatorFactory final : public SpillableHashJoinProbeOperatorFactory {
+public:
+    using SpillableHashJoinProbeOperatorFactory::SpillableHashJoinProbeOperatorFactory;
+
+    OperatorPtr create(int32_t degree_of_parallelism, int32_t driver_sequence) override {
+        auto op = SpillableHashJoinProbeOperatorFactory::create(degree_of_parallelism, driver_sequence);
+        _probe = op.get();
+        return op;
+    }
+
+    Operator* probe() const { return _probe; }
+
+private:
+    Operator* _probe = nullptr;
+};
+
+// Render the rows of the join output as "k,v,k,v", with the slots not in the output skipped.
+class CollectSinkOperator final : public Operator {
+public:
+    CollectSinkOperator(OperatorFactory* factory, int32_t id, int32_t plan_node_id, int32_t driver_sequence,
+                        Operator* probe, JoinOutput* output)
+            : Operator(factory, id, "collect_sink", plan_node_id, false, driver_sequence),
+              _probe(probe),
+              _output(output) {}
+    ~CollectSinkOperator() override = default;
+
+    bool need_input() const override { return true; }
+    bool has_output() const override { return false; }
+    bool is_finished() const override { return _is_finished; }
+
+    Status set_finishing(RuntimeState* state) override {
+        _is_finished = true;
+        auto* counter = _probe->unique_metrics()->get_counter("SpillSkewedBuildSlices");
+        _output->skewed_build_slices = counter != nullptr ? counter->value() : 0;
+        return Status::OK();
+    }
+
+    Status push_chunk(RuntimeState* state, const ChunkPtr& chunk) override {
+        for (size_t i = 0; i < chunk->num_rows(); i++) {
+            std::string row;
+            for (SlotId slot_id : {kProbeKeySlotId, kProbeValueSlotId, kBuildKeySlotId, kBuildValueSlotId}) {
+                if (!chunk->is_slot_exist(slot_id)) {
+                    continue;
+                }
+                const auto& column = chunk->get_column_by_slot_id(slot_id);
+                row += row.empty() ? "" : ",";
+                row += column->is_null(i) ? "NULL" : std::to_string(column->get(i).get_int32());
+            }
+            _output->rows.emplace_back(std::move(row));
+        }
+        return Status::OK();
+    }
+
+    StatusOr<ChunkPtr> pull_chunk(RuntimeState* state) override {
+        return Status::InternalError("Shouldn't pull chunk from sink operator");
+    }
+
+private:
+    Operator* _probe;
+    JoinOutput* _output;
+    bool _is_finished = false;
+};
+
+class CollectSinkOperatorFactory final : public OperatorFactory {
+public:
+    CollectSinkOperatorFactory(int32_t id, int32_t plan_node_id, const TestHashJoinProbeOperatorFactory* probe_factory,
+                               JoinOutput* output)
+            : OperatorFactory(id, "collect_sink", plan_node_id), _probe_factory(probe_factory), _output(output) {}
+    ~CollectSinkOperatorFactory() override = default;
+
+    OperatorPtr create(int32_t degree_of_parallelism, int32_t driver_sequence) override {
+        return std::make_shared<CollectSinkOperator>(this, _id, _plan_node_id, driver_sequence,
+                                                     _probe_factory->probe(), _output);
+    }
+
+private:
+    const TestHashJoinProbeOperatorFactory* _probe_factory;
+    JoinOutput* _output;
+};
+
+class SpillableHashJoinTest : public PipelineTestBase {
+public:
+    SpillableHashJoinTest() {
+        // the keys [0, 1000) are on both sides, [1000, 1100) are only on the build side
+        // and [-100, 0) are only on the probe side.
+        for (int32_t k = 0; k < 1100; k++) {
+            _build_rows.emplace_back(k, k * 10);
+        }
+        for (int32_t k = -100; k < 1000; k++) {
+            _probe_rows.emplace_back(k, k * 100);
+        }
+        // the hot key makes a partition of the build side skewed and much larger than the memory budget.
+        for (int32_t i = 0; i < kHotRows; i++) {
+            _build_rows.emplace_back(kHotKey, i);
+        }
+        _probe_rows.emplace_back(kHotKey, -1);
+        _probe_rows.emplace_back(kHotKey, -2);
+    }
+
+protected:
+    void _prepare_request() override {
+        _request.params.query_id = generate_uuid();
+        _request.params.fragment_instance_id = generate_uuid();
+        _request.query_options.__set_enable_spill(true);
+        // spill everything, with a memory budget of a single small mem table
+        TSpillOptions spill_options;
+        spill_options.__set_spill_mode(TSpillMode::FORCE);
+        spill_options.__set_spillable_operator_mask(1LL << TSpillableOperatorType::HASH_JOIN);
+        spill_options.__set_spill_mem_table_size(kSpillMemTableSize);
+        spill_options.__set_spill_mem_table_num(1);
+        spill_options.__set_spill_mem_limit_threshold(1.0);
+        spill_options.__set_spill_operator_min_bytes(0);
+        spill_options.__set_spill_operator_max_bytes(1L << 30);
+        spill_options.__set_spill_revocable_max_bytes(1L << 30);
+        spill_options.__set_spill_encode_level(0);
+        _request.query_options.__set_spill_options(spill_options);
+    }
+
+    std::vector<ChunkPtr> create_chunks(const Rows& rows, SlotId key_slot_id, SlotId value_slot_id) const {
+        std::vector<ChunkPtr> chunks;
+        for (size_t from = 0; from < rows.size(); from += _vector_chunk_size) {
+            size_t to = std::min<size_t>(from + _vector_chunk_size, rows.size());
+            auto keys = Int32Column::create();
+            auto values = Int32Column::create();
+            for (size_t i = from; i < to; i++) {
+                keys->append(rows[i].first);
+                values->append(rows[i].second);
+            }
+            auto chunk = std::make_shared<Chunk>();
+            chunk->append_column(std::move(keys), key_slot_id);
+            chunk->append_column(std::move(values), value_slot_id);
+            chunks.emplace_back(std::move(chunk));
+        }
+        return chunks;
+    }
+
+    ExprContext* create_column_ref(SlotId slot_id) {
+        return _obj_pool->add(new ExprContext(_obj_pool->add(new ColumnRef(TypeDescriptor(TYPE_INT), slot_id))));
+    }
+
+    // join the probe rows and the build rows on the key with spilling forced, the output is collected to _output
+    void run_join(TJoinOp::type join_type) {
+        _join_node.__set_join_op(join_type);
+        _join_node.__set_distribution_mode(TJoinDistributionMode::PARTITIONED);
+        _join_node.__set_is_push_down(false);
+
+        _pipeline_builder = [&](RuntimeState* state) {
+            CHECK_OK(state->query_ctx()->init_spill_manager(state->query_options()));
+
+            TDescriptorTableBuilder desc_tbl_builder;
+            for (int i = 0; i < 2; i++) {
+                TTupleDescriptorBuilder tuple_desc_builder;
+                for (const char* name : {"k", "v"}) {
+                    tuple_desc_builder.add_slot(
+                            TSlotDescriptorBuilder().type(TYPE_INT).nullable(false).column_name(name).build());
+                }
+                tuple_desc_builder.build(&desc_tbl_builder);
+            }
+            DescriptorTbl* tbl = nullptr;
+            CHECK_OK(DescriptorTbl::create(state, _obj_pool, desc_tbl_builder.desc_tbl(), &tbl, _vector_chunk_size));
+            RowDescriptor probe_row_desc(*tbl, std::vector<TTupleId>{0});
+            RowDescriptor build_row_desc(*tbl, std::vector<TTupleId>{1});
+
+            int32_t plan_node_id = next_plan_node_id();
+            HashJoinerParam param(_obj_pool, _join_node, {false}, {create_column_ref(kBuildKeySlotId)},
+                                  {create_column_ref(kProbeKeySlotId)}, {}, {}, build_row_desc, probe_row_desc,
+                                  TPlanNodeType::EXCHANGE_NODE, TPlanNodeType::EXCHANGE_NODE, true, {}, {}, {},
+                                  TJoinDistributionMode::PARTITIONED, false, false);
+            auto hash_joiner_factory = std::make_shared<HashJoinerFactory>(param);
+            auto spill_channel_factory = std::make_shared<SpillProcessChannelFactory>(1);
+
+            OpFactories spill_process_operators;
+            spill_process_operators.emplace_back(std::make_shared<SpillProcessOperatorFactory>(
+                    next_operator_id(), "spill_process", plan_node_id, spill_channel_factory));
+            spill_process_operators.emplace_back(
+                    std::make_shared<NoopSinkOperatorFactory>(next_operator_id(), plan_node_id));
+            _pipelines.push_back(
+                    std::make_shared<Pipeline>(next_pipeline_id(), spill_process_operators, exec_group.get()));
+
+            OpFactories build_operators;
+            build_operators.emplace_back(std::make_shared<RowsSourceOperatorFactory>(
+                    next_operator_id(), next_plan_node_id(),
+                    create_chunks(_build_rows, kBuildKeySlotId, kBuildValueSlotId)));
+            build_operators.emplace_back(std::make_shared<SpillableHashJoinBuildOperatorFactory>(
+                    next_operator_id(), plan_node_id, hash_joiner_factory,
+                    std::make_unique<PartialRuntimeFilterMerger>(_obj_pool, UINT64_MAX, UINT64_MAX),
+                    TJoinDistributionMode::PARTITIONED, spill_channel_factory));
+            _pipelines.push_back(std::make_shared<Pipeline>(next_pipeline_id(), build_operators, exec_group.get()));
+
+            auto probe_factory = std::make_shared<TestHashJoinProbeOperatorFactory>(next_operator_id(), plan_node_id,
+                                                                                    hash_joiner_factory);
+            OpFactories probe_operators;
+            probe_operators.emplace_back(std::make_shared<RowsSourceOperatorFactory>(
+                    next_operator_id(), next_plan_node_id(),
+                    create_chunks(_probe_rows, kProbeKeySlotId, kProbeValueSlotId)));
+            probe_operators.emplace_back(probe_factory);
+            probe_operators.emplace_back(std::make_shared<CollectSinkOperatorFactory>(
+                    next_operator_id(), next_plan_node_id(), probe_factory.get(), &_output));
+            _pipelines.push_back(std::make_shared<Pipeline>(next_pipeline_id(), probe_operators, exec_group.get()));
+
+            _fragment_ctx->runtime_filter_hub()->add_holder(plan_node_id);
+        };
+
+        start_test();
+    }
+
+    // the output of the join computed without the hash join operators
+    std::vector<std::string> expected_rows(TJoinOp::type join_type) const {
+        std::multimap<int32_t, int32_t> build_rows(_build_rows.begin(), _build_rows.end());
+        std::multimap<int32_t, int32_t> probe_rows(_probe_rows.begin(), _probe_rows.end());
+        auto render = [](int32_t k, int32_t v) { return std::to_string(k) + "," + std::to_string(v); };
+        std::vector<std::string> rows;
+        for (const auto& [pk, pv] : _probe_rows) {
+            auto [begin, end] = build_rows.equal_range(pk);
+            if (join_type == TJoinOp::LEFT_SEMI_JOIN) {
+                if (begin != end) {
+                    rows.emplace_back(render(pk, pv));
+                }
+                continue;
+            }
+            if (join_type == TJoinOp::INNER_JOIN || join_type == TJoinOp::LEFT_OUTER_JOIN ||
+                join_type == TJoinOp::RIGHT_OUTER_JOIN) {
+                for (auto it = begin; it != end; ++it) {
+                    rows.emplace_back(render(pk, pv) + "," + render(it->first, it->second));
+                }
+            }
+            if (join_type == TJoinOp::LEFT_OUTER_JOIN && begin == end) {
+                rows.emplace_back(render(pk, pv) + ",NULL,NULL");
+            }
+        }
+        for (const auto& [bk, bv] : _build_rows) {
+            bool matched = probe_rows.count(bk) > 0;
+            if (join_type == TJoinOp::RIGHT_OUTER_JOIN && !matched) {
+                rows.emplace_back("NULL,NULL," + render(bk, bv));
+            } else if ((join_type == TJoinOp::RIGHT_SEMI_JOIN && matched) ||
+                       (join_type == TJoinOp::RIGHT_ANTI_JOIN && !matched)) {
+                rows.emplace_back(render(bk, bv));
+            }
+        }
+        std::sort(rows.begin(), rows.end());
+        return rows;
+    }
+
+    void check_join(TJoinOp::type join_type, bool sliced) {
+        run_join(join_type);
+        ASSERT_EQ(std::future_status::ready, _fragment_future.wait_for(std::chrono::seconds(60)));
+        std::sort(_output.rows.begin(), _output.rows.end());
+        auto expected = expected_rows(join_type);
+        ASSERT_EQ(expected.size(), _output.rows.size());
+        ASSERT_TRUE(expected == _output.rows);
+        if (sliced) {
+            ASSERT_GT(_output.skewed_build_slices, 0);
+        } else {
+            ASSERT_EQ(0, _output.skewed_build_slices);
+        }
+    }
+
+    THashJoinNode _join_node;
+    JoinOutput _output;
+    Rows _build_rows;
+    Rows _probe_rows;
+};
+
+TEST_F(SpillableHashJoinTest, test_inner_join) {
+    check_join(TJoinOp::INNER_JOIN, true);
+}
+
+TEST_F(SpillableHashJoinTest, test_right_outer_join) {
+    check_join(TJoinOp::RIGHT_OUTER_JOIN, true);
+}
+
+TEST_F(SpillableHashJoinTest, test_right_semi_join) {
+    check_join(TJoinOp::RIGHT_SEMI_JOIN, true);
+}
+
+TEST_F(SpillableHashJoinTest, test_right_anti_join) {
+    check_join(TJoinOp::RIGHT_ANTI_JOIN, true);
+}
+
+// the output of a probe row depends on all the build rows of its key, so the build side is never sliced
+TEST_F(SpillableHashJoinTest, test_left_outer_join) {
+    check_join(TJoinOp::LEFT_OUTER_JOIN, false);
+}
+
+TEST_F(SpillableHashJoinTest, test_left_semi_join) {
+    check_join(TJoinOp::LEFT_SEMI_JOIN, false);
+}
+
+} // namespace starrocks::pipeline
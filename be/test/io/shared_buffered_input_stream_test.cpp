@@ -179,4 +179,40 @@ TEST_F(SharedBufferedInputStreamTest, test_orc) {
             sb.value()->debug_string());
 }
 
+PARALLEL_TEST(SharedBufferedInputStreamTest, test_batch_read) {
+    size_t len = 8 * 1024 * 1024;
+    const std::string rand_string = random_string(len);
+    auto in = std::make_shared<TestInputStream>(rand_string, len);
+    auto sb_stream = std::make_shared<io::SharedBufferedInputStream>(in, "test", len);
+    // the ranges are too far from each other to be merged
+    std::vector<io::SharedBufferedInputStream::IORange> ranges;
+    for (int i = 0; i < 4; i++) {
+        ranges.emplace_back(i * 2 * 1024 * 1024 + 100, 1024);
+    }
+    sb_stream->set_coalesce_options({.max_dist_size = 1024 * 1024,
+                                     .max_buffer_size = 1024 * 1024,
+                                     .max_batch_read_size = 3 * 1024});
+    ASSERT_OK(sb_stream->set_io_ranges(ranges));
+
+    // the first miss loads the first three buffers in one batch
+    const uint8_t* buffer = nullptr;
+    ASSERT_OK(sb_stream->get_bytes(&buffer, 100, 1024, nullptr));
+    ASSERT_EQ(rand_string.substr(100, 1024), std::string_view((const char*)buffer, 1024));
+    ASSERT_EQ(3, sb_stream->shared_io_count());
+    for (int i = 0; i < 3; i++) {
+        ASSIGN_OR_ABORT(auto sb, sb_stream->find_shared_buffer(ranges[i].offset, ranges[i].size));
+        ASSERT_NE(0u, sb->buffer.capacity());
+    }
+    ASSIGN_OR_ABORT(auto last, sb_stream->find_shared_buffer(ranges[3].offset, ranges[3].size));
+    ASSERT_EQ(0u, last->buffer.capacity());
+
+    ASSERT_OK(sb_stream->get_bytes(&buffer, ranges[2].offset, 1024, nullptr));
+    ASSERT_EQ(rand_string.substr(ranges[2].offset, 1024), std::string_view((const char*)buffer, 1024));
+    ASSERT_EQ(3, sb_stream->shared_io_count());
+
+    ASSERT_OK(sb_stream->get_bytes(&buffer, ranges[3].offset, 1024, nullptr));
+    ASSERT_EQ(rand_string.substr(ranges[3].offset, 1024), std::string_view((const char*)buffer, 1024));
+    ASSERT_EQ(4, sb_stream->shared_io_count());
+}
+
 } // namespace starrocks::io
\ No newline at end of file
@@ -19,6 +19,7 @@
 #include <filesystem>
 #include <iterator>
 #include <memory>
+#include <random>
 #include <thread>
 #include <utility>
 #include <vector>
@@ -43,6 +44,7 @@
 #include "exec/spill/file_block_manager.h"
 #include "exec/spill/hybird_block_manager.h"
 #include "exec/spill/log_block_manager.h"
+#include "exec/spill/mem_block_manager.h"
 #include "exec/spill/mem_table.h"
 #include "exec/spill/spill_components.h"
 #include "exec/spill/spiller.h"
@@ -60,6 +62,7 @@
 #include "testutil/assert.h"
 #include "types/logical_type.h"
 #include "util/defer_op.h"
+#include "util/compression/block_compression.h"
 #include "util/runtime_profile.h"
 #include "util/uid_util.h"
 
@@ -323,4 +326,79 @@ TEST_F(SpillBlockManagerTest, hybird_block_allocation_test) {
         ASSERT_EQ(block->debug_string(), expected);
     }
 }
+
+static std::string read_block(const spill::BlockPtr& block) {
+    std::string data(block->size(), 0);
+    auto reader = block->get_reader({});
+    CHECK(reader->read_fully(data.data(), data.size()).ok());
+    return data;
+}
+
+TEST_F(SpillBlockManagerTest, mem_block_allocation_test) {
+    auto disk_block_mgr = std::make_unique<spill::LogBlockManager>(dummy_query_id, remote_dir_mgr.get());
+    auto mem_block_mgr = std::make_shared<spill::MemBlockManager>(dummy_query_id, std::move(disk_block_mgr), 3000,
+                                                                  CompressionTypePB::LZ4);
+    ASSERT_OK(mem_block_mgr->open());
+
+    std::mt19937 rng(0);
+    auto acquire_and_write = [&](const std::string& data) {
+        spill::AcquireBlockOptions opts{.query_id = dummy_query_id,
+                                        .fragment_instance_id = dummy_query_id,
+                                        .plan_node_id = 1,
+                                        .name = "node1",
+                                        .block_size = data.size()};
+        auto block = mem_block_mgr->acquire_block(opts).value();
+        CHECK(block->append({Slice(data)}).ok());
+        CHECK(block->flush().ok());
+        CHECK(mem_block_mgr->release_block(block).ok());
+        return block;
+    };
+    auto random_string = [&](size_t size) {
+        std::string data(size, 0);
+        for (auto& c : data) c = static_cast<char>(rng());
+        return data;
+    };
+
+    // 1. a compressible block is kept in memory, compressed
+    std::string data_a(1000, 'a');
+    auto block_a = acquire_and_write(data_a);
+    ASSERT_TRUE(block_a->debug_string().starts_with("MemBlock[len=1000"));
+    ASSERT_LT(mem_block_mgr->used_bytes(), 100);
+    ASSERT_EQ(data_a, read_block(block_a));
+
+    // 2. a block larger than the budget goes to disk directly
+    std::string data_large = random_string(4000);
+    auto block_large = acquire_and_write(data_large);
+    ASSERT_TRUE(block_large->debug_string().starts_with("LogBlock["));
+    ASSERT_EQ(data_large, read_block(block_large));
+
+    // 3. incompressible blocks are kept as they are
+    std::string data_b = random_string(1000);
+    std::string data_c = random_string(1000);
+    auto block_b = acquire_and_write(data_b);
+    auto block_c = acquire_and_write(data_c);
+    int64_t used_bytes = mem_block_mgr->used_bytes();
+    ASSERT_GE(used_bytes, 2000);
+    ASSERT_LT(used_bytes, 2100);
+
+    // 4. restoring block_a makes it the hottest, so block_b is the coldest one and moves to disk to make room
+    ASSERT_OK(block_a->get_readable().status());
+    std::string data_d = random_string(1500);
+    auto block_d = acquire_and_write(data_d);
+    ASSERT_TRUE(block_b->debug_string().starts_with("MemBlock[evicted=LogBlock["));
+    ASSERT_TRUE(block_a->debug_string().starts_with("MemBlock[len=1000"));
+    ASSERT_TRUE(block_c->debug_string().starts_with("MemBlock[len=1000"));
+    ASSERT_TRUE(block_d->debug_string().starts_with("MemBlock[len=1500"));
+    ASSERT_LE(mem_block_mgr->used_bytes(), mem_block_mgr->max_bytes());
+    for (const auto& [block, data] : {std::make_pair(block_a, data_a), std::make_pair(block_b, data_b),
+                                      std::make_pair(block_c, data_c), std::make_pair(block_d, data_d)}) {
+        ASSERT_EQ(data, read_block(block));
+    }
+
+    // 5. the memory is released with the blocks
+    block_a.reset();
+    block_c.reset();
+    block_d.reset();
+    ASSERT_EQ(0, mem_block_mgr->used_bytes());
+}
 } // namespace starrocks::vectorized
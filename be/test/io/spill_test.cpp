@@ -38,6 +38,7 @@
 #include "common/statusor.h"
 #include "exec/sorting/merge.h"
 #include "exec/sorting/sorting.h"
+#include "exec/spill/column_encoding.h"
 #include "exec/spill/executor.h"
 #include "exec/spill/log_block_manager.h"
 #include "exec/spill/mem_table.h"
@@ -590,6 +591,100 @@ TEST_F(SpillTest, aligned_buffer) {
     ASSERT_TRUE(is_aligned(buffer.data(), 4096));
 }
 
+TEST_F(SpillTest, split_partition) {
+    spill::SpilledPartition partition(5);
+    ASSERT_EQ(2, partition.level);
+    auto children = partition.split(3);
+    ASSERT_EQ(8u, children.size());
+    for (size_t i = 0; i < children.size(); ++i) {
+        ASSERT_EQ(5, children[i]->level);
+        // the lower bits of hash are the same with the parent, and the next bits are the index of child
+        uint32_t hash = (i << 2) | (partition.partition_id & partition.mask());
+        ASSERT_EQ(hash & children[i]->mask(), children[i]->partition_id & children[i]->mask());
+    }
+    auto binary = partition.split(1);
+    ASSERT_EQ(partition.partition_id + partition.level_elements(), binary[0]->partition_id);
+    ASSERT_EQ(partition.partition_id + partition.level_elements() * 2, binary[1]->partition_id);
+}
+
+TEST_F(SpillTest, heavy_hitters) {
+    spill::HashHeavyHitters heavy_hitters;
+    ASSERT_EQ(0u, heavy_hitters.top().second);
+
+    // a hot hash value among many distinct ones
+    std::vector<uint32_t> hashes;
+    for (uint32_t i = 0; i < 10000; ++i) {
+        hashes.push_back(i % 3 == 0 ? 42 : i);
+    }
+    heavy_hitters.update(hashes.data(), hashes.size());
+    auto [hash, count] = heavy_hitters.top();
+    ASSERT_EQ(42u, hash);
+    // the count is under estimated by at most num_rows / (kMaxCounters + 1)
+    ASSERT_LE(count, 3334u);
+    ASSERT_GE(count, 3334u - hashes.size() / (spill::HashHeavyHitters::kMaxCounters + 1));
+
+    heavy_hitters.reset();
+    std::vector<uint32_t> same(4096, 7);
+    heavy_hitters.update(same.data(), same.size());
+    heavy_hitters.update(same.data(), same.size());
+    ASSERT_EQ(std::make_pair(7u, size_t(8192)), heavy_hitters.top());
+}
+
+static void check_column_encoding(const Column& column, int encode_level) {
+    std::vector<uint8_t> buffer(spill::SpillColumnEncoding::max_serialized_size(column, encode_level));
+    uint8_t* end = spill::SpillColumnEncoding::serialize(column, buffer.data(), encode_level);
+    ASSERT_TRUE(end != nullptr);
+    ASSERT_LE(end - buffer.data(), static_cast<int64_t>(buffer.size()));
+
+    auto result = column.clone_empty();
+    const uint8_t* read_end = spill::SpillColumnEncoding::deserialize(buffer.data(), result.get(), encode_level);
+    ASSERT_EQ(end, read_end);
+    ASSERT_EQ(column.size(), result->size());
+    for (size_t i = 0; i < column.size(); i++) {
+        ASSERT_EQ(column.debug_item(i), result->debug_item(i)) << "row " << i;
+    }
+}
+
+static int64_t encoded_size(const Column& column, int encode_level) {
+    std::vector<uint8_t> buffer(spill::SpillColumnEncoding::max_serialized_size(column, encode_level));
+    return spill::SpillColumnEncoding::serialize(column, buffer.data(), encode_level) - buffer.data();
+}
+
+TEST_F(SpillTest, column_encoding) {
+    const size_t num_rows = 4096;
+    auto low_card = BinaryColumn::create();
+    auto high_card = BinaryColumn::create();
+    auto ints = Int64Column::create();
+    for (size_t i = 0; i < num_rows; i++) {
+        low_card->append(Slice("value_" + std::to_string(i % 17)));
+        high_card->append(Slice("value_" + std::to_string(i)));
+        ints->append(i * 3);
+    }
+
+    // nulls in a few long runs, alternating nulls and no null at all
+    auto null_runs = NullableColumn::create(low_card->clone(), NullColumn::create(num_rows, 0));
+    auto alternating = NullableColumn::create(high_card->clone(), NullColumn::create(num_rows, 0));
+    auto no_null = NullableColumn::create(ints->clone(), NullColumn::create(num_rows, 0));
+    for (size_t i = 0; i < num_rows; i++) {
+        null_runs->null_column_data()[i] = (i / 1000) % 2;
+        alternating->null_column_data()[i] = i % 2;
+    }
+    null_runs->update_has_null();
+    alternating->update_has_null();
+
+    for (int encode_level : {0, 7, 8, 16, 31}) {
+        for (const Column* column : std::vector<const Column*>{low_card.get(), high_card.get(), ints.get(),
+                                                              null_runs.get(), alternating.get(), no_null.get()}) {
+            check_column_encoding(*column, encode_level);
+        }
+    }
+
+    // dictionary encoding and null runs make the low cardinality and few null runs columns smaller
+    ASSERT_LT(encoded_size(*low_card, 8), encoded_size(*low_card, 0) / 2);
+    ASSERT_LT(encoded_size(*null_runs, 16), encoded_size(*null_runs, 0) - static_cast<int64_t>(num_rows) / 2);
+    ASSERT_LT(encoded_size(*alternating, 16), encoded_size(*alternating, 0));
+}
+
 /*
 TEST_F(SpillTest, file_group_test) {
     auto chunk = std::make_unique<Chunk>();
@@ -0,0 +1,151 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "io/uring_input_stream.h"
+
+#include <gtest/gtest.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <cstdlib>
+
+#include "common/logging.h"
+#include "io/io_uring.h"
+#include "testutil/assert.h"
+#include "testutil/parallel_test.h"
+
+namespace starrocks::io {
+
+static int open_temp_file() {
+    char tmpl[] = "/tmp/uring_input_stream_testXXXXXX";
+    int fd = ::mkstemp(tmpl);
+    if (fd < 0) {
+        PLOG(FATAL) << "mkstemp() failed";
+    }
+    if (::unlink(tmpl) < 0) {
+        PLOG(FATAL) << "unlink() failed";
+    }
+    return fd;
+}
+
+static std::string make_contents(size_t size) {
+    std::string contents(size, '\0');
+    for (size_t i = 0; i < size; i++) {
+        contents[i] = static_cast<char>('a' + i % 26);
+    }
+    return contents;
+}
+
+static void write_or_die(int fd, const std::string& contents) {
+    if (::pwrite(fd, contents.data(), contents.size(), 0) != static_cast<ssize_t>(contents.size())) {
+        PLOG(FATAL) << "pwrite() failed";
+    }
+}
+
+// NOLINTNEXTLINE
+PARALLEL_TEST(UringInputStreamTest, test_default_read_at_fully_batch) {
+    int fd = open_temp_file();
+    const std::string contents = make_contents(10000);
+    write_or_die(fd, contents);
+    FdInputStream in(fd);
+    in.set_close_on_delete(true);
+
+    char buff1[100];
+    char buff2[200];
+    ASSERT_OK(in.read_at_fully_batch({{.offset = 5000, .out = buff1, .count = 100},
+                                      {.offset = 10, .out = buff2, .count = 200}}));
+    ASSERT_EQ(contents.substr(5000, 100), std::string_view(buff1, 100));
+    ASSERT_EQ(contents.substr(10, 200), std::string_view(buff2, 200));
+
+    ASSERT_FALSE(in.read_at_fully_batch({{.offset = 9950, .out = buff1, .count = 100}}).ok());
+}
+
+// NOLINTNEXTLINE
+PARALLEL_TEST(UringInputStreamTest, test_submit_and_wait) {
+    if (!IoUring::is_supported()) {
+        GTEST_SKIP() << "io_uring is not supported";
+    }
+    ASSIGN_OR_ABORT(auto ring, IoUring::create(4));
+    int fd = open_temp_file();
+    const std::string contents = make_contents(64 * 1024);
+    struct iovec write_iov = {const_cast<char*>(contents.data()), contents.size()};
+    IoUring::Request write_req;
+    write_req.fd = fd;
+    write_req.is_write = true;
+    write_req.iov = &write_iov;
+    write_req.iov_count = 1;
+    ASSERT_OK(ring->submit_and_wait(&write_req, 1));
+    ASSERT_EQ(static_cast<int64_t>(contents.size()), write_req.result);
+
+    // more requests than the queue depth
+    const int num_reads = 10;
+    std::vector<std::string> buffers(num_reads, std::string(1000, '\0'));
+    std::vector<struct iovec> iovs(num_reads);
+    std::vector<IoUring::Request> requests(num_reads);
+    for (int i = 0; i < num_reads; i++) {
+        iovs[i] = {buffers[i].data(), buffers[i].size()};
+        requests[i].fd = fd;
+        requests[i].offset = i * 6000 + 7;
+        requests[i].iov = &iovs[i];
+        requests[i].iov_count = 1;
+    }
+    ASSERT_OK(ring->submit_and_wait(requests.data(), requests.size()));
+    for (int i = 0; i < num_reads; i++) {
+        ASSERT_EQ(1000, requests[i].result);
+        ASSERT_EQ(contents.substr(i * 6000 + 7, 1000), buffers[i]);
+    }
+
+    // short read at the end of file, and a bad fd
+    requests[0].offset = contents.size() - 10;
+    requests[1].fd = -1;
+    ASSERT_OK(ring->submit_and_wait(requests.data(), 2));
+    ASSERT_EQ(10, requests[0].result);
+    ASSERT_EQ(-EBADF, requests[1].result);
+    ::close(fd);
+}
+
+// NOLINTNEXTLINE
+PARALLEL_TEST(UringInputStreamTest, test_read_at_fully_batch) {
+    int fd = open_temp_file();
+    const std::string contents = make_contents(1024 * 1024);
+    write_or_die(fd, contents);
+    auto fd_stream = std::make_unique<FdInputStream>(fd);
+    fd_stream->set_close_on_delete(true);
+    UringInputStream in(std::move(fd_stream));
+    ASSERT_EQ(static_cast<int64_t>(contents.size()), *in.get_size());
+
+    // works with or without io_uring
+    const int num_reads = 100;
+    std::vector<std::string> buffers(num_reads, std::string(4096, '\0'));
+    std::vector<SeekableInputStream::ReadRequest> requests;
+    for (int i = 0; i < num_reads; i++) {
+        int64_t offset = (i * 7919L * 4096 + 13) % static_cast<int64_t>(contents.size() - 4096);
+        requests.push_back({.offset = offset, .out = buffers[i].data(), .count = 4096});
+    }
+    ASSERT_OK(in.read_at_fully_batch(requests));
+    for (int i = 0; i < num_reads; i++) {
+        ASSERT_EQ(contents.substr(requests[i].offset, 4096), buffers[i]);
+    }
+    ASSERT_EQ(requests.back().offset + 4096, *in.position());
+
+    // the last request reaches the end of file
+    requests.back().offset = contents.size() - 100;
+    ASSERT_FALSE(in.read_at_fully_batch(requests).ok());
+
+    char buff[10];
+    ASSERT_OK(in.read_at_fully(20, buff, 10));
+    ASSERT_EQ(contents.substr(20, 10), std::string_view(buff, 10));
+}
+
+} // namespace starrocks::io
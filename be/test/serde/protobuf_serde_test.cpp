@@ -96,6 +96,24 @@ PARALLEL_TEST(ProtobufChunkSerde, test_serde) {
     }
 }
 
+// NOLINTNEXTLINE
+PARALLEL_TEST(ProtobufChunkSerde, test_serialize_to) {
+    auto chunk = std::make_unique<Chunk>(make_columns(2), make_schema(2));
+
+    StatusOr<ChunkPB> expected = serde::ProtobufChunkSerde::serialize_without_meta(*chunk);
+    ASSERT_TRUE(expected.ok()) << expected.status();
+
+    std::string buffer(serde::ProtobufChunkSerde::max_serialized_data_size(*chunk), '\0');
+    ASSERT_GE(buffer.size(), expected->data().size());
+    StatusOr<ChunkPB> res =
+            serde::ProtobufChunkSerde::serialize_to(*chunk, reinterpret_cast<uint8_t*>(buffer.data()), false);
+    ASSERT_TRUE(res.ok()) << res.status();
+    ASSERT_TRUE(res->data().empty());
+    ASSERT_EQ(expected->serialized_size(), res->serialized_size());
+    ASSERT_EQ(expected->uncompressed_size(), res->uncompressed_size());
+    ASSERT_EQ(expected->data(), buffer.substr(0, res->uncompressed_size()));
+}
+
 // NOLINTNEXTLINE
 PARALLEL_TEST(ProtobufChunkSerde, TestChunkWithExtraData) {
     auto chunk = std::make_unique<Chunk>(make_columns(2), make_schema(2));
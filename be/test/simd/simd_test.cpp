@@ -134,4 +134,14 @@ TEST_F(SIMDTest, count_nonzero_int32) {
     EXPECT_EQ(30u, SIMD::count_nonzero(numbers));
 }
 
+TEST_F(SIMDTest, match_byte16) {
+    uint8_t data[16];
+    for (int i = 0; i < 16; i++) {
+        data[i] = i % 3 == 0 ? 0x85 : i;
+    }
+    EXPECT_EQ(0b1001001001001001u, SIMD::match_byte16(data, 0x85));
+    EXPECT_EQ(1u << 2, SIMD::match_byte16(data, 2));
+    EXPECT_EQ(0u, SIMD::match_byte16(data, 0));
+}
+
 } // namespace starrocks
@@ -0,0 +1,239 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/column_expr_predicate.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "column/column_helper.h"
+#include "column/fixed_length_column.h"
+#include "common/config.h"
+#include "exprs/binary_predicate.h"
+#include "exprs/column_ref.h"
+#include "exprs/expr_context.h"
+#include "exprs/function_call_expr.h"
+#include "exprs/literal.h"
+#include "exprs/map_element_expr.h"
+#include "exprs/subfield_expr.h"
+#include "runtime/descriptor_helper.h"
+#include "runtime/runtime_state.h"
+#include "storage/column_predicate.h"
+#include "testutil/assert.h"
+
+namespace starrocks {
+
+class ColumnExprPredicateTest : public testing::Test {
+public:
+    void SetUp() override {
+        _old_enable_subfield_zonemap = config::enable_subfield_zonemap;
+        config::enable_subfield_zonemap = true;
+    }
+
+    void TearDown() override { config::enable_subfield_zonemap = _old_enable_subfield_zonemap; }
+
+protected:
+    SlotDescriptor* new_slot(const TypeDescriptor& type) {
+        return _pool.add(new SlotDescriptor(TSlotDescriptorBuilder().type(type).column_name("c1").id(1).build()));
+    }
+
+    Expr* new_literal(ColumnPtr value, const TypeDescriptor& type) {
+        return _pool.add(new VectorizedLiteral(std::move(value), type));
+    }
+
+    Expr* new_int_literal(int32_t value) {
+        return new_literal(ColumnHelper::create_const_column<TYPE_INT>(value, 1), TypeDescriptor(TYPE_INT));
+    }
+
+    // slot.name0.name1...
+    Expr* new_subfield(SlotDescriptor* slot, const TypeDescriptor& type, const std::vector<std::string>& names) {
+        TExprNode node;
+        node.__set_node_type(TExprNodeType::SUBFIELD_EXPR);
+        node.__set_is_nullable(true);
+        node.__set_type(type.to_thrift());
+        node.__set_num_children(1);
+        node.__set_used_subfield_names(names);
+        Expr* expr = _pool.add(SubfieldExprFactory::from_thrift(node));
+        expr->add_child(_pool.add(new ColumnRef(slot)));
+        return expr;
+    }
+
+    // slot[key]
+    Expr* new_map_element(SlotDescriptor* slot, Expr* key) {
+        TExprNode node;
+        node.__set_node_type(TExprNodeType::MAP_ELEMENT_EXPR);
+        node.__set_is_nullable(true);
+        node.__set_type(slot->type().children[1].to_thrift());
+        node.__set_num_children(2);
+        Expr* expr = _pool.add(MapElementExprFactory::from_thrift(node));
+        expr->add_child(_pool.add(new ColumnRef(slot)));
+        expr->add_child(key);
+        return expr;
+    }
+
+    // get_json_int(slot, path)
+    Expr* new_get_json_int(SlotDescriptor* slot, const std::string& path) {
+        TFunctionName fn_name;
+        fn_name.__set_function_name("get_json_int");
+        TFunction fn;
+        fn.__set_name(fn_name);
+        fn.__set_binary_type(TFunctionBinaryType::BUILTIN);
+        fn.__set_has_var_args(false);
+        fn.__set_fid(110023);
+        TExprNode node;
+        node.__set_node_type(TExprNodeType::FUNCTION_CALL);
+        node.__set_type(TypeDescriptor(TYPE_BIGINT).to_thrift());
+        node.__set_num_children(2);
+        node.__set_fn(fn);
+        Expr* expr = _pool.add(new VectorizedFunctionCallExpr(node));
+        expr->add_child(_pool.add(new ColumnRef(slot)));
+        expr->add_child(new_literal(ColumnHelper::create_const_column<TYPE_VARCHAR>(Slice(path), 1),
+                                    TypeDescriptor::create_varchar_type(path.size())));
+        return expr;
+    }
+
+    // the predicate of `lhs op rhs` on |slot|
+    ColumnExprPredicate* new_predicate(SlotDescriptor* slot, TExprOpcode::type op, Expr* lhs, Expr* rhs) {
+        TExprNode node;
+        node.__set_node_type(TExprNodeType::BINARY_PRED);
+        node.__set_opcode(op);
+        node.__set_child_type(to_thrift(lhs->type().type));
+        node.__set_type(TypeDescriptor(TYPE_BOOLEAN).to_thrift());
+        node.__set_num_children(2);
+        Expr* root = _pool.add(VectorizedBinaryPredicateFactory::from_thrift(node));
+        root->add_child(lhs);
+        root->add_child(rhs);
+
+        auto* ctx = _pool.add(new ExprContext(root));
+        CHECK_OK(ctx->prepare(&_runtime_state));
+        CHECK_OK(ctx->open(&_runtime_state));
+        auto pred = ColumnExprPredicate::make_column_expr_predicate(nullptr, 0, &_runtime_state, ctx, slot);
+        CHECK_OK(pred.status());
+        return _pool.add(pred.value());
+    }
+
+    std::vector<const ColumnExprPredicate*> rewrite(const ColumnExprPredicate* pred) {
+        std::vector<const ColumnExprPredicate*> output;
+        CHECK_OK(pred->try_to_rewrite_for_subfield_zone_map_filter(&_pool, &output));
+        return output;
+    }
+
+    // the selection of |pred| on the int values, e.g. "0,1,1"
+    static std::string evaluate(const ColumnPredicate* pred, const std::vector<int32_t>& values) {
+        auto column = Int32Column::create();
+        for (int32_t value : values) {
+            column->append(value);
+        }
+        std::vector<uint8_t> selection(values.size(), 0);
+        CHECK_OK(pred->evaluate(column.get(), selection.data(), 0, values.size()));
+        std::string result;
+        for (uint8_t selected : selection) {
+            result += result.empty() ? "" : ",";
+            result += selected != 0 ? "1" : "0";
+        }
+        return result;
+    }
+
+    static TypeDescriptor struct_type() {
+        return TypeDescriptor::create_struct_type({"a", "b"}, {TypeDescriptor(TYPE_INT), TypeDescriptor(TYPE_INT)});
+    }
+
+    RuntimeState _runtime_state;
+    ObjectPool _pool;
+    bool _old_enable_subfield_zonemap = false;
+};
+
+TEST_F(ColumnExprPredicateTest, test_rewrite_struct_subfield) {
+    SlotDescriptor* slot = new_slot(struct_type());
+    // s.a > 10
+    {
+        auto* pred = new_predicate(slot, TExprOpcode::GT, new_subfield(slot, TypeDescriptor(TYPE_INT), {"a"}),
+                                   new_int_literal(10));
+        auto output = rewrite(pred);
+        ASSERT_EQ(1, output.size());
+        ASSERT_EQ(std::vector<std::string>{"a"}, output[0]->subfield_path());
+        ASSERT_EQ(TYPE_INT, output[0]->type_info()->type());
+        ASSERT_EQ("0,0,1", evaluate(output[0], {5, 10, 11}));
+    }
+    // 10 > s.a is rewritten to s.a < 10
+    {
+        auto* pred = new_predicate(slot, TExprOpcode::GT, new_int_literal(10),
+                                   new_subfield(slot, TypeDescriptor(TYPE_INT), {"a"}));
+        auto output = rewrite(pred);
+        ASSERT_EQ(1, output.size());
+        ASSERT_EQ("1,0,0", evaluate(output[0], {5, 10, 11}));
+    }
+    // s.a = 10 is rewritten to s.a <= 10 and s.a >= 10
+    {
+        auto* pred = new_predicate(slot, TExprOpcode::EQ, new_subfield(slot, TypeDescriptor(TYPE_INT), {"a"}),
+                                   new_int_literal(10));
+        auto output = rewrite(pred);
+        ASSERT_EQ(2, output.size());
+        ASSERT_EQ("1,1,0", evaluate(output[0], {5, 10, 11}));
+        ASSERT_EQ("0,1,1", evaluate(output[1], {5, 10, 11}));
+    }
+    // s.a > s.b is not compared with a literal
+    {
+        auto* pred = new_predicate(slot, TExprOpcode::GT, new_subfield(slot, TypeDescriptor(TYPE_INT), {"a"}),
+                                   new_subfield(slot, TypeDescriptor(TYPE_INT), {"b"}));
+        ASSERT_TRUE(rewrite(pred).empty());
+    }
+}
+
+TEST_F(ColumnExprPredicateTest, test_rewrite_map_element) {
+    auto map_type = TypeDescriptor::create_map_type(TypeDescriptor(TYPE_INT), TypeDescriptor(TYPE_INT));
+    SlotDescriptor* slot = new_slot(map_type);
+    // m[3] > 100 only passes the rows with the key 3, which is key <= 3 and key >= 3
+    auto* pred = new_predicate(slot, TExprOpcode::GT, new_map_element(slot, new_int_literal(3)),
+                               new_int_literal(100));
+    auto output = rewrite(pred);
+    ASSERT_EQ(2, output.size());
+    for (const auto* leaf : output) {
+        ASSERT_EQ(std::vector<std::string>{kMapKeysSubfield}, leaf->subfield_path());
+    }
+    ASSERT_EQ("1,1,0", evaluate(output[0], {2, 3, 4}));
+    ASSERT_EQ("0,1,1", evaluate(output[1], {2, 3, 4}));
+}
+
+TEST_F(ColumnExprPredicateTest, test_rewrite_get_json) {
+    SlotDescriptor* slot = new_slot(TypeDescriptor::create_json_type());
+    auto bigint_literal = [&](int64_t value) {
+        return new_literal(ColumnHelper::create_const_column<TYPE_BIGINT>(value, 1), TypeDescriptor(TYPE_BIGINT));
+    };
+    // get_json_int(j, '$.a') < 7 is on the flattened sub-column a
+    {
+        auto* pred = new_predicate(slot, TExprOpcode::LT, new_get_json_int(slot, "$.a"), bigint_literal(7));
+        auto output = rewrite(pred);
+        ASSERT_EQ(1, output.size());
+        ASSERT_EQ(std::vector<std::string>{"a"}, output[0]->subfield_path());
+        ASSERT_EQ(TYPE_BIGINT, output[0]->type_info()->type());
+    }
+    // the paths of multiple levels are not flattened to a single sub-column
+    {
+        auto* pred = new_predicate(slot, TExprOpcode::LT, new_get_json_int(slot, "$.a.b"), bigint_literal(7));
+        ASSERT_TRUE(rewrite(pred).empty());
+    }
+}
+
+TEST_F(ColumnExprPredicateTest, test_rewrite_disabled) {
+    SlotDescriptor* slot = new_slot(struct_type());
+    auto* pred = new_predicate(slot, TExprOpcode::GT, new_subfield(slot, TypeDescriptor(TYPE_INT), {"a"}),
+                               new_int_literal(10));
+    ASSERT_EQ(1, rewrite(pred).size());
+    config::enable_subfield_zonemap = false;
+    ASSERT_TRUE(rewrite(pred).empty());
+}
+
+} // namespace starrocks
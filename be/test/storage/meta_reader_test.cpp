@@ -19,9 +19,15 @@
 #include <memory>
 
 #include "column/fixed_length_column.h"
+#include "column/object_column.h"
+#include "common/config.h"
 #include "fs/fs_util.h"
+#include "storage/chunk_helper.h"
 #include "storage/rowset/segment_writer.h"
 #include "testutil/assert.h"
+#include "types/hll.h"
+#include "util/defer_op.h"
+#include "util/hash_util.hpp"
 
 namespace starrocks {
 
@@ -101,4 +107,89 @@ TEST_F(SegmentMetaCollecterTest, test_open_and_collect) {
     EXPECT_EQ(0, col->get(0).get_int64());
 }
 
+TEST_F(SegmentMetaCollecterTest, test_collect_ndv) {
+    TabletSchemaPB schema_pb;
+    auto c0 = schema_pb.add_column();
+    c0->set_name("c0");
+    c0->set_type("INT");
+    c0->set_is_key(true);
+    c0->set_is_nullable(false);
+    auto c1 = schema_pb.add_column();
+    c1->set_name("c1");
+    c1->set_type("VARCHAR");
+    c1->set_length(64);
+    c1->set_is_key(false);
+    c1->set_is_nullable(true);
+    auto tablet_schema = TabletSchema::create(schema_pb);
+
+    config::enable_segment_ndv_sketch = true;
+    DeferOp defer([]() { config::enable_segment_ndv_sketch = false; });
+
+    // 1000 distinct values of c0, and 90 distinct values of c1 with nulls
+    std::string segment_name = "segment_meta_collector_ndv_test.dat";
+    ASSIGN_OR_ABORT(auto fs, FileSystem::CreateSharedFromString(segment_name));
+    WritableFileOptions options{.mode = FileSystem::CREATE_OR_OPEN_WITH_TRUNCATE};
+    ASSIGN_OR_ABORT(auto wf, fs->new_writable_file(options, segment_name));
+    SegmentWriter writer(std::move(wf), 0, tablet_schema, SegmentWriterOptions());
+    ASSERT_OK(writer.init());
+    auto chunk = ChunkHelper::new_chunk(ChunkHelper::convert_schema(tablet_schema), 10000);
+    HyperLogLog expected;
+    for (int32_t i = 0; i < 10000; i++) {
+        int32_t v = i / 10;
+        chunk->get_column_by_index(0)->append_datum(Datum(v));
+        expected.update(HashUtil::murmur_hash64A(&v, sizeof(v), HashUtil::MURMUR_SEED));
+        if (i % 10 == 0) {
+            chunk->get_column_by_index(1)->append_nulls(1);
+        } else {
+            std::string s = "v" + std::to_string(i % 100);
+            chunk->get_column_by_index(1)->append_datum(Datum(Slice(s)));
+        }
+    }
+    ASSERT_OK(writer.append_chunk(*chunk));
+    uint64_t file_size, index_size, footer_pos;
+    ASSERT_OK(writer.finalize(&file_size, &index_size, &footer_pos));
+    ASSIGN_OR_ABORT(auto segment, Segment::open(fs, FileInfo{segment_name}, 0, tablet_schema));
+
+    std::string field;
+    std::string col_name;
+    ASSERT_OK(SegmentMetaCollecter::parse_field_and_colname("ndv_c1", &field, &col_name));
+    ASSERT_EQ("ndv", field);
+    ASSERT_EQ("c1", col_name);
+
+    SegmentMetaCollecterParams params;
+    params.fields = {"ndv", "ndv"};
+    params.field_type = {LogicalType::TYPE_INT, LogicalType::TYPE_VARCHAR};
+    params.cids = {0, 1};
+    params.read_page = {false, false};
+    params.tablet_schema = tablet_schema;
+    SegmentMetaCollecter collecter(segment);
+    ASSERT_OK(collecter.init(&params));
+    ASSERT_OK(collecter.open());
+
+    auto hll0 = HyperLogLogColumn::create();
+    auto hll1 = HyperLogLogColumn::create();
+    std::vector<Column*> columns{hll0.get(), hll1.get()};
+    ASSERT_OK(collecter.collect(&columns));
+    ASSERT_EQ(1u, hll0->size());
+    ASSERT_EQ(1u, hll1->size());
+    // the sketch is the same as the one of ndv() on the values
+    ASSERT_EQ(expected.estimate_cardinality(), hll0->get_object(0)->estimate_cardinality());
+    ASSERT_NEAR(1000, hll0->get_object(0)->estimate_cardinality(), 50);
+    ASSERT_EQ(90, hll1->get_object(0)->estimate_cardinality());
+
+    // the segments written without the sketches can't answer ndv
+    SegmentMetaCollecterParams old_params = params;
+    old_params.fields = {"ndv"};
+    old_params.field_type = {LogicalType::TYPE_INT};
+    old_params.cids = {0};
+    old_params.read_page = {false};
+    old_params.tablet_schema = _tablet_schema;
+    SegmentMetaCollecter old_collecter(_segment);
+    ASSERT_OK(old_collecter.init(&old_params));
+    ASSERT_OK(old_collecter.open());
+    auto hll = HyperLogLogColumn::create();
+    std::vector<Column*> old_columns{hll.get()};
+    ASSERT_TRUE(old_collecter.collect(&old_columns).is_not_found());
+}
+
 } // namespace starrocks
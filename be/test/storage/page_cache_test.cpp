@@ -184,4 +184,117 @@ TEST_F(StoragePageCacheTest, metrics) {
     ASSERT_EQ(cache.get_hit_count(), 2);
 }
 
+TEST_F(StoragePageCacheTest, segment_pages) {
+    StoragePageCache cache(_mem_tracker.get(), kNumShards * 2048);
+
+    PageCacheSegment segment1;
+    PageCacheSegment segment2;
+    segment1.init("/data/1.dat", 8192);
+    segment2.init("/data/2.dat", 8192);
+    ASSERT_NE(0, memcmp(segment1.id(), segment2.id(), PageCacheSegment::kIdSize));
+    for (int64_t offset : {0, 1024, 4096}) {
+        for (auto* segment : {&segment1, &segment2}) {
+            PageCacheHandle handle;
+            cache.insert(StoragePageCache::CacheKey(*segment, offset), Slice(new char[16], 16), &handle, false);
+        }
+    }
+
+    // the pages are keyed by the segment id, and not confused with the pages keyed by the file name.
+    {
+        PageCacheHandle handle;
+        ASSERT_TRUE(cache.lookup(StoragePageCache::CacheKey(segment1, 1024), &handle));
+        ASSERT_FALSE(cache.lookup(StoragePageCache::CacheKey(segment1, 2048), &handle));
+        StoragePageCache::CacheKey fname_key(std::string("12345678"), 1024);
+        ASSERT_FALSE(cache.lookup(fname_key, &handle));
+    }
+
+    // drop all the pages of segment1, and the pages in use are still readable by their handles.
+    PageCacheHandle in_use_handle;
+    ASSERT_TRUE(cache.lookup(StoragePageCache::CacheKey(segment1, 0), &in_use_handle));
+    cache.drop_segments({&segment1});
+    ASSERT_EQ(16u, in_use_handle.data().size);
+    for (int64_t offset : {0, 1024, 4096}) {
+        PageCacheHandle handle;
+        ASSERT_FALSE(cache.lookup(StoragePageCache::CacheKey(segment1, offset), &handle));
+        ASSERT_TRUE(cache.lookup(StoragePageCache::CacheKey(segment2, offset), &handle));
+    }
+
+    // dropping again is a no-op.
+    cache.drop_segments({&segment1});
+    PageCacheHandle handle;
+    ASSERT_TRUE(cache.lookup(StoragePageCache::CacheKey(segment2, 4096), &handle));
+}
+
+TEST_F(StoragePageCacheTest, segment_pages_after_reload) {
+    StoragePageCache cache(_mem_tracker.get(), kNumShards * 2048);
+
+    {
+        PageCacheSegment segment;
+        segment.init("/data/1.dat", 8192);
+        PageCacheHandle handle;
+        cache.insert(StoragePageCache::CacheKey(segment, 1024), Slice(new char[16], 16), &handle, false);
+    }
+
+    // the segment reloaded from the same file finds the pages.
+    PageCacheSegment reloaded;
+    reloaded.init("/data/1.dat", 8192);
+    PageCacheHandle handle;
+    ASSERT_TRUE(cache.lookup(StoragePageCache::CacheKey(reloaded, 1024), &handle));
+
+    // the file rewritten in place with another size doesn't.
+    PageCacheSegment rewritten;
+    rewritten.init("/data/1.dat", 16384);
+    ASSERT_FALSE(cache.lookup(StoragePageCache::CacheKey(rewritten, 1024), &handle));
+    cache.insert(StoragePageCache::CacheKey(rewritten, 1024), Slice(new char[16], 16), &handle, false);
+
+    // the pages inserted by the segment before reloading are dropped by the reloaded one as well.
+    cache.insert(StoragePageCache::CacheKey(reloaded, 4096), Slice(new char[16], 16), &handle, false);
+    cache.drop_segments({&reloaded});
+    ASSERT_FALSE(cache.lookup(StoragePageCache::CacheKey(reloaded, 1024), &handle));
+    ASSERT_FALSE(cache.lookup(StoragePageCache::CacheKey(reloaded, 4096), &handle));
+    ASSERT_TRUE(cache.lookup(StoragePageCache::CacheKey(rewritten, 1024), &handle));
+}
+
+TEST_F(StoragePageCacheTest, decoded_pages) {
+    StoragePageCache cache(_mem_tracker.get(), kNumShards * 2048);
+    ASSERT_FALSE(cache.decoded_cache_enabled());
+    cache.set_decoded_capacity(kNumShards * 2048);
+    ASSERT_TRUE(cache.decoded_cache_enabled());
+    ASSERT_EQ(kNumShards * 2048, cache.get_decoded_capacity());
+
+    static int num_deleted = 0;
+    auto deleter = [](const CacheKey& key, void* value) {
+        delete reinterpret_cast<int64_t*>(value);
+        num_deleted++;
+    };
+    PageCacheSegment segment;
+    segment.init("/data/1.dat", 8192);
+    {
+        PageCacheHandle handle;
+        cache.insert_decoded(&segment, 1024, new int64_t(42), 8, deleter, &handle);
+        ASSERT_EQ(42, *reinterpret_cast<int64_t*>(handle.value()));
+    }
+
+    // the decoded pages don't share the keys with the raw pages.
+    StoragePageCache::CacheKey key(segment, 1024);
+    {
+        PageCacheHandle handle;
+        ASSERT_FALSE(cache.lookup(key, &handle));
+        ASSERT_TRUE(cache.lookup_decoded(key, &handle));
+        ASSERT_EQ(42, *reinterpret_cast<int64_t*>(handle.value()));
+        ASSERT_FALSE(cache.lookup_decoded(StoragePageCache::CacheKey(segment, 0), &handle));
+    }
+    ASSERT_EQ(2u, cache.get_decoded_lookup_count());
+    ASSERT_EQ(1u, cache.get_decoded_hit_count());
+
+    // the decoded pages are dropped with the segment.
+    cache.drop_segments({&segment});
+    ASSERT_EQ(1, num_deleted);
+    PageCacheHandle handle;
+    ASSERT_FALSE(cache.lookup_decoded(key, &handle));
+
+    cache.set_decoded_capacity(0);
+    ASSERT_FALSE(cache.decoded_cache_enabled());
+}
+
 } // namespace starrocks
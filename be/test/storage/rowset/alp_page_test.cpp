@@ -0,0 +1,181 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/rowset/alp_page.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "column/fixed_length_column.h"
+#include "testutil/assert.h"
+
+namespace starrocks {
+
+class AlpPageTest : public testing::Test {
+public:
+    template <LogicalType Type>
+    OwnedSlice encode(const std::vector<typename TypeTraits<Type>::CppType>& values) {
+        PageBuilderOptions options;
+        options.data_page_size = 256 * 1024;
+        AlpPageBuilder<Type> builder(options);
+        EXPECT_EQ(values.size(), builder.add(reinterpret_cast<const uint8_t*>(values.data()), values.size()));
+        OwnedSlice page = builder.finish()->build();
+        EXPECT_EQ(values.size(), builder.count());
+        if (!values.empty()) {
+            typename TypeTraits<Type>::CppType first;
+            typename TypeTraits<Type>::CppType last;
+            EXPECT_OK(builder.get_first_value(&first));
+            EXPECT_OK(builder.get_last_value(&last));
+            EXPECT_EQ(0, memcmp(&values.front(), &first, sizeof(first)));
+            EXPECT_EQ(0, memcmp(&values.back(), &last, sizeof(last)));
+        }
+        return page;
+    }
+
+    // Encode and decode the values, and check they are decoded to the same bits.
+    template <LogicalType Type>
+    uint8_t test_encode_decode(const std::vector<typename TypeTraits<Type>::CppType>& values) {
+        using CppType = typename TypeTraits<Type>::CppType;
+        OwnedSlice page = encode<Type>(values);
+        AlpPageDecoder<Type> decoder(page.slice());
+        EXPECT_OK(decoder.init());
+        EXPECT_EQ(values.size(), decoder.count());
+
+        // sequential read
+        auto column = FixedLengthColumn<CppType>::create();
+        size_t n = values.size();
+        EXPECT_OK(decoder.next_batch(&n, column.get()));
+        EXPECT_EQ(values.size(), n);
+        EXPECT_EQ(0, memcmp(values.data(), column->get_data().data(), values.size() * sizeof(CppType)));
+
+        // read by ranges crossing the vectors
+        if (values.size() > 3000) {
+            SparseRange<> range;
+            range.add(Range<>(5, 1030));
+            range.add(Range<>(2047, 2049));
+            range.add(Range<>(values.size() - 10, values.size()));
+            column = FixedLengthColumn<CppType>::create();
+            EXPECT_OK(decoder.seek_to_position_in_page(5));
+            EXPECT_OK(decoder.next_batch(range, column.get()));
+            EXPECT_EQ(range.span_size(), column->size());
+            EXPECT_EQ(values.size(), decoder.current_index());
+            size_t i = 0;
+            auto iter = range.new_iterator();
+            while (iter.has_more()) {
+                Range<> r = iter.next(values.size());
+                for (rowid_t row = r.begin(); row < r.end(); row++, i++) {
+                    EXPECT_EQ(0, memcmp(&values[row], &column->get_data()[i], sizeof(CppType))) << "row " << row;
+                }
+            }
+        }
+        // the mode of the page
+        return page.slice().data[sizeof(uint32_t)];
+    }
+};
+
+TEST_F(AlpPageTest, test_decimals) {
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int64_t> dist(-1000000, 1000000);
+    std::vector<double> values;
+    for (int i = 0; i < 10000; i++) {
+        values.push_back(dist(rng) / 100.0);
+    }
+    ASSERT_EQ(ALP_PAGE_ALP, test_encode_decode<TYPE_DOUBLE>(values));
+    // 21 bits for each value in a range of 2 * 10^6
+    OwnedSlice page = encode<TYPE_DOUBLE>(values);
+    ASSERT_LT(page.slice().size, values.size() * sizeof(double) / 2);
+
+    std::vector<float> floats;
+    for (int i = 0; i < 10000; i++) {
+        floats.push_back(dist(rng) / 100.0f);
+    }
+    ASSERT_EQ(ALP_PAGE_ALP, test_encode_decode<TYPE_FLOAT>(floats));
+}
+
+TEST_F(AlpPageTest, test_exceptions) {
+    std::vector<double> values;
+    for (int i = 0; i < 5000; i++) {
+        values.push_back(i * 0.5);
+    }
+    values[3] = std::numeric_limits<double>::quiet_NaN();
+    values[100] = std::numeric_limits<double>::infinity();
+    values[1024] = -std::numeric_limits<double>::infinity();
+    values[2000] = -0.0;
+    values[3000] = M_PI;
+    values[4999] = std::numeric_limits<double>::max();
+    ASSERT_EQ(ALP_PAGE_ALP, test_encode_decode<TYPE_DOUBLE>(values));
+}
+
+TEST_F(AlpPageTest, test_plain_fallback) {
+    // the values of the full precision can't be encoded by ALP.
+    std::mt19937_64 rng(42);
+    std::uniform_real_distribution<double> dist(0, 1);
+    std::vector<double> values;
+    for (int i = 0; i < 5000; i++) {
+        values.push_back(dist(rng));
+    }
+    ASSERT_EQ(ALP_PAGE_PLAIN, test_encode_decode<TYPE_DOUBLE>(values));
+}
+
+TEST_F(AlpPageTest, test_small_pages) {
+    test_encode_decode<TYPE_DOUBLE>({});
+    test_encode_decode<TYPE_DOUBLE>({1.5});
+    test_encode_decode<TYPE_DOUBLE>(std::vector<double>(3000, 7.25));
+    test_encode_decode<TYPE_FLOAT>({-1.5f, 2.25f, 0.0f});
+}
+
+TEST_F(AlpPageTest, test_corruption) {
+    std::vector<double> values;
+    for (int i = 0; i < 2000; i++) {
+        values.push_back(i * 0.1);
+    }
+    OwnedSlice page = encode<TYPE_DOUBLE>(values);
+    Slice truncated(page.slice().data, page.slice().size - 1);
+    AlpPageDecoder<TYPE_DOUBLE> decoder(truncated);
+    ASSERT_TRUE(decoder.init().is_corruption());
+}
+
+TEST_F(AlpPageTest, test_corrupted_exception_position) {
+    using Coding = AlpCoding<double>;
+    std::vector<double> values;
+    for (int i = 0; i < 2000; i++) {
+        values.push_back(i * 0.1);
+    }
+    values[3] = std::numeric_limits<double>::quiet_NaN();
+    OwnedSlice page = encode<TYPE_DOUBLE>(values);
+    ASSERT_EQ(ALP_PAGE_ALP, page.slice().data[sizeof(uint32_t)]);
+
+    // move the first exception of the first vector out of the vector
+    std::string data = page.slice().to_string();
+    auto* vector = reinterpret_cast<uint8_t*>(data.data()) + ALP_PAGE_HEADER_SIZE;
+    uint16_t num_exceptions;
+    memcpy(&num_exceptions, vector + 3, sizeof(uint16_t));
+    ASSERT_GE(num_exceptions, 1);
+    size_t bit_width = vector[2];
+    size_t positions = Coding::kVectorHeaderSize + BitUtil::Ceil(Coding::kVectorSize * bit_width, 8);
+    uint16_t pos = Coding::kVectorSize;
+    memcpy(vector + positions, &pos, sizeof(uint16_t));
+
+    AlpPageDecoder<TYPE_DOUBLE> decoder{Slice(data)};
+    ASSERT_OK(decoder.init());
+    auto column = DoubleColumn::create();
+    size_t n = values.size();
+    ASSERT_TRUE(decoder.next_batch(&n, column.get()).is_corruption());
+}
+
+} // namespace starrocks
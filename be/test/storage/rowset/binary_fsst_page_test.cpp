@@ -0,0 +1,238 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/rowset/binary_fsst_page.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "column/binary_column.h"
+#include "common/config.h"
+#include "storage/chunk_helper.h"
+#include "storage/column_predicate.h"
+#include "storage/rowset/binary_dict_page.h"
+#include "storage/rowset/binary_plain_page.h"
+#include "storage/rowset/storage_page_decoder.h"
+#include "storage/types.h"
+#include "testutil/assert.h"
+#include "util/defer_op.h"
+
+namespace starrocks {
+
+class BinaryFsstPageTest : public testing::Test {
+public:
+    static std::vector<std::string> generate_urls(size_t count) {
+        std::mt19937 rng(42);
+        const char* hosts[] = {"www.example.com", "api.starrocks.io", "docs.starrocks.io", "github.com"};
+        std::vector<std::string> urls;
+        for (size_t i = 0; i < count; i++) {
+            urls.emplace_back(std::string("https://") + hosts[rng() % 4] + "/path/to/page?id=" +
+                              std::to_string(rng() % 100000) + "&lang=en");
+        }
+        return urls;
+    }
+
+    static OwnedSlice encode(const std::vector<std::string>& values) {
+        std::vector<Slice> slices(values.begin(), values.end());
+        PageBuilderOptions options;
+        options.data_page_size = 1024 * 1024;
+        BinaryFsstPageBuilder builder(options);
+        EXPECT_EQ(slices.size(), builder.add(reinterpret_cast<const uint8_t*>(slices.data()), slices.size()));
+        OwnedSlice page = builder.finish()->build();
+        EXPECT_EQ(values.size(), builder.count());
+        if (!values.empty()) {
+            Slice first;
+            Slice last;
+            EXPECT_OK(builder.get_first_value(&first));
+            EXPECT_OK(builder.get_last_value(&last));
+            EXPECT_EQ(values.front(), first.to_string());
+            EXPECT_EQ(values.back(), last.to_string());
+        }
+        return page;
+    }
+
+    static void check_decode(const std::vector<std::string>& values, const OwnedSlice& page) {
+        BinaryFsstPageDecoder<TYPE_VARCHAR> decoder(page.slice());
+        ASSERT_OK(decoder.init());
+        ASSERT_EQ(values.size(), decoder.count());
+
+        auto column = ChunkHelper::column_from_field_type(TYPE_VARCHAR, false);
+        size_t n = values.size();
+        ASSERT_OK(decoder.next_batch(&n, column.get()));
+        ASSERT_EQ(values.size(), n);
+        for (size_t i = 0; i < values.size(); i++) {
+            ASSERT_EQ(values[i], column->get(i).get_slice().to_string());
+        }
+
+        if (values.size() > 100) {
+            SparseRange<> range;
+            range.add(Range<>(3, 10));
+            range.add(Range<>(50, 51));
+            range.add(Range<>(values.size() - 5, values.size()));
+            column = ChunkHelper::column_from_field_type(TYPE_VARCHAR, false);
+            ASSERT_OK(decoder.seek_to_position_in_page(3));
+            ASSERT_OK(decoder.next_batch(range, column.get()));
+            ASSERT_EQ(range.span_size(), column->size());
+            ASSERT_EQ(values.size(), decoder.current_index());
+            size_t i = 0;
+            for (size_t k = 0; k < range.size(); k++) {
+                for (rowid_t row = range[k].begin(); row < range[k].end(); row++, i++) {
+                    ASSERT_EQ(values[row], column->get(i).get_slice().to_string());
+                }
+            }
+        }
+    }
+};
+
+TEST_F(BinaryFsstPageTest, test_encode_decode) {
+    auto values = generate_urls(5000);
+    values.emplace_back("");
+    values.emplace_back(std::string("\xff\x00\x01", 3));
+    OwnedSlice page = encode(values);
+    size_t raw_size = 0;
+    for (const auto& v : values) {
+        raw_size += v.size();
+    }
+    ASSERT_LT(page.slice().size, raw_size / 2);
+    check_decode(values, page);
+
+    check_decode({}, encode({}));
+    check_decode({"a"}, encode({"a"}));
+}
+
+TEST_F(BinaryFsstPageTest, test_incompressible) {
+    std::mt19937 rng(42);
+    std::vector<std::string> values;
+    for (int i = 0; i < 1000; i++) {
+        std::string s(16, '\0');
+        for (auto& c : s) {
+            c = static_cast<char>(rng());
+        }
+        values.emplace_back(std::move(s));
+    }
+    OwnedSlice page = encode(values);
+    BinaryFsstPageDecoder<TYPE_VARCHAR> decoder(page.slice());
+    ASSERT_OK(decoder.init());
+    // the strings are stored as they are
+    ASSERT_EQ(0u, decoder.symbol_table().num_symbols());
+    check_decode(values, page);
+}
+
+TEST_F(BinaryFsstPageTest, test_char) {
+    std::vector<std::string> values;
+    for (int i = 0; i < 200; i++) {
+        std::string s = "value_" + std::to_string(i);
+        s.resize(16, '\0');
+        values.emplace_back(std::move(s));
+    }
+    OwnedSlice page = encode(values);
+    BinaryFsstPageDecoder<TYPE_CHAR> decoder(page.slice());
+    ASSERT_OK(decoder.init());
+    auto column = ChunkHelper::column_from_field_type(TYPE_CHAR, false);
+    size_t n = values.size();
+    ASSERT_OK(decoder.next_batch(&n, column.get()));
+    ASSERT_EQ("value_0", column->get(0).get_slice().to_string());
+    ASSERT_EQ("value_199", column->get(199).get_slice().to_string());
+}
+
+TEST_F(BinaryFsstPageTest, test_compressed_predicates) {
+    auto values = generate_urls(2000);
+    values[10] = "https://github.com/StarRocks/starrocks";
+    values[20] = "https://github.com/StarRocks/starrocks";
+    values[30] = "https://github.com/StarRocks/starrocks/pulls";
+    OwnedSlice page = encode(values);
+    BinaryFsstPageDecoder<TYPE_VARCHAR> decoder(page.slice());
+    ASSERT_OK(decoder.init());
+    std::vector<Slice> codes;
+    for (uint32_t i = 0; i < decoder.count(); i++) {
+        codes.emplace_back(decoder.codes_at(i));
+    }
+    const FsstSymbolTable& table = decoder.symbol_table();
+    ASSERT_GT(table.num_symbols(), 0u);
+
+    // equality on the codes
+    std::unique_ptr<ColumnPredicate> eq(
+            new_column_eq_predicate(get_type_info(TYPE_VARCHAR), 0, "https://github.com/StarRocks/starrocks"));
+    ASSERT_TRUE(eq->support_fsst_filter());
+    std::vector<uint8_t> selection(codes.size(), 1);
+    ASSERT_OK(eq->fsst_filter(table, codes.data(), codes.size(), selection.data()));
+    for (size_t i = 0; i < values.size(); i++) {
+        ASSERT_EQ(values[i] == "https://github.com/StarRocks/starrocks", selection[i] != 0) << i;
+    }
+
+    // prefix on the codes
+    for (const std::string prefix : {"", "h", "https://github.com/", "https://github.com/StarRocks/starrocks/p",
+                                     "https://www.example.com/path/to/page?id=1", "ftp://"}) {
+        for (size_t i = 0; i < values.size(); i++) {
+            ASSERT_EQ(Slice(values[i]).starts_with(prefix), table.starts_with(codes[i], prefix))
+                    << values[i] << " " << prefix;
+        }
+    }
+}
+
+TEST_F(BinaryFsstPageTest, test_dict_page_fallback) {
+    bool old_value = config::enable_fsst_string_encoding;
+    config::enable_fsst_string_encoding = true;
+    DeferOp defer([&]() { config::enable_fsst_string_encoding = old_value; });
+
+    auto values = generate_urls(1000);
+    std::vector<Slice> slices(values.begin(), values.end());
+    PageBuilderOptions options;
+    options.data_page_size = 1024 * 1024;
+    // the dictionary is full after a few strings, so that the next page falls back to FSST.
+    options.dict_page_size = 256;
+    BinaryDictPageBuilder builder(options);
+    size_t added = builder.add(reinterpret_cast<const uint8_t*>(slices.data()), slices.size());
+    ASSERT_LT(added, slices.size());
+    builder.finish();
+    ASSERT_FALSE(builder.is_compressed());
+    builder.reset();
+    ASSERT_FALSE(builder.all_dict_encoded());
+    size_t count = slices.size() - added;
+    ASSERT_EQ(count, builder.add(reinterpret_cast<const uint8_t*>(slices.data() + added), count));
+    OwnedSlice page = builder.finish()->build();
+    // The FSST page is not compressed by the compression codec of the column again.
+    ASSERT_TRUE(builder.is_compressed());
+
+    Slice encoded_data = page.slice();
+    PageFooterPB footer;
+    footer.set_type(DATA_PAGE);
+    footer.mutable_data_page_footer()->set_nullmap_size(0);
+    std::unique_ptr<char[]> decoded_page;
+    ASSERT_OK(StoragePageDecoder::decode_page(&footer, 0, DICT_ENCODING, &decoded_page, &encoded_data));
+
+    BinaryDictPageDecoder<TYPE_VARCHAR> decoder(encoded_data);
+    ASSERT_OK(decoder.init());
+    ASSERT_EQ(FSST_ENCODING, decoder.encoding_type());
+    auto column = ChunkHelper::column_from_field_type(TYPE_VARCHAR, false);
+    size_t n = count;
+    ASSERT_OK(decoder.next_batch(&n, column.get()));
+    ASSERT_EQ(count, n);
+    for (size_t i = 0; i < count; i++) {
+        ASSERT_EQ(values[added + i], column->get(i).get_slice().to_string());
+    }
+}
+
+TEST_F(BinaryFsstPageTest, test_corruption) {
+    OwnedSlice page = encode(generate_urls(100));
+    Slice truncated(page.slice().data, page.slice().size - 1);
+    BinaryFsstPageDecoder<TYPE_VARCHAR> decoder(truncated);
+    ASSERT_TRUE(decoder.init().is_corruption());
+}
+
+} // namespace starrocks
@@ -44,6 +44,7 @@
 #include "storage/olap_common.h"
 #include "storage/rowset/bitmap_index_reader.h"
 #include "storage/rowset/bitmap_index_writer.h"
+#include "storage/roaring2range.h"
 #include "storage/types.h"
 #include "testutil/assert.h"
 
@@ -295,4 +296,69 @@ TEST_F(BitmapIndexTest, test_concurrent_load) {
     delete[] val;
 }
 
+TEST_F(BitmapIndexTest, test_read_union_bitmap_of_ranges) {
+    size_t num_rows = 1024 * 10;
+    int* val = new int[num_rows];
+    for (int i = 0; i < num_rows; ++i) {
+        val[i] = i % 100;
+    }
+
+    std::string file_name = kTestDir + "/union_ranges";
+    ColumnIndexMetaPB meta;
+    write_index_file<TYPE_INT>(file_name, val, num_rows, 0, &meta);
+
+    BitmapIndexReader* reader = nullptr;
+    BitmapIndexIterator* iter = nullptr;
+    ASSIGN_OR_ABORT(auto rfile, _fs->new_random_access_file(file_name));
+    get_bitmap_reader_iter(rfile.get(), meta, &reader, &iter);
+
+    // the values in [10, 20) and [50, 55), plus the rows already in the result
+    Roaring bitmap = Roaring::bitmapOf(2, 0, 10001);
+    ASSERT_OK(iter->read_union_bitmap(SparseRange<>{Range<>(10, 20), Range<>(50, 55)}, &bitmap));
+    Roaring expected = Roaring::bitmapOf(2, 0, 10001);
+    for (int i = 0; i < num_rows; ++i) {
+        if ((val[i] >= 10 && val[i] < 20) || (val[i] >= 50 && val[i] < 55)) {
+            expected.add(i);
+        }
+    }
+    ASSERT_TRUE(expected == bitmap);
+
+    delete reader;
+    delete iter;
+    delete[] val;
+}
+
+TEST_F(BitmapIndexTest, test_roaring_and_or_many) {
+    std::vector<Roaring> bitmaps(5);
+    for (uint32_t i = 0; i < 100000; i++) {
+        for (uint32_t k = 0; k < bitmaps.size(); k++) {
+            if (i % (k + 2) == 0) {
+                bitmaps[k].add(i);
+            }
+        }
+    }
+    Roaring expected_and = bitmaps[0];
+    Roaring expected_or = bitmaps[0];
+    for (size_t k = 1; k < bitmaps.size(); k++) {
+        expected_and &= bitmaps[k];
+        expected_or |= bitmaps[k];
+    }
+
+    auto copy = bitmaps;
+    ASSERT_TRUE(expected_and == roaring_and_many(copy));
+    copy = bitmaps;
+    ASSERT_TRUE(expected_or == roaring_or_many(copy));
+
+    // the intersection with an empty bitmap is empty
+    copy = bitmaps;
+    copy.emplace_back();
+    ASSERT_TRUE(roaring_and_many(copy).isEmpty());
+
+    std::vector<Roaring> empty;
+    ASSERT_TRUE(roaring_and_many(empty).isEmpty());
+    ASSERT_TRUE(roaring_or_many(empty).isEmpty());
+    std::vector<Roaring> single{bitmaps[3]};
+    ASSERT_TRUE(bitmaps[3] == roaring_or_many(single));
+}
+
 } // namespace starrocks
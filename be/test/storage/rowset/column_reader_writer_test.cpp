@@ -556,6 +556,25 @@ TEST_F(ColumnReaderWriterTest, test_double) {
     test_numeric_types<TYPE_DOUBLE>();
 }
 
+// NOLINTNEXTLINE
+TEST_F(ColumnReaderWriterTest, test_double_alp) {
+    auto col = numeric_data<TYPE_DOUBLE>(10000);
+    test_nullable_data<TYPE_DOUBLE, ALP_ENCODING, 2>(*col, "0", "10000");
+    test_nullable_data<TYPE_DOUBLE, ALP_ENCODING, 2>(*col, "1", "10000");
+}
+
+// NOLINTNEXTLINE
+TEST_F(ColumnReaderWriterTest, test_delta_binary_packed) {
+    auto col = numeric_data<TYPE_BIGINT>(10000);
+    test_nullable_data<TYPE_BIGINT, DELTA_BINARY_PACKED, 2>(*col, "0", "10000");
+    test_nullable_data<TYPE_BIGINT, DELTA_BINARY_PACKED, 2>(*col, "1", "10000");
+
+    auto date_col = date_values(100);
+    test_nullable_data<TYPE_DATE, DELTA_BINARY_PACKED, 2>(*date_col, "0", "100");
+    auto datetime_col = datetime_values(100);
+    test_nullable_data<TYPE_DATETIME, DELTA_BINARY_PACKED, 2>(*datetime_col, "1", "100");
+}
+
 // NOLINTNEXTLINE
 TEST_F(ColumnReaderWriterTest, test_date) {
     auto col = date_values(100);
@@ -0,0 +1,247 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/rowset/delta_binary_packed_page.h"
+
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "column/fixed_length_column.h"
+#include "testutil/assert.h"
+
+namespace starrocks {
+
+class DeltaBinaryPackedPageTest : public testing::Test {
+public:
+    template <LogicalType Type>
+    OwnedSlice encode(const std::vector<typename TypeTraits<Type>::CppType>& values) {
+        PageBuilderOptions options;
+        options.data_page_size = 256 * 1024;
+        DeltaBinaryPackedPageBuilder<Type> builder(options);
+        EXPECT_EQ(values.size(), builder.add(reinterpret_cast<const uint8_t*>(values.data()), values.size()));
+        OwnedSlice page = builder.finish()->build();
+        EXPECT_EQ(values.size(), builder.count());
+        if (!values.empty()) {
+            typename TypeTraits<Type>::CppType first;
+            typename TypeTraits<Type>::CppType last;
+            EXPECT_OK(builder.get_first_value(&first));
+            EXPECT_OK(builder.get_last_value(&last));
+            EXPECT_EQ(values.front(), first);
+            EXPECT_EQ(values.back(), last);
+        }
+        return page;
+    }
+
+    // Encode and decode the values, and check they are decoded to the same values.
+    template <LogicalType Type>
+    void test_encode_decode(const std::vector<typename TypeTraits<Type>::CppType>& values) {
+        using CppType = typename TypeTraits<Type>::CppType;
+        OwnedSlice page = encode<Type>(values);
+        DeltaBinaryPackedPageDecoder<Type> decoder(page.slice());
+        ASSERT_OK(decoder.init());
+        ASSERT_EQ(values.size(), decoder.count());
+        ASSERT_EQ(std::is_sorted(values.begin(), values.end()), decoder.is_non_decreasing());
+        for (uint32_t i = 0; i < decoder.num_miniblocks(); i++) {
+            ASSERT_EQ(values[i * 128], decoder.anchor(i));
+        }
+        if (!values.empty()) {
+            ASSERT_EQ(values.back(), decoder.last_value());
+        }
+
+        // sequential read by small batches
+        auto column = FixedLengthColumn<CppType>::create();
+        while (decoder.current_index() < values.size()) {
+            size_t n = 100;
+            ASSERT_OK(decoder.next_batch(&n, column.get()));
+        }
+        ASSERT_EQ(values.size(), column->size());
+        ASSERT_EQ(0, memcmp(values.data(), column->get_data().data(), values.size() * sizeof(CppType)));
+
+        // read by ranges crossing the miniblocks
+        if (values.size() > 1000) {
+            SparseRange<> range;
+            range.add(Range<>(5, 300));
+            range.add(Range<>(383, 385));
+            range.add(Range<>(512, 640));
+            range.add(Range<>(values.size() - 10, values.size()));
+            column = FixedLengthColumn<CppType>::create();
+            ASSERT_OK(decoder.seek_to_position_in_page(5));
+            ASSERT_OK(decoder.next_batch(range, column.get()));
+            ASSERT_EQ(range.span_size(), column->size());
+            ASSERT_EQ(values.size(), decoder.current_index());
+            size_t i = 0;
+            auto iter = range.new_iterator();
+            while (iter.has_more()) {
+                Range<> r = iter.next(values.size());
+                for (rowid_t row = r.begin(); row < r.end(); row++, i++) {
+                    ASSERT_EQ(values[row], column->get_data()[i]) << "row " << row;
+                }
+            }
+        }
+
+        // random seek
+        std::mt19937 rng(42);
+        for (int k = 0; k < 20 && !values.empty(); k++) {
+            uint32_t pos = rng() % values.size();
+            ASSERT_OK(decoder.seek_to_position_in_page(pos));
+            column = FixedLengthColumn<CppType>::create();
+            size_t n = 1;
+            ASSERT_OK(decoder.next_batch(&n, column.get()));
+            ASSERT_EQ(1u, n);
+            ASSERT_EQ(values[pos], column->get_data()[0]) << "pos " << pos;
+        }
+    }
+};
+
+TEST_F(DeltaBinaryPackedPageTest, test_monotonic) {
+    std::mt19937 rng(42);
+    std::vector<int64_t> bigints;
+    int64_t ts = 1700000000000;
+    for (int i = 0; i < 10000; i++) {
+        ts += rng() % 1000;
+        bigints.push_back(ts);
+    }
+    test_encode_decode<TYPE_BIGINT>(bigints);
+    // less than 10 bits for each delta in the range of 1000
+    OwnedSlice page = encode<TYPE_BIGINT>(bigints);
+    ASSERT_LT(page.slice().size, bigints.size() * sizeof(int64_t) / 5);
+
+    std::vector<int32_t> ints;
+    for (int i = 0; i < 10000; i++) {
+        ints.push_back(i * 3);
+    }
+    test_encode_decode<TYPE_INT>(ints);
+    // the constant deltas need no bits at all
+    page = encode<TYPE_INT>(ints);
+    ASSERT_LT(page.slice().size, 2000u);
+}
+
+TEST_F(DeltaBinaryPackedPageTest, test_random) {
+    std::mt19937_64 rng(42);
+    std::vector<int64_t> bigints;
+    std::vector<int32_t> ints;
+    std::vector<int16_t> smallints;
+    std::vector<int8_t> tinyints;
+    for (int i = 0; i < 5000; i++) {
+        bigints.push_back(static_cast<int64_t>(rng()));
+        ints.push_back(static_cast<int32_t>(rng()));
+        smallints.push_back(static_cast<int16_t>(rng()));
+        tinyints.push_back(static_cast<int8_t>(rng()));
+    }
+    test_encode_decode<TYPE_BIGINT>(bigints);
+    test_encode_decode<TYPE_INT>(ints);
+    test_encode_decode<TYPE_SMALLINT>(smallints);
+    test_encode_decode<TYPE_TINYINT>(tinyints);
+}
+
+TEST_F(DeltaBinaryPackedPageTest, test_extremes) {
+    std::vector<int64_t> values;
+    for (int i = 0; i < 2000; i++) {
+        switch (i % 4) {
+        case 0:
+            values.push_back(std::numeric_limits<int64_t>::min());
+            break;
+        case 1:
+            values.push_back(std::numeric_limits<int64_t>::max());
+            break;
+        case 2:
+            values.push_back(0);
+            break;
+        default:
+            values.push_back(-1);
+        }
+    }
+    test_encode_decode<TYPE_BIGINT>(values);
+    test_encode_decode<TYPE_BIGINT>(std::vector<int64_t>(1000, std::numeric_limits<int64_t>::max()));
+}
+
+TEST_F(DeltaBinaryPackedPageTest, test_date_and_datetime) {
+    std::vector<int32_t> dates;
+    for (int i = 0; i < 3000; i++) {
+        dates.push_back(2460000 + i / 7);
+    }
+    test_encode_decode<TYPE_DATE>(dates);
+
+    std::vector<int64_t> datetimes;
+    for (int i = 0; i < 3000; i++) {
+        datetimes.push_back(211845000000000000L + i * 1000000L);
+    }
+    test_encode_decode<TYPE_DATETIME>(datetimes);
+}
+
+TEST_F(DeltaBinaryPackedPageTest, test_small_pages) {
+    test_encode_decode<TYPE_INT>({});
+    test_encode_decode<TYPE_INT>({7});
+    test_encode_decode<TYPE_INT>({3, 1, 2});
+    std::vector<int32_t> values;
+    for (int i = 0; i < 129; i++) {
+        values.push_back(i);
+    }
+    test_encode_decode<TYPE_INT>(values);
+}
+
+TEST_F(DeltaBinaryPackedPageTest, test_seek_at_or_after_value) {
+    // 0, 0, 2, 2, 4, 4, ... with the duplicates crossing the miniblock boundaries
+    std::vector<int32_t> values;
+    for (int i = 0; i < 1001; i++) {
+        values.push_back(i / 2 * 2);
+    }
+    OwnedSlice page = encode<TYPE_INT>(values);
+    DeltaBinaryPackedPageDecoder<TYPE_INT> decoder(page.slice());
+    ASSERT_OK(decoder.init());
+    ASSERT_TRUE(decoder.is_non_decreasing());
+
+    for (int32_t target = -1; target <= 1001; target++) {
+        bool exact_match = false;
+        Status st = decoder.seek_at_or_after_value(&target, &exact_match);
+        if (target > values.back()) {
+            ASSERT_TRUE(st.is_not_found()) << target;
+            continue;
+        }
+        ASSERT_OK(st);
+        uint32_t expected = std::lower_bound(values.begin(), values.end(), target) - values.begin();
+        ASSERT_EQ(expected, decoder.current_index()) << target;
+        ASSERT_EQ(values[expected] == target, exact_match) << target;
+    }
+
+    // the pages not in order can't be searched
+    OwnedSlice unordered = encode<TYPE_INT>({3, 1, 2});
+    DeltaBinaryPackedPageDecoder<TYPE_INT> decoder2(unordered.slice());
+    ASSERT_OK(decoder2.init());
+    ASSERT_FALSE(decoder2.is_non_decreasing());
+    int32_t target = 1;
+    bool exact_match = false;
+    ASSERT_TRUE(decoder2.seek_at_or_after_value(&target, &exact_match).is_not_supported());
+}
+
+TEST_F(DeltaBinaryPackedPageTest, test_corruption) {
+    std::mt19937_64 rng(42);
+    std::vector<int64_t> values;
+    for (int i = 0; i < 2000; i++) {
+        values.push_back(static_cast<int64_t>(rng() % 100000));
+    }
+    OwnedSlice page = encode<TYPE_BIGINT>(values);
+    Slice truncated(page.slice().data, page.slice().size - 1);
+    DeltaBinaryPackedPageDecoder<TYPE_BIGINT> decoder(truncated);
+    ASSERT_TRUE(decoder.init().is_corruption());
+
+    Slice header_only(page.slice().data, DELTA_PAGE_HEADER_SIZE - 1);
+    DeltaBinaryPackedPageDecoder<TYPE_BIGINT> decoder2(header_only);
+    ASSERT_TRUE(decoder2.init().is_corruption());
+}
+
+} // namespace starrocks
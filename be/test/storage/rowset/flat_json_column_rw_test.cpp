@@ -24,6 +24,7 @@
 #include "gen_cpp/PlanNodes_types.h"
 #include "gutil/casts.h"
 #include "storage/chunk_helper.h"
+#include "storage/column_predicate.h"
 #include "storage/rowset/column_iterator.h"
 #include "storage/rowset/column_reader.h"
 #include "storage/rowset/column_writer.h"
@@ -33,6 +34,7 @@
 #include "storage/types.h"
 #include "testutil/assert.h"
 #include "types/logical_type.h"
+#include "util/defer_op.h"
 #include "util/json.h"
 #include "util/json_flattener.h"
 
@@ -56,44 +58,46 @@ protected:
         return std::make_shared<Segment>(fs, FileInfo{fname}, 1, _dummy_segment_schema, nullptr);
     }
 
+    void write_json(const std::shared_ptr<FileSystem>& fs, const std::string& fname, const ColumnPtr& write_col,
+                    ColumnMetaPB* meta, bool write_zone_map = false) {
+        TabletColumn json_tablet_column = create_with_default_value<TYPE_JSON>("");
+        ASSIGN_OR_ABORT(auto wfile, fs->new_writable_file(fname));
+
+        ColumnWriterOptions writer_opts;
+        writer_opts.meta = meta;
+        writer_opts.meta->set_column_id(0);
+        writer_opts.meta->set_unique_id(0);
+        writer_opts.meta->set_type(TYPE_JSON);
+        writer_opts.meta->set_length(0);
+        writer_opts.meta->set_encoding(DEFAULT_ENCODING);
+        writer_opts.meta->set_compression(starrocks::LZ4_FRAME);
+        writer_opts.meta->set_is_nullable(write_col->is_nullable());
+        writer_opts.need_zone_map = false;
+
+        ASSIGN_OR_ABORT(auto writer, ColumnWriter::create(writer_opts, &json_tablet_column, wfile.get()));
+        ASSERT_OK(writer->init());
+
+        ASSERT_TRUE(writer->append(*write_col).ok());
+
+        ASSERT_TRUE(writer->finish().ok());
+        ASSERT_TRUE(writer->write_data().ok());
+        ASSERT_TRUE(writer->write_ordinal_index().ok());
+        if (write_zone_map) {
+            ASSERT_TRUE(writer->write_zone_map().ok());
+        }
+
+        // close the file
+        ASSERT_TRUE(wfile->close().ok());
+    }
+
     void test_json(const std::string& case_file, ColumnPtr& write_col, ColumnPtr& read_col, ColumnAccessPath* path) {
         auto fs = std::make_shared<MemoryFileSystem>();
         ASSERT_TRUE(fs->create_dir(TEST_DIR).ok());
 
-        TabletColumn json_tablet_column = create_with_default_value<TYPE_JSON>("");
-        TypeInfoPtr type_info = get_type_info(json_tablet_column);
         ColumnMetaPB meta;
-
         const std::string fname = TEST_DIR + case_file;
         auto segment = create_dummy_segment(fs, fname);
-
-        // write data
-        {
-            ASSIGN_OR_ABORT(auto wfile, fs->new_writable_file(fname));
-
-            ColumnWriterOptions writer_opts;
-            writer_opts.meta = &meta;
-            writer_opts.meta->set_column_id(0);
-            writer_opts.meta->set_unique_id(0);
-            writer_opts.meta->set_type(TYPE_JSON);
-            writer_opts.meta->set_length(0);
-            writer_opts.meta->set_encoding(DEFAULT_ENCODING);
-            writer_opts.meta->set_compression(starrocks::LZ4_FRAME);
-            writer_opts.meta->set_is_nullable(write_col->is_nullable());
-            writer_opts.need_zone_map = false;
-
-            ASSIGN_OR_ABORT(auto writer, ColumnWriter::create(writer_opts, &json_tablet_column, wfile.get()));
-            ASSERT_OK(writer->init());
-
-            ASSERT_TRUE(writer->append(*write_col).ok());
-
-            ASSERT_TRUE(writer->finish().ok());
-            ASSERT_TRUE(writer->write_data().ok());
-            ASSERT_TRUE(writer->write_ordinal_index().ok());
-
-            // close the file
-            ASSERT_TRUE(wfile->close().ok());
-        }
+        write_json(fs, fname, write_col, &meta);
         LOG(INFO) << "Finish writing";
 
         auto res = ColumnReader::create(&meta, segment.get(), nullptr);
@@ -161,6 +165,95 @@ TEST_F(FlatJsonColumnRWTest, testNormalFlatJson) {
     EXPECT_EQ("3", read_json->get_flat_field("a")->debug_item(2));
 }
 
+TEST_F(FlatJsonColumnRWTest, testFlatJsonZoneMap) {
+    config::json_flat_internal_column_min_limit = 1;
+    bool old_enable_subfield_zonemap = config::enable_subfield_zonemap;
+    DeferOp defer([&]() { config::enable_subfield_zonemap = old_enable_subfield_zonemap; });
+
+    ColumnPtr write_col = JsonColumn::create();
+    auto* json_col = down_cast<JsonColumn*>(write_col.get());
+    for (int i = 1; i <= 5; i++) {
+        std::string json = "{\"a\": " + std::to_string(i) + ", \"b\": " + std::to_string(20 + i) + "}";
+        ASSIGN_OR_ABORT(auto jv, JsonValue::parse(json));
+        json_col->append(&jv);
+    }
+
+    auto fs = std::make_shared<MemoryFileSystem>();
+    ASSERT_OK(fs->create_dir(TEST_DIR));
+    const std::string fname = TEST_DIR + "/test_flat_json_zone_map.data";
+    auto segment = create_dummy_segment(fs, fname);
+
+    // the flattened sub-columns have no zone map if the subfield zone map is disabled
+    {
+        config::enable_subfield_zonemap = false;
+        ColumnMetaPB meta;
+        write_json(fs, fname, write_col, &meta, true);
+        ASSIGN_OR_ABORT(auto reader, ColumnReader::create(&meta, segment.get(), nullptr));
+        ASSERT_NE(nullptr, reader->subfield_reader({"a"}));
+        ASSERT_FALSE(reader->subfield_reader({"a"})->has_zone_map());
+    }
+
+    config::enable_subfield_zonemap = true;
+    ColumnMetaPB meta;
+    write_json(fs, fname, write_col, &meta, true);
+    ASSIGN_OR_ABORT(auto reader, ColumnReader::create(&meta, segment.get(), nullptr));
+    ColumnReader* a_reader = reader->subfield_reader({"a"});
+    ASSERT_NE(nullptr, a_reader);
+    ASSERT_TRUE(a_reader->has_zone_map());
+
+    ASSIGN_OR_ABORT(auto root_path, ColumnAccessPath::create(TAccessPathType::FIELD, "root", 0));
+    ASSIGN_OR_ABORT(auto f1_path, ColumnAccessPath::create(TAccessPathType::FIELD, "a", 0));
+    ASSIGN_OR_ABORT(auto f2_path, ColumnAccessPath::create(TAccessPathType::FIELD, "b", 0));
+    root_path->children().emplace_back(std::move(f1_path));
+    root_path->children().emplace_back(std::move(f2_path));
+    ASSIGN_OR_ABORT(auto iter, reader->new_iterator(root_path.get()));
+    ASSIGN_OR_ABORT(auto read_file, fs->new_random_access_file(fname));
+    ColumnIteratorOptions iter_opts;
+    OlapReaderStatistics stats;
+    iter_opts.stats = &stats;
+    iter_opts.read_file = read_file.get();
+    ASSERT_OK(iter->init(iter_opts));
+
+    // the predicates on the sub-columns, of the types of the sub-columns
+    auto subfield_pred = [&](const std::string& name, PredicateType type, const char* operand) {
+        ColumnReader* sub_reader = reader->subfield_reader({name});
+        auto type_info = get_type_info(sub_reader != nullptr ? sub_reader->column_type() : TYPE_BIGINT);
+        std::unique_ptr<ColumnPredicate> pred(new_column_cmp_predicate(type, type_info, 0, operand));
+        pred->set_subfield_path({name});
+        return pred;
+    };
+    // a <= 3 hits the page
+    {
+        auto le = subfield_pred("a", PredicateType::kLE, "3");
+        SparseRange<> row_ranges;
+        ASSERT_OK(iter->get_row_ranges_by_zone_map({le.get()}, nullptr, &row_ranges, CompoundNodeType::AND));
+        ASSERT_EQ(SparseRange<>(0, 5), row_ranges);
+    }
+    // a > 100 misses the page, and so does `a >= 2 AND b > 100`
+    {
+        auto gt = subfield_pred("a", PredicateType::kGT, "100");
+        SparseRange<> row_ranges;
+        ASSERT_OK(iter->get_row_ranges_by_zone_map({gt.get()}, nullptr, &row_ranges, CompoundNodeType::AND));
+        ASSERT_TRUE(row_ranges.empty());
+
+        auto ge = subfield_pred("a", PredicateType::kGE, "2");
+        auto b_gt = subfield_pred("b", PredicateType::kGT, "100");
+        row_ranges.clear();
+        ASSERT_OK(iter->get_row_ranges_by_zone_map({ge.get(), b_gt.get()}, nullptr, &row_ranges,
+                                                   CompoundNodeType::AND));
+        ASSERT_TRUE(row_ranges.empty());
+    }
+    // the predicate on a path which is not flattened keeps all the rows of OR
+    {
+        auto gt = subfield_pred("a", PredicateType::kGT, "100");
+        auto c_gt = subfield_pred("c", PredicateType::kGT, "100");
+        SparseRange<> row_ranges;
+        ASSERT_OK(iter->get_row_ranges_by_zone_map({gt.get(), c_gt.get()}, nullptr, &row_ranges,
+                                                   CompoundNodeType::OR));
+        ASSERT_EQ(SparseRange<>(0, 5), row_ranges);
+    }
+}
+
 TEST_F(FlatJsonColumnRWTest, testNullFlatJson) {
     config::json_flat_internal_column_min_limit = 1;
 
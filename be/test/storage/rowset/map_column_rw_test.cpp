@@ -22,8 +22,10 @@
 #include "column/fixed_length_column.h"
 #include "column/map_column.h"
 #include "column/nullable_column.h"
+#include "common/config.h"
 #include "common/statusor.h"
 #include "fs/fs_memory.h"
+#include "storage/column_predicate.h"
 #include "storage/rowset/column_iterator.h"
 #include "storage/rowset/column_reader.h"
 #include "storage/rowset/column_writer.h"
@@ -31,6 +33,7 @@
 #include "storage/rowset/segment.h"
 #include "storage/tablet_schema_helper.h"
 #include "testutil/assert.h"
+#include "util/defer_op.h"
 
 namespace starrocks {
 
@@ -255,6 +258,138 @@ protected:
         }
     }
 
+    void test_keys_zone_map() {
+        bool old_enable_subfield_zonemap = config::enable_subfield_zonemap;
+        config::enable_subfield_zonemap = true;
+        DeferOp defer([&]() { config::enable_subfield_zonemap = old_enable_subfield_zonemap; });
+        auto fs = std::make_shared<MemoryFileSystem>();
+        ASSERT_TRUE(fs->create_dir(TEST_DIR).ok());
+
+        TabletColumn map_column = create_map(0, true);
+        TabletColumn key_column = create_int_value(1, STORAGE_AGGREGATE_NONE, true);
+        map_column.add_sub_column(key_column);
+        TabletColumn value_column = create_int_value(2, STORAGE_AGGREGATE_NONE, true);
+        map_column.add_sub_column(value_column);
+
+        // page 0: rows 0-9 {i:i}
+        // page 1: row 10 {}, rows 11-20 {100+i:i}
+        // page 2: rows 21-30 {200+i:i}
+        auto make_maps = [](int key_base, bool with_empty_map) {
+            auto offsets = UInt32Column::create();
+            auto keys = NullableColumn::create(Int32Column::create(), NullColumn::create());
+            auto values = NullableColumn::create(Int32Column::create(), NullColumn::create());
+            offsets->append(0);
+            if (with_empty_map) {
+                offsets->append(0);
+            }
+            for (int i = 0; i < 10; i++) {
+                keys->append_datum(key_base + i);
+                values->append_datum(i);
+                offsets->append(i + 1);
+            }
+            return MapColumn::create(keys, values, offsets);
+        };
+
+        ColumnMetaPB meta;
+        const std::string fname = TEST_DIR + "/test_map_keys_zone_map.data";
+        auto segment = create_dummy_segment(fs, fname);
+        {
+            ASSIGN_OR_ABORT(auto wfile, fs->new_writable_file(fname));
+
+            ColumnWriterOptions writer_opts;
+            writer_opts.meta = &meta;
+            writer_opts.meta->set_column_id(0);
+            writer_opts.meta->set_unique_id(0);
+            writer_opts.meta->set_type(TYPE_MAP);
+            writer_opts.meta->set_length(0);
+            writer_opts.meta->set_encoding(DEFAULT_ENCODING);
+            writer_opts.meta->set_compression(starrocks::LZ4_FRAME);
+            writer_opts.meta->set_is_nullable(false);
+            writer_opts.need_zone_map = true;
+
+            for (const auto& sub_column : {key_column, value_column}) {
+                ColumnMetaPB* sub_meta = writer_opts.meta->add_children_columns();
+                sub_meta->set_column_id(0);
+                sub_meta->set_unique_id(0);
+                sub_meta->set_type(sub_column.type());
+                sub_meta->set_length(sub_column.length());
+                sub_meta->set_encoding(DEFAULT_ENCODING);
+                sub_meta->set_compression(LZ4_FRAME);
+                sub_meta->set_is_nullable(false);
+            }
+
+            ASSIGN_OR_ABORT(auto writer, ColumnWriter::create(writer_opts, &map_column, wfile.get()));
+            ASSERT_OK(writer->init());
+            ASSERT_OK(writer->append(*make_maps(0, false)));
+            ASSERT_OK(writer->finish_current_page());
+            ASSERT_OK(writer->append(*make_maps(100, true)));
+            ASSERT_OK(writer->finish_current_page());
+            ASSERT_OK(writer->append(*make_maps(200, false)));
+            ASSERT_OK(writer->finish());
+            ASSERT_OK(writer->write_data());
+            ASSERT_OK(writer->write_ordinal_index());
+            ASSERT_OK(writer->write_zone_map());
+            ASSERT_OK(wfile->close());
+        }
+
+        ASSIGN_OR_ABORT(auto reader, ColumnReader::create(&meta, segment.get(), nullptr));
+        ASSERT_TRUE(reader->subfield_reader({kMapKeysSubfield})->has_zone_map());
+        ASSERT_EQ(nullptr, reader->subfield_reader({"values"}));
+
+        ASSIGN_OR_ABORT(auto iter, reader->new_iterator());
+        ASSIGN_OR_ABORT(auto read_file, fs->new_random_access_file(fname));
+        ColumnIteratorOptions iter_opts;
+        OlapReaderStatistics stats;
+        iter_opts.stats = &stats;
+        iter_opts.read_file = read_file.get();
+        ASSERT_OK(iter->init(iter_opts));
+
+        auto type_info = get_type_info(TYPE_INT);
+        auto key_pred = [&](PredicateType type, const char* operand) {
+            std::unique_ptr<ColumnPredicate> pred(new_column_cmp_predicate(type, type_info, 0, operand));
+            pred->set_subfield_path({kMapKeysSubfield});
+            return pred;
+        };
+
+        // m[105] is not NULL, which is rewritten to `key <= 105 AND key >= 105`
+        {
+            auto le = key_pred(PredicateType::kLE, "105");
+            auto ge = key_pred(PredicateType::kGE, "105");
+            SparseRange<> row_ranges;
+            ASSERT_OK(iter->get_row_ranges_by_zone_map({le.get(), ge.get()}, nullptr, &row_ranges,
+                                                       CompoundNodeType::AND));
+            ASSERT_EQ(SparseRange<>(11, 21), row_ranges);
+        }
+        // the keys of page 0 and page 1 are hit, the empty map between them is kept
+        {
+            auto le = key_pred(PredicateType::kLE, "105");
+            auto ge = key_pred(PredicateType::kGE, "5");
+            SparseRange<> row_ranges;
+            ASSERT_OK(iter->get_row_ranges_by_zone_map({le.get(), ge.get()}, nullptr, &row_ranges,
+                                                       CompoundNodeType::AND));
+            ASSERT_EQ(SparseRange<>(0, 21), row_ranges);
+        }
+        // the keys less than 5 or greater than 205
+        {
+            auto lt = key_pred(PredicateType::kLT, "5");
+            auto gt = key_pred(PredicateType::kGT, "205");
+            SparseRange<> row_ranges;
+            ASSERT_OK(iter->get_row_ranges_by_zone_map({lt.get(), gt.get()}, nullptr, &row_ranges,
+                                                       CompoundNodeType::OR));
+            SparseRange<> expected(0, 10);
+            expected.add({21, 31});
+            ASSERT_EQ(expected, row_ranges);
+        }
+        // no key satisfies the predicate
+        {
+            auto gt = key_pred(PredicateType::kGT, "1000");
+            SparseRange<> row_ranges;
+            ASSERT_OK(iter->get_row_ranges_by_zone_map({gt.get()}, nullptr, &row_ranges, CompoundNodeType::AND));
+            ASSERT_TRUE(row_ranges.empty());
+            ASSERT_FALSE(reader->subfield_reader({kMapKeysSubfield})->segment_zone_map_filter({gt.get()}));
+        }
+    }
+
 private:
     std::shared_ptr<TabletSchema> _dummy_segment_schema;
 };
@@ -264,4 +399,8 @@ TEST_F(MapColumnRWTest, test_map_int) {
     test_int_map();
 }
 
+TEST_F(MapColumnRWTest, test_map_keys_zone_map) {
+    test_keys_zone_map();
+}
+
 } // namespace starrocks
@@ -50,11 +50,13 @@
 #include "storage/olap_common.h"
 #include "storage/rowset/column_iterator.h"
 #include "storage/rowset/column_reader.h"
+#include "storage/rowset/rowid_range_option.h"
 #include "storage/rowset/segment_options.h"
 #include "storage/rowset/segment_writer.h"
 #include "storage/tablet_schema.h"
 #include "storage/tablet_schema_helper.h"
 #include "testutil/assert.h"
+#include "util/defer_op.h"
 
 namespace starrocks {
 
@@ -561,4 +563,136 @@ TEST_F(SegmentReaderWriterTest, TestTypeConversion) {
         EXPECT_EQ(10, read_chunk->get(0)[1].get_int64());
     }
 }
+TEST_F(SegmentReaderWriterTest, TestDeltaAnchorsFilter) {
+    bool old_value = config::enable_delta_binary_packed_sort_key_encoding;
+    config::enable_delta_binary_packed_sort_key_encoding = true;
+    DeferOp defer([&]() { config::enable_delta_binary_packed_sort_key_encoding = old_value; });
+
+    // The sort key c0 is i and c1 is i + 1, so every miniblock of 128 rows of c0 is within its anchor and the next.
+    auto tablet_schema = std::shared_ptr<TabletSchema>{
+            TabletSchemaHelper::create_tablet_schema({create_int_key_pb(0, false), create_int_value_pb(1)})};
+    const int32_t num_rows = 40000;
+    std::shared_ptr<Segment> segment;
+    build_segment(SegmentWriterOptions{}, tablet_schema, tablet_schema, num_rows,
+                  [](size_t rid, int cid, int block_id) { return Datum(static_cast<int32_t>(rid + cid)); }, &segment);
+
+    auto read_schema = ChunkHelper::convert_schema(tablet_schema);
+    auto type_info = get_type_info(LogicalType::TYPE_INT);
+    auto scan = [&](std::vector<ColumnPredicate*> predicates, OlapReaderStatistics* stats) {
+        std::vector<std::unique_ptr<ColumnPredicate>> guards;
+        auto pred_root = PredicateAndNode{};
+        for (auto* predicate : predicates) {
+            guards.emplace_back(predicate);
+            pred_root.add_child(PredicateColumnNode{predicate});
+        }
+        auto seg_options = SegmentReadOptions{};
+        seg_options.fs = _fs;
+        seg_options.stats = stats;
+        seg_options.tablet_schema = tablet_schema;
+        seg_options.pred_tree = PredicateTree::create(std::move(pred_root));
+        seg_options.pred_tree_for_zone_map = seg_options.pred_tree;
+        ASSIGN_OR_ABORT(auto seg_iter, segment->new_iterator(read_schema, seg_options));
+        std::vector<int32_t> values;
+        auto read_chunk = ChunkHelper::new_chunk(read_schema, config::vector_chunk_size);
+        while (true) {
+            read_chunk->reset();
+            auto st = seg_iter->get_next(read_chunk.get());
+            if (st.is_end_of_file()) {
+                break;
+            }
+            CHECK_OK(st);
+            for (size_t i = 0; i < read_chunk->num_rows(); ++i) {
+                values.emplace_back(read_chunk->get(i)[0].get_int32());
+                CHECK_EQ(values.back() + 1, read_chunk->get(i)[1].get_int32());
+            }
+        }
+        return values;
+    };
+
+    // The pages start at multiples of 128 rows, so the miniblocks read for [begin, end) are from the one containing
+    // begin to the one containing end - 1, whichever pages they are in.
+    for (auto [begin, end] : std::vector<std::pair<int32_t, int32_t>>{{1000, 3000}, {16000, 17000}}) {
+        OlapReaderStatistics stats;
+        auto values = scan({new_column_ge_predicate(type_info, 0, std::to_string(begin)),
+                            new_column_lt_predicate(type_info, 0, std::to_string(end))},
+                           &stats);
+        ASSERT_EQ(end - begin, static_cast<int32_t>(values.size()));
+        for (int32_t i = 0; i < static_cast<int32_t>(values.size()); i++) {
+            ASSERT_EQ(begin + i, values[i]);
+        }
+        ASSERT_EQ((end + 127) / 128 * 128 - begin / 128 * 128, stats.raw_rows_read);
+        ASSERT_EQ(num_rows - stats.raw_rows_read, stats.rows_stats_filtered + stats.rows_delta_anchor_filtered);
+        ASSERT_GT(stats.rows_delta_anchor_filtered, 0);
+    }
+    // Only the miniblock [19968, 20096) is read for the equality predicate.
+    {
+        OlapReaderStatistics stats;
+        auto values = scan({new_column_eq_predicate(type_info, 0, "20000")}, &stats);
+        ASSERT_EQ(std::vector<int32_t>{20000}, values);
+        ASSERT_EQ(128, stats.raw_rows_read);
+        ASSERT_GT(stats.rows_delta_anchor_filtered, 0);
+    }
+}
+
+TEST_F(SegmentReaderWriterTest, TestSplitRowidRange) {
+    auto tablet_schema = std::shared_ptr<TabletSchema>{
+            TabletSchemaHelper::create_tablet_schema({create_int_key_pb(0, false), create_int_value_pb(1)})};
+    const int32_t num_rows = 40000;
+    std::shared_ptr<Segment> segment;
+    build_segment(SegmentWriterOptions{}, tablet_schema, tablet_schema, num_rows,
+                  [](size_t rid, int cid, int block_id) { return Datum(static_cast<int32_t>(rid)); }, &segment);
+
+    auto read_schema = ChunkHelper::convert_schema(tablet_schema);
+    auto read_chunk = ChunkHelper::new_chunk(read_schema, config::vector_chunk_size);
+    auto read_next = [&](ChunkIterator* seg_iter, std::vector<int32_t>* values) {
+        read_chunk->reset();
+        auto st = seg_iter->get_next(read_chunk.get());
+        if (st.is_end_of_file()) {
+            return false;
+        }
+        CHECK_OK(st);
+        for (size_t i = 0; i < read_chunk->num_rows(); ++i) {
+            values->emplace_back(read_chunk->get(i)[0].get_int32());
+        }
+        return true;
+    };
+
+    RowsetId rowset_id;
+    rowset_id.init(10);
+    auto rowid_range = std::make_shared<SplittableRowidRange>(rowset_id, 0, 0, num_rows, nullptr);
+    OlapReaderStatistics stats;
+    auto seg_options = SegmentReadOptions{};
+    seg_options.fs = _fs;
+    seg_options.stats = &stats;
+    seg_options.tablet_schema = tablet_schema;
+    seg_options.splittable_rowid_range = rowid_range;
+    ASSIGN_OR_ABORT(auto seg_iter, segment->new_iterator(read_schema, seg_options));
+
+    // The rows of the first chunk are claimed by the scanner, and the tail half of the rest is split off.
+    std::vector<int32_t> values;
+    ASSERT_TRUE(read_next(seg_iter.get(), &values));
+    const auto begin = static_cast<uint32_t>(values.size());
+    ASSERT_EQ(num_rows - begin, rowid_range->num_pending_rows());
+    SparseRange<> split_range;
+    ASSERT_TRUE(rowid_range->split(1000, &split_range));
+    const uint32_t mid = begin + (num_rows - begin) / 2;
+    ASSERT_EQ(SparseRange<>(mid, num_rows), split_range);
+    ASSERT_FALSE(rowid_range->split(num_rows, &split_range));
+
+    while (read_next(seg_iter.get(), &values)) {
+    }
+    ASSERT_EQ(mid, values.size());
+    ASSERT_EQ(0u, rowid_range->num_pending_rows());
+
+    // The split rows are read by another scanner.
+    seg_options.splittable_rowid_range = nullptr;
+    seg_options.rowid_range_option = std::make_shared<SparseRange<>>(split_range);
+    ASSIGN_OR_ABORT(seg_iter, segment->new_iterator(read_schema, seg_options));
+    while (read_next(seg_iter.get(), &values)) {
+    }
+    ASSERT_EQ(num_rows, static_cast<int32_t>(values.size()));
+    for (int32_t i = 0; i < num_rows; i++) {
+        ASSERT_EQ(i, values[i]);
+    }
+}
 } // namespace starrocks
@@ -23,8 +23,10 @@
 #include "column/map_column.h"
 #include "column/nullable_column.h"
 #include "column/struct_column.h"
+#include "common/config.h"
 #include "fs/fs_memory.h"
 #include "storage/chunk_helper.h"
+#include "storage/column_predicate.h"
 #include "storage/rowset/column_iterator.h"
 #include "storage/rowset/column_reader.h"
 #include "storage/rowset/column_writer.h"
@@ -32,6 +34,7 @@
 #include "storage/rowset/segment.h"
 #include "storage/tablet_schema_helper.h"
 #include "testutil/assert.h"
+#include "util/defer_op.h"
 
 namespace starrocks {
 
@@ -323,6 +326,129 @@ protected:
         }
     }
 
+    void test_subfield_zone_map() {
+        bool old_enable_subfield_zonemap = config::enable_subfield_zonemap;
+        config::enable_subfield_zonemap = true;
+        DeferOp defer([&]() { config::enable_subfield_zonemap = old_enable_subfield_zonemap; });
+        auto fs = std::make_shared<MemoryFileSystem>();
+        ASSERT_TRUE(fs->create_dir(TEST_DIR).ok());
+
+        TabletColumn struct_column = create_struct(0, true);
+        std::vector<std::string> names{"f1", "f2"};
+        TabletColumn f1_tablet_column = create_int_value(1, STORAGE_AGGREGATE_NONE, true);
+        f1_tablet_column.set_name("f1");
+        struct_column.add_sub_column(f1_tablet_column);
+        TabletColumn f2_tablet_column = create_varchar_key(2, true);
+        f2_tablet_column.set_name("f2");
+        struct_column.add_sub_column(f2_tablet_column);
+
+        // page 0: {f1: 0-9, f2: 'a'}, page 1: {f1: 100-109, f2: 'b'}, page 2: {f1: 200-209, f2: 'c'}
+        auto make_structs = [&](int page) {
+            auto f1_column = Int32Column::create();
+            auto f2_column = BinaryColumn::create();
+            for (int i = 0; i < 10; i++) {
+                f1_column->append(page * 100 + i);
+                f2_column->append_string(std::string(1, 'a' + page));
+            }
+            Columns columns;
+            columns.emplace_back(std::move(f1_column));
+            columns.emplace_back(std::move(f2_column));
+            return StructColumn::create(columns, names);
+        };
+
+        ColumnMetaPB meta;
+        const std::string fname = TEST_DIR + "/test_struct_subfield_zone_map.data";
+        auto segment = create_dummy_segment(fs, fname);
+        {
+            ASSIGN_OR_ABORT(auto wfile, fs->new_writable_file(fname));
+
+            ColumnWriterOptions writer_opts;
+            writer_opts.meta = &meta;
+            writer_opts.meta->set_column_id(0);
+            writer_opts.meta->set_unique_id(0);
+            writer_opts.meta->set_type(TYPE_STRUCT);
+            writer_opts.meta->set_length(0);
+            writer_opts.meta->set_encoding(DEFAULT_ENCODING);
+            writer_opts.meta->set_compression(starrocks::LZ4_FRAME);
+            writer_opts.meta->set_is_nullable(false);
+            writer_opts.need_zone_map = true;
+
+            for (const auto& field : {f1_tablet_column, f2_tablet_column}) {
+                ColumnMetaPB* field_meta = writer_opts.meta->add_children_columns();
+                field_meta->set_column_id(0);
+                field_meta->set_unique_id(field.unique_id());
+                field_meta->set_type(field.type());
+                field_meta->set_length(field.length());
+                field_meta->set_encoding(DEFAULT_ENCODING);
+                field_meta->set_compression(LZ4_FRAME);
+                field_meta->set_is_nullable(false);
+            }
+
+            ASSIGN_OR_ABORT(auto writer, ColumnWriter::create(writer_opts, &struct_column, wfile.get()));
+            ASSERT_OK(writer->init());
+            for (int page = 0; page < 3; page++) {
+                ASSERT_OK(writer->append(*make_structs(page)));
+                ASSERT_OK(writer->finish_current_page());
+            }
+            ASSERT_OK(writer->finish());
+            ASSERT_OK(writer->write_data());
+            ASSERT_OK(writer->write_ordinal_index());
+            ASSERT_OK(writer->write_zone_map());
+            ASSERT_OK(wfile->close());
+        }
+
+        ASSIGN_OR_ABORT(auto reader, ColumnReader::create(&meta, segment.get(), &struct_column));
+        ASSERT_TRUE(reader->subfield_reader({"f1"})->has_zone_map());
+        ASSERT_TRUE(reader->subfield_reader({"f2"})->has_zone_map());
+        ASSERT_EQ(nullptr, reader->subfield_reader({"f3"}));
+        ASSERT_EQ(nullptr, reader->subfield_reader({"f1", "f2"}));
+
+        ASSIGN_OR_ABORT(auto iter, reader->new_iterator(nullptr, &struct_column));
+        ASSIGN_OR_ABORT(auto read_file, fs->new_random_access_file(fname));
+        ColumnIteratorOptions iter_opts;
+        OlapReaderStatistics stats;
+        iter_opts.stats = &stats;
+        iter_opts.read_file = read_file.get();
+        ASSERT_OK(iter->init(iter_opts));
+
+        auto subfield_pred = [](ColumnPredicate* pred, const std::string& name) {
+            pred->set_subfield_path({name});
+            return std::unique_ptr<ColumnPredicate>(pred);
+        };
+        auto f1_ge = subfield_pred(new_column_ge_predicate(get_type_info(TYPE_INT), 0, "150"), "f1");
+        auto f2_lt = subfield_pred(new_column_lt_predicate(get_type_info(TYPE_VARCHAR), 0, "c"), "f2");
+        auto f3_eq = subfield_pred(new_column_eq_predicate(get_type_info(TYPE_INT), 0, "1"), "f3");
+
+        {
+            SparseRange<> row_ranges;
+            ASSERT_OK(iter->get_row_ranges_by_zone_map({f1_ge.get()}, nullptr, &row_ranges, CompoundNodeType::AND));
+            ASSERT_EQ(SparseRange<>(10, 30), row_ranges);
+        }
+        {
+            SparseRange<> row_ranges;
+            ASSERT_OK(iter->get_row_ranges_by_zone_map({f1_ge.get(), f2_lt.get()}, nullptr, &row_ranges,
+                                                       CompoundNodeType::AND));
+            ASSERT_EQ(SparseRange<>(10, 20), row_ranges);
+        }
+        {
+            SparseRange<> row_ranges;
+            ASSERT_OK(iter->get_row_ranges_by_zone_map({f1_ge.get(), f2_lt.get()}, nullptr, &row_ranges,
+                                                       CompoundNodeType::OR));
+            ASSERT_EQ(SparseRange<>(0, 30), row_ranges);
+        }
+        // the predicate on the missing field keeps all the rows
+        {
+            SparseRange<> row_ranges;
+            ASSERT_OK(iter->get_row_ranges_by_zone_map({f1_ge.get(), f3_eq.get()}, nullptr, &row_ranges,
+                                                       CompoundNodeType::AND));
+            ASSERT_EQ(SparseRange<>(10, 30), row_ranges);
+        }
+
+        std::unique_ptr<ColumnPredicate> f1_gt(new_column_gt_predicate(get_type_info(TYPE_INT), 0, "1000"));
+        ASSERT_FALSE(reader->subfield_reader({"f1"})->segment_zone_map_filter({f1_gt.get()}));
+        ASSERT_TRUE(reader->subfield_reader({"f1"})->segment_zone_map_filter({f1_ge.get()}));
+    }
+
 private:
     std::shared_ptr<TabletSchema> _dummy_segment_schema;
 };
@@ -332,4 +458,8 @@ TEST_F(StructColumnRWTest, test_struct_int) {
     test_int_struct();
 }
 
+TEST_F(StructColumnRWTest, test_struct_subfield_zone_map) {
+    test_subfield_zone_map();
+}
+
 } // namespace starrocks
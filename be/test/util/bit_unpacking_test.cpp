@@ -0,0 +1,126 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "util/bit_unpacking.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "util/bit_stream_utils.inline.h"
+
+namespace starrocks {
+
+class BitUnpackingTest : public testing::Test {
+public:
+    static std::vector<uint64_t> random_values(int bit_width, size_t count) {
+        std::mt19937_64 rng(bit_width);
+        std::vector<uint64_t> values(count);
+        for (auto& v : values) {
+            v = bit_width == 0 ? 0 : rng() >> (64 - bit_width);
+        }
+        return values;
+    }
+
+    // Pack the values with the least significant bit first, as BitWriter does.
+    static std::vector<uint8_t> pack_lsb(const std::vector<uint64_t>& values, int bit_width) {
+        faststring buffer;
+        BitWriter writer(&buffer);
+        for (uint64_t v : values) {
+            writer.PutValue(v, bit_width);
+        }
+        writer.Flush();
+        return {buffer.data(), buffer.data() + buffer.size()};
+    }
+
+    // Pack the values with the most significant bit first, as ForEncoder does.
+    static std::vector<uint8_t> pack_msb(const std::vector<uint64_t>& values, int bit_width) {
+        std::vector<uint8_t> buffer((values.size() * bit_width + 7) / 8, 0);
+        size_t bit = 0;
+        for (uint64_t v : values) {
+            for (int k = bit_width - 1; k >= 0; k--, bit++) {
+                buffer[bit / 8] |= ((v >> k) & 1) << (7 - bit % 8);
+            }
+        }
+        return buffer;
+    }
+
+    template <typename T>
+    static void check_unpack(bool msb, int bit_width, size_t count) {
+        auto values = random_values(bit_width, count);
+        std::vector<uint8_t> packed = msb ? pack_msb(values, bit_width) : pack_lsb(values, bit_width);
+        size_t in_bytes = (count * bit_width + 7) / 8;
+        // Copy the input into a buffer of the exact size, so that the sanitizers catch the reads after it.
+        std::unique_ptr<uint8_t[]> in(new uint8_t[in_bytes]);
+        memcpy(in.get(), packed.data(), in_bytes);
+
+        std::vector<T> out(count);
+        if (msb) {
+            BitUnpacking::unpack_msb(in.get(), in_bytes, bit_width, count, out.data());
+        } else {
+            BitUnpacking::unpack_lsb(in.get(), in_bytes, bit_width, count, out.data());
+        }
+        for (size_t i = 0; i < count; i++) {
+            ASSERT_EQ(values[i], out[i]) << "msb: " << msb << ", bit_width: " << bit_width << ", count: " << count
+                                         << ", index: " << i;
+        }
+    }
+};
+
+TEST_F(BitUnpackingTest, test_all_bit_widths) {
+    for (bool msb : {false, true}) {
+        for (size_t count : {1, 7, 8, 15, 16, 17, 33, 128, 255, 300, 1025}) {
+            for (int bit_width = 0; bit_width <= 64; bit_width++) {
+                check_unpack<uint64_t>(msb, bit_width, count);
+                if (bit_width <= 32) {
+                    check_unpack<uint32_t>(msb, bit_width, count);
+                }
+            }
+        }
+    }
+}
+
+TEST_F(BitUnpackingTest, test_other_types) {
+    auto values = random_values(11, 100);
+    std::vector<uint8_t> packed = pack_lsb(values, 11);
+    std::vector<int16_t> out(values.size());
+    BitUnpacking::unpack_lsb(packed.data(), packed.size(), 11, values.size(), out.data());
+    for (size_t i = 0; i < values.size(); i++) {
+        ASSERT_EQ(values[i], static_cast<uint64_t>(out[i]));
+    }
+
+    std::vector<int64_t> out64(values.size());
+    BitUnpacking::unpack_lsb(packed.data(), packed.size(), 11, values.size(), out64.data());
+    for (size_t i = 0; i < values.size(); i++) {
+        ASSERT_EQ(values[i], static_cast<uint64_t>(out64[i]));
+    }
+}
+
+TEST_F(BitUnpackingTest, test_bit_reader_get_batch) {
+    auto values = random_values(13, 1000);
+    std::vector<uint8_t> packed = pack_lsb(values, 13);
+    BitReader reader(packed.data(), packed.size());
+    std::vector<uint32_t> out(values.size());
+    // starts in the middle of a byte
+    ASSERT_TRUE(reader.GetValue(13, &out[0]));
+    ASSERT_EQ(500, reader.GetBatch(13, out.data() + 1, 500));
+    ASSERT_EQ(499, reader.GetBatch(13, out.data() + 501, 1000));
+    for (size_t i = 0; i < values.size(); i++) {
+        ASSERT_EQ(values[i], out[i]);
+    }
+}
+
+} // namespace starrocks
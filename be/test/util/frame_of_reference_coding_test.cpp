@@ -19,6 +19,8 @@
 
 #include <gtest/gtest.h>
 
+#include <random>
+
 namespace starrocks {
 class TestForCoding : public testing::Test {
 public:
@@ -243,4 +245,44 @@ TEST_F(TestForCoding, TestValueSeek) {
     ASSERT_EQ(found, false);
 }
 
+TEST_F(TestForCoding, TestAllBitWidths) {
+    std::mt19937_64 rng(42);
+    for (int bit_width = 0; bit_width <= 63; bit_width++) {
+        faststring buffer(1);
+        ForEncoder<int64_t> encoder(&buffer);
+        std::vector<int64_t> data;
+        for (int64_t i = 0; i < 300; ++i) {
+            // not ascending, so that the frames are packed by the bit width of (max - min)
+            int64_t delta = bit_width == 0 ? 0 : static_cast<int64_t>(rng() >> (64 - bit_width));
+            data.push_back(i % 2 == 0 ? -1000 + delta : -1000);
+        }
+        encoder.put_batch(data.data(), data.size());
+        encoder.flush();
+
+        ForDecoder<int64_t> decoder(buffer.data(), buffer.length());
+        ASSERT_TRUE(decoder.init());
+        std::vector<int64_t> actual_result(data.size());
+        ASSERT_TRUE(decoder.get_batch(actual_result.data(), data.size()));
+        ASSERT_EQ(data, actual_result) << "bit_width: " << bit_width;
+
+        if (bit_width > 30) {
+            continue;
+        }
+        faststring buffer32(1);
+        ForEncoder<int32_t> encoder32(&buffer32);
+        std::vector<int32_t> data32;
+        for (int64_t v : data) {
+            data32.push_back(static_cast<int32_t>(v));
+        }
+        encoder32.put_batch(data32.data(), data32.size());
+        encoder32.flush();
+
+        ForDecoder<int32_t> decoder32(buffer32.data(), buffer32.length());
+        ASSERT_TRUE(decoder32.init());
+        std::vector<int32_t> actual_result32(data32.size());
+        ASSERT_TRUE(decoder32.get_batch(actual_result32.data(), data32.size()));
+        ASSERT_EQ(data32, actual_result32) << "bit_width: " << bit_width;
+    }
+}
+
 } // namespace starrocks
@@ -171,6 +171,27 @@ TEST_F(CacheTest, Erase) {
     ASSERT_EQ(1, _deleted_keys.size());
 }
 
+TEST_F(CacheTest, EraseIf) {
+    for (int i = 0; i < 100; i++) {
+        Insert(i, i + 1000, 1);
+    }
+    std::string result;
+    Cache::Handle* h = _cache->lookup(EncodeKey(&result, 10));
+
+    // erase the even keys, and the one in use is deleted after it's released.
+    ASSERT_EQ(50, _cache->erase_if([](const CacheKey& key) { return DecodeKey(key) % 2 == 0; }));
+    ASSERT_EQ(49, _deleted_keys.size());
+    for (int i = 0; i < 100; i++) {
+        ASSERT_EQ(i % 2 == 0 ? -1 : i + 1000, Lookup(i));
+    }
+    ASSERT_EQ(1010, DecodeValue(_cache->value(h)));
+    _cache->release(h);
+    ASSERT_EQ(50, _deleted_keys.size());
+    ASSERT_EQ(50, _cache->get_memory_usage());
+
+    ASSERT_EQ(0, _cache->erase_if([](const CacheKey& key) { return DecodeKey(key) % 2 == 0; }));
+}
+
 TEST_F(CacheTest, EntriesArePinned) {
     Insert(100, 101, 1);
     std::string result1;
@@ -272,6 +293,135 @@ TEST_F(CacheTest, Usage) {
     ASSERT_EQ(950, cache.get_usage());
 }
 
+static bool lookup_LRUCache(LRUCache& cache, const CacheKey& key) {
+    uint32_t hash = key.hash(key.data(), key.size(), 0);
+    Cache::Handle* handle = cache.lookup(key, hash);
+    cache.release(handle);
+    return handle != nullptr;
+}
+
+static void insert_LRUCache(LRUCache& cache, int key) {
+    std::string result;
+    CacheKey cache_key = EncodeKey(&result, key);
+    uint32_t hash = cache_key.hash(cache_key.data(), cache_key.size(), 0);
+    cache.release(cache.insert(cache_key, hash, EncodeValue(key), 1, [](const CacheKey&, void*) {}));
+}
+
+static bool lookup_LRUCache(LRUCache& cache, int key) {
+    std::string result;
+    return lookup_LRUCache(cache, EncodeKey(&result, key));
+}
+
+TEST_F(CacheTest, S3FIFOScanResistance) {
+    for (auto policy : {CacheEvictionPolicy::LRU, CacheEvictionPolicy::S3FIFO}) {
+        LRUCache cache;
+        cache.set_eviction_policy(policy);
+        cache.set_capacity(100);
+
+        // the working set is accessed again after insertion.
+        for (int i = 0; i < 50; i++) {
+            insert_LRUCache(cache, i);
+            ASSERT_TRUE(lookup_LRUCache(cache, i));
+        }
+        // a scan reads each key once.
+        for (int i = 1000; i < 2000; i++) {
+            insert_LRUCache(cache, i);
+        }
+        ASSERT_EQ(100u, cache.get_usage());
+
+        int num_hits = 0;
+        for (int i = 0; i < 50; i++) {
+            num_hits += lookup_LRUCache(cache, i);
+        }
+        if (policy == CacheEvictionPolicy::S3FIFO) {
+            ASSERT_EQ(50, num_hits);
+        } else {
+            ASSERT_EQ(0, num_hits);
+        }
+    }
+}
+
+TEST_F(CacheTest, S3FIFOGhostQueue) {
+    LRUCache cache;
+    cache.set_eviction_policy(CacheEvictionPolicy::S3FIFO);
+    cache.set_capacity(10);
+
+    for (int i = 0; i < 20; i++) {
+        insert_LRUCache(cache, i);
+    }
+    ASSERT_EQ(10u, cache.get_usage());
+    ASSERT_FALSE(lookup_LRUCache(cache, 0));
+    ASSERT_EQ(0u, cache.get_ghost_hit_count());
+
+    // key 0 is remembered by the ghost queue, so it's inserted into the main queue, and survives another scan.
+    insert_LRUCache(cache, 0);
+    ASSERT_EQ(1u, cache.get_ghost_hit_count());
+    for (int i = 100; i < 200; i++) {
+        insert_LRUCache(cache, i);
+    }
+    ASSERT_TRUE(lookup_LRUCache(cache, 0));
+    ASSERT_EQ(10u, cache.get_usage());
+
+    ASSERT_EQ(10, cache.prune());
+    ASSERT_EQ(0u, cache.get_usage());
+}
+
+TEST_F(CacheTest, S3FIFOEntriesArePinned) {
+    delete _cache;
+    CacheOptions options;
+    options.capacity = kCacheSize;
+    options.eviction_policy = CacheEvictionPolicy::S3FIFO;
+    _cache = new_cache(options);
+
+    Insert(100, 101, 1);
+    std::string result1;
+    Cache::Handle* h1 = _cache->lookup(EncodeKey(&result1, 100));
+    ASSERT_EQ(101, DecodeValue(_cache->value(h1)));
+
+    // the entries in use are never evicted.
+    for (int i = 0; i < kCacheSize * 2; i++) {
+        Insert(1000 + i, 2000 + i, 1);
+    }
+    Insert(100, 102, 1);
+    ASSERT_EQ(102, Lookup(100));
+    ASSERT_EQ(101, DecodeValue(_cache->value(h1)));
+    _cache->release(h1);
+
+    Erase(100);
+    ASSERT_EQ(-1, Lookup(100));
+    ASSERT_LE(_cache->get_memory_usage(), kCacheSize);
+}
+
+TEST_F(CacheTest, TinyLFUAdmission) {
+    LRUCache cache;
+    cache.set_tinylfu_admission(true);
+    cache.set_capacity(10);
+
+    for (int i = 0; i < 10; i++) {
+        insert_LRUCache(cache, i);
+        for (int j = 0; j < 3; j++) {
+            ASSERT_TRUE(lookup_LRUCache(cache, i));
+        }
+    }
+
+    // the new key looked up less frequently than the one to evict is rejected.
+    insert_LRUCache(cache, 100);
+    ASSERT_EQ(1u, cache.get_admission_reject_count());
+    ASSERT_EQ(10u, cache.get_usage());
+    for (int i = 0; i < 10; i++) {
+        ASSERT_TRUE(lookup_LRUCache(cache, i));
+    }
+
+    // it's admitted once it's looked up more frequently.
+    for (int i = 0; i < 10; i++) {
+        ASSERT_FALSE(lookup_LRUCache(cache, 100));
+    }
+    insert_LRUCache(cache, 100);
+    ASSERT_EQ(1u, cache.get_admission_reject_count());
+    ASSERT_TRUE(lookup_LRUCache(cache, 100));
+    ASSERT_EQ(10u, cache.get_usage());
+}
+
 TEST_F(CacheTest, HeavyEntries) {
     // Add a bunch of light and heavy entries and then count the combined
     // size of items still in the cache, which must be approximately the
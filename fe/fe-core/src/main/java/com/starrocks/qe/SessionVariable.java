@@ -712,6 +712,10 @@ public class SessionVariable implements Serializable, Writable, Cloneable {
     // negative value means force interleaving under the group size of abs(interleaving_group_size)
     public static final String INTERLEAVING_GROUP_SIZE = "interleaving_group_size";
 
+    // the distance in rows of the software prefetches issued ahead of the hash join and aggregation lookups,
+    // 0 disables the prefetches, negative value means each operator takes its own default
+    public static final String HASH_TABLE_PREFETCH_DISTANCE = "hash_table_prefetch_distance";
+
     public static final String CBO_PUSHDOWN_TOPN_LIMIT = "cbo_push_down_topn_limit";
 
     public static final String ENABLE_AGGREGATION_PIPELINE_SHARE_LIMIT = "enable_aggregation_pipeline_share_limit";
@@ -1149,9 +1153,11 @@ public class SessionVariable implements Serializable, Writable, Cloneable {
     @VarAttr(name = SPILL_REVOCABLE_MAX_BYTES)
     private long spillRevocableMaxBytes = 0;
     // the encoding level of spilled data, the meaning of values is similar to transmission_encode_level,
-    // see more details in the comment above transmissionEncodeLevel
+    // see more details in the comment above transmissionEncodeLevel. Besides, for spilled data only,
+    // 8 for dictionary encoding low cardinality strings,
+    // 16 for encoding the null flags as runs or a bitmap.
     @VarAttr(name = SPILL_ENCODE_LEVEL)
-    private int spillEncodeLevel = 7;
+    private int spillEncodeLevel = 31;
 
     @VarAttr(name = SPILL_ENABLE_DIRECT_IO)
     private boolean spillEnableDirectIO = false;
@@ -1487,6 +1493,9 @@ public class SessionVariable implements Serializable, Writable, Cloneable {
     @VariableMgr.VarAttr(name = INTERLEAVING_GROUP_SIZE)
     private int interleavingGroupSize = 10;
 
+    @VariableMgr.VarAttr(name = HASH_TABLE_PREFETCH_DISTANCE)
+    private int hashTablePrefetchDistance = -1;
+
     // support auto|row|column
     @VariableMgr.VarAttr(name = PARTIAL_UPDATE_MODE)
     private String partialUpdateMode = "auto";
@@ -4113,6 +4122,7 @@ public class SessionVariable implements Serializable, Writable, Cloneable {
         tResult.setGroup_concat_max_len(groupConcatMaxLen);
         tResult.setRpc_http_min_size(rpcHttpMinSize);
         tResult.setInterleaving_group_size(interleavingGroupSize);
+        tResult.setHash_table_prefetch_distance(hashTablePrefetchDistance);
 
         TCompressionType loadCompressionType =
                 CompressionUtils.findTCompressionByName(loadTransmissionCompressionType);
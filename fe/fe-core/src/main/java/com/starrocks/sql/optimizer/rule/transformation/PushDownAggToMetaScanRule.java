@@ -45,6 +45,8 @@ import java.util.Map;
 // For meta scan query: select max(a), min(a), dict_merge(a) from test_all_type [_META_]
 // we need to push max, min, dict_merge aggregate function info to meta scan node
 // we will generate new columns: max_a, min_a, dict_merge_a, make meta scan known what meta info to collect
+// ndv(a) and approx_count_distinct(a) are rewritten to hll_union_agg(ndv_a), which merges the HyperLogLog
+// sketches of a kept in the segments
 public class PushDownAggToMetaScanRule extends TransformationRule {
     public PushDownAggToMetaScanRule() {
         super(RuleType.TF_PUSH_DOWN_AGG_TO_META_SCAN,
@@ -70,7 +72,8 @@ public class PushDownAggToMetaScanRule extends TransformationRule {
             if (!aggFuncName.equalsIgnoreCase(FunctionSet.DICT_MERGE)
                     && !aggFuncName.equalsIgnoreCase(FunctionSet.MAX)
                     && !aggFuncName.equalsIgnoreCase(FunctionSet.MIN)
-                    && !aggFuncName.equalsIgnoreCase(FunctionSet.COUNT)) {
+                    && !aggFuncName.equalsIgnoreCase(FunctionSet.COUNT)
+                    && !isNdvAgg(aggCall)) {
                 return false;
             }
         }
@@ -108,13 +111,16 @@ public class PushDownAggToMetaScanRule extends TransformationRule {
                 // for count, just use the first output column as a placeholder, BE won't read this column.
                 usedColumn = metaScan.getOutputColumns().get(0);
             }
-            String metaColumnName = aggCall.getFnName() + "_" + usedColumn.getName();
+            String metaFieldName = isNdvAgg(aggCall) ? FunctionSet.NDV : aggCall.getFnName();
+            String metaColumnName = metaFieldName + "_" + usedColumn.getName();
 
             Type columnType = aggCall.getType();
             // DictMerge meta aggregate function is special, need change the column type from
             // VARCHAR to ARRAY_VARCHAR
             if (aggCall.getFnName().equals(FunctionSet.DICT_MERGE)) {
                 columnType = Type.ARRAY_VARCHAR;
+            } else if (isNdvAgg(aggCall)) {
+                columnType = Type.HLL;
             }
 
             ColumnRefOperator metaColumn;
@@ -149,6 +155,14 @@ public class PushDownAggToMetaScanRule extends TransformationRule {
                         new Type[] {Type.ARRAY_VARCHAR}, Function.CompareMode.IS_IDENTICAL);
             }
 
+            // rewrite ndv to merge the sketches of the segments
+            if (isNdvAgg(aggCall)) {
+                aggFunction = Expr.getBuiltinFunction(FunctionSet.HLL_UNION_AGG,
+                        new Type[] {Type.HLL}, Function.CompareMode.IS_IDENTICAL);
+                newAggFnName = FunctionSet.HLL_UNION_AGG;
+                newAggReturnType = Type.BIGINT;
+            }
+
             // rewrite count to sum
             if (aggCall.getFnName().equals(FunctionSet.COUNT)) {
                 aggFunction = Expr.getBuiltinFunction(FunctionSet.SUM,
@@ -169,4 +183,10 @@ public class PushDownAggToMetaScanRule extends TransformationRule {
         // all used columns from aggCalls are from newMetaScan, we can remove the old project directly.
         return Lists.newArrayList(OptExpression.create(newAggOperator, OptExpression.create(newMetaScan)));
     }
+
+    private static boolean isNdvAgg(CallOperator aggCall) {
+        String aggFuncName = aggCall.getFnName();
+        return !aggCall.isDistinct() && (aggFuncName.equalsIgnoreCase(FunctionSet.NDV) ||
+                aggFuncName.equalsIgnoreCase(FunctionSet.APPROX_COUNT_DISTINCT));
+    }
 }
\ No newline at end of file
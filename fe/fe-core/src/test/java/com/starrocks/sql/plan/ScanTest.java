@@ -453,6 +453,13 @@ public class ScanTest extends PlanTestBase {
                 "args nullable: true; result nullable: true]");
     }
 
+    @Test
+    public void testMetaScanWithNdv() throws Exception {
+        String sql = "select ndv(t1b), approx_count_distinct(t1c), max(t1c) from test_all_type[_META_]";
+        String plan = getFragmentPlan(sql);
+        assertContains(plan, "hll_union_agg(ndv_t1b)", "hll_union_agg(ndv_t1c)", "max(max_t1c)", "0:MetaScan");
+    }
+
     @Test
     public void testImplicitCast() throws Exception {
         String sql = "select count(distinct v1||v2) from t0";
@@ -319,6 +319,8 @@ struct TQueryOptions {
   140: optional string catalog;
 
   141: optional i32 datacache_evict_probability;
+
+  142: optional i32 hash_table_prefetch_distance;
 }
 
 